@@ -0,0 +1,164 @@
+// File:           AllocationCounter.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   The replaced operators are the plain, array and nothrow forms, along with their
+//                          over-aligned versions (the parsed vertex attribute streams are over-aligned, see
+//                          VertexAttributeStreams.h). Placement new is left alone. Each matching operator delete
+//                          must be replaced along with them since the memory now comes from malloc() [or, for the
+//                          over-aligned forms, from the platform's aligned allocation function].
+//
+//                          The counters are only ever incremented, so relaxed ordering is all that is needed.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "AllocationCounter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef _MSC_VER
+#include <malloc.h>  //_aligned_malloc
+#endif
+
+namespace {
+    std::atomic<uint64_t> allocationCount{ 0u };
+    std::atomic<uint64_t> allocatedBytes{ 0u };
+
+    inline void * countedAllocation(size_t bytes) noexcept {
+        allocationCount.fetch_add(1u, std::memory_order_relaxed);
+        allocatedBytes.fetch_add(static_cast<uint64_t>(bytes), std::memory_order_relaxed);
+        return malloc((bytes > 0u) ? bytes : 1u); //operator new must return a unique pointer even for 0 bytes
+    }
+
+    inline void * countedAlignedAllocation(size_t bytes, std::align_val_t alignment) noexcept {
+        allocationCount.fetch_add(1u, std::memory_order_relaxed);
+        allocatedBytes.fetch_add(static_cast<uint64_t>(bytes), std::memory_order_relaxed);
+        bytes = ((bytes > 0u) ? bytes : 1u);
+#ifdef _MSC_VER
+        return _aligned_malloc(bytes, static_cast<size_t>(alignment));
+#else
+        void * memory = nullptr;
+        const size_t alignmentBytes = std::max(static_cast<size_t>(alignment), sizeof(void *));
+        return ((posix_memalign(&memory, alignmentBytes, bytes) == 0) ? memory : nullptr);
+#endif
+    }
+
+    inline void alignedFree(void * memory) noexcept {
+#ifdef _MSC_VER
+        _aligned_free(memory);
+#else
+        free(memory);
+#endif
+    }
+} //namespace
+
+
+namespace AllocationCounter {
+
+    uint64_t getAllocationCount() noexcept {
+        return allocationCount.load(std::memory_order_relaxed);
+    }
+
+    uint64_t getAllocatedBytes() noexcept {
+        return allocatedBytes.load(std::memory_order_relaxed);
+    }
+
+} //namespace AllocationCounter
+
+
+void * operator new(size_t bytes) {
+    void * memory = countedAllocation(bytes);
+    if (memory == nullptr)
+        throw std::bad_alloc();
+    return memory;
+}
+
+void * operator new[](size_t bytes) {
+    void * memory = countedAllocation(bytes);
+    if (memory == nullptr)
+        throw std::bad_alloc();
+    return memory;
+}
+
+void * operator new(size_t bytes, const std::nothrow_t&) noexcept {
+    return countedAllocation(bytes);
+}
+
+void * operator new[](size_t bytes, const std::nothrow_t&) noexcept {
+    return countedAllocation(bytes);
+}
+
+void operator delete(void * memory) noexcept {
+    free(memory);
+}
+
+void operator delete[](void * memory) noexcept {
+    free(memory);
+}
+
+void operator delete(void * memory, size_t) noexcept {
+    free(memory);
+}
+
+void operator delete[](void * memory, size_t) noexcept {
+    free(memory);
+}
+
+void operator delete(void * memory, const std::nothrow_t&) noexcept {
+    free(memory);
+}
+
+void operator delete[](void * memory, const std::nothrow_t&) noexcept {
+    free(memory);
+}
+
+
+void * operator new(size_t bytes, std::align_val_t alignment) {
+    void * memory = countedAlignedAllocation(bytes, alignment);
+    if (memory == nullptr)
+        throw std::bad_alloc();
+    return memory;
+}
+
+void * operator new[](size_t bytes, std::align_val_t alignment) {
+    void * memory = countedAlignedAllocation(bytes, alignment);
+    if (memory == nullptr)
+        throw std::bad_alloc();
+    return memory;
+}
+
+void * operator new(size_t bytes, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return countedAlignedAllocation(bytes, alignment);
+}
+
+void * operator new[](size_t bytes, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return countedAlignedAllocation(bytes, alignment);
+}
+
+void operator delete(void * memory, std::align_val_t) noexcept {
+    alignedFree(memory);
+}
+
+void operator delete[](void * memory, std::align_val_t) noexcept {
+    alignedFree(memory);
+}
+
+void operator delete(void * memory, size_t, std::align_val_t) noexcept {
+    alignedFree(memory);
+}
+
+void operator delete[](void * memory, size_t, std::align_val_t) noexcept {
+    alignedFree(memory);
+}
+
+void operator delete(void * memory, std::align_val_t, const std::nothrow_t&) noexcept {
+    alignedFree(memory);
+}
+
+void operator delete[](void * memory, std::align_val_t, const std::nothrow_t&) noexcept {
+    alignedFree(memory);
+}
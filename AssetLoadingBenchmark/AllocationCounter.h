@@ -0,0 +1,34 @@
+// File:           AllocationCounter.h
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Counts every heap allocation this process makes through operator new. AllocationCounter.cpp
+//                 replaces the global operator new/delete functions with versions that forward to malloc()/free()
+//                 after bumping a pair of atomic counters, so the counts include allocations made on any thread
+//                 (such as the ones the parallel tokenizer makes).
+//
+//                 To find out how many allocations a piece of code makes, read the count before and after
+//                 running it and take the difference.
+//
+// Note:           Only allocations made through operator new are counted. Memory that is allocated by calling
+//                 malloc() directly or that is memory-mapped is not included. Nothing in the asset loading code
+//                 calls malloc() directly, so for the loaders this counts every container and string allocation.
+
+#pragma once
+
+#ifndef ALLOCATION_COUNTER_H_
+#define ALLOCATION_COUNTER_H_
+
+#include <cstdint>
+
+namespace AllocationCounter {
+
+    //The number of times operator new (in any of its forms) has been called since the process began
+    uint64_t getAllocationCount() noexcept;
+
+    //The total number of bytes requested through operator new since the process began
+    uint64_t getAllocatedBytes() noexcept;
+
+} //namespace AllocationCounter
+
+#endif //ALLOCATION_COUNTER_H_
@@ -0,0 +1,89 @@
+// File:           AsciiAssetLoadBenchmark.cpp
+//
+//  See header file for details.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "AsciiAssetLoadBenchmark.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "AsciiAsset.h"
+#include "BenchmarkClock.h"
+#include "ProcessMemoryStats.h"
+#include "LoggingMessageTargets.h"
+
+namespace {
+
+    //Touches every line of the asset the same way QuickObj's parse loop does. The returned checksum
+    //is printed so that the compiler is unable to optimize any of the work away.
+    size_t touchEveryLine(const AssetLoadingInternal::AsciiAsset& asset, AsciiAssetLoadMode mode) {
+        size_t checksum = 0u;
+        const int lineCount = asset.getNumberOfLines();
+        if (mode == AsciiAssetLoadMode::COPY) {
+            for (int i = 0; i < lineCount; i++) {
+                const std::string line = asset.getLine(i);
+                checksum += line.length() + static_cast<unsigned char>(line.front());
+            }
+        }
+        else {
+            for (int i = 0; i < lineCount; i++) {
+                const std::string_view line = asset.getLineView(i);
+                checksum += line.length() + static_cast<unsigned char>(line.front());
+            }
+        }
+        //QuickObj also asks how many lines are of each type
+        checksum += asset.getNumberOfLinesThatBeginWith('v');
+        checksum += asset.getNumberOfLinesThatBeginWith('f');
+        return checksum;
+    }
+
+} //namespace
+
+
+bool runAsciiAssetLoadBenchmark(const std::string& filepath, AsciiAssetLoadMode mode, int iterations) {
+    const bool useMapping = (mode == AsciiAssetLoadMode::MAPPED);
+    iterations = std::max(iterations, 1);
+
+    const size_t residentBeforeLoad = ProcessMemoryStats::currentResidentSetBytes();
+
+    double bestMilliseconds = std::numeric_limits<double>::max();
+    double totalMilliseconds = 0.0;
+    size_t checksum = 0u;
+    size_t textBytes = 0u;
+    size_t residentWhileLoaded = 0u;
+    bool wasMapped = false;
+
+    for (int i = 0; i < iterations; i++) {
+        BenchmarkClock clock;
+        AssetLoadingInternal::AsciiAsset asset(filepath, true, useMapping);
+        if (asset.getStoredTextLength() == 0u) {
+            fprintf(ERRLOG, "\nERROR! Unable to load the file \"%s\" for benchmarking!\n", filepath.c_str());
+            return false;
+        }
+        checksum += touchEveryLine(asset, mode);
+        const double elapsed = clock.elapsedMilliseconds();
+
+        bestMilliseconds = std::min(bestMilliseconds, elapsed);
+        totalMilliseconds += elapsed;
+        textBytes = asset.getStoredTextLength();
+        wasMapped = asset.isMemoryMapped();
+        residentWhileLoaded = ProcessMemoryStats::currentResidentSetBytes(); //Measured while 'asset' is still alive
+    }
+
+    const double megabytes = ProcessMemoryStats::toMegabytes(textBytes);
+    fprintf(MSGLOG, "\nAsciiAsset load benchmark  [%s]\n", (useMapping ? "MAPPED" : "COPY"));
+    fprintf(MSGLOG, "    File:                  %s  (%.2f MB)\n", filepath.c_str(), megabytes);
+    if (useMapping && !wasMapped) 
+        fprintf(MSGLOG, "    Note:                  Mapping was not possible for this file, the copying path was used\n");
+    fprintf(MSGLOG, "    Iterations:            %d\n", iterations);
+    fprintf(MSGLOG, "    Best load time:        %.3f ms  (%.1f MB/s)\n", bestMilliseconds, (megabytes / (bestMilliseconds / 1000.0)));
+    fprintf(MSGLOG, "    Average load time:     %.3f ms\n", (totalMilliseconds / iterations));
+    fprintf(MSGLOG, "    Resident while loaded: %+.2f MB  (relative to before the first load)\n",
+        (ProcessMemoryStats::toMegabytes(residentWhileLoaded) - ProcessMemoryStats::toMegabytes(residentBeforeLoad)));
+    fprintf(MSGLOG, "    Peak resident memory:  %.2f MB\n", ProcessMemoryStats::toMegabytes(ProcessMemoryStats::peakResidentSetBytes()));
+    fprintf(MSGLOG, "    [checksum %zu]\n", checksum);
+    return true;
+}
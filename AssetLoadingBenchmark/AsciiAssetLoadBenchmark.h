@@ -0,0 +1,32 @@
+// File:           AsciiAssetLoadBenchmark.h
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Compares the two ways AsciiAsset can acquire a file's text:
+//                      COPY      --  The original path. The file is read through an ifstream into a 
+//                                    std::string and each line is retrieved as a new std::string
+//                                    through 'getLine()'.
+//                      MAPPED    --  The file is memory-mapped and each line is retrieved as a 
+//                                    std::string_view through 'getLineView()'.
+//                 The timed workload is the same for both modes and mirrors what QuickObj does with 
+//                 the text: construct the asset, then touch every line once.
+//
+//                 Reported are the best and average time per load, the throughput of the best 
+//                 load, how much resident memory the final loaded asset accounts for, and the
+//                 process's peak resident memory. Because the peak is a process-wide high-water
+//                 mark, run each mode in a separate invocation when comparing peaks.
+
+#pragma once
+
+#ifndef ASCII_ASSET_LOAD_BENCHMARK_H_
+#define ASCII_ASSET_LOAD_BENCHMARK_H_
+
+#include <string>
+
+enum class AsciiAssetLoadMode { COPY, MAPPED };
+
+//Runs the benchmark on the file at 'filepath', performing 'iterations' timed loads. Results are 
+//printed to MSGLOG. Returns false if the file could not be loaded.
+bool runAsciiAssetLoadBenchmark(const std::string& filepath, AsciiAssetLoadMode mode, int iterations);
+
+#endif //ASCII_ASSET_LOAD_BENCHMARK_H_
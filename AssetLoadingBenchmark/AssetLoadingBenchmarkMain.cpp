@@ -0,0 +1,301 @@
+// File:           AssetLoadingBenchmarkMain.cpp
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Entry point for the headless asset-loading benchmarks. This project compiles
+//                 the asset loading code straight out of the main project's directory, but it never
+//                 creates a window or a GL context, so it can be run anywhere.
+//
+//                 Usage:
+//                     AssetLoadingBenchmark asciiasset <copy|mapped> <file> [iterations]
+//                     AssetLoadingBenchmark objtokenizer <file> [iterations]
+//                     AssetLoadingBenchmark objscaling <file> [maxThreads] [iterations]
+//                     AssetLoadingBenchmark ngon [cornerCount] [iterations]
+//                     AssetLoadingBenchmark objstream <stream|whole> <file> [bufferKB] [iterations]
+//                     AssetLoadingBenchmark objcorpus <directory> [iterations] [output.json]
+//                     AssetLoadingBenchmark bvh <directory> [meshCount] [iterations]
+//                     AssetLoadingBenchmark cull [objectCount] [iterations]
+//                     AssetLoadingBenchmark wireframe <directory> [meshCount] [iterations]
+//                     AssetLoadingBenchmark sceneassembly [vertexCount] [iterations]
+//                     AssetLoadingBenchmark meshlets <directory> [meshCount] [iterations]
+//                     AssetLoadingBenchmark weld <directory> [meshCount] [iterations]
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include "LoggingMessageTargets.h"
+#include "AsciiAssetLoadBenchmark.h"
+#include "ObjTokenizerBenchmark.h"
+#include "NGonTriangulatorBenchmark.h"
+#include "StreamingObjLoadBenchmark.h"
+#include "ObjCorpusBenchmark.h"
+#include "TriangleBVHBenchmark.h"
+#include "FrustumCullingBenchmark.h"
+#include "WireframeEdgesBenchmark.h"
+#include "SceneAssemblyBenchmark.h"
+#include "MeshletBenchmark.h"
+#include "VertexWelderBenchmark.h"
+
+namespace {
+    constexpr const int DEFAULT_ITERATIONS = 10;
+    constexpr const size_t DEFAULT_NGON_CORNER_COUNT = 64u;
+    constexpr const size_t DEFAULT_STREAM_BUFFER_KILOBYTES = 1024u;
+    constexpr const char* DEFAULT_CORPUS_RESULTS_FILE = "obj_corpus_benchmark.json";
+    constexpr const size_t DEFAULT_BVH_MESH_COUNT = 3u;
+    constexpr const size_t DEFAULT_CULLING_OBJECT_COUNT = 100000u;
+    constexpr const size_t DEFAULT_WIREFRAME_MESH_COUNT = 8u;
+    constexpr const size_t DEFAULT_ASSEMBLY_VERTEX_COUNT = 12000000u;
+    constexpr const size_t DEFAULT_MESHLET_MESH_COUNT = 3u;
+    constexpr const size_t DEFAULT_WELD_MESH_COUNT = 3u;
+
+    void printUsage(const char* programName) {
+        fprintf(MSGLOG, "\nUsage:\n"
+            "    %s asciiasset <copy|mapped> <file> [iterations]\n"
+            "          Times loading a text file through AsciiAsset and walking every line,\n"
+            "          either copying the text (the original path) or memory-mapping it.\n"
+            "          Run each mode in its own process to compare peak memory use.\n"
+            "    %s objtokenizer <file> [iterations]\n"
+            "          Times the single-pass tokenizer QuickObj uses to parse '.obj' files.\n"
+            "    %s objscaling <file> [maxThreads] [iterations]\n"
+            "          Times the multi-threaded chunked parse at 1 through maxThreads threads\n"
+            "          (defaults to the number of hardware threads) and verifies every result\n"
+            "          is identical to the single-threaded result.\n"
+            "    %s ngon [cornerCount] [iterations]\n"
+            "          Times triangulating a convex and a concave n-gon with cornerCount\n"
+            "          corners (defaults to %zu).\n"
+            "    %s objstream <stream|whole> <file> [bufferKB] [iterations]\n"
+            "          Times the streaming '.obj' loader, either through a buffer of bufferKB\n"
+            "          (defaults to %zu) or with the whole file in memory at once. Run each\n"
+            "          mode in its own process to compare peak memory use.\n"
+            "    %s objcorpus <directory> [iterations] [output.json]\n"
+            "          Times every '.obj' loading path on every '.obj' file under directory\n"
+            "          and writes the results as JSON to output.json (defaults to %s).\n"
+            "    %s bvh <directory> [meshCount] [iterations]\n"
+            "          Times building and querying a BVH over the meshCount (defaults to %zu)\n"
+            "          largest '.obj' files under directory, checking every result.\n"
+            "    %s cull [objectCount] [iterations]\n"
+            "          Times frustum culling a generated scene of objectCount (defaults to %zu)\n"
+            "          objects, checking that no visible object is ever culled.\n"
+            "    %s wireframe <directory> [meshCount] [iterations]\n"
+            "          Times building the outline index list of a scene made of the meshCount\n"
+            "          (defaults to %zu) largest '.obj' files under directory, checking the result.\n"
+            "    %s sceneassembly [vertexCount] [iterations]\n"
+            "          Times putting a generated scene of vertexCount (defaults to %zu) vertices\n"
+            "          together into 1 buffer, checking it against the old float at a time loop.\n"
+            "    %s meshlets <directory> [meshCount] [iterations]\n"
+            "          Times splitting the meshCount (defaults to %zu) largest '.obj' files under\n"
+            "          directory into meshlets and culling them, checking every result.\n"
+            "    %s weld <directory> [meshCount] [iterations]\n"
+            "          Times welding together the positions of the meshCount (defaults to %zu)\n"
+            "          largest '.obj' files under directory, checking every result.\n",
+            programName, programName, programName, programName, DEFAULT_NGON_CORNER_COUNT,
+            programName, DEFAULT_STREAM_BUFFER_KILOBYTES, programName, DEFAULT_CORPUS_RESULTS_FILE,
+            programName, DEFAULT_BVH_MESH_COUNT, programName, DEFAULT_CULLING_OBJECT_COUNT,
+            programName, DEFAULT_WIREFRAME_MESH_COUNT, programName, DEFAULT_ASSEMBLY_VERTEX_COUNT,
+            programName, DEFAULT_MESHLET_MESH_COUNT, programName, DEFAULT_WELD_MESH_COUNT);
+    }
+
+    int getIterations(int argc, char** argv, int argIndex) {
+        if (argc > argIndex) {
+            const int iterations = atoi(argv[argIndex]);
+            if (iterations > 0)
+                return iterations;
+            fprintf(WRNLOG, "\nWarning! Invalid iteration count \"%s\", using %d instead.\n", argv[argIndex], DEFAULT_ITERATIONS);
+        }
+        return DEFAULT_ITERATIONS;
+    }
+} //namespace
+
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const std::string benchmark = argv[1];
+
+    if (benchmark == "asciiasset") {
+        if (argc < 4) {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        AsciiAssetLoadMode mode;
+        if (strcmp(argv[2], "copy") == 0)
+            mode = AsciiAssetLoadMode::COPY;
+        else if (strcmp(argv[2], "mapped") == 0)
+            mode = AsciiAssetLoadMode::MAPPED;
+        else {
+            fprintf(ERRLOG, "\nERROR! Unknown AsciiAsset load mode \"%s\"!\n", argv[2]);
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        return (runAsciiAssetLoadBenchmark(argv[3], mode, getIterations(argc, argv, 4)) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    if (benchmark == "objtokenizer") {
+        if (argc < 3) {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        return (runObjTokenizerBenchmark(argv[2], getIterations(argc, argv, 3)) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    if (benchmark == "objscaling") {
+        if (argc < 3) {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        unsigned int maxThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        if (argc > 3) {
+            const int requestedThreads = atoi(argv[3]);
+            if (requestedThreads > 0)
+                maxThreads = static_cast<unsigned int>(requestedThreads);
+            else
+                fprintf(WRNLOG, "\nWarning! Invalid thread count \"%s\", using %u instead.\n", argv[3], maxThreads);
+        }
+        return (runObjTokenizerScalingBenchmark(argv[2], maxThreads, getIterations(argc, argv, 4)) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    if (benchmark == "ngon") {
+        size_t cornerCount = DEFAULT_NGON_CORNER_COUNT;
+        if (argc > 2) {
+            const int requestedCorners = atoi(argv[2]);
+            if (requestedCorners > 0)
+                cornerCount = static_cast<size_t>(requestedCorners);
+            else
+                fprintf(WRNLOG, "\nWarning! Invalid corner count \"%s\", using %zu instead.\n", argv[2], cornerCount);
+        }
+        return (runNGonTriangulatorBenchmark(cornerCount, getIterations(argc, argv, 3)) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    if (benchmark == "objstream") {
+        if (argc < 4) {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        StreamingObjLoadMode mode;
+        if (strcmp(argv[2], "stream") == 0)
+            mode = StreamingObjLoadMode::STREAM;
+        else if (strcmp(argv[2], "whole") == 0)
+            mode = StreamingObjLoadMode::WHOLE;
+        else {
+            fprintf(ERRLOG, "\nERROR! Unknown streaming mode \"%s\"!\n", argv[2]);
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        size_t bufferKilobytes = DEFAULT_STREAM_BUFFER_KILOBYTES;
+        if (argc > 4) {
+            const int requestedKilobytes = atoi(argv[4]);
+            if (requestedKilobytes > 0)
+                bufferKilobytes = static_cast<size_t>(requestedKilobytes);
+            else
+                fprintf(WRNLOG, "\nWarning! Invalid buffer size \"%s\", using %zu KB instead.\n", argv[4], bufferKilobytes);
+        }
+        return (runStreamingObjLoadBenchmark(argv[3], mode, bufferKilobytes, getIterations(argc, argv, 5)) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    if (benchmark == "objcorpus") {
+        if (argc < 3) {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        const std::string jsonFilepath = ((argc > 4) ? argv[4] : DEFAULT_CORPUS_RESULTS_FILE);
+        return (runObjCorpusBenchmark(argv[2], getIterations(argc, argv, 3), jsonFilepath) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    if (benchmark == "bvh") {
+        if (argc < 3) {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        size_t meshCount = DEFAULT_BVH_MESH_COUNT;
+        if (argc > 3) {
+            const int requestedMeshes = atoi(argv[3]);
+            if (requestedMeshes > 0)
+                meshCount = static_cast<size_t>(requestedMeshes);
+            else
+                fprintf(WRNLOG, "\nWarning! Invalid mesh count \"%s\", using %zu instead.\n", argv[3], meshCount);
+        }
+        return (runTriangleBVHBenchmark(argv[2], meshCount, getIterations(argc, argv, 4)) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    if (benchmark == "cull") {
+        size_t objectCount = DEFAULT_CULLING_OBJECT_COUNT;
+        if (argc > 2) {
+            const int requestedObjects = atoi(argv[2]);
+            if (requestedObjects > 0)
+                objectCount = static_cast<size_t>(requestedObjects);
+            else
+                fprintf(WRNLOG, "\nWarning! Invalid object count \"%s\", using %zu instead.\n", argv[2], objectCount);
+        }
+        return (runFrustumCullingBenchmark(objectCount, getIterations(argc, argv, 3)) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    if (benchmark == "wireframe") {
+        if (argc < 3) {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        size_t meshCount = DEFAULT_WIREFRAME_MESH_COUNT;
+        if (argc > 3) {
+            const int requestedMeshes = atoi(argv[3]);
+            if (requestedMeshes > 0)
+                meshCount = static_cast<size_t>(requestedMeshes);
+            else
+                fprintf(WRNLOG, "\nWarning! Invalid mesh count \"%s\", using %zu instead.\n", argv[3], meshCount);
+        }
+        return (runWireframeEdgesBenchmark(argv[2], meshCount, getIterations(argc, argv, 4)) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    if (benchmark == "sceneassembly") {
+        size_t vertexCount = DEFAULT_ASSEMBLY_VERTEX_COUNT;
+        if (argc > 2) {
+            const long long requestedVertices = atoll(argv[2]);
+            if (requestedVertices > 0)
+                vertexCount = static_cast<size_t>(requestedVertices);
+            else
+                fprintf(WRNLOG, "\nWarning! Invalid vertex count \"%s\", using %zu instead.\n", argv[2], vertexCount);
+        }
+        return (runSceneAssemblyBenchmark(vertexCount, getIterations(argc, argv, 3)) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    if (benchmark == "meshlets") {
+        if (argc < 3) {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        size_t meshCount = DEFAULT_MESHLET_MESH_COUNT;
+        if (argc > 3) {
+            const int requestedMeshes = atoi(argv[3]);
+            if (requestedMeshes > 0)
+                meshCount = static_cast<size_t>(requestedMeshes);
+            else
+                fprintf(WRNLOG, "\nWarning! Invalid mesh count \"%s\", using %zu instead.\n", argv[3], meshCount);
+        }
+        return (runMeshletBenchmark(argv[2], meshCount, getIterations(argc, argv, 4)) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    if (benchmark == "weld") {
+        if (argc < 3) {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        size_t meshCount = DEFAULT_WELD_MESH_COUNT;
+        if (argc > 3) {
+            const int requestedMeshes = atoi(argv[3]);
+            if (requestedMeshes > 0)
+                meshCount = static_cast<size_t>(requestedMeshes);
+            else
+                fprintf(WRNLOG, "\nWarning! Invalid mesh count \"%s\", using %zu instead.\n", argv[3], meshCount);
+        }
+        return (runVertexWelderBenchmark(argv[2], meshCount, getIterations(argc, argv, 4)) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    fprintf(ERRLOG, "\nERROR! Unknown benchmark \"%s\"!\n", benchmark.c_str());
+    printUsage(argv[0]);
+    return EXIT_FAILURE;
+}
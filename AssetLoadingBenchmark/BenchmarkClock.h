@@ -0,0 +1,33 @@
+// File:           BenchmarkClock.h
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    The main project's Timepoint class measures time through glfwGetTime(),
+//                 which requires GLFW to have been initialized. The benchmarks in this project
+//                 are meant to run headless, so they use this tiny wrapper around
+//                 std::chrono::steady_clock instead.
+
+#pragma once
+
+#ifndef BENCHMARK_CLOCK_H_
+#define BENCHMARK_CLOCK_H_
+
+#include <chrono>
+
+class BenchmarkClock final {
+public:
+    BenchmarkClock() : mStart_(std::chrono::steady_clock::now()) { ; }
+
+    //Resets the start of the measured interval to now
+    void restart() { mStart_ = std::chrono::steady_clock::now(); }
+
+    //Returns the number of milliseconds since construction (or the most recent restart)
+    double elapsedMilliseconds() const {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - mStart_).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point mStart_;
+};
+
+#endif //BENCHMARK_CLOCK_H_
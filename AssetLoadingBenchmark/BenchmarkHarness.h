@@ -0,0 +1,167 @@
+// File:           BenchmarkHarness.h
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    What every benchmark in this project does the same way, so that each benchmark only has to
+//                 supply the step it times and the checks it makes on the results. That covers finding the
+//                 '.obj' files to run on (see BenchmarkObjFiles.h), timing a step over a number of iterations,
+//                 picking the thread counts to compare, and printing the settings and the final pass/fail
+//                 result in the same layout as every other benchmark.
+//
+//                 A typical benchmark looks like:
+//
+//                      const std::vector<std::string> files = beginMeshFileBenchmark("Some benchmark", directory, meshCount);
+//                      printBenchmarkSetting("Iterations:", "%d per thread count", iterations);
+//                      for (unsigned int threads : benchmarkThreadCounts()) {
+//                          BenchmarkTiming timing(iterations);
+//                          timeBenchmarkIterations(timing, iterations, [&]() { doTheWork(threads); });
+//                          ...check the results and print a row using timing.bestMilliseconds()...
+//                      }
+//                      return finishBenchmark(allPassed, "What went wrong!");
+
+#pragma once
+
+#ifndef BENCHMARK_HARNESS_H_
+#define BENCHMARK_HARNESS_H_
+
+#include <algorithm>
+#include <cstdarg>
+#include <limits>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "BenchmarkClock.h"
+#include "BenchmarkObjFiles.h"
+#include "LoggingMessageTargets.h"
+
+//Every time measured for one timed step
+class BenchmarkTiming final {
+public:
+    //Room for 'iterations' times is made up front, so that adding them doesn't allocate while a step is measured
+    explicit BenchmarkTiming(int iterations = 0) : mBestMilliseconds_(std::numeric_limits<double>::max()),
+                                                   mTotalMilliseconds_(0.0) {
+        mSamples_.reserve(static_cast<size_t>(std::max(iterations, 0)));
+    }
+
+    void add(double milliseconds) {
+        mSamples_.push_back(milliseconds);
+        mBestMilliseconds_ = std::min(mBestMilliseconds_, milliseconds);
+        mTotalMilliseconds_ += milliseconds;
+    }
+
+    size_t count() const { return mSamples_.size(); }
+    double bestMilliseconds() const { return (mSamples_.empty() ? 0.0 : mBestMilliseconds_); }
+    double averageMilliseconds() const { return (mSamples_.empty() ? 0.0 : (mTotalMilliseconds_ / mSamples_.size())); }
+
+    //Nearest-rank percentile of the times, with 'fraction' going from 0 (the best time) to 1 (the worst)
+    double percentileMilliseconds(double fraction) const {
+        if (mSamples_.empty())
+            return 0.0;
+        std::vector<double> sorted = mSamples_;
+        std::sort(sorted.begin(), sorted.end());
+        const size_t rank = static_cast<size_t>(fraction * static_cast<double>(sorted.size()) + 0.999999);
+        return sorted[std::min(std::max(rank, static_cast<size_t>(1u)), sorted.size()) - 1u];
+    }
+
+private:
+    std::vector<double> mSamples_;
+    double mBestMilliseconds_;
+    double mTotalMilliseconds_;
+};
+
+//Times 'iterations' runs of 'step()', adding each run's time to 'timing'. After each run 'afterStep()' is called
+//outside of the measured time, for anything (such as checking or throwing away what the step built) which shouldn't
+//count toward it. A step may return a bool, in which case returning false stops the runs and makes this return false.
+template<typename Step, typename AfterStep>
+bool timeBenchmarkIterations(BenchmarkTiming& timing, int iterations, Step&& step, AfterStep&& afterStep) {
+    for (int i = 0; i < iterations; i++) {
+        BenchmarkClock clock;
+        if constexpr (std::is_same<decltype(step()), bool>::value) {
+            const bool succeeded = step();
+            timing.add(clock.elapsedMilliseconds());
+            if (!succeeded)
+                return false;
+        }
+        else {
+            step();
+            timing.add(clock.elapsedMilliseconds());
+        }
+        afterStep();
+    }
+    return true;
+}
+
+template<typename Step>
+bool timeBenchmarkIterations(BenchmarkTiming& timing, int iterations, Step&& step) {
+    return timeBenchmarkIterations(timing, iterations, std::forward<Step>(step), []() { ; });
+}
+
+//How many of 'count' things a second 'milliseconds' works out to
+inline double perSecond(double count, double milliseconds) {
+    return ((milliseconds > 0.0) ? (count / (milliseconds / 1000.0)) : 0.0);
+}
+
+//The thread counts a multi-threaded step is compared at, which is 1 and then (if there is more than 1) every
+//hardware thread. Results from 1 thread come first, so that they can be what the others are checked against.
+inline std::vector<unsigned int> benchmarkThreadCounts() {
+    const unsigned int hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    std::vector<unsigned int> threadCounts = { 1u };
+    if (hardwareThreads > 1u)
+        threadCounts.push_back(hardwareThreads);
+    return threadCounts;
+}
+
+
+///////////////////////////////////////////////////////////////////////
+//////   Reports
+///////////////////////////////////////////////////////////////////////
+
+inline void printBenchmarkTitle(const char * title) {
+    fprintf(MSGLOG, "\n%s\n", title);
+}
+
+//Prints one of the settings listed under a benchmark's title, with every setting's value lined up
+inline void printBenchmarkSetting(const char * label, const char * format, ...) {
+    fprintf(MSGLOG, "    %-23s", label);
+    va_list arguments;
+    va_start(arguments, format);
+    vfprintf(MSGLOG, format, arguments);
+    va_end(arguments);
+    fprintf(MSGLOG, "\n");
+}
+
+//What a check column of a results table shows
+inline const char * checkText(bool passed) {
+    return (passed ? "Yes" : "NO");
+}
+
+//Prints an error if no '.obj' files were found under the directory, returning whether any were
+inline bool foundObjFiles(const std::vector<std::string>& files, const std::string& directory) {
+    if (files.empty())
+        fprintf(ERRLOG, "\nERROR! No '.obj' files were found under \"%s\"!\n", directory.c_str());
+    return (!files.empty());
+}
+
+//Finds the 'meshCount' largest '.obj' files under the directory for a benchmark which runs on meshes, then prints
+//the benchmark's title and which meshes it runs on. Returns no files (after printing why) if there weren't any.
+inline std::vector<std::string> beginMeshFileBenchmark(const char * title, const std::string& directory, size_t meshCount) {
+    std::vector<std::string> files = findLargestObjFiles(directory, meshCount);
+    if (!foundObjFiles(files, directory))
+        return files;
+    printBenchmarkTitle(title);
+    printBenchmarkSetting("Directory:", "%s", directory.c_str());
+    printBenchmarkSetting("Meshes:", "%zu largest", files.size());
+    return files;
+}
+
+//Prints 'failureMessage' as an error unless every check passed, then returns whether they did
+inline bool finishBenchmark(bool allPassed, const char * failureMessage) {
+    if (!allPassed)
+        fprintf(ERRLOG, "\nERROR! %s\n", failureMessage);
+    return allPassed;
+}
+
+#endif //BENCHMARK_HARNESS_H_
@@ -0,0 +1,59 @@
+// File:           BenchmarkObjFiles.h
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Finds the '.obj' files the benchmarks run on, out of a directory (and all of its subdirectories)
+//                 which is meant to be the bundled model corpus in OpenGL_GLFW_Project/obj. The corpus benchmark
+//                 wants every file, while the mesh processing benchmarks each want the biggest few. Files are
+//                 picked by size on disk, with ties broken by path, so every run picks the same files.
+
+#pragma once
+
+#ifndef BENCHMARK_OBJ_FILES_H_
+#define BENCHMARK_OBJ_FILES_H_
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+inline bool isObjFile(const std::filesystem::path& path) {
+    std::string extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return (extension == ".obj");
+}
+
+//Returns every '.obj' file under the directory, sorted by path so that the results of 2 runs line up with each other
+inline std::vector<std::string> findObjFiles(const std::string& directory) {
+    std::vector<std::string> files;
+    std::error_code error;
+    for (std::filesystem::recursive_directory_iterator entry(directory, error), end; (!error) && (entry != end); entry.increment(error)) {
+        if (entry->is_regular_file(error) && isObjFile(entry->path()))
+            files.push_back(entry->path().string());
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+//Returns the 'meshCount' biggest '.obj' files under the directory, biggest first
+inline std::vector<std::string> findLargestObjFiles(const std::string& directory, size_t meshCount) {
+    std::vector<std::pair<uintmax_t, std::string>> files;
+    std::error_code error;
+    for (std::filesystem::recursive_directory_iterator entry(directory, error), end; (!error) && (entry != end); entry.increment(error)) {
+        if (entry->is_regular_file(error) && isObjFile(entry->path()))
+            files.push_back({ entry->file_size(error), entry->path().string() });
+    }
+    std::sort(files.begin(), files.end(), [](const auto& a, const auto& b) {
+        return ((a.first > b.first) || ((a.first == b.first) && (a.second < b.second)));
+    });
+    std::vector<std::string> largest;
+    for (size_t i = 0u; (i < files.size()) && (i < meshCount); i++)
+        largest.push_back(files[i].second);
+    return largest;
+}
+
+#endif //BENCHMARK_OBJ_FILES_H_
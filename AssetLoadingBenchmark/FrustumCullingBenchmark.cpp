@@ -0,0 +1,153 @@
+// File:           FrustumCullingBenchmark.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   A point only counts as visible when it is at least VISIBLE_POINT_MARGIN inside of every
+//                          plane (measured in doubles), so that a point sitting right on a plane can't fail the
+//                          check just because culling rounded the other way.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "FrustumCullingBenchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "GlobalIncludes.h"
+#include "FrustumCulling.h"
+#include "BenchmarkHarness.h"
+#include "LoggingMessageTargets.h"
+
+using AssetLoadingInternal::BoundingVolumeSet;
+using AssetLoadingInternal::BVHFrustum;
+
+namespace {
+
+    constexpr const size_t POINTS_PER_OBJECT = 8u;
+    constexpr const size_t CAMERA_COUNT = 16u;
+    constexpr const unsigned int SCENE_SEED = 20261017u;
+    //Objects are spread throughout a cube this many units from the origin along each axis
+    constexpr const float SCENE_HALF_SIZE = 500.0f;
+    //Each object's points are within this many units of its center along each axis
+    constexpr const float OBJECT_HALF_SIZE = 4.0f;
+    constexpr const float CAMERA_FIELD_OF_VIEW_DEGREES = 60.0f;
+    constexpr const double VISIBLE_POINT_MARGIN = 1.0e-3;
+
+    struct Scene {
+        std::vector<float> points; //POINTS_PER_OBJECT (x, y, z) points per object
+        BoundingVolumeSet volumes;
+        std::vector<BVHFrustum> frustums;
+    };
+
+    Scene generateScene(size_t objectCount) {
+        std::mt19937 generator(SCENE_SEED);
+        std::uniform_real_distribution<float> sceneCoordinate(-SCENE_HALF_SIZE, SCENE_HALF_SIZE);
+        std::uniform_real_distribution<float> objectCoordinate(-OBJECT_HALF_SIZE, OBJECT_HALF_SIZE);
+        std::uniform_real_distribution<float> objectW(0.5f, 2.0f);
+
+        Scene scene;
+        scene.points.reserve(objectCount * POINTS_PER_OBJECT * 3u);
+        for (size_t object = 0u; object < objectCount; object++) {
+            const float center[3] = { sceneCoordinate(generator), sceneCoordinate(generator), sceneCoordinate(generator) };
+            //The points are scaled by w, so that they land around the center once they are divided by it
+            const float w = objectW(generator);
+            const size_t firstPoint = scene.points.size();
+            for (size_t point = 0u; point < POINTS_PER_OBJECT; point++) {
+                for (int axis = 0; axis < 3; axis++)
+                    scene.points.push_back((center[axis] + objectCoordinate(generator)) * w);
+            }
+            scene.volumes.addObject(&scene.points[firstPoint], 3u, POINTS_PER_OBJECT, w);
+        }
+
+        const glm::mat4 projection = glm::perspective(glm::radians(CAMERA_FIELD_OF_VIEW_DEGREES), 16.0f / 9.0f, 1.0f, 4.0f * SCENE_HALF_SIZE);
+        for (size_t camera = 0u; camera < CAMERA_COUNT; camera++) {
+            const glm::vec3 eye(sceneCoordinate(generator) * 1.5f, sceneCoordinate(generator) * 1.5f, sceneCoordinate(generator) * 1.5f);
+            const glm::vec3 target(sceneCoordinate(generator), sceneCoordinate(generator), sceneCoordinate(generator));
+            const glm::mat4 view = glm::lookAt(eye, target, glm::vec3(0.0f, 1.0f, 0.0f));
+            const glm::mat4 viewProjection = projection * view;
+            scene.frustums.push_back(AssetLoadingInternal::extractFrustumPlanes(glm::value_ptr(viewProjection)));
+        }
+        return scene;
+    }
+
+    bool isPointVisible(const BVHFrustum& frustum, const float * point, float w) {
+        for (const float * plane : frustum.planes) {
+            const double distance = ((static_cast<double>(plane[0]) * point[0]) + (static_cast<double>(plane[1]) * point[1]) +
+                                     (static_cast<double>(plane[2]) * point[2]) + (static_cast<double>(plane[3]) * w)) / w;
+            const double normalLength = std::sqrt((static_cast<double>(plane[0]) * plane[0]) + (static_cast<double>(plane[1]) * plane[1]) +
+                                                  (static_cast<double>(plane[2]) * plane[2]));
+            if (distance < (VISIBLE_POINT_MARGIN * normalLength))
+                return false;
+        }
+        return true;
+    }
+
+    //Counts the objects with a point inside of the frustum, returning false if any of them were culled
+    bool checkNothingVisibleWasCulled(const Scene& scene, const BVHFrustum& frustum, const std::vector<uint8_t>& visible,
+                                      size_t& visibleObjectCount) {
+        visibleObjectCount = 0u;
+        bool correct = true;
+        for (size_t object = 0u; object < scene.volumes.size(); object++) {
+            for (size_t point = 0u; point < POINTS_PER_OBJECT; point++) {
+                if (isPointVisible(frustum, &scene.points[((object * POINTS_PER_OBJECT) + point) * 3u], scene.volumes.w[object])) {
+                    visibleObjectCount++;
+                    correct = (correct && (visible[object] != 0u));
+                    break;
+                }
+            }
+        }
+        return correct;
+    }
+
+} //namespace
+
+
+bool runFrustumCullingBenchmark(size_t objectCount, int iterations) {
+    iterations = std::max(iterations, 1);
+    printBenchmarkTitle("Frustum culling benchmark");
+    printBenchmarkSetting("Objects:", "%zu  (%zu points each)", objectCount, POINTS_PER_OBJECT);
+    printBenchmarkSetting("Cameras:", "%zu", CAMERA_COUNT);
+    printBenchmarkSetting("Iterations:", "%d per thread count", iterations);
+
+    const Scene scene = generateScene(objectCount);
+
+    //What 1 thread decided for each camera, which every other thread count has to match
+    std::vector<std::vector<uint8_t>> singleThreadedResults(scene.frustums.size());
+    std::vector<uint8_t> visible;
+    bool allPassed = true;
+    fprintf(MSGLOG, "\n    Cull     Threads  Best Time (ms)  Avg Time (ms)      Objects/s   Avg Kept  Avg Visible  Identical  Correct\n");
+    for (unsigned int threads : benchmarkThreadCounts()) {
+        BenchmarkTiming timing(iterations);
+        size_t keptCount = 0u;
+        timeBenchmarkIterations(timing, iterations, [&]() {
+            keptCount = 0u;
+            for (const BVHFrustum& frustum : scene.frustums)
+                keptCount += AssetLoadingInternal::cullBoundingVolumes(frustum, scene.volumes, 0.0f, 0.0f, visible, threads);
+        });
+
+        //Checked outside of the timed loop
+        bool identical = true;
+        bool correct = true;
+        size_t visibleCount = 0u;
+        for (size_t camera = 0u; camera < scene.frustums.size(); camera++) {
+            AssetLoadingInternal::cullBoundingVolumes(scene.frustums[camera], scene.volumes, 0.0f, 0.0f, visible, threads);
+            if (threads == 1u)
+                singleThreadedResults[camera] = visible;
+            identical = (identical && (visible == singleThreadedResults[camera]));
+            size_t cameraVisibleCount = 0u;
+            correct = (checkNothingVisibleWasCulled(scene, scene.frustums[camera], visible, cameraVisibleCount) && correct);
+            visibleCount += cameraVisibleCount;
+        }
+        allPassed = (allPassed && identical && correct);
+
+        const double objectsPerSecond = perSecond(static_cast<double>(objectCount * scene.frustums.size()), timing.bestMilliseconds());
+        fprintf(MSGLOG, "    cull     %7u  %14.3f  %13.3f  %13.0f  %9.1f  %11.1f  %-9s  %s\n", threads, timing.bestMilliseconds(),
+            timing.averageMilliseconds(), objectsPerSecond,
+            (static_cast<double>(keptCount) / scene.frustums.size()), (static_cast<double>(visibleCount) / scene.frustums.size()),
+            checkText(identical), checkText(correct));
+    }
+    return finishBenchmark(allPassed, "Culling dropped a visible object or depended on the thread count!");
+}
@@ -0,0 +1,28 @@
+// File:           FrustumCullingBenchmark.h
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Measures culling a large scene of objects against a view frustum [see FrustumCulling.h].
+//                 The scene is generated from a fixed seed: every object is a small cloud of random points
+//                 somewhere inside of a large cube, with a random w shared by all of its points. Cameras
+//                 at random spots around the cube each look at a random point inside of it.
+//
+//                 Culling is timed on 1 thread and on every hardware thread, and the 2 have to agree on
+//                 every object. Culling must also never drop an object that has a point inside of the
+//                 frustum, which is checked by testing every point of every object one by one. Reported
+//                 for each thread count are the best and average times, the objects culled per second,
+//                 and how many objects were kept compared to how many truly are visible.
+
+#pragma once
+
+#ifndef FRUSTUM_CULLING_BENCHMARK_H_
+#define FRUSTUM_CULLING_BENCHMARK_H_
+
+#include <cstddef>
+
+//Runs the benchmark on a scene of 'objectCount' objects, culling the scene against every camera 'iterations'
+//times per thread count. Results are printed to MSGLOG. Returns false if culling ever dropped a visible object
+//or gave different results on different thread counts.
+bool runFrustumCullingBenchmark(size_t objectCount, int iterations);
+
+#endif //FRUSTUM_CULLING_BENCHMARK_H_
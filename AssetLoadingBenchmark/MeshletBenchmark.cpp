@@ -0,0 +1,315 @@
+// File:           MeshletBenchmark.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   The checks of culled meshlets are done in doubles with a small margin, so that a triangle
+//                          seen exactly edge-on or a vertex sitting right on a plane can't fail the check just
+//                          because the culling rounded the other way.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "MeshletBenchmark.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "GlobalIncludes.h"
+#include "QuickObj.h"
+#include "MeshletBuilder.h"
+#include "MeshletCulling.h"
+#include "BenchmarkHarness.h"
+#include "LoggingMessageTargets.h"
+
+using AssetLoadingInternal::Meshlet;
+using AssetLoadingInternal::MeshletMesh;
+using AssetLoadingInternal::MeshletDrawRange;
+using AssetLoadingInternal::MeshletCullingResult;
+using AssetLoadingInternal::BVHFrustum;
+
+namespace {
+
+    constexpr const size_t CAMERA_COUNT = 64u;
+    constexpr const unsigned int CAMERA_SEED = 20261017u;
+    constexpr const float CAMERA_FIELD_OF_VIEW_DEGREES = 60.0f;
+    //How far a triangle may face toward the camera (as the cosine of the angle) and still count as facing away
+    constexpr const double BACKFACING_MARGIN = 1.0e-4;
+    //How far inside of every plane (relative to the plane's normal) a vertex has to be to count as inside
+    constexpr const double INSIDE_FRUSTUM_MARGIN = 1.0e-4;
+
+    struct Mesh {
+        std::vector<float> vertices;
+        size_t vertexSize = 0u;
+        std::vector<uint32_t> indices;
+
+        size_t vertexCount() const { return (vertices.size() / vertexSize); }
+        const float * positionOf(uint32_t vertex) const { return &vertices[static_cast<size_t>(vertex) * vertexSize]; }
+    };
+
+    struct Camera {
+        BVHFrustum frustum;
+        float position[3];
+    };
+
+    Mesh gatherMesh(const QuickObj& model) {
+        Mesh mesh;
+        mesh.vertexSize = model.getVertexSize();
+        mesh.vertices = model.mVertices_;
+        const size_t cornerCount = (model.isIndexed() ? model.getIndexCount() : mesh.vertexCount());
+        mesh.indices.resize(cornerCount - (cornerCount % 3u));
+        for (size_t corner = 0u; corner < mesh.indices.size(); corner++) {
+            if (!model.isIndexed())
+                mesh.indices[corner] = static_cast<uint32_t>(corner);
+            else
+                mesh.indices[corner] = (model.uses16BitIndices() ? model.mIndices16_[corner] : model.mIndices32_[corner]);
+        }
+        return mesh;
+    }
+
+    std::vector<Camera> generateCameras(const Mesh& mesh) {
+        glm::vec3 boundsMin(std::numeric_limits<float>::max());
+        glm::vec3 boundsMax(-std::numeric_limits<float>::max());
+        for (size_t vertex = 0u; vertex < mesh.vertexCount(); vertex++) {
+            const float * position = mesh.positionOf(static_cast<uint32_t>(vertex));
+            boundsMin = glm::min(boundsMin, glm::vec3(position[0], position[1], position[2]));
+            boundsMax = glm::max(boundsMax, glm::vec3(position[0], position[1], position[2]));
+        }
+        const glm::vec3 center = ((boundsMin + boundsMax) * 0.5f);
+        const glm::vec3 extent = (boundsMax - boundsMin);
+        const float radius = std::max(glm::length(extent) * 0.5f, 1.0e-6f);
+
+        std::mt19937 generator(CAMERA_SEED);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        std::uniform_real_distribution<float> distance(0.75f, 3.0f);
+        std::vector<Camera> cameras(CAMERA_COUNT);
+        for (Camera& camera : cameras) {
+            glm::vec3 direction;
+            do {
+                direction = ((glm::vec3(unit(generator), unit(generator), unit(generator)) * 2.0f) - 1.0f);
+            } while ((glm::dot(direction, direction) > 1.0f) || (glm::dot(direction, direction) < 1.0e-4f));
+            const glm::vec3 eye = (center + (glm::normalize(direction) * (distance(generator) * radius)));
+            const glm::vec3 target = (boundsMin + (glm::vec3(unit(generator), unit(generator), unit(generator)) * extent));
+            const glm::vec3 forward = glm::normalize(target - eye);
+            const glm::vec3 up = ((std::fabs(forward.y) > 0.99f) ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f));
+            const glm::mat4 projection = glm::perspective(glm::radians(CAMERA_FIELD_OF_VIEW_DEGREES), 16.0f / 9.0f,
+                                                          (0.01f * radius), (8.0f * radius));
+            const glm::mat4 viewProjection = (projection * glm::lookAt(eye, target, up));
+            camera.frustum = AssetLoadingInternal::extractFrustumPlanes(glm::value_ptr(viewProjection));
+            camera.position[0] = eye.x;
+            camera.position[1] = eye.y;
+            camera.position[2] = eye.z;
+        }
+        return cameras;
+    }
+
+
+    ///////////////////////////////////////////////////////////////////////
+    //////   Checks
+    ///////////////////////////////////////////////////////////////////////
+
+    typedef std::array<uint32_t, 3> Triangle;
+
+    bool checkMeshlets(const Mesh& mesh, const MeshletMesh& meshlets) {
+        if (meshlets.bounds.size() != meshlets.meshlets.size())
+            return false;
+        for (const Meshlet& meshlet : meshlets.meshlets) {
+            if ((meshlet.vertexCount > AssetLoadingInternal::MAX_MESHLET_VERTICES) ||
+                (meshlet.triangleCount > AssetLoadingInternal::MAX_MESHLET_TRIANGLES) || (meshlet.triangleCount == 0u))
+                return false;
+            for (size_t triangle = 0u; triangle < meshlet.triangleCount; triangle++) {
+                for (size_t corner = 0u; corner < 3u; corner++) {
+                    const uint8_t local = meshlets.meshletTriangles[((meshlet.firstTriangle + triangle) * 3u) + corner];
+                    if ((local >= meshlet.vertexCount) || (meshlets.meshletVertices[meshlet.firstVertex + local] !=
+                                                           meshlets.indices[meshlet.firstIndex + (triangle * 3u) + corner]))
+                        return false;
+                }
+            }
+        }
+
+        //Every usable triangle has to show up exactly once
+        std::vector<Triangle> expected;
+        for (size_t triangle = 0u; triangle < (mesh.indices.size() / 3u); triangle++) {
+            const Triangle corners = { mesh.indices[triangle * 3u], mesh.indices[(triangle * 3u) + 1u], mesh.indices[(triangle * 3u) + 2u] };
+            if ((corners[0] < mesh.vertexCount()) && (corners[1] < mesh.vertexCount()) && (corners[2] < mesh.vertexCount()))
+                expected.push_back(corners);
+        }
+        std::vector<Triangle> found;
+        for (size_t triangle = 0u; triangle < (meshlets.indices.size() / 3u); triangle++)
+            found.push_back({ meshlets.indices[triangle * 3u], meshlets.indices[(triangle * 3u) + 1u], meshlets.indices[(triangle * 3u) + 2u] });
+        std::sort(expected.begin(), expected.end());
+        std::sort(found.begin(), found.end());
+        return (expected == found);
+    }
+
+    bool isFacingAway(const Mesh& mesh, const uint32_t * corners, const float * cameraPosition) {
+        const float * p0 = mesh.positionOf(corners[0]);
+        const float * p1 = mesh.positionOf(corners[1]);
+        const float * p2 = mesh.positionOf(corners[2]);
+        const double e1[3] = { static_cast<double>(p1[0]) - p0[0], static_cast<double>(p1[1]) - p0[1], static_cast<double>(p1[2]) - p0[2] };
+        const double e2[3] = { static_cast<double>(p2[0]) - p0[0], static_cast<double>(p2[1]) - p0[1], static_cast<double>(p2[2]) - p0[2] };
+        const double normal[3] = { (e1[1] * e2[2]) - (e1[2] * e2[1]), (e1[2] * e2[0]) - (e1[0] * e2[2]), (e1[0] * e2[1]) - (e1[1] * e2[0]) };
+        const double toCamera[3] = { static_cast<double>(cameraPosition[0]) - p0[0], static_cast<double>(cameraPosition[1]) - p0[1],
+                                     static_cast<double>(cameraPosition[2]) - p0[2] };
+        const double facing = ((normal[0] * toCamera[0]) + (normal[1] * toCamera[1]) + (normal[2] * toCamera[2]));
+        const double lengths = (std::sqrt((normal[0] * normal[0]) + (normal[1] * normal[1]) + (normal[2] * normal[2])) *
+                                std::sqrt((toCamera[0] * toCamera[0]) + (toCamera[1] * toCamera[1]) + (toCamera[2] * toCamera[2])));
+        return (facing <= (BACKFACING_MARGIN * lengths));
+    }
+
+    bool isInsideFrustum(const BVHFrustum& frustum, const float * position) {
+        for (const float * plane : frustum.planes) {
+            const double distance = ((static_cast<double>(plane[0]) * position[0]) + (static_cast<double>(plane[1]) * position[1]) +
+                                     (static_cast<double>(plane[2]) * position[2]) + plane[3]);
+            const double normalLength = std::sqrt((static_cast<double>(plane[0]) * plane[0]) + (static_cast<double>(plane[1]) * plane[1]) +
+                                                  (static_cast<double>(plane[2]) * plane[2]));
+            if (distance < (INSIDE_FRUSTUM_MARGIN * normalLength))
+                return false;
+        }
+        return true;
+    }
+
+    //Checks that nothing was culled which shouldn't have been, and that the draw list covers exactly what was kept
+    bool checkCulling(const Mesh& mesh, const MeshletMesh& meshlets, const Camera& camera, const std::vector<uint8_t>& visible,
+                      const std::vector<MeshletDrawRange>& drawList) {
+        size_t keptIndices = 0u;
+        for (size_t i = 0u; i < meshlets.meshlets.size(); i++) {
+            const Meshlet& meshlet = meshlets.meshlets[i];
+            if (visible[i] != 0u) {
+                keptIndices += (3u * meshlet.triangleCount);
+                continue;
+            }
+            if (AssetLoadingInternal::isMeshletBackfacing(meshlet, camera.position)) {
+                for (size_t triangle = 0u; triangle < meshlet.triangleCount; triangle++) {
+                    if (!isFacingAway(mesh, &meshlets.indices[meshlet.firstIndex + (triangle * 3u)], camera.position))
+                        return false;
+                }
+            }
+            else {
+                for (size_t vertex = 0u; vertex < meshlet.vertexCount; vertex++) {
+                    if (isInsideFrustum(camera.frustum, mesh.positionOf(meshlets.meshletVertices[meshlet.firstVertex + vertex])))
+                        return false;
+                }
+            }
+        }
+        size_t drawnIndices = 0u;
+        for (const MeshletDrawRange& range : drawList)
+            drawnIndices += range.indexCount;
+        return (drawnIndices == keptIndices);
+    }
+
+
+    ///////////////////////////////////////////////////////////////////////
+    //////   Timed passes
+    ///////////////////////////////////////////////////////////////////////
+
+    bool benchmarkBuilds(const Mesh& mesh, int iterations, MeshletMesh& meshlets) {
+        BenchmarkTiming timing(iterations);
+        timeBenchmarkIterations(timing, iterations, [&]() {
+            AssetLoadingInternal::buildMeshlets(mesh.indices.data(), mesh.indices.size(), mesh.vertices.data(), mesh.vertexSize,
+                                                mesh.vertexCount(), meshlets);
+        });
+        const bool correct = checkMeshlets(mesh, meshlets);
+
+        size_t coneCount = 0u;
+        for (const Meshlet& meshlet : meshlets.meshlets)
+            coneCount += ((meshlet.coneCutoff <= 1.0f) ? 1u : 0u);
+        const size_t meshletCount = std::max(meshlets.meshlets.size(), static_cast<size_t>(1u));
+        const size_t triangleCount = (meshlets.indices.size() / 3u);
+        fprintf(MSGLOG, "\n    Build    Best Time (ms)  Avg Time (ms)    Triangles/s  Meshlets  Avg Vertices  Avg Triangles  With Cones  Correct\n");
+        fprintf(MSGLOG, "    build    %14.3f  %13.3f  %13.0f  %8zu  %12.1f  %13.1f  %10zu  %s\n", timing.bestMilliseconds(),
+            timing.averageMilliseconds(), perSecond(static_cast<double>(triangleCount), timing.bestMilliseconds()),
+            meshlets.meshlets.size(), (static_cast<double>(meshlets.meshletVertices.size()) / meshletCount),
+            (static_cast<double>(triangleCount) / meshletCount), coneCount, checkText(correct));
+        return correct;
+    }
+
+    bool benchmarkCulling(const Mesh& mesh, const MeshletMesh& meshlets, const std::vector<Camera>& cameras, int iterations) {
+        std::vector<std::vector<MeshletDrawRange>> singleThreadedLists(cameras.size());
+        std::vector<uint8_t> visible;
+        std::vector<MeshletDrawRange> drawList;
+        bool allPassed = true;
+        fprintf(MSGLOG, "\n    Cull     Threads  Best Time (ms)  Avg Time (ms)     Meshlets/s  Frustum Culled  Backface Culled  Triangles Drawn  Draw Ranges  Identical  Correct\n");
+        for (unsigned int threads : benchmarkThreadCounts()) {
+            BenchmarkTiming timing(iterations);
+            timeBenchmarkIterations(timing, iterations, [&]() {
+                for (const Camera& camera : cameras)
+                    AssetLoadingInternal::cullMeshlets(meshlets, camera.frustum, camera.position, visible, drawList, threads);
+            });
+
+            //Checked outside of the timed loop
+            bool identical = true;
+            bool correct = true;
+            size_t frustumCulled = 0u, backfaceCulled = 0u, trianglesDrawn = 0u, drawRanges = 0u;
+            for (size_t camera = 0u; camera < cameras.size(); camera++) {
+                const MeshletCullingResult result = AssetLoadingInternal::cullMeshlets(meshlets, cameras[camera].frustum,
+                    cameras[camera].position, visible, drawList, threads);
+                if (threads == 1u)
+                    singleThreadedLists[camera] = drawList;
+                identical = (identical && (drawList.size() == singleThreadedLists[camera].size()) &&
+                    std::equal(drawList.cbegin(), drawList.cend(), singleThreadedLists[camera].cbegin(),
+                        [](const MeshletDrawRange& a, const MeshletDrawRange& b) {
+                            return ((a.firstIndex == b.firstIndex) && (a.indexCount == b.indexCount));
+                        }));
+                correct = (checkCulling(mesh, meshlets, cameras[camera], visible, drawList) && correct);
+                frustumCulled += result.frustumCulledMeshlets;
+                backfaceCulled += result.backfaceCulledMeshlets;
+                trianglesDrawn += result.drawnTriangles;
+                drawRanges += drawList.size();
+            }
+            allPassed = (allPassed && identical && correct);
+
+            const double cameraCount = static_cast<double>(cameras.size());
+            const double meshletsPerSecond = perSecond(meshlets.meshlets.size() * cameraCount, timing.bestMilliseconds());
+            const double triangleCount = std::max(static_cast<double>(meshlets.indices.size() / 3u), 1.0);
+            fprintf(MSGLOG, "    cull     %7u  %14.3f  %13.3f  %13.0f  %14.1f  %15.1f  %14.1f%%  %11.1f  %-9s  %s\n", threads,
+                timing.bestMilliseconds(), timing.averageMilliseconds(), meshletsPerSecond, (frustumCulled / cameraCount),
+                (backfaceCulled / cameraCount), (100.0 * (trianglesDrawn / cameraCount) / triangleCount), (drawRanges / cameraCount),
+                checkText(identical), checkText(correct));
+        }
+        return allPassed;
+    }
+
+} //namespace
+
+
+bool runMeshletBenchmark(const std::string& directory, size_t meshCount, int iterations) {
+    iterations = std::max(iterations, 1);
+    const std::vector<std::string> files = beginMeshFileBenchmark("Meshlet benchmark", directory, meshCount);
+    if (files.empty())
+        return false;
+    printBenchmarkSetting("Meshlet limits:", "%zu vertices, %zu triangles", AssetLoadingInternal::MAX_MESHLET_VERTICES,
+        AssetLoadingInternal::MAX_MESHLET_TRIANGLES);
+    printBenchmarkSetting("Cameras:", "%zu per mesh", CAMERA_COUNT);
+    printBenchmarkSetting("Iterations:", "%d per build and per culling pass", iterations);
+
+    bool allPassed = true;
+    size_t meshesLoaded = 0u;
+    for (const std::string& file : files) {
+        const QuickObj model(file, 1.0f, true, false, 0.5f, 0.5f, QuickObj::AUTOMATIC_PARSE_THREAD_COUNT,
+                             QuickObj::OutputFormat::INDEXED, false);
+        if (model.error()) {
+            fprintf(WRNLOG, "\nWarning! Skipping \"%s\", which failed to load!\n", file.c_str());
+            continue;
+        }
+        meshesLoaded++;
+        const Mesh mesh = gatherMesh(model);
+
+        fprintf(MSGLOG, "\n  %s   (%zu triangles)\n", file.c_str(), (mesh.indices.size() / 3u));
+        MeshletMesh meshlets;
+        if (!benchmarkBuilds(mesh, iterations, meshlets)) {
+            allPassed = false;
+            continue;
+        }
+        if (meshlets.meshlets.empty()) {
+            fprintf(MSGLOG, "    The mesh has no triangles to cull.\n");
+            continue;
+        }
+        allPassed = (benchmarkCulling(mesh, meshlets, generateCameras(mesh), iterations) && allPassed);
+    }
+    return (finishBenchmark(allPassed, "A meshlet build or culling pass gave a wrong result!") && (meshesLoaded > 0u));
+}
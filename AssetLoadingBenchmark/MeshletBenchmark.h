@@ -0,0 +1,33 @@
+// File:           MeshletBenchmark.h
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Measures splitting meshes up into meshlets [see MeshletBuilder.h] and culling them [see
+//                 MeshletCulling.h], on the largest '.obj' files found in a directory (and all of its
+//                 subdirectories). Each file is loaded through QuickObj as an INDEXED mesh.
+//
+//                 Building is timed and reported along with how full the meshlets came out. The meshlets have to
+//                 stay within their limits, their local vertices and triangles have to describe the same triangles
+//                 as their index ranges, and every triangle of the mesh has to end up in exactly 1 meshlet.
+//
+//                 Culling is then timed from cameras placed around the mesh [generated from a fixed seed], on 1
+//                 thread and on every hardware thread, reporting how many meshlets each test culls, how much of
+//                 the mesh is left to draw and how many draw ranges it takes. Both thread counts have to give the
+//                 same draw lists, and every culled meshlet is checked: a meshlet culled by its cone must have every
+//                 triangle facing away from the camera, and a meshlet culled by the frustum must not have any vertex
+//                 inside of it.
+
+#pragma once
+
+#ifndef MESHLET_BENCHMARK_H_
+#define MESHLET_BENCHMARK_H_
+
+#include <cstddef>
+#include <string>
+
+//Runs the benchmark on the 'meshCount' largest '.obj' files under 'directory', performing 'iterations' timed builds
+//and 'iterations' timed passes over the cameras. Results are printed to MSGLOG. Returns false if no file could be
+//loaded, or if any build or culling pass gave a wrong result.
+bool runMeshletBenchmark(const std::string& directory, size_t meshCount, int iterations);
+
+#endif //MESHLET_BENCHMARK_H_
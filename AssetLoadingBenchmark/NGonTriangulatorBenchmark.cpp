@@ -0,0 +1,103 @@
+// File:           NGonTriangulatorBenchmark.cpp
+//
+//  See header file for details.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "NGonTriangulatorBenchmark.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "NGonTriangulator.h"
+#include "BenchmarkHarness.h"
+#include "LoggingMessageTargets.h"
+
+namespace {
+
+    constexpr const double PI = 3.14159265358979323846;
+
+    //Builds a polygon in the xy plane, with every odd corner pulled in to 'innerRadius' (so an
+    //'innerRadius' of 1.0 gives a circle). The polygon is then tilted around the x and y axes.
+    std::vector<std::array<float, 3>> buildTiltedPolygon(size_t cornerCount, double innerRadius) {
+        const double tiltX = 0.6, tiltY = 0.35;
+        std::vector<std::array<float, 3>> corners;
+        corners.reserve(cornerCount);
+        for (size_t i = 0u; i < cornerCount; i++) {
+            const double angle = (2.0 * PI * static_cast<double>(i)) / static_cast<double>(cornerCount);
+            const double radius = (((i % 2u) == 1u) ? innerRadius : 1.0);
+            const double x = radius * std::cos(angle);
+            const double y0 = radius * std::sin(angle);
+
+            const double y = y0 * std::cos(tiltX);
+            const double z0 = y0 * std::sin(tiltX);
+            corners.push_back({ static_cast<float>(x * std::cos(tiltY) + z0 * std::sin(tiltY)),
+                                static_cast<float>(y),
+                                static_cast<float>(z0 * std::cos(tiltY) - x * std::sin(tiltY)) });
+        }
+        return corners;
+    }
+
+    double triangleArea(const std::array<float, 3>& a, const std::array<float, 3>& b, const std::array<float, 3>& c) {
+        const double ux = b[0] - a[0], uy = b[1] - a[1], uz = b[2] - a[2];
+        const double vx = c[0] - a[0], vy = c[1] - a[1], vz = c[2] - a[2];
+        const double cx = (uy * vz) - (uz * vy), cy = (uz * vx) - (ux * vz), cz = (ux * vy) - (uy * vx);
+        return 0.5 * std::sqrt((cx * cx) + (cy * cy) + (cz * cz));
+    }
+
+    //A correct triangulation covers the polygon exactly once, so the triangles' areas must add up
+    //to the polygon's area (any overlapping or flipped triangles would make the total too large)
+    bool coversPolygon(const std::vector<std::array<float, 3>>& corners, const std::vector<uint32_t>& triangleCorners,
+                       double expectedArea) {
+        if (triangleCorners.size() != ((corners.size() - 2u) * 3u))
+            return false;
+        double area = 0.0;
+        for (size_t i = 0u; i < triangleCorners.size(); i += 3u)
+            area += triangleArea(corners[triangleCorners[i]], corners[triangleCorners[i + 1u]], corners[triangleCorners[i + 2u]]);
+        return (std::fabs(area - expectedArea) <= (expectedArea * 1.0e-4));
+    }
+
+    bool benchmarkPolygon(const char* name, size_t cornerCount, double innerRadius, int iterations) {
+        const std::vector<std::array<float, 3>> corners = buildTiltedPolygon(cornerCount, innerRadius);
+        //Each pair of corners forms a kite with the center of the polygon
+        const double expectedArea = static_cast<double>(cornerCount) * 0.5 * innerRadius * std::sin((2.0 * PI) / static_cast<double>(cornerCount));
+
+        AssetLoadingInternal::NGonTriangulator triangulator;
+        std::vector<uint32_t> triangleCorners;
+        BenchmarkTiming timing(iterations);
+        bool triangulatedCleanly = true;
+        timeBenchmarkIterations(timing, iterations, [&]() {
+            triangulatedCleanly &= triangulator.triangulate(corners.data(), corners.size(), triangleCorners);
+        });
+
+        const bool correct = (triangulatedCleanly && coversPolygon(corners, triangleCorners, expectedArea));
+        const double bestSeconds = std::max(timing.bestMilliseconds() / 1000.0, 1.0e-9);
+        fprintf(MSGLOG, "    %-6s  %14.4f  %13.4f  %16.0f  %14.0f   %s\n", name, timing.bestMilliseconds(),
+            timing.averageMilliseconds(), (1.0 / bestSeconds), (static_cast<double>(cornerCount) / bestSeconds),
+            checkText(correct));
+        return correct;
+    }
+
+} //namespace
+
+
+bool runNGonTriangulatorBenchmark(size_t cornerCount, int iterations) {
+    iterations = std::max(iterations, 1);
+    if ((cornerCount < 6u) || ((cornerCount % 2u) != 0u)) {
+        fprintf(ERRLOG, "\nERROR! The n-gon benchmark needs an even number of corners that is at least 6 (got %zu)!\n", cornerCount);
+        return false;
+    }
+
+    printBenchmarkTitle("NGonTriangulator benchmark");
+    printBenchmarkSetting("Corners per n-gon:", "%zu", cornerCount);
+    printBenchmarkSetting("Iterations:", "%d per polygon", iterations);
+    fprintf(MSGLOG, "    Shape   Best Time (ms)  Avg Time (ms)  Triangulations/s       Corners/s   Correct\n");
+
+    bool allCorrect = true;
+    allCorrect &= benchmarkPolygon("circle", cornerCount, 1.0, iterations);
+    allCorrect &= benchmarkPolygon("star", cornerCount, 0.45, iterations);
+    return finishBenchmark(allCorrect, "At least one n-gon was not triangulated correctly!");
+}
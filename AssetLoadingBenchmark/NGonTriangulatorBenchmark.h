@@ -0,0 +1,27 @@
+// File:           NGonTriangulatorBenchmark.h
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Measures how quickly the NGonTriangulator splits large n-gons into triangles.
+//                 Two synthetic polygons with the same number of corners are timed: a circle
+//                 (convex, the common case for the caps of cylinders) and a star (where every
+//                 other corner is reflex, which is the expensive case for ear clipping). Both
+//                 polygons are tilted so that they don't lie in any of the coordinate planes.
+//
+//                 Reported for each polygon are the best time per triangulation along with the
+//                 triangulations and corners processed per second. Every triangulation is also
+//                 checked to make sure it covers exactly the area of the polygon.
+
+#pragma once
+
+#ifndef NGON_TRIANGULATOR_BENCHMARK_H_
+#define NGON_TRIANGULATOR_BENCHMARK_H_
+
+#include <cstddef>
+
+//Runs the benchmark on polygons with 'cornerCount' corners, performing 'iterations' timed
+//triangulations of each polygon. Results are printed to MSGLOG. Returns false if the corner
+//count is too small or if any triangulation did not cover the polygon correctly.
+bool runNGonTriangulatorBenchmark(size_t cornerCount, int iterations);
+
+#endif //NGON_TRIANGULATOR_BENCHMARK_H_
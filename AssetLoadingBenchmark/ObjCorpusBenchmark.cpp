@@ -0,0 +1,290 @@
+// File:           ObjCorpusBenchmark.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   Each loading path is a plain function which loads a file once and reports how many
+//                          triangles it produced, so that adding a new loading path to the benchmark is a
+//                          matter of writing one more of these functions and adding it to LOADING_PATHS.
+//
+//                          The loaders print their own messages to MSGLOG while they work, the same as they do
+//                          in the Application, so that time is included in the measurements. The table is only
+//                          printed once every file has been loaded so that it isn't broken up by those messages.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "ObjCorpusBenchmark.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "QuickObj.h"
+#include "StreamingObjLoader.h"
+#include "WavefrontObj.h"
+#include "ObjMeshCache.h"
+#include "AllocationCounter.h"
+#include "BenchmarkHarness.h"
+#include "ProcessMemoryStats.h"
+#include "LoggingMessageTargets.h"
+
+namespace {
+
+    //Loads the file once, returning false if it failed to load
+    typedef bool (*LoadingPathFunction)(const std::string& filepath, size_t& triangles);
+
+    struct LoadingPath {
+        const char * name;
+        LoadingPathFunction load;
+        //Called once the path is done with a file, to clean up anything the path left behind. May be null.
+        void (*cleanUp)(const std::string& filepath);
+    };
+
+    //Missing components are generated (which is how the Application loads models) but the texture coordinates
+    //are constant, so that every load of a file produces exactly the same data
+    static constexpr const float MODEL_SCALE = 1.0f;
+    static constexpr const bool GENERATE_MISSING_COMPONENTS = true;
+    static constexpr const bool RANDOMIZE_TEXTURE_COORDS = false;
+    static constexpr const float TEXTURE_COORD_S = 0.5f;
+    static constexpr const float TEXTURE_COORD_T = 0.5f;
+
+    static constexpr const double PERCENTILE_50 = 0.50;
+    static constexpr const double PERCENTILE_95 = 0.95;
+
+    size_t countQuickObjTriangles(const QuickObj& model) {
+        if (model.isIndexed())
+            return (model.getIndexCount() / 3u);
+        const size_t vertexSize = 4u + (model.hasTexCoords() ? 2u : 0u) + (model.hasNormals() ? 3u : 0u);
+        return (model.mVertices_.size() / (vertexSize * 3u));
+    }
+
+    bool loadQuickObj(const std::string& filepath, QuickObj::OutputFormat outputFormat, bool useMeshCache, size_t& triangles) {
+        const QuickObj model(filepath, MODEL_SCALE, GENERATE_MISSING_COMPONENTS, RANDOMIZE_TEXTURE_COORDS, TEXTURE_COORD_S,
+            TEXTURE_COORD_T, QuickObj::AUTOMATIC_PARSE_THREAD_COUNT, outputFormat, useMeshCache);
+        triangles = countQuickObjTriangles(model);
+        return ((!model.error()) && (triangles > 0u));
+    }
+
+    bool loadQuickObjExpanded(const std::string& filepath, size_t& triangles) {
+        return loadQuickObj(filepath, QuickObj::OutputFormat::EXPANDED, false, triangles);
+    }
+
+    bool loadQuickObjIndexed(const std::string& filepath, size_t& triangles) {
+        return loadQuickObj(filepath, QuickObj::OutputFormat::INDEXED, false, triangles);
+    }
+
+    bool loadQuickObjCached(const std::string& filepath, size_t& triangles) {
+        return loadQuickObj(filepath, QuickObj::OutputFormat::INDEXED, true, triangles);
+    }
+
+    //These must match the options QuickObj builds out of the arguments passed in by 'loadQuickObjCached()'
+    void removeQuickObjCache(const std::string& filepath) {
+        const AssetLoadingInternal::MeshCacheLoadOptions options = { MODEL_SCALE, GENERATE_MISSING_COMPONENTS,
+            RANDOMIZE_TEXTURE_COORDS, TEXTURE_COORD_S, TEXTURE_COORD_T, true, true, false, false, QuickObj::NO_POSITION_WELDING };
+        std::error_code ignored;
+        std::filesystem::remove(AssetLoadingInternal::getMeshCacheFilepath(filepath, options), ignored);
+    }
+
+    bool loadStreaming(const std::string& filepath, size_t& triangles) {
+        StreamingObjLoader loader(StreamingObjLoader::DEFAULT_BUFFER_BYTES, MODEL_SCALE);
+        auto sink = [](const StreamedMeshBatch&) { ; }; //The batches would be uploaded to the GPU here
+        const bool loaded = loader.loadFile(filepath, sink);
+        triangles = (loader.getIndicesEmitted() / 3u);
+        return loaded;
+    }
+
+    bool loadWavefrontObj(const std::string& filepath, size_t& triangles) {
+        const WavefrontObj model(filepath, MODEL_SCALE);
+        triangles = (model.getIndices().size() / 3u);
+        return ((!model.error()) && (triangles > 0u));
+    }
+
+    static const LoadingPath LOADING_PATHS[] = {
+        { "quickobj-expanded", loadQuickObjExpanded, nullptr },
+        { "quickobj-indexed",  loadQuickObjIndexed,  nullptr },
+        { "quickobj-cached",   loadQuickObjCached,   removeQuickObjCache },
+        { "streaming",         loadStreaming,        nullptr },
+        { "wavefrontobj",      loadWavefrontObj,     nullptr }
+    };
+
+    struct FileResult {
+        std::string file;
+        uint64_t bytes = 0u;
+        const char * loader = "";
+        bool ok = false;
+        size_t triangles = 0u;
+        double p50Milliseconds = 0.0, p95Milliseconds = 0.0, minMilliseconds = 0.0, maxMilliseconds = 0.0;
+        uint64_t allocationsPerLoad = 0u;
+        uint64_t allocatedBytesPerLoad = 0u;
+        size_t peakResidentBytes = 0u;
+    };
+
+    struct LoaderTotals {
+        const char * loader = "";
+        size_t files = 0u, failures = 0u;
+        uint64_t bytes = 0u, triangles = 0u, allocationsPerLoad = 0u;
+        double p50Milliseconds = 0.0;
+    };
+
+    double megabytesPerSecond(uint64_t bytes, double milliseconds) {
+        return ((milliseconds > 0.0) ? (ProcessMemoryStats::toMegabytes(static_cast<size_t>(bytes)) / (milliseconds / 1000.0)) : 0.0);
+    }
+
+    FileResult benchmarkFile(const std::string& filepath, uint64_t bytes, const LoadingPath& path, int iterations) {
+        FileResult result;
+        result.file = filepath;
+        result.bytes = bytes;
+        result.loader = path.name;
+
+        size_t triangles = 0u;
+        if (!path.load(filepath, triangles)) { //Untimed
+            if (path.cleanUp)
+                path.cleanUp(filepath);
+            result.peakResidentBytes = ProcessMemoryStats::peakResidentSetBytes();
+            return result;
+        }
+
+        BenchmarkTiming timing(iterations);
+        const uint64_t allocationsBefore = AllocationCounter::getAllocationCount();
+        const uint64_t allocatedBytesBefore = AllocationCounter::getAllocatedBytes();
+        const bool ok = timeBenchmarkIterations(timing, iterations, [&]() { return path.load(filepath, triangles); });
+        //(the timing made room for every time up front, so it doesn't add any allocations of its own)
+        const uint64_t allocations = AllocationCounter::getAllocationCount() - allocationsBefore;
+        const uint64_t allocatedBytes = AllocationCounter::getAllocatedBytes() - allocatedBytesBefore;
+        if (path.cleanUp)
+            path.cleanUp(filepath);
+        result.peakResidentBytes = ProcessMemoryStats::peakResidentSetBytes();
+        if (!ok)
+            return result;
+
+        result.ok = true;
+        result.triangles = triangles;
+        result.p50Milliseconds = timing.percentileMilliseconds(PERCENTILE_50);
+        result.p95Milliseconds = timing.percentileMilliseconds(PERCENTILE_95);
+        result.minMilliseconds = timing.bestMilliseconds();
+        result.maxMilliseconds = timing.percentileMilliseconds(1.0);
+        result.allocationsPerLoad = allocations / static_cast<uint64_t>(iterations);
+        result.allocatedBytesPerLoad = allocatedBytes / static_cast<uint64_t>(iterations);
+        return result;
+    }
+
+    void writeJsonString(FILE * json, const std::string& text) {
+        fputc('"', json);
+        for (const char c : text) {
+            if ((c == '"') || (c == '\\'))
+                fprintf(json, "\\%c", c);
+            else if (static_cast<unsigned char>(c) < 0x20u)
+                fprintf(json, "\\u%04x", static_cast<unsigned int>(static_cast<unsigned char>(c)));
+            else
+                fputc(c, json);
+        }
+        fputc('"', json);
+    }
+
+    bool writeJson(const std::string& jsonFilepath, const std::string& directory, int iterations,
+                   const std::vector<FileResult>& results, const std::vector<LoaderTotals>& totals) {
+        FILE * json = fopen(jsonFilepath.c_str(), "w");
+        if (!json) {
+            fprintf(ERRLOG, "\nERROR! Unable to create the results file \"%s\"!\n", jsonFilepath.c_str());
+            return false;
+        }
+        fprintf(json, "{\n  \"benchmark\": \"objcorpus\",\n  \"directory\": ");
+        writeJsonString(json, directory);
+        fprintf(json, ",\n  \"iterations\": %d,\n  \"results\": [", iterations);
+        for (size_t i = 0u; i < results.size(); i++) {
+            const FileResult& r = results[i];
+            fprintf(json, "%s\n    { \"file\": ", ((i > 0u) ? "," : ""));
+            writeJsonString(json, r.file);
+            fprintf(json, ", \"bytes\": %llu, \"loader\": \"%s\", \"ok\": %s, \"triangles\": %zu, "
+                "\"p50_ms\": %.4f, \"p95_ms\": %.4f, \"min_ms\": %.4f, \"max_ms\": %.4f, "
+                "\"mb_per_s\": %.2f, \"triangles_per_s\": %.0f, \"allocations_per_load\": %llu, "
+                "\"allocated_bytes_per_load\": %llu, \"peak_rss_bytes\": %zu }",
+                static_cast<unsigned long long>(r.bytes), r.loader, (r.ok ? "true" : "false"), r.triangles,
+                r.p50Milliseconds, r.p95Milliseconds, r.minMilliseconds, r.maxMilliseconds,
+                megabytesPerSecond(r.bytes, r.p50Milliseconds), perSecond(r.triangles, r.p50Milliseconds),
+                static_cast<unsigned long long>(r.allocationsPerLoad), static_cast<unsigned long long>(r.allocatedBytesPerLoad),
+                r.peakResidentBytes);
+        }
+        fprintf(json, "\n  ],\n  \"totals\": [");
+        for (size_t i = 0u; i < totals.size(); i++) {
+            const LoaderTotals& t = totals[i];
+            fprintf(json, "%s\n    { \"loader\": \"%s\", \"files\": %zu, \"failures\": %zu, \"bytes\": %llu, "
+                "\"triangles\": %llu, \"p50_ms_sum\": %.4f, \"mb_per_s\": %.2f, \"triangles_per_s\": %.0f, "
+                "\"allocations_per_load_sum\": %llu }",
+                ((i > 0u) ? "," : ""), t.loader, t.files, t.failures, static_cast<unsigned long long>(t.bytes),
+                static_cast<unsigned long long>(t.triangles), t.p50Milliseconds, megabytesPerSecond(t.bytes, t.p50Milliseconds),
+                perSecond(t.triangles, t.p50Milliseconds), static_cast<unsigned long long>(t.allocationsPerLoad));
+        }
+        fprintf(json, "\n  ],\n  \"peak_rss_bytes\": %zu\n}\n", ProcessMemoryStats::peakResidentSetBytes());
+        const bool written = (ferror(json) == 0);
+        fclose(json);
+        if (!written)
+            fprintf(ERRLOG, "\nERROR! An error occurred while writing the results file \"%s\"!\n", jsonFilepath.c_str());
+        return written;
+    }
+
+} //namespace
+
+
+bool runObjCorpusBenchmark(const std::string& directory, int iterations, const std::string& jsonFilepath) {
+    iterations = std::max(iterations, 1);
+
+    const std::vector<std::string> files = findObjFiles(directory);
+    if (!foundObjFiles(files, directory))
+        return false;
+
+    std::vector<FileResult> results;
+    results.reserve(files.size() * std::size(LOADING_PATHS));
+    std::vector<LoaderTotals> totals(std::size(LOADING_PATHS));
+    for (size_t p = 0u; p < std::size(LOADING_PATHS); p++)
+        totals[p].loader = LOADING_PATHS[p].name;
+
+    for (const std::string& file : files) {
+        std::error_code error;
+        const uint64_t bytes = static_cast<uint64_t>(std::filesystem::file_size(file, error));
+        for (size_t p = 0u; p < std::size(LOADING_PATHS); p++) {
+            results.push_back(benchmarkFile(file, (error ? 0u : bytes), LOADING_PATHS[p], iterations));
+            const FileResult& result = results.back();
+            LoaderTotals& total = totals[p];
+            if (!result.ok) {
+                total.failures++;
+                continue;
+            }
+            total.files++;
+            total.bytes += result.bytes;
+            total.triangles += result.triangles;
+            total.p50Milliseconds += result.p50Milliseconds;
+            total.allocationsPerLoad += result.allocationsPerLoad;
+        }
+    }
+
+    printBenchmarkTitle(".obj corpus benchmark");
+    printBenchmarkSetting("Directory:", "%s  (%zu files)", directory.c_str(), files.size());
+    printBenchmarkSetting("Iterations:", "%d", iterations);
+    fprintf(MSGLOG, "\n%-18s %10s %10s %10s %10s %14s %14s %12s  %s\n", "Loader", "Bytes", "Triangles", "p50 ms",
+        "p95 ms", "MB/s", "Triangles/s", "Allocations", "File");
+    for (const FileResult& r : results) {
+        if (!r.ok) {
+            fprintf(MSGLOG, "%-18s %10llu %10s %10s %10s %14s %14s %12s  %s\n", r.loader, static_cast<unsigned long long>(r.bytes),
+                "FAILED", "-", "-", "-", "-", "-", r.file.c_str());
+            continue;
+        }
+        fprintf(MSGLOG, "%-18s %10llu %10zu %10.3f %10.3f %14.1f %14.0f %12llu  %s\n", r.loader,
+            static_cast<unsigned long long>(r.bytes), r.triangles, r.p50Milliseconds, r.p95Milliseconds,
+            megabytesPerSecond(r.bytes, r.p50Milliseconds), perSecond(r.triangles, r.p50Milliseconds),
+            static_cast<unsigned long long>(r.allocationsPerLoad), r.file.c_str());
+    }
+    fprintf(MSGLOG, "\nTotals  [Summed over every file each loader loaded, rates are computed from the summed medians]\n");
+    for (const LoaderTotals& t : totals) {
+        fprintf(MSGLOG, "    %-18s %4zu files  %3zu failed  %10.3f ms  %8.1f MB/s  %12.0f triangles/s  %10llu allocations\n",
+            t.loader, t.files, t.failures, t.p50Milliseconds, megabytesPerSecond(t.bytes, t.p50Milliseconds),
+            perSecond(t.triangles, t.p50Milliseconds), static_cast<unsigned long long>(t.allocationsPerLoad));
+    }
+    fprintf(MSGLOG, "    Peak resident memory:  %.2f MB\n", ProcessMemoryStats::toMegabytes(ProcessMemoryStats::peakResidentSetBytes()));
+
+    if (!writeJson(jsonFilepath, directory, iterations, results, totals))
+        return false;
+    fprintf(MSGLOG, "    Results written to \"%s\"\n", jsonFilepath.c_str());
+    return true;
+}
@@ -0,0 +1,55 @@
+// File:           ObjCorpusBenchmark.h
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Runs every '.obj' loading path over every '.obj' file found in a directory (and all of
+//                 its subdirectories), which is meant to be the bundled model corpus in OpenGL_GLFW_Project/obj.
+//                 This is the benchmark to run before and after a change to the loading code to find out
+//                 whether anything got slower.
+//
+//                 The loading paths measured are:
+//                      quickobj-expanded   --  QuickObj with EXPANDED output, without the mesh cache
+//                      quickobj-indexed    --  QuickObj with INDEXED output, without the mesh cache
+//                      quickobj-cached     --  QuickObj with INDEXED output, loaded from the mesh cache. The
+//                                              cache is written by an untimed load first and is deleted again
+//                                              afterwards.
+//                      streaming           --  The StreamingObjLoader with its default buffer size
+//                      wavefrontobj        --  WavefrontObj, which also records the sub-mesh ranges
+//
+//                 Each path loads each file once untimed (to get the file into the OS's file cache) and then
+//                 'iterations' timed times. For every file and path the following are reported:
+//                      -The median (p50) and 95th percentile (p95) load time, along with the fastest and slowest
+//                      -MB/s and triangles/s, both computed from the median time
+//                      -The number of heap allocations (and bytes allocated) per load, see AllocationCounter.h
+//                      -The process's peak resident memory once the path has finished with the file. This is a
+//                        high-water mark over the whole run, so it only says something about the largest files.
+//                        Use the 'objstream' benchmark in separate processes to compare the peaks of 2 paths.
+//                 A table is printed to MSGLOG, and everything is also written out as JSON so that the results
+//                 of 2 runs can be compared with a script.
+//
+// JSON Format:    { "benchmark": "objcorpus", "directory": ..., "iterations": N,
+//                   "results": [ { "file": ..., "bytes": N, "loader": ..., "ok": true,
+//                                  "triangles": N, "p50_ms": x, "p95_ms": x, "min_ms": x, "max_ms": x,
+//                                  "mb_per_s": x, "triangles_per_s": x, "allocations_per_load": N,
+//                                  "allocated_bytes_per_load": N, "peak_rss_bytes": N }, ... ],
+//                   "totals": [ { "loader": ..., "files": N, "failures": N, "bytes": N, "triangles": N,
+//                                 "p50_ms_sum": x, "mb_per_s": x, "triangles_per_s": x,
+//                                 "allocations_per_load_sum": N }, ... ],
+//                   "peak_rss_bytes": N }
+//                 A result with "ok": false means that path failed to load the file, its other values are all 0.
+//                 The totals only include the files the path loaded successfully.
+
+#pragma once
+
+#ifndef OBJ_CORPUS_BENCHMARK_H_
+#define OBJ_CORPUS_BENCHMARK_H_
+
+#include <string>
+
+//Runs every loading path over every '.obj' file under 'directory', performing 'iterations' timed loads of each.
+//The table is printed to MSGLOG and the JSON is written to 'jsonFilepath'. Returns false if no '.obj' files were
+//found or if the JSON could not be written. A file failing to load is recorded in the results but is not a failure
+//of the benchmark.
+bool runObjCorpusBenchmark(const std::string& directory, int iterations, const std::string& jsonFilepath);
+
+#endif //OBJ_CORPUS_BENCHMARK_H_
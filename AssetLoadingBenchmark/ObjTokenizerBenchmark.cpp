@@ -0,0 +1,167 @@
+// File:           ObjTokenizerBenchmark.cpp
+//
+//  See header file for details.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "ObjTokenizerBenchmark.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "AsciiAsset.h"
+#include "ObjTokenizer.h"
+#include "ParallelObjTokenizer.h"
+#include "BenchmarkClock.h"
+#include "ProcessMemoryStats.h"
+#include "LoggingMessageTargets.h"
+
+namespace {
+
+    //Compared bit for bit, so that NaNs and negative zeros have to match too
+    template<size_t COMPONENTS>
+    bool verticesAreIdentical(const AssetLoadingInternal::VertexAttributeStreams<COMPONENTS>& a,
+                              const AssetLoadingInternal::VertexAttributeStreams<COMPONENTS>& b) {
+        if (a.size() != b.size())
+            return false;
+        for (size_t component = 0u; (component < COMPONENTS) && (!a.empty()); component++) {
+            if (memcmp(a.stream(component), b.stream(component), a.size() * sizeof(float)) != 0)
+                return false;
+        }
+        return true;
+    }
+
+    //Neither of the n-gon structs has any padding
+    template<typename T>
+    bool arraysAreIdentical(const std::vector<T>& a, const std::vector<T>& b) {
+        return ((a.size() == b.size()) &&
+            ((a.empty()) || (memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0)));
+    }
+
+    bool subMeshTagsAreIdentical(const std::vector<AssetLoadingInternal::ParsedSubMeshTag>& a,
+                                 const std::vector<AssetLoadingInternal::ParsedSubMeshTag>& b) {
+        if (a.size() != b.size())
+            return false;
+        for (size_t i = 0u; i < a.size(); i++) {
+            if ((a[i].firstFace != b[i].firstFace) || (a[i].name != b[i].name) || (a[i].type != b[i].type))
+                return false;
+        }
+        return true;
+    }
+
+    bool resultsAreIdentical(const AssetLoadingInternal::ObjParseResult& a, const AssetLoadingInternal::ObjParseResult& b) {
+        return (verticesAreIdentical(a.positions, b.positions) &&
+                verticesAreIdentical(a.texCoords, b.texCoords) &&
+                verticesAreIdentical(a.normals, b.normals) &&
+                (a.faces == b.faces) &&
+                arraysAreIdentical(a.nGons, b.nGons) &&
+                arraysAreIdentical(a.nGonCorners, b.nGonCorners) &&
+                subMeshTagsAreIdentical(a.subMeshTags, b.subMeshTags) &&
+                (a.lineEndpoints == b.lineEndpoints) &&
+                (a.hasTexCoords == b.hasTexCoords) &&
+                (a.hasNormals == b.hasNormals));
+    }
+
+} //namespace
+
+
+bool runObjTokenizerBenchmark(const std::string& filepath, int iterations) {
+    iterations = std::max(iterations, 1);
+
+    const AssetLoadingInternal::AsciiAsset asset(filepath, true, true);
+    const std::string_view text = asset.getTextView();
+    if (text.empty()) {
+        fprintf(ERRLOG, "\nERROR! Unable to load the file \"%s\" for benchmarking!\n", filepath.c_str());
+        return false;
+    }
+
+    double bestMilliseconds = std::numeric_limits<double>::max();
+    double totalMilliseconds = 0.0;
+    size_t linesWithErrors = 0u;
+    AssetLoadingInternal::ObjParseResult lastResult;
+
+    for (int i = 0; i < iterations; i++) {
+        AssetLoadingInternal::ObjParseResult result;
+        AssetLoadingInternal::ObjTokenizer tokenizer(filepath);
+
+        BenchmarkClock clock;
+        linesWithErrors = tokenizer.tokenize(text, result);
+        const double elapsed = clock.elapsedMilliseconds();
+
+        bestMilliseconds = std::min(bestMilliseconds, elapsed);
+        totalMilliseconds += elapsed;
+        lastResult = std::move(result);
+    }
+
+    const double megabytes = ProcessMemoryStats::toMegabytes(text.length());
+    fprintf(MSGLOG, "\nObjTokenizer parse benchmark\n");
+    fprintf(MSGLOG, "    File:                  %s  (%.2f MB)\n", filepath.c_str(), megabytes);
+    fprintf(MSGLOG, "    Iterations:            %d\n", iterations);
+    fprintf(MSGLOG, "    Best parse time:       %.3f ms  (%.1f MB/s)\n", bestMilliseconds, (megabytes / (bestMilliseconds / 1000.0)));
+    fprintf(MSGLOG, "    Average parse time:    %.3f ms\n", (totalMilliseconds / iterations));
+    fprintf(MSGLOG, "    Parsed:                %zu positions, %zu texCoords, %zu normals, %zu faces, %zu line segments\n",
+        lastResult.positions.size(), lastResult.texCoords.size(), lastResult.normals.size(),
+        lastResult.faces.size(), (lastResult.lineEndpoints.size() / 2u));
+    if (linesWithErrors > 0u)
+        fprintf(MSGLOG, "    Lines with errors:     %zu\n", linesWithErrors);
+    return true;
+}
+
+
+bool runObjTokenizerScalingBenchmark(const std::string& filepath, unsigned int maxThreads, int iterations) {
+    iterations = std::max(iterations, 1);
+    maxThreads = std::max(maxThreads, 1u);
+
+    const AssetLoadingInternal::AsciiAsset asset(filepath, true, true);
+    if (asset.getStoredTextLength() == 0u) {
+        fprintf(ERRLOG, "\nERROR! Unable to load the file \"%s\" for benchmarking!\n", filepath.c_str());
+        return false;
+    }
+
+    const double megabytes = ProcessMemoryStats::toMegabytes(asset.getStoredTextLength());
+    fprintf(MSGLOG, "\nObjTokenizer thread scaling benchmark\n");
+    fprintf(MSGLOG, "    File:                  %s  (%.2f MB)\n", filepath.c_str(), megabytes);
+    fprintf(MSGLOG, "    Iterations:            %d per thread count\n", iterations);
+    fprintf(MSGLOG, "    [Files are never split into chunks smaller than %zu KB]\n",
+        (AssetLoadingInternal::MIN_BYTES_PER_OBJ_PARSE_CHUNK / 1024u));
+    fprintf(MSGLOG, "    Threads   Best Time (ms)      MB/s    Speedup   Identical\n");
+
+    AssetLoadingInternal::ObjParseResult singleThreadedResult;
+    double singleThreadedMilliseconds = 0.0;
+    bool allIdentical = true;
+
+    for (unsigned int threads = 1u; threads <= maxThreads; threads++) {
+        double bestMilliseconds = std::numeric_limits<double>::max();
+        AssetLoadingInternal::ObjParseResult lastResult;
+
+        for (int i = 0; i < iterations; i++) {
+            AssetLoadingInternal::ObjParseResult result;
+
+            BenchmarkClock clock;
+            AssetLoadingInternal::tokenizeObjInParallel(asset, result, threads);
+            bestMilliseconds = std::min(bestMilliseconds, clock.elapsedMilliseconds());
+
+            lastResult = std::move(result);
+        }
+
+        bool identical = true;
+        if (threads == 1u) {
+            singleThreadedResult = std::move(lastResult);
+            singleThreadedMilliseconds = bestMilliseconds;
+        }
+        else {
+            identical = resultsAreIdentical(singleThreadedResult, lastResult);
+            allIdentical = (allIdentical && identical);
+        }
+
+        fprintf(MSGLOG, "    %7u   %14.3f   %7.1f   %7.2fx   %s\n", threads, bestMilliseconds,
+            (megabytes / (bestMilliseconds / 1000.0)), (singleThreadedMilliseconds / bestMilliseconds),
+            (identical ? "yes" : "NO!"));
+    }
+
+    if (!allIdentical)
+        fprintf(ERRLOG, "\nERROR! A multi-threaded parse did not match the single-threaded parse!\n");
+    return allIdentical;
+}
@@ -0,0 +1,33 @@
+// File:           ObjTokenizerBenchmark.h
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Measures the raw parse rate of the ObjTokenizer class that QuickObj uses to
+//                 parse '.obj' files. The file is memory-mapped through AsciiAsset once up front,
+//                 so the timed work is only the single pass over the text which fills in the 
+//                 position/texCoord/normal pools and the face and line index arrays. 
+//
+//                 Reported are the best and average time per parse along with the throughput 
+//                 (in MB/s) of the best parse and a summary of what was parsed.
+//
+//                 The scaling benchmark instead times the chunked multi-threaded parse (see 
+//                 ParallelObjTokenizer.h) at every thread count from 1 up to a maximum, and verifies
+//                 that each multi-threaded result is identical to the single-threaded one.
+
+#pragma once
+
+#ifndef OBJ_TOKENIZER_BENCHMARK_H_
+#define OBJ_TOKENIZER_BENCHMARK_H_
+
+#include <string>
+
+//Runs the benchmark on the '.obj' file at 'filepath', performing 'iterations' timed parses. Results 
+//are printed to MSGLOG. Returns false if the file could not be loaded.
+bool runObjTokenizerBenchmark(const std::string& filepath, int iterations);
+
+//Runs the scaling benchmark on the '.obj' file at 'filepath' for 1 through 'maxThreads' threads, performing
+//'iterations' timed parses at each thread count. Returns false if the file could not be loaded or if any
+//multi-threaded parse produced a result that differs from the single-threaded parse.
+bool runObjTokenizerScalingBenchmark(const std::string& filepath, unsigned int maxThreads, int iterations);
+
+#endif //OBJ_TOKENIZER_BENCHMARK_H_
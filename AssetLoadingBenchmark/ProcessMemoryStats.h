@@ -0,0 +1,82 @@
+// File:           ProcessMemoryStats.h
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Two small functions for querying how much physical memory this process is
+//                 using. Both return a size in bytes, or 0 if the platform query failed.
+//                         currentResidentSetBytes()  --  Memory resident right now
+//                         peakResidentSetBytes()     --  High-water mark over the process's lifetime
+//
+//                 Since the peak can only ever grow, comparing the peak memory use of two different
+//                 loading strategies requires running each strategy in its own process.
+//
+//                 Windows reports these as the current and peak working set sizes (through psapi). 
+//                 Linux reads the current RSS from /proc/self/statm and the peak from getrusage().
+
+#pragma once
+
+#ifndef PROCESS_MEMORY_STATS_H_
+#define PROCESS_MEMORY_STATS_H_
+
+#include <cstddef>
+#include <cstdio>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif //WIN32_LEAN_AND_MEAN
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif //NOMINMAX
+#include <Windows.h>
+#include <Psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <unistd.h>        //sysconf
+#include <sys/resource.h>  //getrusage
+#endif //_WIN32
+
+namespace ProcessMemoryStats {
+
+    inline size_t currentResidentSetBytes() {
+#ifdef _WIN32
+        PROCESS_MEMORY_COUNTERS counters;
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) 
+            return static_cast<size_t>(counters.WorkingSetSize);
+        return 0u;
+#else
+        FILE* statm = fopen("/proc/self/statm", "r");
+        if (!statm)
+            return 0u;
+        long totalPages = 0, residentPages = 0;
+        const int read = fscanf(statm, "%ld %ld", &totalPages, &residentPages);
+        fclose(statm);
+        if (read != 2)
+            return 0u;
+        return static_cast<size_t>(residentPages) * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif //_WIN32
+    }
+
+    inline size_t peakResidentSetBytes() {
+#ifdef _WIN32
+        PROCESS_MEMORY_COUNTERS counters;
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+            return static_cast<size_t>(counters.PeakWorkingSetSize);
+        return 0u;
+#else
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+            return 0u;
+#ifdef __APPLE__
+        return static_cast<size_t>(usage.ru_maxrss);           //macOS reports bytes
+#else
+        return static_cast<size_t>(usage.ru_maxrss) * 1024u;   //Linux reports kilobytes
+#endif //__APPLE__
+#endif //_WIN32
+    }
+
+    inline double toMegabytes(size_t bytes) { return (static_cast<double>(bytes) / (1024.0 * 1024.0)); }
+
+} //namespace ProcessMemoryStats
+
+#endif //PROCESS_MEMORY_STATS_H_
@@ -0,0 +1,132 @@
+// File:           SceneAssemblyBenchmark.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   Each timed build starts from an empty vector, so the time includes allocating the
+//                          scene buffer, just as it does when AssetLoadingDemo builds its scene. The vertices are
+//                          generated with some -0.0 components, since copying those over unchanged is the one
+//                          place where adding an offset of 0 could go wrong.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "SceneAssemblyBenchmark.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "SceneBufferAssembly.h"
+#include "BenchmarkHarness.h"
+#include "LoggingMessageTargets.h"
+
+using AssetLoadingInternal::SceneBufferObject;
+
+namespace {
+
+    constexpr const size_t VERTEX_SIZE = 9u;
+    constexpr const size_t MIN_OBJECT_VERTICES = 2000u;
+    constexpr const size_t MAX_OBJECT_VERTICES = 400000u;
+    constexpr const unsigned int SCENE_SEED = 20261017u;
+
+    struct Scene {
+        std::vector<std::vector<float>> objectVertices;
+        std::vector<SceneBufferObject> objects;
+        size_t vertexCount = 0u;
+    };
+
+    Scene generateScene(size_t vertexCount) {
+        std::mt19937 generator(SCENE_SEED);
+        std::uniform_int_distribution<size_t> objectSize(MIN_OBJECT_VERTICES, MAX_OBJECT_VERTICES);
+        std::uniform_real_distribution<float> component(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> offset(-500.0f, 500.0f);
+
+        Scene scene;
+        while (scene.vertexCount < vertexCount) {
+            const size_t objectVertexCount = std::min(objectSize(generator), (vertexCount - scene.vertexCount));
+            std::vector<float> vertices(objectVertexCount * VERTEX_SIZE);
+            for (size_t i = 0u; i < vertices.size(); i++)
+                vertices[i] = (((i % 97u) == 0u) ? -0.0f : component(generator));
+            scene.objectVertices.push_back(std::move(vertices));
+            scene.objects.push_back({ nullptr, objectVertexCount, { offset(generator), offset(generator), 0.0f } });
+            scene.vertexCount += objectVertexCount;
+        }
+        for (size_t object = 0u; object < scene.objects.size(); object++)
+            scene.objects[object].vertices = scene.objectVertices[object].data();
+        return scene;
+    }
+
+    //The loop AssetLoadingDemo used before the scene buffer was assembled in 2 phases
+    void buildByPushBack(const Scene& scene, std::vector<float>& sceneBuffer) {
+        sceneBuffer.reserve(scene.vertexCount * VERTEX_SIZE);
+        for (size_t object = 0u; object < scene.objects.size(); object++) {
+            const SceneBufferObject& placed = scene.objects[object];
+            int vertComponentCounter = -1;
+            for (const float value : scene.objectVertices[object]) {
+                vertComponentCounter = ((vertComponentCounter + 1) % 9);
+                if (vertComponentCounter < 3)
+                    sceneBuffer.push_back(placed.positionOffset[vertComponentCounter] + value);
+                else
+                    sceneBuffer.push_back(value);
+            }
+        }
+    }
+
+    void buildByAssembly(const Scene& scene, std::vector<float>& sceneBuffer, unsigned int threads) {
+        std::vector<size_t> firstVertices;
+        const size_t vertexCount = AssetLoadingInternal::computeSceneBufferLayout(scene.objects.data(), scene.objects.size(),
+                                                                                  firstVertices);
+        sceneBuffer.resize(vertexCount * VERTEX_SIZE);
+        AssetLoadingInternal::assembleSceneBuffer(scene.objects.data(), scene.objects.size(), firstVertices, VERTEX_SIZE,
+                                                  sceneBuffer.data(), threads);
+    }
+
+    bool isBitIdentical(const std::vector<float>& a, const std::vector<float>& b) {
+        return ((a.size() == b.size()) && ((a.empty()) || (memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0)));
+    }
+
+    void printRow(const char * method, unsigned int threads, const BenchmarkTiming& timing, size_t vertexCount,
+                  const char * identical) {
+        const double verticesPerSecond = perSecond(static_cast<double>(vertexCount), timing.bestMilliseconds());
+        const double gigabytesPerSecond = ((verticesPerSecond * VERTEX_SIZE * sizeof(float)) / 1.0e9);
+        fprintf(MSGLOG, "    %-10s  %7u  %14.3f  %13.3f  %14.0f  %11.2f  %s\n", method, threads, timing.bestMilliseconds(),
+            timing.averageMilliseconds(), verticesPerSecond, gigabytesPerSecond, identical);
+    }
+
+} //namespace
+
+
+bool runSceneAssemblyBenchmark(size_t vertexCount, int iterations) {
+    iterations = std::max(iterations, 1);
+    const Scene scene = generateScene(vertexCount);
+    printBenchmarkTitle("Scene assembly benchmark");
+    printBenchmarkSetting("Vertices:", "%zu  (%zu floats each)", scene.vertexCount, VERTEX_SIZE);
+    printBenchmarkSetting("Objects:", "%zu", scene.objects.size());
+    printBenchmarkSetting("Iterations:", "%d per method", iterations);
+
+    fprintf(MSGLOG, "\n    Method      Threads  Best Time (ms)  Avg Time (ms)      Vertices/s  GB/s Copied  Identical\n");
+    //Every build starts from an empty buffer, which is thrown away after the build's time is taken
+    std::vector<float> reference;
+    std::vector<float> sceneBuffer;
+    BenchmarkTiming pushBackTiming(iterations);
+    timeBenchmarkIterations(pushBackTiming, iterations, [&]() { buildByPushBack(scene, sceneBuffer); }, [&]() {
+        if (reference.empty())
+            reference.swap(sceneBuffer);
+        std::vector<float>().swap(sceneBuffer);
+    });
+    printRow("pushback", 1u, pushBackTiming, scene.vertexCount, "-");
+
+    bool allPassed = true;
+    for (unsigned int threads : benchmarkThreadCounts()) {
+        BenchmarkTiming timing(iterations);
+        bool identical = true;
+        timeBenchmarkIterations(timing, iterations, [&]() { buildByAssembly(scene, sceneBuffer, threads); }, [&]() {
+            identical = (identical && isBitIdentical(sceneBuffer, reference));
+            std::vector<float>().swap(sceneBuffer);
+        });
+        allPassed = (allPassed && identical);
+        printRow("assemble", threads, timing, scene.vertexCount, checkText(identical));
+    }
+    return finishBenchmark(allPassed, "An assembled scene buffer didn't match the one built a float at a time!");
+}
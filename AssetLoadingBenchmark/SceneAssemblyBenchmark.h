@@ -0,0 +1,27 @@
+// File:           SceneAssemblyBenchmark.h
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Measures putting a scene's vertices together into 1 buffer [see SceneBufferAssembly.h]. The
+//                 scene is generated from a fixed seed, as objects of anywhere from a few thousand to a few
+//                 hundred thousand vertices, each vertex laid out like QuickObj's {x,y,z,w, s,t, nx,ny,nz}.
+//
+//                 2 ways of building the buffer are timed:
+//                      pushback    --  the way AssetLoadingDemo used to, appending 1 float at a time onto a
+//                                      reserved vector and adding each object's offset to its positions as it goes
+//                      assemble    --  sizing the buffer once from the layout and then copying every object into
+//                                      it, on 1 thread and on every hardware thread
+//                 Every buffer is compared against the pushback buffer, and has to match it bit for bit.
+
+#pragma once
+
+#ifndef SCENE_ASSEMBLY_BENCHMARK_H_
+#define SCENE_ASSEMBLY_BENCHMARK_H_
+
+#include <cstddef>
+
+//Runs the benchmark on a generated scene of about 'vertexCount' vertices, performing 'iterations' timed builds
+//each way. Results are printed to MSGLOG. Returns false if any buffer didn't match.
+bool runSceneAssemblyBenchmark(size_t vertexCount, int iterations);
+
+#endif //SCENE_ASSEMBLY_BENCHMARK_H_
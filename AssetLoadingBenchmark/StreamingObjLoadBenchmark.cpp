@@ -0,0 +1,63 @@
+// File:           StreamingObjLoadBenchmark.cpp
+//
+//  See header file for details.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "StreamingObjLoadBenchmark.h"
+
+#include <algorithm>
+#include <filesystem>
+
+#include "StreamingObjLoader.h"
+#include "BenchmarkHarness.h"
+#include "ProcessMemoryStats.h"
+#include "LoggingMessageTargets.h"
+
+
+bool runStreamingObjLoadBenchmark(const std::string& filepath, StreamingObjLoadMode mode, size_t bufferKilobytes,
+                                  int iterations) {
+    iterations = std::max(iterations, 1);
+
+    std::error_code error;
+    const uintmax_t fileBytes = std::filesystem::file_size(filepath, error);
+    if (error || (fileBytes == 0u)) {
+        fprintf(ERRLOG, "\nERROR! Unable to load the file \"%s\" for benchmarking!\n", filepath.c_str());
+        return false;
+    }
+
+    const size_t bufferBytes = ((mode == StreamingObjLoadMode::WHOLE) ? static_cast<size_t>(fileBytes) :
+                                                                        (bufferKilobytes * 1024u));
+    StreamingObjLoader loader(bufferBytes);
+
+    //The checksum is printed so that the compiler is unable to optimize any of the work away
+    size_t checksum = 0u;
+    auto sink = [&checksum](const StreamedMeshBatch& batch) {
+        checksum += batch.vertexCount + batch.indexCount;
+        if (batch.indexCount > 0u)
+            checksum += batch.indices[batch.indexCount - 1u];
+    };
+
+    BenchmarkTiming timing(iterations);
+    if (!timeBenchmarkIterations(timing, iterations, [&]() { return loader.loadFile(filepath, sink); }))
+        return false;
+
+    const double megabytes = ProcessMemoryStats::toMegabytes(static_cast<size_t>(fileBytes));
+    printBenchmarkTitle("StreamingObjLoader benchmark");
+    printBenchmarkSetting("File:", "%s  (%.2f MB)", filepath.c_str(), megabytes);
+    if (mode == StreamingObjLoadMode::WHOLE)
+        printBenchmarkSetting("Mode:", "whole  (the entire file is loaded at once)");
+    else
+        printBenchmarkSetting("Mode:", "stream  (%.2f MB buffer)", ProcessMemoryStats::toMegabytes(bufferBytes));
+    printBenchmarkSetting("Iterations:", "%d", iterations);
+    printBenchmarkSetting("Best load time:", "%.3f ms  (%.1f MB/s)", timing.bestMilliseconds(),
+        perSecond(megabytes, timing.bestMilliseconds()));
+    printBenchmarkSetting("Average load time:", "%.3f ms", timing.averageMilliseconds());
+    printBenchmarkSetting("Emitted:", "%zu batches, %zu vertices, %zu indices", loader.getBatchCount(),
+        loader.getVerticesEmitted(), loader.getIndicesEmitted());
+    printBenchmarkSetting("Vertex pools:", "%.2f MB", ProcessMemoryStats::toMegabytes(loader.getVertexPoolBytes()));
+    printBenchmarkSetting("Peak resident memory:", "%.2f MB", ProcessMemoryStats::toMegabytes(ProcessMemoryStats::peakResidentSetBytes()));
+    fprintf(MSGLOG, "    [Checksum: %zu]\n", checksum);
+    return true;
+}
@@ -0,0 +1,34 @@
+// File:           StreamingObjLoadBenchmark.h
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Measures the StreamingObjLoader, which loads an '.obj' file through a fixed-size
+//                 buffer and hands the mesh data off in batches. Two modes are provided:
+//                      STREAM    --  The file is streamed through a buffer of the requested size.
+//                      WHOLE     --  The buffer is made big enough to hold the entire file, so the
+//                                    whole text, every face and the entire mesh are all in memory at
+//                                    once [which is how QuickObj loads a file].
+//                 The sink used for timing only checksums each batch, standing in for a sink that
+//                 would upload each batch to the GPU and then let it go.
+//
+//                 Reported are the best and average load time, the throughput of the best load, the
+//                 batch and vertex counts, the size of the vertex pools and the process's peak resident
+//                 memory. Because the peak is a process-wide high-water mark, run each mode in a separate
+//                 invocation when comparing peaks.
+
+#pragma once
+
+#ifndef STREAMING_OBJ_LOAD_BENCHMARK_H_
+#define STREAMING_OBJ_LOAD_BENCHMARK_H_
+
+#include <cstddef>
+#include <string>
+
+enum class StreamingObjLoadMode { STREAM, WHOLE };
+
+//Runs the benchmark on the '.obj' file at 'filepath', performing 'iterations' timed loads. 'bufferKilobytes'
+//is only used by the STREAM mode. Results are printed to MSGLOG. Returns false if the file could not be loaded.
+bool runStreamingObjLoadBenchmark(const std::string& filepath, StreamingObjLoadMode mode, size_t bufferKilobytes,
+                                  int iterations);
+
+#endif //STREAMING_OBJ_LOAD_BENCHMARK_H_
@@ -0,0 +1,395 @@
+// File:           TriangleBVHBenchmark.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   The brute force answers use the same ray/triangle test and the same box and plane
+//                          arithmetic as the BVH, so they agree exactly on which triangles are found by the box
+//                          and frustum queries. Ray hits are only compared by distance (2 triangles sharing an
+//                          edge can both be hit at the same distance), and only to within RAY_DISTANCE_TOLERANCE
+//                          since the BVH skips boxes by where a ray enters them, which is rounded differently
+//                          from where it hits a triangle.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "TriangleBVHBenchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "GlobalIncludes.h"
+#include "QuickObj.h"
+#include "TriangleBVH.h"
+#include "BenchmarkHarness.h"
+#include "LoggingMessageTargets.h"
+
+using AssetLoadingInternal::TriangleBVH;
+using AssetLoadingInternal::BVHNode;
+using AssetLoadingInternal::BVHRayHit;
+using AssetLoadingInternal::BVHFrustum;
+
+namespace {
+
+    constexpr const size_t RAYS_PER_PASS = 100000u;
+    constexpr const size_t BOXES_PER_PASS = 10000u;
+    constexpr const size_t FRUSTUMS_PER_PASS = 200u;
+    //How many of each kind of query get checked against the brute force answer
+    constexpr const size_t VERIFIED_QUERIES = 64u;
+    constexpr const unsigned int QUERY_SEED = 20261017u;
+    //Query boxes are this fraction of the size of the mesh's bounding box
+    constexpr const float QUERY_BOX_SCALE = 0.05f;
+    constexpr const float FRUSTUM_FIELD_OF_VIEW_DEGREES = 20.0f;
+    //Relative difference allowed between the BVH's closest hit and the brute force closest hit
+    constexpr const float RAY_DISTANCE_TOLERANCE = 1.0e-5f;
+
+    struct Ray {
+        float origin[3];
+        float direction[3];
+    };
+
+    struct Box {
+        float min[3];
+        float max[3];
+    };
+
+    //Every usable triangle of the mesh, for the brute force answers
+    struct ReferenceTriangle {
+        glm::vec3 corners[3];
+        uint32_t id;
+    };
+
+    struct Queries {
+        std::vector<Ray> rays;
+        std::vector<Box> boxes;
+        std::vector<BVHFrustum> frustums;
+    };
+
+    std::vector<ReferenceTriangle> gatherReferenceTriangles(const QuickObj& mesh) {
+        const size_t vertexSize = mesh.getVertexSize();
+        const size_t vertexCount = (mesh.mVertices_.size() / vertexSize);
+        const size_t cornerCount = (mesh.isIndexed() ? mesh.getIndexCount() : vertexCount);
+        auto vertexOfCorner = [&](size_t corner) -> size_t {
+            if (!mesh.isIndexed())
+                return corner;
+            return (mesh.uses16BitIndices() ? mesh.mIndices16_[corner] : mesh.mIndices32_[corner]);
+        };
+        std::vector<ReferenceTriangle> triangles;
+        for (size_t triangle = 0u; triangle < (cornerCount / 3u); triangle++) {
+            ReferenceTriangle reference;
+            reference.id = static_cast<uint32_t>(triangle);
+            bool usable = true;
+            for (size_t corner = 0u; corner < 3u; corner++) {
+                const size_t vertex = vertexOfCorner((triangle * 3u) + corner);
+                usable = (usable && (vertex < vertexCount));
+                if (!usable)
+                    break;
+                const float * position = &mesh.mVertices_[vertex * vertexSize];
+                reference.corners[corner] = glm::vec3(position[0], position[1], position[2]);
+                usable = (usable && std::isfinite(position[0]) && std::isfinite(position[1]) && std::isfinite(position[2]));
+            }
+            if (usable && (glm::cross(reference.corners[1] - reference.corners[0], reference.corners[2] - reference.corners[0]) != glm::vec3(0.0f)))
+                triangles.push_back(reference);
+        }
+        return triangles;
+    }
+
+    Queries generateQueries(const BVHNode& root) {
+        const glm::vec3 boundsMin(root.boundsMin[0], root.boundsMin[1], root.boundsMin[2]);
+        const glm::vec3 boundsMax(root.boundsMax[0], root.boundsMax[1], root.boundsMax[2]);
+        const glm::vec3 center = ((boundsMin + boundsMax) * 0.5f);
+        const glm::vec3 extent = (boundsMax - boundsMin);
+        const float radius = std::max(glm::length(extent) * 0.5f, 1.0e-6f);
+
+        std::mt19937 generator(QUERY_SEED);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        auto pointInBounds = [&]() { return (boundsMin + (glm::vec3(unit(generator), unit(generator), unit(generator)) * extent)); };
+        auto pointAround = [&](float distance) {
+            glm::vec3 direction;
+            do {
+                direction = ((glm::vec3(unit(generator), unit(generator), unit(generator)) * 2.0f) - 1.0f);
+            } while ((glm::dot(direction, direction) > 1.0f) || (glm::dot(direction, direction) < 1.0e-4f));
+            return (center + (glm::normalize(direction) * distance));
+        };
+
+        Queries queries;
+        queries.rays.resize(RAYS_PER_PASS);
+        for (Ray& ray : queries.rays) {
+            const glm::vec3 origin = pointAround(2.0f * radius);
+            const glm::vec3 direction = (pointInBounds() - origin);
+            memcpy(ray.origin, &origin[0], sizeof(ray.origin));
+            memcpy(ray.direction, &direction[0], sizeof(ray.direction));
+        }
+        queries.boxes.resize(BOXES_PER_PASS);
+        for (Box& box : queries.boxes) {
+            const glm::vec3 boxCenter = pointInBounds();
+            const glm::vec3 halfSize = (extent * (QUERY_BOX_SCALE * 0.5f));
+            for (int axis = 0; axis < 3; axis++) {
+                box.min[axis] = (boxCenter[axis] - halfSize[axis]);
+                box.max[axis] = (boxCenter[axis] + halfSize[axis]);
+            }
+        }
+        queries.frustums.resize(FRUSTUMS_PER_PASS);
+        for (BVHFrustum& frustum : queries.frustums) {
+            const glm::vec3 eye = pointAround(1.5f * radius);
+            const glm::vec3 target = pointInBounds();
+            const glm::vec3 forward = glm::normalize(target - eye);
+            const glm::vec3 up = ((std::fabs(forward.y) > 0.99f) ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f));
+            const glm::mat4 projection = glm::perspective(glm::radians(FRUSTUM_FIELD_OF_VIEW_DEGREES), 1.0f, (0.01f * radius), (4.0f * radius));
+            const glm::mat4 view = glm::lookAt(eye, target, up);
+            const glm::mat4 viewProjection = (projection * view);
+            frustum = AssetLoadingInternal::extractFrustumPlanes(glm::value_ptr(viewProjection));
+        }
+        return queries;
+    }
+
+
+    ///////////////////////////////////////////////////////////////////////
+    //////   Brute force answers
+    ///////////////////////////////////////////////////////////////////////
+
+    //The same test the BVH does, see 'intersectRayWithTriangle()' in TriangleBVH.cpp
+    bool intersectRayWithTriangle(const ReferenceTriangle& triangle, const glm::vec3& origin, const glm::vec3& direction,
+                                  float maxDistance, float& distance) {
+        const glm::vec3 edge1 = (triangle.corners[1] - triangle.corners[0]);
+        const glm::vec3 edge2 = (triangle.corners[2] - triangle.corners[0]);
+        const glm::vec3 p = glm::cross(direction, edge2);
+        const float determinant = glm::dot(edge1, p);
+        if (determinant == 0.0f)
+            return false;
+        const float inverseDeterminant = (1.0f / determinant);
+        const glm::vec3 s = (origin - triangle.corners[0]);
+        const float u = (glm::dot(s, p) * inverseDeterminant);
+        if ((u < 0.0f) || (u > 1.0f))
+            return false;
+        const glm::vec3 q = glm::cross(s, edge1);
+        const float v = (glm::dot(direction, q) * inverseDeterminant);
+        if ((v < 0.0f) || ((u + v) > 1.0f))
+            return false;
+        distance = (glm::dot(edge2, q) * inverseDeterminant);
+        return ((distance >= 0.0f) && (distance <= maxDistance));
+    }
+
+    bool castRayBruteForce(const std::vector<ReferenceTriangle>& triangles, const Ray& ray, float& closest) {
+        const glm::vec3 origin(ray.origin[0], ray.origin[1], ray.origin[2]);
+        const glm::vec3 direction(ray.direction[0], ray.direction[1], ray.direction[2]);
+        closest = std::numeric_limits<float>::max();
+        bool foundHit = false;
+        for (const ReferenceTriangle& triangle : triangles) {
+            float distance;
+            if (intersectRayWithTriangle(triangle, origin, direction, closest, distance)) {
+                closest = distance;
+                foundHit = true;
+            }
+        }
+        return foundHit;
+    }
+
+    void triangleBounds(const ReferenceTriangle& triangle, glm::vec3& min, glm::vec3& max) {
+        min = glm::min(glm::min(triangle.corners[0], triangle.corners[1]), triangle.corners[2]);
+        max = glm::max(glm::max(triangle.corners[0], triangle.corners[1]), triangle.corners[2]);
+    }
+
+    std::vector<uint32_t> findInBoxBruteForce(const std::vector<ReferenceTriangle>& triangles, const Box& box) {
+        std::vector<uint32_t> found;
+        for (const ReferenceTriangle& triangle : triangles) {
+            glm::vec3 min, max;
+            triangleBounds(triangle, min, max);
+            bool overlaps = true;
+            for (int axis = 0; axis < 3; axis++)
+                overlaps = (overlaps && (min[axis] <= box.max[axis]) && (box.min[axis] <= max[axis]));
+            if (overlaps)
+                found.push_back(triangle.id);
+        }
+        return found;
+    }
+
+    std::vector<uint32_t> findInFrustumBruteForce(const std::vector<ReferenceTriangle>& triangles, const BVHFrustum& frustum) {
+        std::vector<uint32_t> found;
+        for (const ReferenceTriangle& triangle : triangles) {
+            glm::vec3 min, max;
+            triangleBounds(triangle, min, max);
+            bool outside = false;
+            for (int plane = 0; (plane < 6) && (!outside); plane++) {
+                const float * p = frustum.planes[plane];
+                const float furthest = (((std::max(p[0] * min.x, p[0] * max.x) + std::max(p[1] * min.y, p[1] * max.y)) +
+                                         std::max(p[2] * min.z, p[2] * max.z)) + p[3]);
+                outside = (furthest < 0.0f);
+            }
+            if (!outside)
+                found.push_back(triangle.id);
+        }
+        return found;
+    }
+
+
+    ///////////////////////////////////////////////////////////////////////
+    //////   Measurements
+    ///////////////////////////////////////////////////////////////////////
+
+    bool benchmarkBuilds(const QuickObj& mesh, int iterations, TriangleBVH& bvh) {
+        fprintf(MSGLOG, "    Build    Threads  Best Time (ms)  Avg Time (ms)    Triangles/s     Nodes  Depth  SAH Cost  Identical\n");
+        std::vector<BVHNode> singleThreadedNodes;
+        bool allIdentical = true;
+        for (unsigned int threads : benchmarkThreadCounts()) {
+            BenchmarkTiming timing(iterations);
+            if (!timeBenchmarkIterations(timing, iterations, [&]() { return bvh.build(mesh, threads); }))
+                return false;
+            const std::vector<BVHNode>& nodes = bvh.getNodes();
+            if (threads == 1u)
+                singleThreadedNodes = nodes;
+            const bool identical = ((nodes.size() == singleThreadedNodes.size()) &&
+                                    (memcmp(nodes.data(), singleThreadedNodes.data(), nodes.size() * sizeof(BVHNode)) == 0));
+            allIdentical = (allIdentical && identical);
+            fprintf(MSGLOG, "    build    %7u  %14.3f  %13.3f  %13.0f  %8zu  %5zu  %8.2f  %s\n", threads, timing.bestMilliseconds(),
+                timing.averageMilliseconds(), perSecond(static_cast<double>(bvh.getTriangleCount()), timing.bestMilliseconds()),
+                nodes.size(), bvh.getDepth(), bvh.computeSAHCost(), checkText(identical));
+        }
+        return finishBenchmark(allIdentical, "Building with more threads gave a different BVH!");
+    }
+
+    void printQueryRow(const char * name, size_t queryCount, const BenchmarkTiming& timing, double averageResults, bool correct) {
+        fprintf(MSGLOG, "    %-9s  %7zu  %14.3f  %13.3f  %13.0f  %14.1f  %s\n", name, queryCount, timing.bestMilliseconds(),
+            timing.averageMilliseconds(), perSecond(static_cast<double>(queryCount), timing.bestMilliseconds()), averageResults,
+            checkText(correct));
+    }
+
+    bool benchmarkQueries(const TriangleBVH& bvh, const std::vector<ReferenceTriangle>& triangles, const Queries& queries, int iterations) {
+        fprintf(MSGLOG, "    Query      Queries  Best Time (ms)  Avg Time (ms)      Queries/s  Avg Results/Query  Correct\n");
+        bool allCorrect = true;
+
+        //Rays
+        {
+            BenchmarkTiming timing(iterations);
+            size_t hits = 0u;
+            timeBenchmarkIterations(timing, iterations, [&]() {
+                hits = 0u;
+                for (const Ray& ray : queries.rays) {
+                    BVHRayHit hit;
+                    if (bvh.castRay(ray.origin, ray.direction, std::numeric_limits<float>::max(), hit))
+                        hits++;
+                }
+            });
+            bool correct = true;
+            for (size_t i = 0u; i < std::min(VERIFIED_QUERIES, queries.rays.size()); i++) {
+                const Ray& ray = queries.rays[i];
+                BVHRayHit hit;
+                float expected = 0.0f;
+                const bool bvhHit = bvh.castRay(ray.origin, ray.direction, std::numeric_limits<float>::max(), hit);
+                const bool bruteForceHit = castRayBruteForce(triangles, ray, expected);
+                correct = (correct && (bvhHit == bruteForceHit) && ((!bvhHit) || (std::fabs(hit.distance - expected) <= (RAY_DISTANCE_TOLERANCE * expected))));
+            }
+            printQueryRow("ray", queries.rays.size(), timing, (static_cast<double>(hits) / queries.rays.size()), correct);
+            allCorrect = (allCorrect && correct);
+        }
+
+        //Occlusion
+        {
+            BenchmarkTiming timing(iterations);
+            size_t occluded = 0u;
+            timeBenchmarkIterations(timing, iterations, [&]() {
+                occluded = 0u;
+                for (const Ray& ray : queries.rays) {
+                    if (bvh.isOccluded(ray.origin, ray.direction, std::numeric_limits<float>::max()))
+                        occluded++;
+                }
+            });
+            bool correct = true;
+            for (size_t i = 0u; i < std::min(VERIFIED_QUERIES, queries.rays.size()); i++) {
+                float expected = 0.0f;
+                const Ray& ray = queries.rays[i];
+                correct = (correct && (bvh.isOccluded(ray.origin, ray.direction, std::numeric_limits<float>::max()) == castRayBruteForce(triangles, ray, expected)));
+            }
+            printQueryRow("occlusion", queries.rays.size(), timing, (static_cast<double>(occluded) / queries.rays.size()), correct);
+            allCorrect = (allCorrect && correct);
+        }
+
+        //Boxes and frustums, which both return lists of triangles
+        std::vector<uint32_t> found;
+        auto compareFound = [&found](std::vector<uint32_t> expected) {
+            std::sort(found.begin(), found.end());
+            std::sort(expected.begin(), expected.end());
+            return (found == expected);
+        };
+        {
+            BenchmarkTiming timing(iterations);
+            size_t totalFound = 0u;
+            timeBenchmarkIterations(timing, iterations, [&]() {
+                totalFound = 0u;
+                for (const Box& box : queries.boxes) {
+                    found.clear();
+                    totalFound += bvh.findTrianglesOverlappingBox(box.min, box.max, found);
+                }
+            });
+            bool correct = true;
+            for (size_t i = 0u; i < std::min(VERIFIED_QUERIES, queries.boxes.size()); i++) {
+                found.clear();
+                bvh.findTrianglesOverlappingBox(queries.boxes[i].min, queries.boxes[i].max, found);
+                correct = (correct && compareFound(findInBoxBruteForce(triangles, queries.boxes[i])));
+            }
+            printQueryRow("box", queries.boxes.size(), timing, (static_cast<double>(totalFound) / queries.boxes.size()), correct);
+            allCorrect = (allCorrect && correct);
+        }
+        {
+            BenchmarkTiming timing(iterations);
+            size_t totalFound = 0u;
+            timeBenchmarkIterations(timing, iterations, [&]() {
+                totalFound = 0u;
+                for (const BVHFrustum& frustum : queries.frustums) {
+                    found.clear();
+                    totalFound += bvh.findTrianglesInFrustum(frustum, found);
+                }
+            });
+            bool correct = true;
+            for (size_t i = 0u; i < std::min(VERIFIED_QUERIES, queries.frustums.size()); i++) {
+                found.clear();
+                bvh.findTrianglesInFrustum(queries.frustums[i], found);
+                correct = (correct && compareFound(findInFrustumBruteForce(triangles, queries.frustums[i])));
+            }
+            printQueryRow("frustum", queries.frustums.size(), timing, (static_cast<double>(totalFound) / queries.frustums.size()), correct);
+            allCorrect = (allCorrect && correct);
+        }
+
+        return finishBenchmark(allCorrect, "At least one BVH query did not match the brute force answer!");
+    }
+
+} //namespace
+
+
+bool runTriangleBVHBenchmark(const std::string& directory, size_t meshCount, int iterations) {
+    iterations = std::max(iterations, 1);
+    const std::vector<std::string> files = beginMeshFileBenchmark("TriangleBVH benchmark", directory, meshCount);
+    if (files.empty())
+        return false;
+    printBenchmarkSetting("Iterations:", "%d per build and per query pass", iterations);
+
+    bool allPassed = true;
+    size_t meshesLoaded = 0u;
+    for (const std::string& file : files) {
+        const QuickObj mesh(file, 1.0f, true, false, 0.5f, 0.5f, QuickObj::AUTOMATIC_PARSE_THREAD_COUNT,
+                            QuickObj::OutputFormat::INDEXED, false);
+        if (mesh.error()) {
+            fprintf(WRNLOG, "\nWarning! Skipping \"%s\", which failed to load!\n", file.c_str());
+            continue;
+        }
+        meshesLoaded++;
+        const std::vector<ReferenceTriangle> triangles = gatherReferenceTriangles(mesh);
+
+        fprintf(MSGLOG, "\n  %s   (%zu triangles)\n", file.c_str(), triangles.size());
+        TriangleBVH bvh;
+        if (!benchmarkBuilds(mesh, iterations, bvh)) {
+            allPassed = false;
+            continue;
+        }
+        if (bvh.empty()) {
+            fprintf(MSGLOG, "    The mesh has no triangles to query.\n");
+            continue;
+        }
+        allPassed = (benchmarkQueries(bvh, triangles, generateQueries(bvh.getNodes()[0]), iterations) && allPassed);
+    }
+    return ((meshesLoaded > 0u) && allPassed);
+}
@@ -0,0 +1,37 @@
+// File:           TriangleBVHBenchmark.h
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Measures building a TriangleBVH and querying it, on the largest '.obj' files found in a
+//                 directory (and all of its subdirectories), which is meant to be the bundled model corpus
+//                 in OpenGL_GLFW_Project/obj. Each file is loaded through QuickObj as an INDEXED mesh.
+//
+//                 Building is timed on 1 thread and on every hardware thread. The trees built by the 2 are
+//                 compared node for node, since the BVH is meant to be identical for any thread count.
+//                 Reported for each build are the best and average times, the triangles built per second,
+//                 and the shape of the tree (node count, depth and SAH cost).
+//
+//                 Then 4 kinds of queries are timed, all generated from a fixed seed so every run asks the
+//                 same questions:
+//                      ray         --  'castRay()' with rays fired from around the mesh at random points
+//                                      inside its bounding box
+//                      occlusion   --  'isOccluded()' with the same rays
+//                      box         --  'findTrianglesOverlappingBox()' with boxes 5% of the mesh's size
+//                      frustum     --  'findTrianglesInFrustum()' with narrow cameras looking at the mesh
+//                 The first few queries of each kind are also answered by testing every triangle one by one,
+//                 and the benchmark fails if the BVH ever gives a different answer.
+
+#pragma once
+
+#ifndef TRIANGLE_BVH_BENCHMARK_H_
+#define TRIANGLE_BVH_BENCHMARK_H_
+
+#include <cstddef>
+#include <string>
+
+//Runs the benchmark on the 'meshCount' largest '.obj' files under 'directory', performing 'iterations'
+//timed builds and 'iterations' timed passes over each kind of query. Results are printed to MSGLOG.
+//Returns false if no file could be loaded, or if any build or query gave a wrong result.
+bool runTriangleBVHBenchmark(const std::string& directory, size_t meshCount, int iterations);
+
+#endif //TRIANGLE_BVH_BENCHMARK_H_
@@ -0,0 +1,189 @@
+// File:           VertexWelderBenchmark.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   The files are loaded with QuickObj welding their positions with Vertex's tolerance, so
+//                          any 2 different positions in the loaded vertices are at least that far apart.
+//                          Welding them again with the same tolerance therefore has to leave exactly 1 position for
+//                          each different bit pattern [counting -0.0 as 0.0].
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "VertexWelderBenchmark.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include "QuickObj.h"
+#include "Vertex.h"
+#include "VertexWelder.h"
+#include "BenchmarkHarness.h"
+#include "LoggingMessageTargets.h"
+
+namespace {
+
+    //How many of the first positions get checked against comparing every pair
+    constexpr const size_t REFERENCE_CHECK_COUNT = 4096u;
+    //The looser tolerance, as a fraction of the largest side of the mesh's bounding box
+    constexpr const float NOISY_TOLERANCE_FRACTION = 1.0e-4f;
+    //The noise added to each component, as a fraction of the looser tolerance
+    constexpr const float NOISE_FRACTION = 0.1f;
+    constexpr const unsigned int NOISE_SEED = 20261017u;
+
+    struct Positions {
+        std::vector<float> vertices;
+        size_t vertexSize = 0u;
+
+        size_t count() const { return ((vertexSize > 0u) ? (vertices.size() / vertexSize) : 0u); }
+        const float * positionOf(size_t vertex) const { return &vertices[vertex * vertexSize]; }
+    };
+
+    bool withinTolerance(const float * a, const float * b, float tolerance) {
+        return ((std::fabs(a[0] - b[0]) < tolerance) && (std::fabs(a[1] - b[1]) < tolerance) && (std::fabs(a[2] - b[2]) < tolerance));
+    }
+
+    size_t countDifferentPositions(const Positions& positions) {
+        struct BitsHash {
+            size_t operator()(const std::array<uint32_t, 3>& bits) const noexcept {
+                return static_cast<size_t>((bits[0] * 0x9E3779B1u) ^ (bits[1] * 0x85EBCA77u) ^ (bits[2] * 0xC2B2AE3Du));
+            }
+        };
+        std::unordered_set<std::array<uint32_t, 3>, BitsHash> different;
+        different.reserve(positions.count());
+        for (size_t vertex = 0u; vertex < positions.count(); vertex++) {
+            std::array<uint32_t, 3> bits;
+            for (size_t axis = 0u; axis < 3u; axis++) {
+                memcpy(&bits[axis], positions.positionOf(vertex) + axis, sizeof(uint32_t));
+                bits[axis] = ((bits[axis] == 0x80000000u) ? 0u : bits[axis]);
+            }
+            different.insert(bits);
+        }
+        return different.size();
+    }
+
+    float largestExtent(const Positions& positions) {
+        float low[3] = { std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+        float high[3] = { std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+        for (size_t vertex = 0u; vertex < positions.count(); vertex++) {
+            for (size_t axis = 0u; axis < 3u; axis++) {
+                low[axis] = std::min(low[axis], positions.positionOf(vertex)[axis]);
+                high[axis] = std::max(high[axis], positions.positionOf(vertex)[axis]);
+            }
+        }
+        return std::max({ high[0] - low[0], high[1] - low[1], high[2] - low[2], 0.0f });
+    }
+
+    //Checks that the kept positions are numbered in order and that every welded position is within the tolerance
+    //of the position it was welded onto
+    bool checkWeld(const Positions& positions, float tolerance, const std::vector<uint32_t>& remap, size_t keptCount) {
+        if (remap.size() != positions.count())
+            return false;
+        std::vector<size_t> kept;
+        kept.reserve(keptCount);
+        for (size_t vertex = 0u; vertex < positions.count(); vertex++) {
+            if (remap[vertex] == kept.size())
+                kept.push_back(vertex);
+            else if ((remap[vertex] > kept.size()) ||
+                     (!withinTolerance(positions.positionOf(vertex), positions.positionOf(kept[remap[vertex]]), tolerance)))
+                return false;
+        }
+        return (kept.size() == keptCount);
+    }
+
+    //Welds the first positions by comparing each one to every position kept before it
+    bool checkAgainstReference(const Positions& positions, float tolerance) {
+        Positions prefix;
+        prefix.vertexSize = positions.vertexSize;
+        const size_t count = std::min(positions.count(), REFERENCE_CHECK_COUNT);
+        prefix.vertices.assign(positions.vertices.cbegin(), positions.vertices.cbegin() + (count * positions.vertexSize));
+
+        std::vector<uint32_t> remap;
+        AssetLoadingInternal::weldPositions(prefix.vertices.data(), prefix.vertexSize, count, tolerance, remap);
+
+        std::vector<size_t> kept;
+        for (size_t vertex = 0u; vertex < count; vertex++) {
+            uint32_t expected = static_cast<uint32_t>(kept.size());
+            for (size_t i = 0u; i < kept.size(); i++) {
+                if (withinTolerance(prefix.positionOf(vertex), prefix.positionOf(kept[i]), tolerance)) {
+                    expected = static_cast<uint32_t>(i);
+                    break;
+                }
+            }
+            if (expected == kept.size())
+                kept.push_back(vertex);
+            if (remap[vertex] != expected)
+                return false;
+        }
+        return true;
+    }
+
+    //Times the weld and prints one row of results. Returns true if the weld was correct.
+    bool benchmarkWeld(const char * name, const Positions& positions, float tolerance, size_t expectedKeptCount, int iterations) {
+        BenchmarkTiming timing(iterations);
+        std::vector<uint32_t> remap;
+        size_t keptCount = 0u;
+        timeBenchmarkIterations(timing, iterations, [&]() {
+            keptCount = AssetLoadingInternal::weldPositions(positions.vertices.data(), positions.vertexSize, positions.count(), tolerance, remap);
+        });
+
+        const bool correct = (checkWeld(positions, tolerance, remap, keptCount) && checkAgainstReference(positions, tolerance) &&
+                              ((expectedKeptCount == 0u) || (keptCount == expectedKeptCount)));
+        fprintf(MSGLOG, "    %-6s  %10.3e  %14.3f  %13.3f  %13.0f  %10zu  %10zu  %s\n", name, tolerance, timing.bestMilliseconds(),
+            timing.averageMilliseconds(), perSecond(static_cast<double>(positions.count()), timing.bestMilliseconds()),
+            positions.count(), keptCount, checkText(correct));
+        return correct;
+    }
+
+} //namespace
+
+
+bool runVertexWelderBenchmark(const std::string& directory, size_t meshCount, int iterations) {
+    iterations = std::max(iterations, 1);
+    const std::vector<std::string> files = beginMeshFileBenchmark("Vertex welder benchmark", directory, meshCount);
+    if (files.empty())
+        return false;
+    printBenchmarkSetting("Iterations:", "%d per weld", iterations);
+
+    const float vertexTolerance = Vertex::getFloatingPointTolerance();
+    std::mt19937 generator(NOISE_SEED);
+    bool allPassed = true;
+    size_t meshesLoaded = 0u;
+    for (const std::string& file : files) {
+        const QuickObj mesh(file, 1.0f, true, false, 0.5f, 0.5f, QuickObj::AUTOMATIC_PARSE_THREAD_COUNT,
+                            QuickObj::OutputFormat::EXPANDED, false, QuickObj::MeshOptimization::NONE, false, vertexTolerance);
+        if (mesh.error() || mesh.mVertices_.empty()) {
+            fprintf(WRNLOG, "\nWarning! Skipping \"%s\", which failed to load!\n", file.c_str());
+            continue;
+        }
+        meshesLoaded++;
+
+        Positions loaded;
+        loaded.vertexSize = mesh.getVertexSize();
+        loaded.vertices = mesh.mVertices_;
+
+        //Every component gets moved by up to a tenth of the looser tolerance
+        const float noisyTolerance = std::max(largestExtent(loaded) * NOISY_TOLERANCE_FRACTION, vertexTolerance);
+        std::uniform_real_distribution<float> noise(-NOISE_FRACTION * noisyTolerance, NOISE_FRACTION * noisyTolerance);
+        Positions noisy = loaded;
+        for (size_t vertex = 0u; vertex < noisy.count(); vertex++) {
+            for (size_t axis = 0u; axis < 3u; axis++)
+                noisy.vertices[(vertex * noisy.vertexSize) + axis] += noise(generator);
+        }
+
+        fprintf(MSGLOG, "\n  %s\n", file.c_str());
+        fprintf(MSGLOG, "\n    Weld     Tolerance  Best Time (ms)  Avg Time (ms)    Positions/s   Positions        Kept  Correct\n");
+        allPassed = (benchmarkWeld("exact", loaded, vertexTolerance, countDifferentPositions(loaded), iterations) && allPassed);
+        allPassed = (benchmarkWeld("noisy", noisy, noisyTolerance, 0u, iterations) && allPassed);
+    }
+    if (meshesLoaded == 0u)
+        return false;
+    return finishBenchmark(allPassed, "A weld kept the wrong positions or welded positions which are too far apart!");
+}
@@ -0,0 +1,33 @@
+// File:           VertexWelderBenchmark.h
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Measures welding positions together [see VertexWelder.h] on the largest '.obj' files found in
+//                 a directory (and all of its subdirectories). Each file is loaded through QuickObj as EXPANDED
+//                 vertices, so every position gets written out once for each triangle corner using it, which
+//                 is the worst case of a mesh split apart at every vertex.
+//
+//                 Each mesh is welded twice. The first weld uses Vertex's floating point tolerance on the
+//                 vertices exactly as they were loaded, which has to come out with as many positions as there
+//                 are different positions in the mesh. The second weld uses a looser tolerance [a small fraction
+//                 of the mesh's size] on a copy of the vertices with a little bit of noise added to every
+//                 position, the way an exporter splitting vertices with some floating point error would write
+//                 them out.
+//
+//                 Every position of both welds has to be within the tolerance of the position it was welded
+//                 onto, and the weld of the first few thousand positions is checked against comparing every
+//                 position to every position kept before it.
+
+#pragma once
+
+#ifndef VERTEX_WELDER_BENCHMARK_H_
+#define VERTEX_WELDER_BENCHMARK_H_
+
+#include <cstddef>
+#include <string>
+
+//Runs the benchmark on the 'meshCount' largest '.obj' files under 'directory', timing 'iterations' welds of each.
+//Results are printed to MSGLOG. Returns false if no file could be loaded, or if any weld gave a wrong result.
+bool runVertexWelderBenchmark(const std::string& directory, size_t meshCount, int iterations);
+
+#endif //VERTEX_WELDER_BENCHMARK_H_
@@ -0,0 +1,157 @@
+// File:           WireframeEdgesBenchmark.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   The reference answer welds by the same exact position bits (with -0.0 counted as 0.0),
+//                          but keys its edges by the 2 positions themselves rather than by vertex, so it doesn't
+//                          depend on which vertex the list draws each position with.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "WireframeEdgesBenchmark.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "QuickObj.h"
+#include "WireframeEdges.h"
+#include "BenchmarkHarness.h"
+#include "LoggingMessageTargets.h"
+
+using AssetLoadingInternal::WireframeRange;
+
+namespace {
+
+    typedef std::array<uint32_t, 3> PositionBits;
+    typedef std::pair<PositionBits, PositionBits> PositionEdge; //Smaller position first
+
+    //Every mesh put together the way AssetLoadingDemo puts together its scene
+    struct Scene {
+        std::vector<float> vertices;
+        size_t vertexSize = 0u;
+        std::vector<uint32_t> indices;
+        std::vector<WireframeRange> objects;
+
+        size_t vertexCount() const { return ((vertexSize > 0u) ? (vertices.size() / vertexSize) : 0u); }
+    };
+
+    bool addMeshToScene(const QuickObj& mesh, Scene& scene) {
+        const size_t vertexSize = mesh.getVertexSize();
+        if ((scene.vertexSize != 0u) && (scene.vertexSize != vertexSize))
+            return false;
+        scene.vertexSize = vertexSize;
+        const uint32_t baseVertex = static_cast<uint32_t>(scene.vertexCount());
+        const size_t meshVertexCount = (mesh.mVertices_.size() / vertexSize);
+        const size_t cornerCount = (mesh.isIndexed() ? mesh.getIndexCount() : meshVertexCount);
+
+        WireframeRange object = { scene.indices.size(), cornerCount - (cornerCount % 3u) };
+        for (size_t corner = 0u; corner < object.indexCount; corner++) {
+            uint32_t vertex = static_cast<uint32_t>(corner);
+            if (mesh.isIndexed())
+                vertex = (mesh.uses16BitIndices() ? mesh.mIndices16_[corner] : mesh.mIndices32_[corner]);
+            scene.indices.push_back(baseVertex + vertex);
+        }
+        scene.vertices.insert(scene.vertices.end(), mesh.mVertices_.cbegin(), mesh.mVertices_.cend());
+        scene.objects.push_back(object);
+        return true;
+    }
+
+    PositionBits positionOf(const Scene& scene, uint32_t vertex) {
+        PositionBits bits;
+        for (size_t axis = 0u; axis < 3u; axis++) {
+            memcpy(&bits[axis], &scene.vertices[(static_cast<size_t>(vertex) * scene.vertexSize) + axis], sizeof(uint32_t));
+            bits[axis] = ((bits[axis] == 0x80000000u) ? 0u : bits[axis]);
+        }
+        return bits;
+    }
+
+    PositionEdge makeEdge(const PositionBits& a, const PositionBits& b) {
+        return ((a < b) ? PositionEdge(a, b) : PositionEdge(b, a));
+    }
+
+    //Checks that 'edges' has every welded edge of each object exactly once, and no other edges
+    bool checkEdgesAgainstReference(const Scene& scene, const std::vector<uint32_t>& edges) {
+        size_t nextEdge = 0u;
+        for (const WireframeRange& object : scene.objects) {
+            std::set<PositionEdge> expected;
+            const uint32_t * triangles = (scene.indices.data() + object.firstIndex);
+            for (size_t triangle = 0u; triangle < (object.indexCount / 3u); triangle++) {
+                const uint32_t * corners = (triangles + (triangle * 3u));
+                if ((corners[0] >= scene.vertexCount()) || (corners[1] >= scene.vertexCount()) || (corners[2] >= scene.vertexCount()))
+                    continue;
+                for (size_t side = 0u; side < 3u; side++) {
+                    const PositionBits start = positionOf(scene, corners[side]);
+                    const PositionBits end = positionOf(scene, corners[(side + 1u) % 3u]);
+                    if (start != end)
+                        expected.insert(makeEdge(start, end));
+                }
+            }
+
+            //The object's edges are next in the list, one after the other
+            std::set<PositionEdge> found;
+            for (size_t edge = 0u; edge < expected.size(); edge++, nextEdge += 2u) {
+                if ((nextEdge + 1u) >= edges.size())
+                    return false;
+                const PositionEdge key = makeEdge(positionOf(scene, edges[nextEdge]), positionOf(scene, edges[nextEdge + 1u]));
+                if ((expected.count(key) == 0u) || (!found.insert(key).second))
+                    return false;
+            }
+        }
+        return (nextEdge == edges.size());
+    }
+
+} //namespace
+
+
+bool runWireframeEdgesBenchmark(const std::string& directory, size_t meshCount, int iterations) {
+    iterations = std::max(iterations, 1);
+    const std::vector<std::string> files = beginMeshFileBenchmark("Wireframe edges benchmark", directory, meshCount);
+    if (files.empty())
+        return false;
+    printBenchmarkSetting("Iterations:", "%d per thread count", iterations);
+
+    Scene scene;
+    for (const std::string& file : files) {
+        const QuickObj mesh(file, 1.0f, true, false, 0.5f, 0.5f, QuickObj::AUTOMATIC_PARSE_THREAD_COUNT,
+                            QuickObj::OutputFormat::INDEXED, false);
+        if (mesh.error() || (!addMeshToScene(mesh, scene))) {
+            fprintf(WRNLOG, "\nWarning! Skipping \"%s\", which failed to load!\n", file.c_str());
+            continue;
+        }
+        fprintf(MSGLOG, "    %s   (%zu triangles)\n", file.c_str(), (scene.objects.back().indexCount / 3u));
+    }
+    if (scene.objects.empty())
+        return false;
+    const size_t triangleCount = (scene.indices.size() / 3u);
+
+    std::vector<uint32_t> singleThreadedEdges;
+    bool allPassed = true;
+    fprintf(MSGLOG, "\n    Threads  Best Time (ms)  Avg Time (ms)    Triangles/s  Outline Indices  Per Triangle  Identical  Correct\n");
+    for (unsigned int threads : benchmarkThreadCounts()) {
+        BenchmarkTiming timing(iterations);
+        std::vector<uint32_t> edges;
+        timeBenchmarkIterations(timing, iterations, [&]() {
+            edges = AssetLoadingInternal::buildWireframeEdges(scene.indices.data(), scene.objects.data(), scene.objects.size(),
+                scene.vertices.data(), scene.vertexSize, scene.vertexCount(), threads);
+        });
+
+        if (threads == 1u)
+            singleThreadedEdges = edges;
+        const bool identical = (edges == singleThreadedEdges);
+        const bool correct = checkEdgesAgainstReference(scene, edges);
+        allPassed = (allPassed && identical && correct);
+
+        fprintf(MSGLOG, "    %7u  %14.3f  %13.3f  %13.0f  %15zu  %12.2f  %-9s  %s\n", threads, timing.bestMilliseconds(),
+            timing.averageMilliseconds(), perSecond(static_cast<double>(triangleCount), timing.bestMilliseconds()), edges.size(),
+            ((triangleCount > 0u) ? (static_cast<double>(edges.size()) / triangleCount) : 0.0),
+            checkText(identical), checkText(correct));
+    }
+    fprintf(MSGLOG, "\n    Outlining every triangle separately takes %zu indices (6.00 per triangle)\n", 6u * triangleCount);
+    return finishBenchmark(allPassed, "The outline edges were wrong or depended on the thread count!");
+}
@@ -0,0 +1,30 @@
+// File:           WireframeEdgesBenchmark.h
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Measures building the TRIANGLE_OUTLINE index list from unique edges [see WireframeEdges.h].
+//                 The largest '.obj' files found in a directory (and all of its subdirectories) are loaded
+//                 through QuickObj as INDEXED meshes and put together into 1 scene, each of them its own object,
+//                 the same way AssetLoadingDemo builds its scene.
+//
+//                 Building is timed on 1 thread and on every hardware thread, and the lists built by the 2 have
+//                 to be identical. Reported are the best and average times, the triangles handled per second,
+//                 and how many indices the list has compared to outlining every triangle separately.
+//
+//                 The list is also checked against a plain std::set of every triangle's welded edges: each edge
+//                 has to show up in the list exactly once, and nothing else may.
+
+#pragma once
+
+#ifndef WIREFRAME_EDGES_BENCHMARK_H_
+#define WIREFRAME_EDGES_BENCHMARK_H_
+
+#include <cstddef>
+#include <string>
+
+//Runs the benchmark on a scene of the 'meshCount' largest '.obj' files under 'directory', performing 'iterations'
+//timed builds per thread count. Results are printed to MSGLOG. Returns false if no file could be loaded, or if
+//any build gave a wrong result.
+bool runWireframeEdgesBenchmark(const std::string& directory, size_t meshCount, int iterations);
+
+#endif //WIREFRAME_EDGES_BENCHMARK_H_
@@ -14,6 +14,8 @@
 
 #include "AsciiAsset.h"
 
+#include <cstring>  //memchr
+
 namespace AssetLoadingInternal {
 
 	void AsciiAsset::initialize() {
@@ -23,32 +25,42 @@ namespace AssetLoadingInternal {
 
 		mValidFilepath_ = false;
 		mHasLocalCopyOfFileText_ = false;
+
+		mLeadingCharCounts_.fill(0);
+		mMappedFile_.reset();
+		mMemoryMapRequested_ = false;
 	}
 
 	AsciiAsset::AsciiAsset() {
 		initialize();
 	}
 
-	AsciiAsset::AsciiAsset(const char * fp, bool storeLocalCopy) {
+	AsciiAsset::AsciiAsset(const char * fp, bool storeLocalCopy, bool memoryMapFile) {
 		initialize();
 		mFilepath_ = fp;
+		mMemoryMapRequested_ = memoryMapFile;
 		mValidFilepath_ = FilepathWrapper::file_exists(mFilepath_.c_str()); 
 		if (mValidFilepath_ && storeLocalCopy) {
 			mHasLocalCopyOfFileText_ = true;
-			loadFile();
-			addNewlineToOneLineFiletexts();
+			if (!(mMemoryMapRequested_ && mapFile())) {
+				loadFile();
+				addNewlineToOneLineFiletexts();
+			}
 			parseFileText(); 
 		}
 	}
 
-	AsciiAsset::AsciiAsset(const std::string& fp, bool storeLocalCopy) {
+	AsciiAsset::AsciiAsset(const std::string& fp, bool storeLocalCopy, bool memoryMapFile) {
 		initialize();
 		mFilepath_ = fp;
+		mMemoryMapRequested_ = memoryMapFile;
 		mValidFilepath_ = FilepathWrapper::file_exists(mFilepath_.c_str());
 		if (mValidFilepath_ && storeLocalCopy) {
 			mHasLocalCopyOfFileText_ = true;
-			loadFile();
-			addNewlineToOneLineFiletexts();
+			if (!(mMemoryMapRequested_ && mapFile())) {
+				loadFile();
+				addNewlineToOneLineFiletexts();
+			}
 			parseFileText();
 		}
 	}
@@ -61,11 +73,14 @@ namespace AssetLoadingInternal {
 		
 		this->mValidFilepath_ = that.mValidFilepath_;
 		this->mHasLocalCopyOfFileText_ = that.mHasLocalCopyOfFileText_;
+		this->mMemoryMapRequested_ = that.mMemoryMapRequested_;
 		if (that.mValidFilepath_) {
 			if (that.mHasLocalCopyOfFileText_) {
 				this->mFileText_ = that.mFileText_;
+				this->mMappedFile_ = that.mMappedFile_; //Mapped text is read-only, so sharing it is safe
 				this->mFileTextLineCount_ = that.mFileTextLineCount_;
 				this->mLineOffsets_ = that.mLineOffsets_;
+				this->mLeadingCharCounts_ = that.mLeadingCharCounts_;
 			}
 		}
 		else {
@@ -80,11 +95,14 @@ namespace AssetLoadingInternal {
 		this->mFilepath_ = std::move(that.mFilepath_);
 		this->mValidFilepath_ = that.mValidFilepath_;
 		this->mHasLocalCopyOfFileText_ = that.mHasLocalCopyOfFileText_;
+		this->mMemoryMapRequested_ = that.mMemoryMapRequested_;
 		if (that.mValidFilepath_) {
 			if (that.mHasLocalCopyOfFileText_) {
 				this->mFileText_.swap(that.mFileText_);
+				this->mMappedFile_.swap(that.mMappedFile_);
 				this->mFileTextLineCount_ = that.mFileTextLineCount_;
 				this->mLineOffsets_.swap(that.mLineOffsets_);
+				this->mLeadingCharCounts_ = that.mLeadingCharCounts_;
 			} 
 			//else 'initialize()' will have already handled setting everything else
 		}
@@ -103,11 +121,14 @@ namespace AssetLoadingInternal {
 
 			this->mValidFilepath_ = that.mValidFilepath_;
 			this->mHasLocalCopyOfFileText_ = that.mHasLocalCopyOfFileText_;
+			this->mMemoryMapRequested_ = that.mMemoryMapRequested_;
 			if (that.mValidFilepath_) {
 				if (that.mHasLocalCopyOfFileText_) {
 					this->mFileText_ = that.mFileText_;
+					this->mMappedFile_ = that.mMappedFile_;
 					this->mFileTextLineCount_ = that.mFileTextLineCount_;
 					this->mLineOffsets_ = that.mLineOffsets_;
+					this->mLeadingCharCounts_ = that.mLeadingCharCounts_;
 				}
 				//else 'initialize()' will have already handled setting everything else
 			} 
@@ -127,12 +148,15 @@ namespace AssetLoadingInternal {
 			this->mFilepath_ = tempFilepathCopy.c_str();
 			this->mValidFilepath_ = that.mValidFilepath_;
 			this->mHasLocalCopyOfFileText_ = that.mHasLocalCopyOfFileText_;
+			this->mMemoryMapRequested_ = that.mMemoryMapRequested_;
 
 			if (that.mValidFilepath_) {
 				if (that.mHasLocalCopyOfFileText_) {
 					this->mFileText_ = that.mFileText_;
+					this->mMappedFile_ = that.mMappedFile_;
 					this->mFileTextLineCount_ = that.mFileTextLineCount_;
 					this->mLineOffsets_ = that.mLineOffsets_;
+					this->mLeadingCharCounts_ = that.mLeadingCharCounts_;
 				}
 			}
 			/* else { //These are not needed I believe
@@ -157,27 +181,8 @@ namespace AssetLoadingInternal {
 				"because this object does not have any stored filetext.\n", c);
 			return 0;
 		}
-
-		const char * fileText = mFileText_.c_str(); 
-		int lineCounter = 0;
-		const char * lineIter;
-
-		for (size_t i = 0; i < mLineOffsets_.size(); i++) {
-			lineIter = (fileText + mLineOffsets_[i].offset);
-			if (*lineIter == c) {
-				lineCounter++;
-			}
-			//Eat up the tabs and whitespace 
-			else if ( (*lineIter == ' ') || (*lineIter == '\t') ) { 
-				while ((*lineIter == ' ') || (*lineIter == '\t')) {
-					lineIter++;
-				} //Check for match with specified character
-				if (*lineIter == c) { 
-					lineCounter++;
-				}
-			}
-		}
-		return lineCounter;
+		//The counts are gathered by 'parseFileText()', so there is no need to rescan the text
+		return mLeadingCharCounts_[static_cast<unsigned char>(c)];
 	}
 
 	//Implementation note: This function closely matches the 'getNumberOfLinesThatBeginWith(char c)' function.
@@ -188,22 +193,16 @@ namespace AssetLoadingInternal {
 			return;
 		}
 
-		const char * fileText = mFileText_.c_str();
-		const char * lineIter;
+		const int matchingLines = mLeadingCharCounts_[static_cast<unsigned char>(c)];
+		if (matchingLines == 0) {
+			return;
+		}
+		lines.reserve(lines.size() + matchingLines);
 
+		//Only the recorded leading character of each line needs to be checked
 		for (size_t i = 0; i < mLineOffsets_.size(); i++) {
-			lineIter = (fileText + mLineOffsets_[i].offset);
-			if (*lineIter == c) {
-				lines.push_back(i);
-			}
-			//Eat up the tabs and whitespace 
-			else if ((*lineIter == ' ') || (*lineIter == '\t')) {
-				while ((*lineIter == ' ') || (*lineIter == '\t')) {
-					lineIter++;
-				} //Check for match with specified character
-				if (*lineIter == c) {
-					lines.push_back(i);
-				}
+			if (mLineOffsets_[i].leadingChar == c) {
+				lines.push_back(static_cast<int>(i));
 			}
 		}
 	}
@@ -211,7 +210,7 @@ namespace AssetLoadingInternal {
 
 	std::string AsciiAsset::getTextCopy() const {
 		if (mValidFilepath_ && mHasLocalCopyOfFileText_) {
-			return mFileText_;
+			return std::string(text());
 		}
 		else if (!mHasLocalCopyOfFileText_) {
 			std::string temp;
@@ -272,7 +271,20 @@ namespace AssetLoadingInternal {
 		}
 
 		NewLineLocation lineLocation = mLineOffsets_[line];
-		return (mFileText_.substr(lineLocation.offset, lineLocation.lineLength));
+		return std::string(text().substr(lineLocation.offset, lineLocation.lineLength));
+	}
+
+	// Precondition:
+	//			This function assumes that the member vector 'mLineOffsets_' is complete 
+	//			and up to date.
+	//Implementation note: This function is intended to be called once per line inside of tight parse 
+	//                     loops, so unlike 'getLine()' it does not print any warnings. 
+	std::string_view AsciiAsset::getLineView(int line) const {
+		if ((!mValidFilepath_) || (!mHasLocalCopyOfFileText_) || (line < 0) || (line >= mFileTextLineCount_)) {
+			return std::string_view();
+		}
+		const NewLineLocation& lineLocation = mLineOffsets_[line];
+		return text().substr(lineLocation.offset, lineLocation.lineLength);
 	}
 
 
@@ -288,8 +300,10 @@ namespace AssetLoadingInternal {
 		}
 		else {
 			mHasLocalCopyOfFileText_ = true;
-			loadFile();
-			addNewlineToOneLineFiletexts();
+			if (!(mMemoryMapRequested_ && mapFile())) {
+				loadFile();
+				addNewlineToOneLineFiletexts();
+			}
 			parseFileText();
 		}
 	}
@@ -312,6 +326,10 @@ namespace AssetLoadingInternal {
 		if (!mValidFilepath_ || !mHasLocalCopyOfFileText_) {
 			return;
 		}
+		//Mapped text is read-only, so switch over to a regular local copy before modifying anything
+		if (mMappedFile_) {
+			convertMappedTextToLocalCopy();
+		}
 		//If the text is empty
 		if (mFileText_.length() <= 1) {
 			return;
@@ -402,54 +420,79 @@ namespace AssetLoadingInternal {
 		}
 	}
 
+	//Implementation note: The rest of this class (and the parsers built on top of it) rely on every line
+	//                     ending with a '\n'. Since the mapped text can't have a newline appended to it,
+	//                     files which don't already end with one are sent down the copying path instead.
+	//                     The same goes for files with '\r\n' line endings, which the text-mode stream used
+	//                     by 'loadFile()' translates on Windows.
+	bool AsciiAsset::mapFile() {
+		auto mapping = std::make_shared<MappedFileView>(mFilepath_);
+		if (!mapping->valid()) {
+			return false;
+		}
+		const std::string_view mappedText = mapping->text();
+		if (mappedText.empty() || (mappedText.back() != '\n')) {
+			return false;
+		}
+		const size_t firstNewline = mappedText.find('\n');
+		if ((firstNewline > 0u) && (mappedText[firstNewline - 1u] == '\r')) {
+			return false;
+		}
+		mFileText_.clear();
+		mMappedFile_ = std::move(mapping);
+		return true;
+	}
+
+	void AsciiAsset::convertMappedTextToLocalCopy() {
+		if (!mMappedFile_) {
+			return;
+		}
+		mFileText_ = std::string(mMappedFile_->text());
+		mMappedFile_.reset(); //Unmaps the file (unless a copy of this object still refers to it)
+		parseFileText();
+	}
+
 	void AsciiAsset::loadFileNoLocalCopy(std::string & target) const {
 		std::ifstream inFile{ mFilepath_ }; //Open a file stream from the filepath 
 		target = { std::istreambuf_iterator<char>(inFile), std::istreambuf_iterator<char>() };
 	}
 
+	//Implementation note: This function has been rewritten to work on a string_view of the active filetext
+	//                     so that it works for both the copied and the memory-mapped text. Newlines are 
+	//                     located with memchr(), which the standard library vectorizes. The first non-blank
+	//                     character of every line is classified during this same pass.
 	void AsciiAsset::parseFileText() {
 		mLineOffsets_.clear(); //Clear any pre-existing line offset data
-		if (mFileText_.length() > 0u) {
-			int lineNumberCounter = 0;
-			std::string::iterator textIterator;
-			//Find the location of the first newLine character
-			textIterator = std::find(mFileText_.begin(), mFileText_.end(), '\n');
-			if (textIterator == mFileText_.end()) {
-				addNewlineToOneLineFiletexts(); //Add a newline to the text so that 'line 0' can be well defined
-				//Note that our iterator may have been invalidated 
-				//after modifying the string, so we must reaquire it
-				textIterator = std::find(mFileText_.begin(), mFileText_.end(), '\n');
-			}
-			//So we know at this point that we have textIterator placed on the first newline 
-			//that occurs in the file. Thus we can add position 0 as a special case (in that 
-			//it's offset isn't to a newline char) before entering the parsing loop.
-
-			//Add location 0 for line 0 to the vector
-			mLineOffsets_.emplace_back(lineNumberCounter++, 0, std::distance(mFileText_.begin(), textIterator) + 1);
-
-			//parse the rest of the lines of text
-			while ( (++textIterator) != mFileText_.end() ) { //Repeat until we run out of lines
-				std::string::iterator startOfCurrentLine = textIterator;
-				textIterator = std::find(startOfCurrentLine, mFileText_.end(), '\n');
-
-				//If we reach the end without encountering a newline
-				if (textIterator == mFileText_.end()) { 
-					textIterator--;
-					mLineOffsets_.emplace_back(lineNumberCounter++,                                      //Line number
-											   std::distance(mFileText_.begin(), startOfCurrentLine),    //Offset
-											   std::distance(startOfCurrentLine, textIterator) + 1);     //Line length
-					continue; //Next iteration will cause exit condition to trigger
-				}
-				else if (startOfCurrentLine == textIterator) { //If the line consists solely of a single newline char
-					mLineOffsets_.emplace_back(lineNumberCounter++, std::distance(mFileText_.begin(), startOfCurrentLine), 1);
-				}
-				else { //We encountered a new line that isn't at the end of the text
-					mLineOffsets_.emplace_back(lineNumberCounter++,                                      //Line number
-						                       std::distance(mFileText_.begin(), startOfCurrentLine),    //Offset
-						                       std::distance(startOfCurrentLine, textIterator) + 1);     //Line Length
-				}
+		mLeadingCharCounts_.fill(0);
+		if ((!mMappedFile_) && (mFileText_.length() > 0u) &&
+			(std::find(mFileText_.begin(), mFileText_.end(), '\n') == mFileText_.end())) {
+			addNewlineToOneLineFiletexts(); //Add a newline to the text so that 'line 0' can be well defined
+		}
+
+		const std::string_view fileText = text();
+		const char * const textBegin = fileText.data();
+		const char * const textEnd = textBegin + fileText.length();
+		const char * lineStart = textBegin;
+		int lineNumberCounter = 0;
+
+		while (lineStart < textEnd) { //Repeat until we run out of lines
+			const char * newline = static_cast<const char *>(memchr(lineStart, '\n', textEnd - lineStart));
+			//If we reach the end without encountering a newline, the last line just runs to the end of the text
+			const char * lineEnd = (newline != nullptr) ? (newline + 1) : textEnd;
+
+			//Eat up the tabs and whitespace to find the line's leading character
+			const char * firstChar = lineStart;
+			while ((firstChar < lineEnd) && ((*firstChar == ' ') || (*firstChar == '\t'))) {
+				firstChar++;
 			}
-
+			const char leadingChar = (firstChar < lineEnd) ? (*firstChar) : '\n';
+			mLeadingCharCounts_[static_cast<unsigned char>(leadingChar)]++;
+
+			mLineOffsets_.emplace_back(lineNumberCounter++,                          //Line number
+				                       static_cast<int>(lineStart - textBegin),      //Offset
+				                       static_cast<int>(lineEnd - lineStart),        //Line length
+				                       leadingChar);                                 //Leading character
+			lineStart = lineEnd;
 		}
 		mFileTextLineCount_ = mLineOffsets_.size();
 		//fprintf(MSGLOG, "\nThe file %s was parsed. This file is %u lines.\n", mFilepath_, mFileTextLineCount_);
@@ -44,6 +44,24 @@
 //                         class to verify a files existence. 
 //                         Basically this class is functional as is but it's implementation could 
 //                         desperately use an overhaul and some refactoring. 
+//
+// Memory-Mapped Mode [Added October 2026]:
+//                         Objects can optionally be constructed with 'memoryMapFile' set to true.
+//                         In this mode the file is mapped into memory through a MappedFileView instead 
+//                         of being copied into 'mFileText_', and lines can be read through 'getLineView()' 
+//                         as std::string_views that point directly into the mapped pages. This removes 
+//                         both the up-front copy of the file and the per-line std::string allocations 
+//                         performed by 'getLine()'. 
+//                         Mapped text is never modified, so the usual trailing '\n' is not appended. Files 
+//                         that do not already end with a newline (or that use '\r\n' line endings) will
+//                         silently fall back to the copying path. Calling 'removeLinesBeginningWithCharacter()'
+//                         on a mapped object will first convert it into a regular locally-stored copy.
+//
+// Line Classification:    While 'parseFileText()' builds the vector of line offsets it also records the 
+//                         first non-whitespace character of each line and keeps a running count of how 
+//                         many lines begin with each character. This lets 'getNumberOfLinesThatBeginWith()' 
+//                         answer in constant time and lets 'getLinesThatBeginWithCharacter()' avoid touching
+//                         the filetext entirely.
 
 #pragma once
 
@@ -55,12 +73,16 @@
 #include <sstream>    //for stringstream functionality (might not need this explicitly)
 #include <algorithm>  //for std::find
 #include <vector>	  //for std::vector
+#include <array>      //for std::array
+#include <memory>     //for std::shared_ptr
+#include <string_view>
 
 #include "FilepathWrapper.h"  //Really this class should use the object defined in this header for filepath 
 //                            //management, but right now this class does it's own filepath management and just
 //                            //uses a few static functions from this file. 
 
 #include "LoggingMessageTargets.h" 
+#include "MappedFileView.h"
 
 namespace AssetLoadingInternal {
 
@@ -84,7 +106,9 @@ namespace AssetLoadingInternal {
 		//     const char * fp       --  A filepath to an ASCII-encoded resource
 		//     bool storeLocalCopy   --  Dictates whether an object-local copy of
 		//                                  the resource should be acquired
-		AsciiAsset(const char * fp, bool storeLocalCopy = true);
+		//     bool memoryMapFile    --  If true (and storeLocalCopy is true), the file is 
+		//                                  memory-mapped instead of copied into a string
+		AsciiAsset(const char * fp, bool storeLocalCopy = true, bool memoryMapFile = false);
 
 		//Creates an AsciiAsset object based off the provided filepath. On
 		//construction, an attempt will be made to open the file at the provided
@@ -95,7 +119,9 @@ namespace AssetLoadingInternal {
 		//        std::string fp      --  A filepath to an ASCII-encoded resource
 		//        bool storeLocalCopy --  Dictates whether an object-local copy of
 		//                                     the resource should be acquired
-		AsciiAsset(const std::string& fp, bool storeLocalCopy = true);
+		//        bool memoryMapFile  --  If true (and storeLocalCopy is true), the file is 
+		//                                     memory-mapped instead of copied into a string
+		AsciiAsset(const std::string& fp, bool storeLocalCopy = true, bool memoryMapFile = false);
 
 		//Creates a copy of another AsciiAsset object
 		AsciiAsset(const AsciiAsset& that);
@@ -158,7 +184,8 @@ namespace AssetLoadingInternal {
 		int getNumberOfLines() const;
 		
 		//Returns the number of lines that begin with the specified character. Ignores any 
-		//Whitespace (' ') and/or Tab ('\t') characters at the start of the line. 
+		//Whitespace (' ') and/or Tab ('\t') characters at the start of the line. This is 
+		//a constant-time lookup into the line classification counts.
 		int getNumberOfLinesThatBeginWith(char c) const;
 
 		//Finds all lines that begin with the character c and stores their line number in the
@@ -178,10 +205,25 @@ namespace AssetLoadingInternal {
 		//Retrieves the line of text at the specified line. Line indexing starts at 0.
 		//Please stay in bounds.
 		std::string getLine(int line) const;
-		
+
+		//Retrieves a view of the line of text at the specified line without making a copy. The 
+		//view includes the line's trailing newline character, so code that walks the characters
+		//of the line can continue to stop on '\n'. Note that the view is NOT null-terminated. 
+		//The returned view is invalidated by any operation that modifies or replaces this object's 
+		//filetext. Line indexing starts at 0. Out-of-bounds lines return an empty view.
+		std::string_view getLineView(int line) const;
+
+		//Retrieves a view of this object's entire filetext (which always ends with a newline) without
+		//making a copy. Useful for parsers that walk the whole file in a single pass rather than
+		//going line by line. The same invalidation rules as 'getLineView()' apply.
+		std::string_view getTextView() const { return text(); }
+
 		//Gets the length of the stored file-text. Will return 0 if this object has an invalid
 		//filepath or if no local copy of the file was ever made.
-		size_t getStoredTextLength() const { return mFileText_.length(); }
+		size_t getStoredTextLength() const { return text().length(); }
+
+		//Returns true if this object's filetext is being read directly out of a memory-mapped file
+		bool isMemoryMapped() const { return (mMappedFile_ != nullptr); }
 
 
 
@@ -242,12 +284,22 @@ namespace AssetLoadingInternal {
 			int lineNumber;              //'location 0' representing line number 0
 			int offset;
 			int lineLength;
-			NewLineLocation(int number, int offset) : lineNumber(number), offset(offset) { lineLength = 0; }
-			NewLineLocation(int number, int offset, int lineLength) : lineNumber(number), offset(offset), lineLength(lineLength) { ; }
+			char leadingChar;            //First character on the line after skipping ' ' and '\t'
+			NewLineLocation(int number, int offset) : lineNumber(number), offset(offset) { lineLength = 0; leadingChar = '\n'; }
+			NewLineLocation(int number, int offset, int lineLength) : lineNumber(number), offset(offset), lineLength(lineLength) { leadingChar = '\n'; }
+			NewLineLocation(int number, int offset, int lineLength, char leadingChar) : lineNumber(number), offset(offset), lineLength(lineLength), leadingChar(leadingChar) { ; }
 		} NewLineLocation;
 		
 		std::vector<NewLineLocation> mLineOffsets_;
 
+		//Number of lines beginning with each character, indexed by the character's unsigned value
+		std::array<int, 256> mLeadingCharCounts_;
+
+		//Only used in memory-mapped mode. Shared so that copies of this object can cheaply 
+		//refer to the same mapping.
+		std::shared_ptr<const MappedFileView> mMappedFile_;
+		bool mMemoryMapRequested_;
+
 		//These next 2 variables represent the object's state
 		bool mValidFilepath_;        
 		bool mHasLocalCopyOfFileText_;
@@ -255,7 +307,11 @@ namespace AssetLoadingInternal {
 
 		//Internal Helper Functions
 		void initialize();
+		//Returns a view of whichever filetext is active (the mapped file or 'mFileText_')
+		std::string_view text() const { return (mMappedFile_ ? mMappedFile_->text() : std::string_view(mFileText_)); }
 		void loadFile();
+		bool mapFile(); //Returns false if the caller should fall back to 'loadFile()'
+		void convertMappedTextToLocalCopy(); 
 		void loadFileNoLocalCopy(std::string & target) const; //Bypasses this object's stored filetext string
 		//void checkFilepathValidity();
 		void parseFileText(); //Basically build the vector of NewLineLocations    
@@ -267,4 +323,4 @@ namespace AssetLoadingInternal {
 
 } //namespace AssetLoadingInternal 
 
-#endif ASCII_ASSET_H_
\ No newline at end of file
+#endif //ASCII_ASSET_H_
\ No newline at end of file
@@ -20,8 +20,9 @@
 //                        the same normal). This is (I think) less-than-ideal compared with per-vertex
 //                        normals, but it gets the job done just fine.
 //                     -The load times can get pretty long for larger models, there is definitely
-//                        work needed still for object loading. The current implementation is entirely
-//                        single threaded and my algorithm performs several iterations over the data to 
+//                        work needed still for object loading. [Update October 2026: Large '.obj' files
+//                        are now tokenized in chunks on multiple threads, see ParallelObjTokenizer.h. Each
+//                        model is also loaded on its own thread now, while the shaders get built.] My algorithm performs several iterations over the data to 
 //                        change it from its '.obj' storage (with Positions, Texture Coordinates and 
 //                        Normals stored in separate sections of the file) to interlaced vertices (in the 
 //                        9-component ordering of {x,y,z,w,s,t,nx,ny,nz}  [with nx, ny, nz as the normal's
@@ -30,10 +31,18 @@
 //                        potential Task-based solutions for breaking up loading to be performed concurrently.
 //                        To speed up the loading of multiple models, wrapping each model's loader object
 //                        in a 'std::packaged_task' looks promising... 
+//                     -Models are loaded as indexed meshes (vertices shared between triangles are only 
+//                        stored once) and the scene is drawn with glDrawElements(). Scenes with no more
+//                        than 65536 vertices automatically use 16-bit indices.
+//                     -Each model is simplified into a few levels of detail while it loads (see
+//                        MeshSimplifier.h), and models that are small on screen get drawn at a coarser
+//                        level. This replaces hand-decimated copies like 'AbstractShapeDecimated.obj'.
 //                     
 //                  
 // Instructions:        To change which model(s) get loaded, find the member function loadModels() and
-//                        just follow the syntax of any of the sample models that are available, 
+//                        just follow the syntax of any of the sample models that are available [models
+//                        added with 'queueModelLoad()' are loaded concurrently, the older commented out
+//                        'sceneObjects.emplace_back()' lines still work but load on the render thread], 
 //                        the only difference being to change the filepath to match the model
 //                        you want. If unsure of filepath of a model/file, click and drag+drop
 //                        the model onto this RenderDemo's mainRenderWindow while it is running, there is
@@ -174,11 +183,16 @@
 //#include <future>
 #include "AssetLoadingDemo.h"
 
+#include <algorithm>  //std::min, std::max
+#include <iterator>   //std::size
+
 //ProjectWide Header File Defining Asset Data Directories
 #include "RelativeFilepathsToResources.h"
 
 //#include "TGAImage.h" //For testing purposes
 #include "ImageData_UByte.h"
+#include "MeshOptimizer.h" //Simplified levels of detail get reordered for the vertex cache
+#include "WireframeEdges.h" //For the TRIANGLE_OUTLINE index list
 
 //The following 2 global variables can be used to define how models are to be loaded into the scene.
 //The first model loaded is translated by the vector:
@@ -226,6 +240,13 @@ void AssetLoadingDemo::initialize() {
     vao = 0U;
     sceneBufferVBO = 0U;
     triangleOutlineEBO = 0U;
+    sceneIndexEBO = 0U;
+    sceneIndexType = GL_UNSIGNED_INT;
+    sceneFullDetailIndexCount = 0u;
+    sceneObjectLodsInUse = false;
+    sceneShaderSupportsCulling = false;
+    sceneObjectCullingInUse = false;
+    compressedSceneDecodeParameters = {};
     practiceTexture = 0U;
 
     //Set the initial custom line width 
@@ -332,6 +353,9 @@ AssetLoadingDemo::~AssetLoadingDemo() noexcept {
     if (triangleOutlineEBO != 0u)
         glDeleteBuffers(1, &triangleOutlineEBO);
 
+    if (sceneIndexEBO != 0u)
+        glDeleteBuffers(1, &sceneIndexEBO);
+
     if (practiceTexture)
         glDeleteTextures(1, &practiceTexture);
 }
@@ -381,11 +405,13 @@ void AssetLoadingDemo::setAssetLoadingDemoSpecificGlobalGLContextState() const {
 void AssetLoadingDemo::loadAssets() {
     OPTICK_EVENT();
     try {
+        loadModels(); //Only queues the models, they get loaded on other threads while the shaders are built
         if (!loadShaders()) { //load the GLSL shader code
             error = true; //It will be impossible to render anything without shaders
+            queuedModelLoads.clear(); //Waits for any models still loading, their results are discarded
             return;
         }
-        loadModels(); 
+        waitForQueuedModels();
         prepareScene();
     }
     catch (const std::system_error& sysErr) {
@@ -439,55 +465,95 @@ SKIP_QUADTEXTURE_TEST_SHADER:
     sceneShader = std::make_unique<ShaderProgram>(); //Create the scene shader
 
 
-#define USE_RUBYMINE 
+    if (USE_COMPRESSED_VERTEX_FORMAT) {
+        /////////////////////////
+        ////    Compressed Vertex Shader
+        /////////////////////////
+
+        //The compressed vertices [see CompressedVertexFormat.h] have a different set of vertex attributes,
+        //so they need their own vertex shader. It is the basic AssetLoadingDemo vertex shader with the
+        //attributes decoded first, which lets it share the normal AssetLoadingDemo fragment shader.
+        sceneShader->attachVert(SHADERS_PATH + "AssetLoadingDemo_CompressedVertices.vert");
+        shaderSources.emplace_back(SHADERS_PATH + "AssetLoadingDemo_CompressedVertices.vert", true, ShaderInterface::ShaderType::VERTEX);
+        sceneShader->attachFrag(SHADERS_PATH + "AssetLoadingDemo.frag");
+        shaderSources.emplace_back(SHADERS_PATH + "AssetLoadingDemo.frag", true, ShaderInterface::ShaderType::FRAGMENT);
+
+        //Create and attach a secondary vertex shader containing the functions which decode the vertices
+        std::unique_ptr<ShaderInterface::VertexShader> vertexDecodeShader =
+            std::make_unique<ShaderInterface::VertexShader>(SHADERS_PATH + "CompressedVertexDecode.glsl");
+        vertexDecodeShader->makeSecondary();
+        sceneShader->attachSecondaryVert(vertexDecodeShader.get());
+        shaderSources.emplace_back(SHADERS_PATH + "CompressedVertexDecode.glsl", false, ShaderInterface::ShaderType::VERTEX);
+
+        //Both stages also use the noise functions
+        std::unique_ptr<ShaderInterface::VertexShader> vertexNoiseShader =
+            std::make_unique<ShaderInterface::VertexShader>(SHADERS_PATH + "ShaderNoiseFunctions.glsl");
+        vertexNoiseShader->makeSecondary();
+        sceneShader->attachSecondaryVert(vertexNoiseShader.get());
+        shaderSources.emplace_back(SHADERS_PATH + "ShaderNoiseFunctions.glsl", false, ShaderInterface::ShaderType::VERTEX);
+
+        std::unique_ptr<ShaderInterface::FragmentShader> fragmentNoiseShader =
+            std::make_unique<ShaderInterface::FragmentShader>(SHADERS_PATH + "ShaderNoiseFunctions.glsl");
+        fragmentNoiseShader->makeSecondary();
+        sceneShader->attachSecondaryFrag(fragmentNoiseShader.get());
+        shaderSources.emplace_back(SHADERS_PATH + "ShaderNoiseFunctions.glsl", false, ShaderInterface::ShaderType::FRAGMENT);
+
+        //Link while the secondary shaders are still in scope
+        sceneShader->link();
+        sceneShaderSupportsCulling = true;
+    }
+    else {
+//#define USE_RUBYMINE  //RubyMine.vert displaces its vertices along their normals and moves them around in clip
+                        //space, so the scene can't be frustum culled while it is in use
 
 #ifdef USE_RUBYMINE
-    /////////////////////////
-    ////    RubyMine Shader   (from the Internet)
-    /////////////////////////
+        /////////////////////////
+        ////    RubyMine Shader   (from the Internet)
+        /////////////////////////
     
-    //Attach the main shader stages to the sceneShader
-    sceneShader->attachVert(SHADERS_PATH + "Sample\\RubyMine.vert"); //Attach Vertex shader to scene
-    shaderSources.emplace_back(SHADERS_PATH + "Sample\\RubyMine.vert", true, ShaderInterface::ShaderType::VERTEX);
-    sceneShader->attachFrag(SHADERS_PATH + "Sample\\RubyMine.frag"); //Attach Fragment shader to scene
-    shaderSources.emplace_back(SHADERS_PATH + "Sample\\RubyMine.frag", true, ShaderInterface::ShaderType::FRAGMENT);
+        //Attach the main shader stages to the sceneShader
+        sceneShader->attachVert(SHADERS_PATH + "Sample\\RubyMine.vert"); //Attach Vertex shader to scene
+        shaderSources.emplace_back(SHADERS_PATH + "Sample\\RubyMine.vert", true, ShaderInterface::ShaderType::VERTEX);
+        sceneShader->attachFrag(SHADERS_PATH + "Sample\\RubyMine.frag"); //Attach Fragment shader to scene
+        shaderSources.emplace_back(SHADERS_PATH + "Sample\\RubyMine.frag", true, ShaderInterface::ShaderType::FRAGMENT);
     
 
 
 #else 
 
-    /////////////////////////
-    ////    Normal Shader
-    /////////////////////////
-
-    //Attach the main shader stages to the sceneShader
-    sceneShader->attachVert(SHADERS_PATH + "AssetLoadingDemo.vert"); //Attach Vertex shader to scene
-    shaderSources.emplace_back(SHADERS_PATH + "AssetLoadingDemo.vert", true, ShaderInterface::ShaderType::VERTEX);
-    sceneShader->attachFrag(SHADERS_PATH + "AssetLoadingDemo.frag"); //Attach Fragment shader to scene
-    shaderSources.emplace_back(SHADERS_PATH + "AssetLoadingDemo.frag", true, ShaderInterface::ShaderType::FRAGMENT);
-
-    // [Each shader stage requires its own set of secondary functions]
-    //Create and attach a secondary vertex shader containing implementations for some noise functions
-    std::unique_ptr<ShaderInterface::VertexShader> vertexNoiseShader =
-        std::make_unique<ShaderInterface::VertexShader>(SHADERS_PATH + "ShaderNoiseFunctions.glsl");
-    vertexNoiseShader->makeSecondary();
-    sceneShader->attachSecondaryVert(vertexNoiseShader.get());
-    shaderSources.emplace_back(SHADERS_PATH + "ShaderNoiseFunctions.glsl", false, ShaderInterface::ShaderType::VERTEX);
-    ///shaderSources.emplace_back(SHADERS_PATH + "VoronoiNoise.glsl", false, ShaderInterface::ShaderType::VERTEX);
-
-    //Create and attach a secondary fragment shader containing implementations for some noise functions 
-    std::unique_ptr<ShaderInterface::FragmentShader> fragmentNoiseShader =
-        std::make_unique<ShaderInterface::FragmentShader>(SHADERS_PATH + std::string("ShaderNoiseFunctions.glsl"));
-    fragmentNoiseShader->makeSecondary();
-    sceneShader->attachSecondaryFrag(fragmentNoiseShader.get()); //the '.get()' function converts the unique_ptr to a raw pointer
-    shaderSources.emplace_back(SHADERS_PATH + "ShaderNoiseFunctions.glsl", false, ShaderInterface::ShaderType::FRAGMENT);
-    ///shaderSources.emplace_back(SHADERS_PATH + "VoronoiNoise.glsl", false, ShaderInterface::ShaderType::FRAGMENT);
+        /////////////////////////
+        ////    Normal Shader
+        /////////////////////////
+
+        //Attach the main shader stages to the sceneShader
+        sceneShader->attachVert(SHADERS_PATH + "AssetLoadingDemo.vert"); //Attach Vertex shader to scene
+        shaderSources.emplace_back(SHADERS_PATH + "AssetLoadingDemo.vert", true, ShaderInterface::ShaderType::VERTEX);
+        sceneShader->attachFrag(SHADERS_PATH + "AssetLoadingDemo.frag"); //Attach Fragment shader to scene
+        shaderSources.emplace_back(SHADERS_PATH + "AssetLoadingDemo.frag", true, ShaderInterface::ShaderType::FRAGMENT);
+        sceneShaderSupportsCulling = true;
+
+        // [Each shader stage requires its own set of secondary functions]
+        //Create and attach a secondary vertex shader containing implementations for some noise functions
+        std::unique_ptr<ShaderInterface::VertexShader> vertexNoiseShader =
+            std::make_unique<ShaderInterface::VertexShader>(SHADERS_PATH + "ShaderNoiseFunctions.glsl");
+        vertexNoiseShader->makeSecondary();
+        sceneShader->attachSecondaryVert(vertexNoiseShader.get());
+        shaderSources.emplace_back(SHADERS_PATH + "ShaderNoiseFunctions.glsl", false, ShaderInterface::ShaderType::VERTEX);
+        ///shaderSources.emplace_back(SHADERS_PATH + "VoronoiNoise.glsl", false, ShaderInterface::ShaderType::VERTEX);
+
+        //Create and attach a secondary fragment shader containing implementations for some noise functions 
+        std::unique_ptr<ShaderInterface::FragmentShader> fragmentNoiseShader =
+            std::make_unique<ShaderInterface::FragmentShader>(SHADERS_PATH + std::string("ShaderNoiseFunctions.glsl"));
+        fragmentNoiseShader->makeSecondary();
+        sceneShader->attachSecondaryFrag(fragmentNoiseShader.get()); //the '.get()' function converts the unique_ptr to a raw pointer
+        shaderSources.emplace_back(SHADERS_PATH + "ShaderNoiseFunctions.glsl", false, ShaderInterface::ShaderType::FRAGMENT);
+        ///shaderSources.emplace_back(SHADERS_PATH + "VoronoiNoise.glsl", false, ShaderInterface::ShaderType::FRAGMENT);
 
 #endif //ifdef USE_RUBYMINE or NORMAL
 
-
-    //Now after all the stages to the shader have been created and attached, it is time to link the sceneShader
-    sceneShader->link();
+        //Now after all the stages to the shader have been created and attached, it is time to link the sceneShader
+        sceneShader->link();
+    }
     if (sceneShader->checkIfLinked()) {
         fprintf(MSGLOG, "Program Successfully linked!\n");
         fprintf(MSGLOG, "\nAll Shaders Successfully Built!\n");
@@ -719,7 +785,7 @@ void AssetLoadingDemo::loadModels() {
     //worldMeshName = "IrregularCube_SkyboxScale.obj";
 
     if (!worldMeshName.empty())
-        sceneObjects.emplace_back(std::make_unique<QuickObj>(modelsRFP + worldMeshName, 1.0f));
+        queueModelLoad(modelsRFP + worldMeshName, 1.0f);
 
 
 
@@ -765,7 +831,7 @@ void AssetLoadingDemo::loadModels() {
     //sceneObjects.emplace_back(std::make_unique<QuickObj>(modelsRFP + "SpikyStarThing.obj", 1.0f));
 
 
-    sceneObjects.emplace_back(std::make_unique<QuickObj>(R"(obj\3D_Coat_Samples\SomeSortOfThing_Painted\SomeSortOfThing.obj)", abstractShapeScale));
+    queueModelLoad(R"(obj\3D_Coat_Samples\SomeSortOfThing_Painted\SomeSortOfThing.obj)", abstractShapeScale);
 
 
     //
@@ -827,17 +893,69 @@ void AssetLoadingDemo::loadModels() {
     //Crazy Engine (Takes several minutes to load, model is over 1,000,000 triangles)
     ///sceneObjects.emplace_back(std::make_unique<QuickObj>(modelsRFP + "CrazyJetEngine.obj", 4.5f));
 
+}
+
 
-    //Report to console how many models were loaded
-    const uint64_t loadedModlCount = static_cast<uint64_t>(sceneObjects.size());
-    if (loadedModlCount == 0) 
+void AssetLoadingDemo::queueModelLoad(const std::string& filepath, float scale, QuickObj::OutputFormat outputFormat) {
+    auto loadModel = [](std::string modelFilepath, float modelScale, QuickObj::OutputFormat format) {
+        LoadedModel loaded;
+        loaded.loadStart = LocalTimepoint("Began Loading Model \"" + modelFilepath + "\"");
+        //Models without texture coordinates get random ones, like they always have in this demo [the constant
+        //(0.5, 0.5) of the OutputFormat constructor would have every untextured model sample just 1 texel]
+        //Those models skip the mesh cache and get parsed on every launch, so their texture coordinates stay random
+        loaded.model = std::make_unique<QuickObj>(modelFilepath, modelScale, true, true, 0.5f, 0.5f,
+                                                  QuickObj::AUTOMATIC_PARSE_THREAD_COUNT, format, true,
+                                                  QuickObj::MeshOptimization::VERTEX_CACHE, false, MODEL_POSITION_WELD_TOLERANCE);
+        loaded.loadEnd = LocalTimepoint("Finished Loading Model \"" + modelFilepath + "\"");
+        //The model is simplified here too so that it stays off of the render thread
+        if (GENERATE_MODEL_LODS && !loaded.model->error())
+            loaded.lods = generateModelLods(*loaded.model);
+        return loaded;
+    };
+    queuedModelLoads.push_back({ filepath, forceBeginAsyncTask(loadModel, filepath, scale, outputFormat) });
+}
+
+
+void AssetLoadingDemo::waitForQueuedModels() {
+    OPTICK_EVENT();
+    if (queuedModelLoads.empty()) {
         fprintf(MSGLOG, "\nNo models were loaded!\n");
-    else if (loadedModlCount == 1) 
-        fprintf(MSGLOG, "\n%u model has been loaded!\n", loadedModlCount);
-    else 
-        fprintf(MSGLOG, "\n%u models were loaded!\n", loadedModlCount);
-    
+        return;
+    }
+
+    const LocalTimepoint waitStart;
+    fprintf(MSGLOG, "\nModel Load Times:\n");
+    double earliestStart = 0.0, latestEnd = 0.0, sumOfLoadTimes = 0.0;
+    for (size_t i = 0u; i < queuedModelLoads.size(); i++) {
+        LoadedModel loaded = queuedModelLoads[i].result.get(); //Rethrows anything thrown while loading
+
+        //The Timepoints are only logged now that they are back on this thread
+        const Timepoint loadStart(loaded.loadStart);
+        const Timepoint loadEnd(loaded.loadEnd);
+        const double loadTime = loadEnd - loadStart;
+        earliestStart = ((i == 0u) ? loadStart.timepoint : std::min(earliestStart, loadStart.timepoint));
+        latestEnd = ((i == 0u) ? loadEnd.timepoint : std::max(latestEnd, loadEnd.timepoint));
+        sumOfLoadTimes += loadTime;
+
+        fprintf(MSGLOG, "    %9.2f ms   %s%s\n", loadTime * 1000.0, queuedModelLoads[i].filepath.c_str(),
+            (loaded.model->error() ? "   [ERROR!]" : ""));
+        if (!loaded.lods.empty()) {
+            fprintf(MSGLOG, "                 Levels of detail: %zu", loaded.model->getIndexCount() / 3u);
+            for (const AssetLoadingInternal::MeshLod& lod : loaded.lods)
+                fprintf(MSGLOG, " -> %zu", lod.indices.size() / 3u);
+            fprintf(MSGLOG, " triangles\n");
+        }
+        sceneObjects.push_back(std::move(loaded.model));
+        sceneObjectLodChains.resize(sceneObjects.size() - 1u);
+        sceneObjectLodChains.push_back(std::move(loaded.lods));
+    }
+    const size_t loadedModelCount = queuedModelLoads.size();
+    queuedModelLoads.clear();
 
+    const LocalTimepoint waitEnd;
+    fprintf(MSGLOG, "%zu model%s loaded in %.2f ms [%.2f ms if loaded one at a time]. The render thread "
+        "waited %.2f ms for them.\n", loadedModelCount, ((loadedModelCount == 1u) ? " was" : "s were"),
+        (latestEnd - earliestStart) * 1000.0, sumOfLoadTimes * 1000.0, (waitEnd - waitStart) * 1000.0);
 }
 
 void AssetLoadingDemo::prepareScene() {
@@ -850,12 +968,23 @@ void AssetLoadingDemo::prepareScene() {
 
     createSceneVBO();
     createTriangleOutlineEBO();
+    createSceneIndexEBO();
 
     fprintf(MSGLOG, "Uploading scene buffer to GPU...\n");
-    uploadSceneBufferToGPU(sceneBufferVBO, sceneBuffer);
-    configureVertexArrayAttributes(); 
+    if (USE_COMPRESSED_VERTEX_FORMAT) {
+        if (!uploadCompressedSceneBufferToGPU(sceneBufferVBO, sceneBuffer)) {
+            error = true; //The compressed vertex shader has no way to draw uncompressed vertices
+            return;
+        }
+        configureCompressedVertexArrayAttributes();
+    }
+    else {
+        uploadSceneBufferToGPU(sceneBufferVBO, sceneBuffer);
+        configureVertexArrayAttributes();
+    }
     uploadTriangleOutlineElementOrderingBufferToGPU(triangleOutlineEBO,
                                                     triangleOutlineElementOrdering);
+    uploadSceneIndexBufferToGPU(sceneIndexEBO, sceneIndexBuffer);
 }
 
 
@@ -2312,6 +2441,8 @@ void AssetLoadingDemo::renderScene() {
     ////////////////////////////
     updateFrameClearColor(); //background color
     updateBaseUniforms();
+    selectSceneObjectLods();
+    cullSceneObjects();
 
     drawVerts();
 }
@@ -2394,27 +2525,113 @@ void AssetLoadingDemo::updateBaseUniforms() noexcept {
     rotation = MathFunc::computeRotationMatrix4x4(head, pitch, roll);
     sceneShader->uniforms.updateUniformMat4x4("rotation", &rotation);
     
-    glm::mat4 MVP; //Model-View-Projection matrix 
-    MVP = perspective * (view * (rotation));
-    const glm::mat4 userTranslation = glm::mat4(1.0f, 0.0f, 0.0f, 0.0f,             //Translation from user input
-                                                0.0f, 1.0f, 0.0f, 0.0f,
-                                                0.0f, 0.0f, 1.0f, 0.0f,
-                                                xTranslation, yTranslation, zTranslation, 1.0f);
-    MVP *= userTranslation;//* MVP;
-    
-    
+    const glm::mat4 MVP = computeSceneMVP(); //Model-View-Projection matrix 
     sceneShader->uniforms.updateUniformMat4x4("MVP", &MVP);
     
     sceneShader->uniforms.updateUniform1u(CUSTOM_SHADER_PARAMETER_1_UNIFORM_NAME, customShaderParameter1);
     sceneShader->uniforms.updateUniform1u(CUSTOM_SHADER_PARAMETER_2_UNIFORM_NAME, customShaderParameter2);
     sceneShader->uniforms.updateUniform1u(CUSTOM_SHADER_PARAMETER_3_UNIFORM_NAME, customShaderParameter3);
     
+    if (USE_COMPRESSED_VERTEX_FORMAT) {
+        const CompressedVertexFormat::DecodeParameters& decode = compressedSceneDecodeParameters;
+        sceneShader->uniforms.updateUniform3f(CompressedVertexFormat::POSITION_MIN_UNIFORM_NAME,
+            decode.positionMin[0], decode.positionMin[1], decode.positionMin[2]);
+        sceneShader->uniforms.updateUniform3f(CompressedVertexFormat::POSITION_EXTENT_UNIFORM_NAME,
+            decode.positionExtent[0], decode.positionExtent[1], decode.positionExtent[2]);
+        sceneShader->uniforms.updateUniform1f(CompressedVertexFormat::SCALE_UNIFORM_NAME, decode.scale);
+    }
+}
+
+
+glm::mat4 AssetLoadingDemo::computeSceneMVP() const noexcept {
+    const glm::mat4 userTranslation = glm::mat4(1.0f, 0.0f, 0.0f, 0.0f,             //Translation from user input
+                                                0.0f, 1.0f, 0.0f, 0.0f,
+                                                0.0f, 0.0f, 1.0f, 0.0f,
+                                                xTranslation, yTranslation, zTranslation, 1.0f);
+    return (perspective * (view * (rotation)) * userTranslation);
+}
+
+
+void AssetLoadingDemo::selectSceneObjectLods() noexcept {
+    OPTICK_EVENT();
+    sceneObjectLodsInUse = false;
+    if (sceneObjectLods.empty() || (currentPrimitiveInputType != PIPELINE_PRIMITIVE_INPUT_TYPE::DISCRETE_TRIANGLES))
+        return;
+
+    int width = 1;
+    int height = 1;
+    glfwGetWindowSize(mainRenderWindow, &width, &height);
+    const float screenHeight = static_cast<float>(height);
+
+    //The shaders add 'zoom' to each position's w component, so every position is really divided by
+    //(scale + zoom). Dividing the clip space w by that same amount gives the distance to the camera,
+    //which means the radius can be used as is and the size on screen comes out to be:
+    //    (radius / distance) * (vertical focal length) * (half the screen height)  [doubled for the diameter]
+    const glm::mat4 MVP = computeSceneMVP();
+    const float focalLength = perspective[1][1];
+    const AssetLoadingInternal::BoundingVolumeSet& bounds = sceneObjectBounds;
+    for (size_t i = 0u; i < sceneObjectLods.size(); i++) {
+        SceneObjectLods& object = sceneObjectLods[i];
+        object.selectedLevel = 0u;
+        if (object.levels.size() < 2u)
+            continue;
+        const float w = (bounds.sphereX[i] * MVP[0][3]) + (bounds.sphereY[i] * MVP[1][3]) +
+                        (bounds.sphereZ[i] * MVP[2][3]) + ((bounds.w[i] + zoom) * MVP[3][3]);
+        if (w <= bounds.sphereRadius[i]) //The camera is inside of the bounding sphere
+            continue;
+        const float screenSize = (bounds.sphereRadius[i] / w) * focalLength * screenHeight;
+
+        //Triangles get denser on screen with the square of how much smaller the object gets
+        const float sizeRatio = screenSize / MODEL_LOD_FULL_DETAIL_SCREEN_SIZE;
+        const float neededTriangleRatio = sizeRatio * sizeRatio;
+        const float fullDetailTriangles = static_cast<float>(object.levels[0].count);
+        for (size_t level = object.levels.size() - 1u; level > 0u; level--) {
+            if (static_cast<float>(object.levels[level].count) >= (neededTriangleRatio * fullDetailTriangles)) {
+                object.selectedLevel = level;
+                sceneObjectLodsInUse = true;
+                break;
+            }
+        }
+    }
+}
+
+
+void AssetLoadingDemo::cullSceneObjects() {
+    OPTICK_EVENT();
+    sceneObjectCullingInUse = false;
+    if (!CULL_OBJECTS_OUTSIDE_OF_VIEW || !sceneShaderSupportsCulling || quadTextureTestShader || (sceneObjectBounds.size() == 0u))
+        return;
+    if ((currentPrimitiveInputType != PIPELINE_PRIMITIVE_INPUT_TYPE::DISCRETE_TRIANGLES) &&
+        (currentPrimitiveInputType != PIPELINE_PRIMITIVE_INPUT_TYPE::POINTS))
+        return;
+
+    const glm::mat4 MVP = computeSceneMVP();
+    AssetLoadingInternal::BVHFrustum frustum = AssetLoadingInternal::extractFrustumPlanes(glm::value_ptr(MVP));
+    //The scene shaders clamp each vertex's depth, so nothing gets clipped by the near or far planes. The only other 
+    //thing which does get clipped is whatever is behind the camera [where clip space w is negative], so the near plane
+    //is swapped for the plane through the camera and the far plane for one that every object is inside of.
+    const float behindCameraPlane[4] = { MVP[0][3], MVP[1][3], MVP[2][3], MVP[3][3] };
+    const float everythingInsidePlane[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    std::copy(std::begin(behindCameraPlane), std::end(behindCameraPlane), frustum.planes[4]);
+    std::copy(std::begin(everythingInsidePlane), std::end(everythingInsidePlane), frustum.planes[5]);
+
+    //The instances of an object can't be skipped one at a time [every instance after the first is drawn by the same 
+    //draw as the first], so each object's bounds get grown to cover wherever any of its instances could be moved to
+    float padding = 0.0f;
+    if (drawMultipleInstances)
+        padding = MAX_INSTANCE_DISPLACEMENT_PER_INSTANCE * static_cast<float>(std::max(instanceCount, 1));
+
+    //The shaders add 'zoom' to every position's w
+    const size_t visibleCount = AssetLoadingInternal::cullBoundingVolumes(frustum, sceneObjectBounds, padding, zoom,
+                                                                          sceneObjectVisibility);
+    sceneObjectCullingInUse = (visibleCount < sceneObjectBounds.size());
 }
 
 
 void AssetLoadingDemo::drawVerts() {
     OPTICK_EVENT();
-    const GLsizei BUFFER_SIZE = computeNumberOfVerticesInSceneBuffer(sceneBuffer);
+    const GLsizei INDEX_COUNT = static_cast<GLsizei>(sceneFullDetailIndexCount);
+    const GLsizei OUTLINE_INDEX_COUNT = static_cast<GLsizei>(triangleOutlineElementOrdering.size());
 
     if (quadTextureTestShader)
         quadTextureTestShader->use();
@@ -2444,56 +2661,108 @@ void glDrawElementsInstanced(	GLenum mode,
     if (currentPrimitiveInputType == PIPELINE_PRIMITIVE_INPUT_TYPE::TRIANGLE_OUTLINE) {
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, triangleOutlineEBO);
         if (drawMultipleInstances)
-            glDrawElementsInstanced(GL_LINES, 2*BUFFER_SIZE, GL_UNSIGNED_INT, (const void*)0, instanceCount);
+            glDrawElementsInstanced(GL_LINES, OUTLINE_INDEX_COUNT, GL_UNSIGNED_INT, (const void*)0, instanceCount);
         else
-            glDrawElements(GL_LINES, 2*BUFFER_SIZE, GL_UNSIGNED_INT, (const void*)0); //Last param is offset into ebo to start with
+            glDrawElements(GL_LINES, OUTLINE_INDEX_COUNT, GL_UNSIGNED_INT, (const void*)0); //Last param is offset into ebo to start with
         return;
     }
 
+    //Every other draw mode walks through the scene's vertices in the order given by the scene index buffer,
+    //which visits them in the same order they would appear in if each triangle had its own vertices. Note that
+    //indexed models have their triangles reordered for the vertex cache when they are loaded, so TRIANGLE_STRIP, 
+    //TRIANGLE_FAN, LINE and LINE_STRIP connect up the triangles in that order rather than in the file's order, and
+    //look different than they did back when the scene was drawn from expanded vertices
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, sceneIndexEBO);
+
 
     if (currentPrimitiveInputType == PIPELINE_PRIMITIVE_INPUT_TYPE::DISCRETE_TRIANGLES) {
-        if (drawMultipleInstances) 
-            glDrawArraysInstanced(GL_TRIANGLES, 0, BUFFER_SIZE, instanceCount);
+        if (sceneObjectLodsInUse || sceneObjectCullingInUse)
+            drawVisibleSceneObjects(GL_TRIANGLES);
+        else if (drawMultipleInstances) 
+            glDrawElementsInstanced(GL_TRIANGLES, INDEX_COUNT, sceneIndexType, (const void*)0, instanceCount);
         else 
-            glDrawArrays(GL_TRIANGLES, 0, BUFFER_SIZE);
+            glDrawElements(GL_TRIANGLES, INDEX_COUNT, sceneIndexType, (const void*)0);
     }
 
     else if (currentPrimitiveInputType == PIPELINE_PRIMITIVE_INPUT_TYPE::TRIANGLE_STRIP) {
         if (drawMultipleInstances) 
-            glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, BUFFER_SIZE, instanceCount);
+            glDrawElementsInstanced(GL_TRIANGLE_STRIP, INDEX_COUNT, sceneIndexType, (const void*)0, instanceCount);
         else 
-            glDrawArrays(GL_TRIANGLE_STRIP, 0, BUFFER_SIZE);
+            glDrawElements(GL_TRIANGLE_STRIP, INDEX_COUNT, sceneIndexType, (const void*)0);
     }
 
     else if (currentPrimitiveInputType == PIPELINE_PRIMITIVE_INPUT_TYPE::TRIANGLE_FAN) {
         if (drawMultipleInstances) 
-            glDrawArraysInstanced(GL_TRIANGLE_FAN, 0, BUFFER_SIZE, instanceCount);
+            glDrawElementsInstanced(GL_TRIANGLE_FAN, INDEX_COUNT, sceneIndexType, (const void*)0, instanceCount);
         else 
-            glDrawArrays(GL_TRIANGLE_FAN, 0, BUFFER_SIZE);
+            glDrawElements(GL_TRIANGLE_FAN, INDEX_COUNT, sceneIndexType, (const void*)0);
     }
 
     else if (currentPrimitiveInputType == PIPELINE_PRIMITIVE_INPUT_TYPE::LINE) {
         if (drawMultipleInstances) 
-            glDrawArraysInstanced(GL_LINES, 0, BUFFER_SIZE, instanceCount);
+            glDrawElementsInstanced(GL_LINES, INDEX_COUNT, sceneIndexType, (const void*)0, instanceCount);
         else 
-            glDrawArrays(GL_LINES, 0, BUFFER_SIZE);
+            glDrawElements(GL_LINES, INDEX_COUNT, sceneIndexType, (const void*)0);
     }
 
     else if (currentPrimitiveInputType == PIPELINE_PRIMITIVE_INPUT_TYPE::LINE_STRIP) {
         if (drawMultipleInstances) 
-            glDrawArraysInstanced(GL_LINE_STRIP, 0, BUFFER_SIZE, instanceCount);
+            glDrawElementsInstanced(GL_LINE_STRIP, INDEX_COUNT, sceneIndexType, (const void*)0, instanceCount);
         else 
-            glDrawArrays(GL_LINE_STRIP, 0, BUFFER_SIZE);
+            glDrawElements(GL_LINE_STRIP, INDEX_COUNT, sceneIndexType, (const void*)0);
     }
 
     else if (currentPrimitiveInputType == PIPELINE_PRIMITIVE_INPUT_TYPE::POINTS) {
-        if (drawMultipleInstances) 
-            glDrawArraysInstanced(GL_POINTS, 0, BUFFER_SIZE, instanceCount);
+        if (sceneObjectCullingInUse)
+            drawVisibleSceneObjects(GL_POINTS);
+        else if (drawMultipleInstances) 
+            glDrawElementsInstanced(GL_POINTS, INDEX_COUNT, sceneIndexType, (const void*)0, instanceCount);
         else 
-            glDrawArrays(GL_POINTS, 0, BUFFER_SIZE);
+            glDrawElements(GL_POINTS, INDEX_COUNT, sceneIndexType, (const void*)0);
     }
 }
 
+void AssetLoadingDemo::drawVisibleSceneObjects(GLenum primitiveMode) noexcept {
+    OPTICK_EVENT();
+    const size_t indexSize = ((sceneIndexType == GL_UNSIGNED_SHORT) ? sizeof(GLushort) : sizeof(GLuint));
+    sceneDrawCounts.clear();
+    sceneDrawOffsets.clear();
+    IndexRange merged = { 0u, 0u };
+    auto addDraw = [&](const IndexRange& range) {
+        if (range.count == 0u)
+            return;
+        sceneDrawCounts.push_back(static_cast<GLsizei>(range.count));
+        sceneDrawOffsets.push_back(reinterpret_cast<const void*>(range.first * indexSize)); //Byte offset into the ebo
+    };
+
+    //Every object's full detail range follows right after the previous object's, so when most objects are drawn
+    //at full detail they come out to just a few ranges
+    for (size_t i = 0u; i < sceneObjectLods.size(); i++) {
+        if (sceneObjectCullingInUse && (sceneObjectVisibility[i] == 0u))
+            continue;
+        const SceneObjectLods& object = sceneObjectLods[i];
+        const IndexRange& range = object.levels[sceneObjectLodsInUse ? object.selectedLevel : 0u];
+        if ((merged.count != 0u) && ((merged.first + merged.count) == range.first)) {
+            merged.count += range.count;
+            continue;
+        }
+        addDraw(merged);
+        merged = range;
+    }
+    addDraw(merged);
+    if (sceneDrawCounts.empty())
+        return;
+
+    //There is no instanced version of glMultiDrawElements(), so instanced ranges are drawn one at a time
+    if (drawMultipleInstances) {
+        for (size_t i = 0u; i < sceneDrawCounts.size(); i++)
+            glDrawElementsInstanced(primitiveMode, sceneDrawCounts[i], sceneIndexType, sceneDrawOffsets[i], instanceCount);
+    }
+    else
+        glMultiDrawElements(primitiveMode, sceneDrawCounts.data(), sceneIndexType, sceneDrawOffsets.data(),
+                            static_cast<GLsizei>(sceneDrawCounts.size()));
+}
+
 void AssetLoadingDemo::presentFrame() {
     OPTICK_EVENT();
 
@@ -2618,35 +2887,39 @@ void AssetLoadingDemo::generateTriangleOutlineElementOrdering() noexcept {
     //  triangle and line segment diagrams.
     //
 
-    //  The task of this function is to generate an ascending sequence of numbers 
-    //  following the pattern mentioned above until we have created values        
-    //  twice the size of the vertex data in the vertex buffer.                   
+    //  Outlining every triangle like this draws each edge once for every triangle
+    //  which shares it though, and nearly every edge of a typical model is shared
+    //  by 2 triangles [or more, counting the triangles on the other side of a UV
+    //  seam, which touch the same edge through their own copies of its vertices].
+    //  So instead each object's vertices are welded by position, and each edge
+    //  between 2 welded positions is only added the first time a triangle uses it.
+    //  This draws the same picture from about half as many indices.
+    //
+    //  The task of this function is to build that list of unique edges from the
+    //  scene's full detail indices [the levels of detail are never outlined]. Since
+    //  the scene is drawn as an indexed mesh, 'v0', 'v1', 'v2', etc. are each
+    //  looked up from the scene index buffer. Each object gets its edges found on
+    //  its own, spread across threads, with the objects' edges put back together in
+    //  the same order they are in the scene [see WireframeEdges.h].
     //
 
 
     std::vector<GLuint> vertexOrderingForTriangleOutline;
 
-
-    const GLsizei numberOfVerticesInSceneBuffer = computeNumberOfVerticesInSceneBuffer(sceneBuffer);
-
-    //The number of elements required is always twice the number of vertices in the sceneBuffer
-    const GLsizei elementsToGenerate = 2u * numberOfVerticesInSceneBuffer;
+    const size_t trianglesInScene = sceneFullDetailIndexCount / 3u;
     try {
-        vertexOrderingForTriangleOutline.reserve(elementsToGenerate);
-        for (GLsizei i = 0; i < elementsToGenerate; i += 3) {//numberOfVerticesInSceneBuffer; i += TRIANGLE_SIDES_AMOUNTAGE) {
-
-            //Triangle side 1
-            vertexOrderingForTriangleOutline.push_back(i);
-            vertexOrderingForTriangleOutline.push_back(i + 1);
-
-            //Triangle side 2
-            vertexOrderingForTriangleOutline.push_back(i + 1);
-            vertexOrderingForTriangleOutline.push_back(i + 2);
-
-            //Triangle side 3
-            vertexOrderingForTriangleOutline.push_back(i + 2);
-            vertexOrderingForTriangleOutline.push_back(i);
+        std::vector<AssetLoadingInternal::WireframeRange> objectRanges;
+        objectRanges.reserve(sceneObjectLods.size());
+        for (const SceneObjectLods& object : sceneObjectLods) {
+            if (!object.levels.empty())
+                objectRanges.push_back({ object.levels[0].first, object.levels[0].count });
         }
+        static constexpr const size_t vertexSize = 4u + 2u + 3u;
+        vertexOrderingForTriangleOutline = AssetLoadingInternal::buildWireframeEdges(sceneIndexBuffer.data(),
+            objectRanges.data(), objectRanges.size(), sceneBuffer.data(), vertexSize,
+            static_cast<size_t>(computeNumberOfVerticesInSceneBuffer(sceneBuffer)));
+        fprintf(MSGLOG, "Triangle outlines are drawn with %zu indices [%zu if each triangle were outlined separately]\n",
+            vertexOrderingForTriangleOutline.size(), 6u * trianglesInScene);
     }
     catch (const std::exception & e) {
         try { //Compiler was griping that 'e.what()' might throw an exception
@@ -2729,35 +3002,35 @@ void AssetLoadingDemo::buildSceneBufferFromLoadedSceneObjects() {
 
     //Compute the scene size
     size_t sceneSize = 0u;
+    size_t sceneIndexCount = 0u;
     for (auto objIter = sceneObjects.begin(); objIter != sceneObjects.end(); objIter++) {     
         sceneSize += (*objIter)->mVertices_.size();             
+        if ((*objIter)->isIndexed())
+            sceneIndexCount += (*objIter)->getIndexCount();
+        else 
+            sceneIndexCount += computeNumberOfVerticesInSceneBuffer((*objIter)->mVertices_);
+    }
+    for (const auto& lodChain : sceneObjectLodChains) {
+        for (const AssetLoadingInternal::MeshLod& lod : lodChain)
+            sceneIndexCount += lod.indices.size();
     }
     
     
-    //Reserve that much space
-    fprintf(MSGLOG, "\nCalculated the final scene size as being %u floating point values!\n\n", sceneSize);
-    sceneBuffer.reserve(sceneSize); 
-
     if (sceneSize == 0)
         return;
 
-    //Get an iterator to the first member of the sceneObject vector
-    auto sceneObjIter = sceneObjects.cbegin();
-    //Place the first object in the scene at the origin
-    addObject(sceneObjIter, glm::vec3(0.0f, 0.0f, 0.0f));
-    sceneObjIter++;
-    objectCounter++;
-    fprintf(MSGLOG, "\tAdding Object 0 to scene...\n");
-    fprintf(MSGLOG, "\t\tPosition of Object 0:   <0.0f, 0.0f, 0.0f>\n");
-
-    //Iterate through each object in the sceneObjects vector
-    for ( ; sceneObjIter != sceneObjects.cend(); sceneObjIter++) {
-        objectCounter++;
-
-        //Objects missing Normal and/or Texture Coordinates will need to have data generated for them
-        //so that all vertices in the scene share the same format
-
-        
+    //Work out where each object goes in the scene before any of them get copied
+    std::vector<AssetLoadingInternal::SceneBufferObject> placedObjects;
+    placedObjects.reserve(sceneObjects.size());
+    for (auto sceneObjIter = sceneObjects.cbegin(); sceneObjIter != sceneObjects.cend(); sceneObjIter++) {
+        const size_t objectVertexCount = static_cast<size_t>(computeNumberOfVerticesInSceneBuffer((*sceneObjIter)->mVertices_));
+        if (objectCounter++ == 0) {
+            //Place the first object in the scene at the origin
+            fprintf(MSGLOG, "\tAdding Object 0 to scene...\n");
+            fprintf(MSGLOG, "\t\tPosition of Object 0:   <0.0f, 0.0f, 0.0f>\n");
+            placedObjects.push_back({ (*sceneObjIter)->mVertices_.data(), objectVertexCount, { 0.0f, 0.0f, 0.0f } });
+            continue;
+        }
 
         //Increment offset to prepare for the next object
         objectPositionOffset.x += CHANGE_BETWEEN_OBJECTS.x + MathFunc::getRandomInRangef(-12.0f, 12.0f);
@@ -2769,42 +3042,117 @@ void AssetLoadingDemo::buildSceneBufferFromLoadedSceneObjects() {
         fprintf(MSGLOG, "\tAdding Object %d to scene...\n", objectCounter);
         fprintf(MSGLOG, "\t\tPosition of Object %d:   <%3.3f, %3.3f, %3.3f>\n", objectCounter,
             objectPositionOffset.x, objectPositionOffset.y, objectPositionOffset.z);
-    
-        addObject(sceneObjIter, objectPositionOffset);
-    }
-
-    
+        placedObjects.push_back({ (*sceneObjIter)->mVertices_.data(), objectVertexCount,
+            { objectPositionOffset.x, objectPositionOffset.y, objectPositionOffset.z } });
+    }
+
+    //The sceneBuffer is sized once up front and then filled in by the copy, which is split across threads
+    std::vector<size_t> firstVertices;
+    const size_t sceneVertexCount = AssetLoadingInternal::computeSceneBufferLayout(placedObjects.data(), placedObjects.size(),
+                                                                                   firstVertices);
+    static constexpr const size_t vertexSize = 4u + 2u + 3u;  //Each vertex is {x,y,z,w, s,t, nx,ny,nz}
+    fprintf(MSGLOG, "\nCalculated the final scene size as being %zu floating point values!\n\n", sceneVertexCount * vertexSize);
+    sceneBuffer.resize(sceneVertexCount * vertexSize);
+    sceneIndexBuffer.reserve(sceneIndexCount);
+    AssetLoadingInternal::assembleSceneBuffer(placedObjects.data(), placedObjects.size(), firstVertices, vertexSize,
+                                              sceneBuffer.data());
+
+    size_t objectIndex = 0u;
+    for (auto sceneObjIter = sceneObjects.cbegin(); sceneObjIter != sceneObjects.cend(); sceneObjIter++, objectIndex++)
+        addObject(sceneObjIter, static_cast<GLuint>(firstVertices[objectIndex]));
+    sceneFullDetailIndexCount = sceneIndexBuffer.size();
+    addSceneObjectLods();
+
+    //16-bit indices are enough to address every vertex in smaller scenes, and take half the space
+    if (computeNumberOfVerticesInSceneBuffer(sceneBuffer) <= 65536)
+        sceneIndexType = GL_UNSIGNED_SHORT;
+    else
+        sceneIndexType = GL_UNSIGNED_INT;
+    fprintf(MSGLOG, "\nThe scene has %d unique vertices which are drawn using %zu indices!\n",
+        computeNumberOfVerticesInSceneBuffer(sceneBuffer), sceneFullDetailIndexCount);
+    if (sceneIndexBuffer.size() > sceneFullDetailIndexCount)
+        fprintf(MSGLOG, "Another %zu indices describe the scene's simplified levels of detail!\n",
+            sceneIndexBuffer.size() - sceneFullDetailIndexCount);
 }
 
 
 
-//If the object already has both normals and texCoords, then all that is needed to be modified is 
-//the object's position
 void AssetLoadingDemo::addObject(std::vector<std::unique_ptr<QuickObj>>::const_iterator object,
-    const glm::vec3& objPos) {
+    GLuint baseVertex) {
     OPTICK_EVENT();
-    int vertComponentCounter = -1; //variable will be incremented to '0' on start of first loop iteration
-
-    auto vertsEnd = (*object)->mVertices_.cend(); //Create a variable for loop exit condition
-    for (auto vertIter = (*object)->mVertices_.cbegin(); vertIter != vertsEnd; vertIter++) {
-        vertComponentCounter = ((vertComponentCounter + 1) % 9);
-        if (vertComponentCounter == 0) {
-            //Add x offset then add to vector
-            sceneBuffer.push_back(objPos.x + (*vertIter));
-        }
-        else if (vertComponentCounter == 1) {
-            //Add y offset then add to vector
-            sceneBuffer.push_back(objPos.y + (*vertIter));
-        }
-        else if (vertComponentCounter == 2) {
-            //Add z offset then add to vector
-            sceneBuffer.push_back(objPos.z + (*vertIter));
+    SceneObjectLods objectLods;
+    objectLods.baseVertex = baseVertex;
+    objectLods.levels.push_back({ sceneIndexBuffer.size(), 0u });
+    addObjectIndices(object, baseVertex);
+    objectLods.levels[0].count = sceneIndexBuffer.size() - objectLods.levels[0].first;
+    objectLods.selectedLevel = 0u;
+
+    //The object's bounds are measured where it was placed in the scene, with its scale as the w of its positions
+    static constexpr const size_t vertexSize = 9u;
+    const size_t objectStart = static_cast<size_t>(baseVertex) * vertexSize;
+    sceneObjectBounds.addObject(sceneBuffer.data() + objectStart, vertexSize, (*object)->mVertices_.size() / vertexSize,
+                                (*object)->getScale());
+    sceneObjectLods.push_back(std::move(objectLods));
+}
+
+
+void AssetLoadingDemo::addObjectIndices(std::vector<std::unique_ptr<QuickObj>>::const_iterator object,
+    GLuint baseVertex) {
+    if ((*object)->isIndexed()) {
+        if ((*object)->uses16BitIndices()) {
+            for (const uint16_t index : (*object)->mIndices16_)
+                sceneIndexBuffer.push_back(baseVertex + index);
         }
         else {
-            //add the vertex data straight to vector
-            sceneBuffer.push_back(*vertIter);
+            for (const uint32_t index : (*object)->mIndices32_)
+                sceneIndexBuffer.push_back(baseVertex + index);
         }
     }
+    else { //Objects which were not indexed just have their vertices drawn in order
+        const GLuint vertexCount = static_cast<GLuint>(computeNumberOfVerticesInSceneBuffer((*object)->mVertices_));
+        for (GLuint i = 0u; i < vertexCount; i++)
+            sceneIndexBuffer.push_back(baseVertex + i);
+    }
+}
+
+
+void AssetLoadingDemo::addSceneObjectLods() {
+    OPTICK_EVENT();
+    for (size_t i = 0u; (i < sceneObjectLodChains.size()) && (i < sceneObjectLods.size()); i++) {
+        SceneObjectLods& object = sceneObjectLods[i];
+        for (const AssetLoadingInternal::MeshLod& lod : sceneObjectLodChains[i]) {
+            object.levels.push_back({ sceneIndexBuffer.size(), lod.indices.size() });
+            for (const uint32_t index : lod.indices)
+                sceneIndexBuffer.push_back(object.baseVertex + index);
+        }
+    }
+    //The indices now live in the sceneIndexBuffer
+    sceneObjectLodChains.clear();
+}
+
+
+std::vector<AssetLoadingInternal::MeshLod> AssetLoadingDemo::generateModelLods(const QuickObj& model) {
+    if (!model.isIndexed())
+        return {};
+    std::vector<uint32_t> indices;
+    if (model.uses16BitIndices())
+        indices.assign(model.mIndices16_.cbegin(), model.mIndices16_.cend());
+    else
+        indices = model.mIndices32_;
+
+    //Every vertex is {x,y,z,w, s,t, nx,ny,nz}
+    AssetLoadingInternal::MeshSimplificationSettings settings;
+    settings.vertexStride = 9u;
+    settings.texCoordOffset = 4u;
+    settings.normalOffset = 6u;
+    const size_t vertexCount = model.mVertices_.size() / settings.vertexStride;
+    std::vector<AssetLoadingInternal::MeshLod> lods =
+        AssetLoadingInternal::buildLodChain(indices.data(), indices.size(), model.mVertices_.data(), vertexCount,
+            MODEL_LOD_TRIANGLE_RATIOS, std::size(MODEL_LOD_TRIANGLE_RATIOS), settings);
+    //Simplifying leaves the triangles scattered, so they get put back into an order that suits the vertex cache
+    for (AssetLoadingInternal::MeshLod& lod : lods)
+        AssetLoadingInternal::optimizeVertexCache(lod.indices.data(), lod.indices.size(), vertexCount);
+    return lods;
 }
 
 
@@ -2825,6 +3173,14 @@ void AssetLoadingDemo::createTriangleOutlineEBO() noexcept {
 }
 
 
+void AssetLoadingDemo::createSceneIndexEBO() noexcept {
+
+    glGenBuffers(1, &sceneIndexEBO);
+    fprintf(MSGLOG, "\nCreated an element buffer object to store the scene's vertex indices. (BufferID = %u)\n\n",
+        sceneIndexEBO);
+}
+
+
 void AssetLoadingDemo::uploadSceneBufferToGPU(GLuint& targetVBO, const std::vector<float>& sceneBuf) noexcept {
     OPTICK_EVENT();
     //if (sceneBuf.size() == 0u)
@@ -2888,6 +3244,36 @@ void AssetLoadingDemo::uploadTriangleOutlineElementOrderingBufferToGPU(GLuint& e
 
 
 
+void AssetLoadingDemo::uploadSceneIndexBufferToGPU(GLuint& ebo, const std::vector<GLuint>& indices) noexcept {
+    OPTICK_EVENT();
+    if (0u == ebo) {
+        fprintf(WRNLOG, "\n\tWARNING!\nUnable to Upload Scene Index Buffer to GPU because EBO was\n"
+            "never created with GL context!\n");
+        return;
+    }
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+
+    fprintf(MSGLOG, "\nTransferring the scene's indices from the Application to the GPU.\n"
+        "Target destination on GPU is set to use Element Array Buffer ID %u.\n", ebo);
+    fprintf(MSGLOG, "  [TRANSFER STATISTICS]\n");
+
+    if (sceneIndexType == GL_UNSIGNED_SHORT) {
+        std::vector<GLushort> narrowedIndices;
+        narrowedIndices.reserve(indices.size());
+        for (const GLuint index : indices)
+            narrowedIndices.push_back(static_cast<GLushort>(index));
+        fprintf(MSGLOG, "There are %zu indices total in the scene, stored as GL_UNSIGNED_SHORT values\n\n", narrowedIndices.size());
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLushort) * narrowedIndices.size(), narrowedIndices.data(), GL_STATIC_DRAW);
+    }
+    else {
+        fprintf(MSGLOG, "There are %zu indices total in the scene, stored as GL_UNSIGNED_INT values\n\n", indices.size());
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLuint) * indices.size(), indices.data(), GL_STATIC_DRAW);
+    }
+}
+
+
+
 void AssetLoadingDemo::configureVertexArrayAttributes() noexcept {
     OPTICK_EVENT();
     if (vao == 0u)
@@ -2925,3 +3311,64 @@ void AssetLoadingDemo::configureVertexArrayAttributes() noexcept {
 }
 
 
+bool AssetLoadingDemo::uploadCompressedSceneBufferToGPU(GLuint& targetVBO, const std::vector<float>& sceneBuf) noexcept {
+    OPTICK_EVENT();
+    if (0u == targetVBO) {
+        fprintf(ERRLOG, "\nERROR! Unable to upload the compressed sceneBuffer because its target VBO was\n"
+            "never created with GL context!\n");
+        return false;
+    }
+
+    const GLsizei vertexCount = computeNumberOfVerticesInSceneBuffer(sceneBuf);
+
+    const LocalTimepoint encodeStart;
+    if (!CompressedVertexFormat::encodeVertices(sceneBuf.data(), static_cast<size_t>(vertexCount),
+                                                compressedSceneBuffer, compressedSceneDecodeParameters)) {
+        fprintf(ERRLOG, "\nERROR! The sceneBuffer could not be converted into compressed vertices because the\n"
+            "models in the scene were not all loaded with the same scale! Either load every model with the\n"
+            "same scale or set USE_COMPRESSED_VERTEX_FORMAT to false.\n");
+        return false;
+    }
+    const LocalTimepoint encodeEnd;
+
+    glBindBuffer(GL_ARRAY_BUFFER, targetVBO);
+
+    fprintf(MSGLOG, "\nInitiating transfer of the compressed sceneBuffer data from the Application to the GPU.\n"
+        "Target destination on GPU is set to use Array Buffer ID %u.\n", targetVBO);
+
+    const size_t compressedBytes = compressedSceneBuffer.size() * sizeof(CompressedVertexFormat::CompressedVertex);
+    const size_t uncompressedBytes = static_cast<size_t>(vertexCount) * NUM_VERTEX_COMPONENTS * sizeof(GLfloat);
+    fprintf(MSGLOG, "  [TRANSFER STATISTICS]\n");
+    fprintf(MSGLOG, "There are %d vertices total in the scene, encoded in %.3f ms into %zu bytes\n"
+        "[%zu bytes per vertex instead of %zu, saving %zu bytes]\n\n", vertexCount,
+        (encodeEnd - encodeStart) * 1000.0, compressedBytes, sizeof(CompressedVertexFormat::CompressedVertex),
+        NUM_VERTEX_COMPONENTS * sizeof(GLfloat), uncompressedBytes - compressedBytes);
+
+    glBufferData(GL_ARRAY_BUFFER, compressedBytes, compressedSceneBuffer.data(), GL_STATIC_DRAW);
+    return true;
+}
+
+void AssetLoadingDemo::configureCompressedVertexArrayAttributes() noexcept {
+    OPTICK_EVENT();
+    if (vao == 0u)
+        glCreateVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+
+    //The GPU converts each of these into floats while fetching them, see 'CompressedVertexDecode.glsl'
+    //for what the shader does with them after that
+    static constexpr const GLsizei STRIDE = sizeof(CompressedVertexFormat::CompressedVertex);
+
+    //Location 0    Position       3-components     [unsigned normalized 16-bit, relative to the scene's bounding box]
+    glEnableVertexArrayAttrib(vao, 0);
+    glVertexAttribPointer(0, 3, GL_UNSIGNED_SHORT, GL_TRUE, STRIDE, (GLvoid*)(CompressedVertexFormat::POSITION_OFFSET));
+
+    //Location 1    TexCoords      2-components     [16-bit floating point]
+    glEnableVertexArrayAttrib(vao, 1);
+    glVertexAttribPointer(1, 2, GL_HALF_FLOAT, GL_FALSE, STRIDE, (GLvoid*)(CompressedVertexFormat::TEX_COORD_OFFSET));
+
+    //Location 2    Normals        2-components     [signed normalized 16-bit, octahedral encoded]
+    glEnableVertexArrayAttrib(vao, 2);
+    glVertexAttribPointer(2, 2, GL_SHORT, GL_TRUE, STRIDE, (GLvoid*)(CompressedVertexFormat::NORMAL_OFFSET));
+}
+
+
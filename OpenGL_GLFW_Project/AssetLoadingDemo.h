@@ -41,6 +41,11 @@
 
 #include "RenderDemoBase.h"
 #include "QuickObj.h" //For loading '.obj' files
+#include "CompressedVertexFormat.h" //For optionally uploading the scene in a compact vertex format
+#include "MeshSimplifier.h" //For generating each model's levels of detail
+#include "FrustumCulling.h" //For skipping objects which are outside of the view
+#include "SceneBufferAssembly.h" //For putting the loaded models together into the sceneBuffer
+#include "ForceBeginAsyncTask.h" //Models are loaded concurrently
 
 
 using ParsedModelData_Iter = std::vector<std::unique_ptr<QuickObj>>::iterator;
@@ -56,8 +61,42 @@ using ParsedModelData_CIter = std::vector<std::unique_ptr<QuickObj>>::const_iter
 //Setting this variable to false will cause all generated texture coordinates to be the same point 
 static constexpr const bool ASSIGN_TEXTURE_COORDS_RANDOMLY = true;
 
+//Every model's positions which are within this tolerance of each other are welded together as the model is loaded
+//[see VertexWelder.h]. This is the tolerance Vertex compares positions with. Exporters often write a position out
+//once for each side of a UV seam or hard edge, and welding joins those copies back up so that the generated smooth
+//normals, the triangle outlines and the LOD simplification all see a connected mesh. Use
+//QuickObj::NO_POSITION_WELDING to load the models exactly as they were written.
+static constexpr const float MODEL_POSITION_WELD_TOLERANCE = FP_TOLERANCE;
+
 static constexpr const GLsizei STARTING_INSTANCE_COUNT = 5;
 
+//Setting this to true uploads the scene as 16-byte compressed vertices instead of 36-byte float vertices
+//[see CompressedVertexFormat.h]. The compressed vertices can only be drawn by a shader which decodes them, 
+//so this also swaps the scene shader out for 'AssetLoadingDemo_CompressedVertices.vert'. Every model in
+//the scene must have been loaded with the same scale for the scene to be compressible.
+static constexpr const bool USE_COMPRESSED_VERTEX_FORMAT = false;
+
+//Setting this to true has each indexed model simplified into a chain of levels of detail (LODs) right after it
+//is loaded [see MeshSimplifier.h]. Each level aims for the fraction of the model's triangles given by its entry
+//in MODEL_LOD_TRIANGLE_RATIOS. While drawing TRIANGLES, every model gets drawn each frame at the coarsest level
+//which keeps its triangles at least as dense on screen as the full model's would be if the model's bounding
+//sphere covered MODEL_LOD_FULL_DETAIL_SCREEN_SIZE pixels. The other primitive types always draw full detail.
+//This is off by default. The LOD chain isn't part of the mesh cache, so every startup would pay to simplify each
+//model again and to optimize every level for the vertex cache.
+static constexpr const bool GENERATE_MODEL_LODS = false;
+static constexpr const float MODEL_LOD_TRIANGLE_RATIOS[] = { 0.5f, 0.25f, 0.125f };
+static constexpr const float MODEL_LOD_FULL_DETAIL_SCREEN_SIZE = 600.0f; //Diameter in pixels
+
+//Setting this to true skips drawing every object which is entirely outside of the view, tested each frame against
+//the bounding box and sphere each object gets when the scene is built [see FrustumCulling.h]. The visible objects 
+//are drawn with a single glMultiDrawElements(). Culling only happens while the scene shader places vertices like 
+//'AssetLoadingDemo.vert' does [the other shaders move vertices around too much to predict], and only while drawing 
+//TRIANGLES or POINTS [the other primitive types connect each object to the next].
+static constexpr const bool CULL_OBJECTS_OUTSIDE_OF_VIEW = true;
+//How far 'AssetLoadingDemo.vert' can move each instance from where the first instance is drawn, per instance. Instance
+//i is moved at most (i + 1) times this far [0.45 * (i + 1) * length(vec3(1.0, 1.0, 0.033)), rounded up].
+static constexpr const float MAX_INSTANCE_DISPLACEMENT_PER_INSTANCE = 0.64f;
+
 //The maximum and minimum values are suggestions, if the implementation says it only
 //supports a higher minimum or lower maximum, the value reported by the implementation
 //becomes the cutoff
@@ -115,6 +154,7 @@ protected: //private:
 
     GLuint vao; //Only 1 VertexArrayObject is required because all buffers share a common data layout.
     GLuint triangleOutlineEBO;
+    GLuint sceneIndexEBO; //Models are loaded as indexed meshes, so the scene is drawn with glDrawElements()
     GLuint sceneBufferVBO;//primarySceneBufferVBO, alternateSceneBufferVBO; 
     GLuint practiceTexture;
     std::vector<GLuint> practiceTextureSet;
@@ -146,8 +186,55 @@ protected: //private:
     //Scene Control Variables
     std::unique_ptr<ShaderProgram> sceneShader, quadTextureTestShader;
     std::vector<std::unique_ptr<QuickObj>> sceneObjects;
+
+    //A model that was loaded by an asynchronous task, along with when its loading started 
+    //and finished (recorded on the task's thread, see waitForQueuedModels())
+    struct LoadedModel {
+        std::unique_ptr<QuickObj> model;
+        LocalTimepoint loadStart, loadEnd;
+        std::vector<AssetLoadingInternal::MeshLod> lods; //Only generated if GENERATE_MODEL_LODS is set
+    };
+    struct QueuedModelLoad {
+        std::string filepath;
+        std::future<LoadedModel> result;
+    };
+    //Models which are still being loaded, in the order they were queued
+    std::vector<QueuedModelLoad> queuedModelLoads;
     std::vector<GLfloat> sceneBuffer;// , alternativeSceneBuffer;
     std::vector<GLuint> triangleOutlineElementOrdering;
+    std::vector<GLuint> sceneIndexBuffer; //Indices into the sceneBuffer, 3 per triangle
+    GLenum sceneIndexType; //GL_UNSIGNED_SHORT if the scene is small enough, otherwise GL_UNSIGNED_INT
+    //Every object's full detail indices come first in the sceneIndexBuffer, followed by all of their simplified
+    //levels of detail. Only the full detail indices are used by the draw modes other than TRIANGLES.
+    size_t sceneFullDetailIndexCount;
+    //The levels of detail generated for each of the sceneObjects (objects which were not loaded by
+    //queueModelLoad() have none)
+    std::vector<std::vector<AssetLoadingInternal::MeshLod>> sceneObjectLodChains;
+    struct IndexRange {
+        size_t first, count;
+    };
+    //Where each object's levels of detail ended up in the sceneIndexBuffer. levels[0] is also the range the
+    //object gets drawn from by every primitive type other than TRIANGLES.
+    struct SceneObjectLods {
+        GLuint baseVertex;
+        std::vector<IndexRange> levels; //levels[0] is full detail
+        size_t selectedLevel;
+    };
+    std::vector<SceneObjectLods> sceneObjectLods;
+    bool sceneObjectLodsInUse; //Set when any object is to be drawn at less than full detail this frame
+    //The bounding sphere and box of each of the sceneObjects (in the sceneBuffer's space, with each object's scale
+    //as its w). These are what selectSceneObjectLods() measures each object's size on screen with, and what
+    //cullSceneObjects() tests against the view frustum.
+    AssetLoadingInternal::BoundingVolumeSet sceneObjectBounds;
+    std::vector<uint8_t> sceneObjectVisibility; //1 for each object which may be visible this frame
+    bool sceneShaderSupportsCulling; //Set by loadShaders() if the sceneShader places vertices predictably
+    bool sceneObjectCullingInUse; //Set when any object is to be skipped this frame
+    //The index ranges drawn this frame by drawVisibleSceneObjects(), kept around to avoid reallocating them
+    std::vector<GLsizei> sceneDrawCounts;
+    std::vector<const void*> sceneDrawOffsets;
+    //Only used if USE_COMPRESSED_VERTEX_FORMAT is set. The decode parameters become uniforms.
+    std::vector<CompressedVertexFormat::CompressedVertex> compressedSceneBuffer;
+    CompressedVertexFormat::DecodeParameters compressedSceneDecodeParameters;
 
     //For dynamic shader recompilation
     struct LiveUpdateEnabledShaderSet {
@@ -206,7 +293,22 @@ protected: //private:
     //vital for rendering, it is possible for this function to fail
     //completely and the RenderDemo will still be able to enter its
     //render loop and run as normal (baring any uncaught exceptions)
+    //[Update October 2026: Each model is now queued to be loaded concurrently on its 
+    // own thread, so this function returns right away. The loaded models get moved into
+    // 'sceneObjects' by waitForQueuedModels()]
     void loadModels(); //Loads 3D model data from asset files
+
+    //Begins loading a model on its own thread. Parsing a model doesn't touch the GL context,
+    //so any number of models can be loaded at once while the render thread does other work.
+    //Missing texture coordinates are randomized [which keeps INDEXED models from sharing
+    //many of their vertices, since no 2 corners get the same texture coordinates].
+    void queueModelLoad(const std::string& filepath, float scale, 
+                        QuickObj::OutputFormat outputFormat = QuickObj::OutputFormat::INDEXED);
+    //Waits for every queued model to finish loading and moves them (in the order they were
+    //queued) onto the end of 'sceneObjects'. The start and end of each model's load are logged
+    //as Timepoints and each model's load time is reported. Any exception thrown while loading a
+    //model gets rethrown from here.
+    void waitForQueuedModels();
     
     //This function is meant to be called after the sceneShader is linked and 
     //all models for the scene have finished loading
@@ -408,6 +510,12 @@ protected: //private:
     ///////////////////////////////////
     
     void updateBaseUniforms() noexcept;
+    //The Model-View-Projection matrix the scene is drawn with
+    glm::mat4 computeSceneMVP() const noexcept;
+    //Picks the level of detail each object gets drawn at this frame from its size on screen
+    void selectSceneObjectLods() noexcept;
+    //Finds which objects are entirely outside of the view this frame, so they can be skipped
+    void cullSceneObjects();
     
     
     //////////////////////////////////
@@ -421,6 +529,9 @@ protected: //private:
     ///  (4-2c)  Make Draw Call    ///                           
     ////////////////////////////////// 
     virtual void drawVerts();                  
+    //Draws every object that wasn't culled, at its selected level of detail if LODs are in use. Objects which
+    //are next to each other in the sceneIndexBuffer get merged into a single range.
+    void drawVisibleSceneObjects(GLenum primitiveMode) noexcept;
                                       
     // [REPEAT Step 4-2 (parts a-c) for each draw call]  
     
@@ -465,8 +576,20 @@ protected: //private:
     //The following 4 functions are intended for use within the function
     //buildSceneBufferFromLoadedSceneObjects() to handle 
     //data into the sceneBuffer
+    //Records where the object's vertices were placed in the sceneBuffer (starting at vertex 'baseVertex'),
+    //adding its indices and bounds to the scene. The vertices themselves are copied over beforehand.
     void addObject(std::vector<std::unique_ptr<QuickObj>>::const_iterator object,
-        const glm::vec3& objPos);
+        GLuint baseVertex);
+    //Appends the object's indices onto the sceneIndexBuffer, offset by the number of vertices 
+    //that were already in the sceneBuffer before the object was added
+    void addObjectIndices(std::vector<std::unique_ptr<QuickObj>>::const_iterator object,
+        GLuint baseVertex);
+    //Appends each object's simplified levels of detail onto the sceneIndexBuffer. Call this once every
+    //object's full detail indices have been added.
+    void addSceneObjectLods();
+
+    //Simplifies an indexed model into its chain of levels of detail. This runs on the model's loading task.
+    static std::vector<AssetLoadingInternal::MeshLod> generateModelLods(const QuickObj& model);
 
     //Helper function for generating random texture coordinates
     static inline glm::vec2 generateRandomTexCoords() {
@@ -479,13 +602,21 @@ protected: //private:
 
     void createSceneVBO() noexcept;
     void createTriangleOutlineEBO() noexcept;
+    void createSceneIndexEBO() noexcept;
 
     //Does exactly what you think [creates buffers within the GL Context, uploads vertices to buffer]
     void uploadSceneBufferToGPU(GLuint& targetVBO, const std::vector<float>& sceneBuf) noexcept;
     void uploadTriangleOutlineElementOrderingBufferToGPU(GLuint& ebo, const std::vector<GLuint>& eboData) noexcept;
+    //Uploads the scene's indices as either 16-bit or 32-bit values, depending on 'sceneIndexType'
+    void uploadSceneIndexBufferToGPU(GLuint& ebo, const std::vector<GLuint>& indices) noexcept;
     //Sets up the VAO [which describes how the vertex data is arranged in the VertexArrayBuffer]
     void configureVertexArrayAttributes() noexcept; 
 
+    //The compressed vertex format equivalents of the 2 preceding functions. Encoding the sceneBuffer
+    //fails [returning false] if the models in the scene don't all share the same scale.
+    bool uploadCompressedSceneBufferToGPU(GLuint& targetVBO, const std::vector<float>& sceneBuf) noexcept;
+    void configureCompressedVertexArrayAttributes() noexcept;
+
 
 };
 
@@ -0,0 +1,289 @@
+// File:           CompressedVertexFormat.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   The SIMD and scalar paths have to agree exactly, so the scalar code is written in
+//                          terms of the same operations the SSE instructions perform:
+//                               -Rounding to an integer uses lrintf(), which rounds to nearest-even just
+//                                like _mm_cvtps_epi32() does under the default rounding mode
+//                               -Clamping uses 'sseMin()'/'sseMax()', which resolve NaNs the same way
+//                                _mm_min_ps()/_mm_max_ps() do [a NaN input clamps to the bound]
+//                               -The octahedral fold takes its sign from the sign bit (so -0 counts as
+//                                negative), which is what masking off the sign bit in SSE gives
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "CompressedVertexFormat.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>   //memcpy
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define COMPRESSED_VERTEX_FORMAT_USE_SSE2_ 1
+#endif
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__)) //MSVC has no F16C flag, AVX2 implies it
+#include <immintrin.h>
+#define COMPRESSED_VERTEX_FORMAT_USE_F16C_ 1
+#endif
+
+namespace CompressedVertexFormat {
+
+    namespace {
+
+        static constexpr const float UNORM16_MAX = 65535.0f;
+        static constexpr const float SNORM16_MAX = 32767.0f;
+
+        //Offsets within a source vertex
+        static constexpr const size_t SOURCE_X = 0u;
+        static constexpr const size_t SOURCE_W = 3u;
+        static constexpr const size_t SOURCE_S = 4u;
+        static constexpr const size_t SOURCE_NX = 6u;
+
+        inline float sseMax(float a, float b) noexcept { return ((a > b) ? a : b); }
+        inline float sseMin(float a, float b) noexcept { return ((a < b) ? a : b); }
+
+        inline uint16_t quantizeUnorm16(float value, float min, float inverseExtent) noexcept {
+            const float scaled = (value - min) * inverseExtent;
+            return static_cast<uint16_t>(lrintf(sseMin(sseMax(scaled, 0.0f), UNORM16_MAX)));
+        }
+
+        inline int16_t quantizeSnorm16(float value) noexcept {
+            return static_cast<int16_t>(lrintf(sseMin(sseMax(value, -1.0f), 1.0f) * SNORM16_MAX));
+        }
+
+        //Per-axis multiplier taking a position relative to the minimum into 0 to 65535
+        inline float computeInverseExtent(float extent) noexcept {
+            return ((extent > 0.0f) ? (UNORM16_MAX / extent) : 0.0f);
+        }
+
+        void encodeVertex(const float * source, const DecodeParameters& parameters,
+                          const float inverseExtent[3], CompressedVertex& destination) noexcept {
+            for (int axis = 0; axis < 3; axis++)
+                destination.position[axis] = quantizeUnorm16(source[SOURCE_X + axis], parameters.positionMin[axis], inverseExtent[axis]);
+            destination.padding = 0u;
+            destination.texCoord[0] = floatToHalf(source[SOURCE_S]);
+            destination.texCoord[1] = floatToHalf(source[SOURCE_S + 1u]);
+            encodeOctahedralNormal(source[SOURCE_NX], source[SOURCE_NX + 1u], source[SOURCE_NX + 2u], destination.normal);
+        }
+
+#ifdef COMPRESSED_VERTEX_FORMAT_USE_SSE2_
+        static constexpr const size_t SIMD_WIDTH = 4u;
+
+        //Loads one component from each of 4 consecutive source vertices
+        inline __m128 loadComponent(const float * source, size_t component) noexcept {
+            return _mm_setr_ps(source[component], source[SOURCE_VERTEX_COMPONENTS + component],
+                source[(2u * SOURCE_VERTEX_COMPONENTS) + component], source[(3u * SOURCE_VERTEX_COMPONENTS) + component]);
+        }
+
+        inline __m128 clamp(__m128 value, __m128 low, __m128 high) noexcept {
+            return _mm_min_ps(_mm_max_ps(value, low), high);
+        }
+
+        //Encodes 4 consecutive source vertices
+        void encodeVertexBlock(const float * source, const __m128 positionMin[3], const __m128 inverseExtent[3],
+                               CompressedVertex * destination) noexcept {
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 one = _mm_set1_ps(1.0f);
+            const __m128 signBit = _mm_set1_ps(-0.0f);
+
+            //Positions
+            alignas(16) int32_t quantizedPositions[3][SIMD_WIDTH];
+            for (int axis = 0; axis < 3; axis++) {
+                const __m128 scaled = _mm_mul_ps(_mm_sub_ps(loadComponent(source, SOURCE_X + axis), positionMin[axis]), inverseExtent[axis]);
+                const __m128 clamped = clamp(scaled, zero, _mm_set1_ps(UNORM16_MAX));
+                _mm_store_si128(reinterpret_cast<__m128i *>(quantizedPositions[axis]), _mm_cvtps_epi32(clamped));
+            }
+
+            //Texture coordinates
+            alignas(16) uint16_t halfTexCoords[2][SIMD_WIDTH];
+#ifdef COMPRESSED_VERTEX_FORMAT_USE_F16C_
+            for (int component = 0; component < 2; component++) {
+                const __m128i halves = _mm_cvtps_ph(loadComponent(source, SOURCE_S + component), _MM_FROUND_TO_NEAREST_INT);
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(halfTexCoords[component]), halves);
+            }
+#else
+            for (size_t i = 0u; i < SIMD_WIDTH; i++) {
+                halfTexCoords[0][i] = floatToHalf(source[(i * SOURCE_VERTEX_COMPONENTS) + SOURCE_S]);
+                halfTexCoords[1][i] = floatToHalf(source[(i * SOURCE_VERTEX_COMPONENTS) + SOURCE_S + 1u]);
+            }
+#endif //COMPRESSED_VERTEX_FORMAT_USE_F16C_
+
+            //Normals [see 'encodeOctahedralNormal()' for the steps]
+            const __m128 nx = loadComponent(source, SOURCE_NX);
+            const __m128 ny = loadComponent(source, SOURCE_NX + 1u);
+            const __m128 nz = loadComponent(source, SOURCE_NX + 2u);
+            const __m128 sum = _mm_add_ps(_mm_add_ps(_mm_andnot_ps(signBit, nx), _mm_andnot_ps(signBit, ny)), _mm_andnot_ps(signBit, nz));
+            const __m128 hasLength = _mm_cmpgt_ps(sum, zero);
+            const __m128 px = _mm_and_ps(hasLength, _mm_div_ps(nx, sum));
+            const __m128 py = _mm_and_ps(hasLength, _mm_div_ps(ny, sum));
+            const __m128 foldedX = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signBit, py)), _mm_or_ps(_mm_and_ps(signBit, px), one));
+            const __m128 foldedY = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signBit, px)), _mm_or_ps(_mm_and_ps(signBit, py), one));
+            const __m128 lowerHemisphere = _mm_cmplt_ps(nz, zero);
+            const __m128 ex = _mm_or_ps(_mm_and_ps(lowerHemisphere, foldedX), _mm_andnot_ps(lowerHemisphere, px));
+            const __m128 ey = _mm_or_ps(_mm_and_ps(lowerHemisphere, foldedY), _mm_andnot_ps(lowerHemisphere, py));
+            const __m128 snormMax = _mm_set1_ps(SNORM16_MAX);
+            alignas(16) int32_t quantizedNormals[2][SIMD_WIDTH];
+            _mm_store_si128(reinterpret_cast<__m128i *>(quantizedNormals[0]),
+                _mm_cvtps_epi32(_mm_mul_ps(clamp(ex, _mm_set1_ps(-1.0f), one), snormMax)));
+            _mm_store_si128(reinterpret_cast<__m128i *>(quantizedNormals[1]),
+                _mm_cvtps_epi32(_mm_mul_ps(clamp(ey, _mm_set1_ps(-1.0f), one), snormMax)));
+
+            for (size_t i = 0u; i < SIMD_WIDTH; i++) {
+                CompressedVertex& vertex = destination[i];
+                vertex.position[0] = static_cast<uint16_t>(quantizedPositions[0][i]);
+                vertex.position[1] = static_cast<uint16_t>(quantizedPositions[1][i]);
+                vertex.position[2] = static_cast<uint16_t>(quantizedPositions[2][i]);
+                vertex.padding = 0u;
+                vertex.texCoord[0] = halfTexCoords[0][i];
+                vertex.texCoord[1] = halfTexCoords[1][i];
+                vertex.normal[0] = static_cast<int16_t>(quantizedNormals[0][i]);
+                vertex.normal[1] = static_cast<int16_t>(quantizedNormals[1][i]);
+            }
+        }
+#endif //COMPRESSED_VERTEX_FORMAT_USE_SSE2_
+
+    } //namespace
+
+
+    bool encodeVertices(const float * vertices, size_t vertexCount, std::vector<CompressedVertex>& encoded,
+                        DecodeParameters& parameters) {
+        encoded.clear();
+        parameters.positionMin = { 0.0f, 0.0f, 0.0f };
+        parameters.positionExtent = { 0.0f, 0.0f, 0.0f };
+        parameters.scale = 1.0f;
+        if (vertexCount == 0u)
+            return true;
+
+        //The bounds [and a check that the scale can be moved into a uniform]
+        std::array<float, 3> positionMax;
+        for (int axis = 0; axis < 3; axis++)
+            parameters.positionMin[axis] = positionMax[axis] = vertices[SOURCE_X + axis];
+        parameters.scale = vertices[SOURCE_W];
+        for (size_t i = 0u; i < vertexCount; i++) {
+            const float * const vertex = vertices + (i * SOURCE_VERTEX_COMPONENTS);
+            if (vertex[SOURCE_W] != parameters.scale)
+                return false;
+            for (int axis = 0; axis < 3; axis++) {
+                parameters.positionMin[axis] = std::min(parameters.positionMin[axis], vertex[SOURCE_X + axis]);
+                positionMax[axis] = std::max(positionMax[axis], vertex[SOURCE_X + axis]);
+            }
+        }
+        float inverseExtent[3];
+        for (int axis = 0; axis < 3; axis++) {
+            parameters.positionExtent[axis] = positionMax[axis] - parameters.positionMin[axis];
+            inverseExtent[axis] = computeInverseExtent(parameters.positionExtent[axis]);
+        }
+
+        encoded.resize(vertexCount);
+        size_t i = 0u;
+#ifdef COMPRESSED_VERTEX_FORMAT_USE_SSE2_
+        const __m128 positionMin[3] = { _mm_set1_ps(parameters.positionMin[0]), _mm_set1_ps(parameters.positionMin[1]),
+                                        _mm_set1_ps(parameters.positionMin[2]) };
+        const __m128 inverseExtents[3] = { _mm_set1_ps(inverseExtent[0]), _mm_set1_ps(inverseExtent[1]), _mm_set1_ps(inverseExtent[2]) };
+        for (; (i + SIMD_WIDTH) <= vertexCount; i += SIMD_WIDTH)
+            encodeVertexBlock(vertices + (i * SOURCE_VERTEX_COMPONENTS), positionMin, inverseExtents, encoded.data() + i);
+#endif //COMPRESSED_VERTEX_FORMAT_USE_SSE2_
+        for (; i < vertexCount; i++)
+            encodeVertex(vertices + (i * SOURCE_VERTEX_COMPONENTS), parameters, inverseExtent, encoded[i]);
+        return true;
+    }
+
+
+    //Rounds to nearest-even, the same as the F16C instructions
+    uint16_t floatToHalf(float value) noexcept {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        const uint32_t sign = (bits >> 16u) & 0x8000u;
+        const uint32_t magnitude = bits & 0x7FFFFFFFu;
+
+        if (magnitude >= 0x7F800000u) { //Infinity or NaN [NaNs stay quiet NaNs]
+            const uint32_t nanBits = ((magnitude > 0x7F800000u) ? (0x0200u | ((magnitude >> 13u) & 0x03FFu)) : 0u);
+            return static_cast<uint16_t>(sign | 0x7C00u | nanBits);
+        }
+        if (magnitude >= 0x477FF000u) //Rounds to beyond the largest half (65504)
+            return static_cast<uint16_t>(sign | 0x7C00u);
+        if (magnitude < 0x38800000u) { //Below the smallest normal half, so becomes a denormal (or 0)
+            if (magnitude < 0x33000000u)
+                return static_cast<uint16_t>(sign);
+            const uint32_t exponent = magnitude >> 23u;
+            const uint32_t mantissa = (magnitude & 0x007FFFFFu) | 0x00800000u;
+            const uint32_t shift = 126u - exponent;
+            uint32_t result = mantissa >> shift;
+            const uint32_t remainder = mantissa & ((1u << shift) - 1u);
+            const uint32_t halfway = 1u << (shift - 1u);
+            if ((remainder > halfway) || ((remainder == halfway) && ((result & 1u) != 0u)))
+                result++;
+            return static_cast<uint16_t>(sign | result);
+        }
+        const uint32_t rebiased = magnitude - 0x38000000u; //Exponent bias 127 becomes 15
+        return static_cast<uint16_t>(sign | ((rebiased + 0x0FFFu + ((rebiased >> 13u) & 1u)) >> 13u));
+    }
+
+
+    float halfToFloat(uint16_t half) noexcept {
+        const uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16u;
+        const uint32_t exponent = (half >> 10u) & 0x1Fu;
+        uint32_t mantissa = half & 0x03FFu;
+        uint32_t bits;
+        if (exponent == 0x1Fu)
+            bits = sign | 0x7F800000u | (mantissa << 13u);
+        else if (exponent != 0u)
+            bits = sign | ((exponent + 112u) << 23u) | (mantissa << 13u);
+        else if (mantissa == 0u)
+            bits = sign;
+        else { //Denormal, which is normal as a float
+            uint32_t floatExponent = 113u;
+            while ((mantissa & 0x0400u) == 0u) {
+                mantissa <<= 1u;
+                floatExponent--;
+            }
+            bits = sign | (floatExponent << 23u) | ((mantissa & 0x03FFu) << 13u);
+        }
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+
+    //The normal is projected onto the octahedron |x| + |y| + |z| = 1, then the lower half of the octahedron
+    //is folded over the upper half so that the whole thing flattens out into the square [-1, 1] x [-1, 1]
+    void encodeOctahedralNormal(float x, float y, float z, int16_t encoded[2]) noexcept {
+        const float sum = std::fabs(x) + std::fabs(y) + std::fabs(z);
+        const float px = ((sum > 0.0f) ? (x / sum) : 0.0f);
+        const float py = ((sum > 0.0f) ? (y / sum) : 0.0f);
+        float ex = px, ey = py;
+        if (z < 0.0f) {
+            ex = (1.0f - std::fabs(py)) * std::copysign(1.0f, px);
+            ey = (1.0f - std::fabs(px)) * std::copysign(1.0f, py);
+        }
+        encoded[0] = quantizeSnorm16(ex);
+        encoded[1] = quantizeSnorm16(ey);
+    }
+
+
+    //The same steps as 'decodeOctahedralNormal()' in 'CompressedVertexDecode.glsl'
+    std::array<float, 3> decodeOctahedralNormal(const int16_t encoded[2]) noexcept {
+        const float ex = std::max(static_cast<float>(encoded[0]) / SNORM16_MAX, -1.0f);
+        const float ey = std::max(static_cast<float>(encoded[1]) / SNORM16_MAX, -1.0f);
+        std::array<float, 3> normal = { ex, ey, 1.0f - std::fabs(ex) - std::fabs(ey) };
+        const float fold = std::max(-normal[2], 0.0f);
+        normal[0] += ((normal[0] >= 0.0f) ? -fold : fold);
+        normal[1] += ((normal[1] >= 0.0f) ? -fold : fold);
+        const float length = std::sqrt((normal[0] * normal[0]) + (normal[1] * normal[1]) + (normal[2] * normal[2]));
+        for (float& component : normal)
+            component /= length;
+        return normal;
+    }
+
+
+    std::array<float, 3> decodePosition(const CompressedVertex& vertex, const DecodeParameters& parameters) noexcept {
+        std::array<float, 3> position;
+        for (int axis = 0; axis < 3; axis++)
+            position[axis] = parameters.positionMin[axis] + ((static_cast<float>(vertex.position[axis]) / UNORM16_MAX) * parameters.positionExtent[axis]);
+        return position;
+    }
+
+} //namespace CompressedVertexFormat
@@ -0,0 +1,85 @@
+// File:           CompressedVertexFormat.h
+// Namespace:      CompressedVertexFormat
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    An optional compact vertex format for uploading meshes to the GPU. The vertices QuickObj
+//                 assembles are 9 floats [36 bytes] each:
+//                        x, y, z, w(the model's scale), s, t, nx, ny, nz
+//                 which this format packs into 16 bytes:
+//                      -Position:  3 x unorm16, relative to the bounding box of all of the encoded vertices
+//                      -TexCoord:  2 x half float [texture coordinates are allowed to go outside of 0 to 1]
+//                      -Normal:    2 x snorm16, octahedral encoded
+//                 The 'w' component is not stored per vertex at all, it becomes a uniform. Vertices can
+//                 only be encoded if every one of them has the same scale.
+//
+//                 The GPU expands each attribute back into floats as part of fetching it (the positions and
+//                 normals are normalized integers, the texture coordinates are half floats), which leaves
+//                 only the bounding box and the octahedral fold to be undone by the vertex shader. The GLSL
+//                 for that is in 'Shaders/CompressedVertexDecode.glsl', which is linked in as a secondary
+//                 vertex shader, and the uniforms it needs are the members of DecodeParameters.
+//
+//                 The encoder processes 4 vertices at a time with SSE2 [and converts the texture coordinates
+//                 with F16C when the compiler is targeting it]. The scalar code which handles the leftover
+//                 vertices produces bit-for-bit the same results.
+//
+// Precision:      A position is off by about half of 1/65535th of the bounding box along each axis, and a
+//                 normal by less than a tenth of a degree. Half floats keep about 3 significant digits,
+//                 which is plenty for texture coordinates within a few repeats of the 0 to 1 range.
+
+#pragma once
+
+#ifndef COMPRESSED_VERTEX_FORMAT_H_
+#define COMPRESSED_VERTEX_FORMAT_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace CompressedVertexFormat {
+
+    //The layout of the uncompressed vertices being encoded [x, y, z, w, s, t, nx, ny, nz]
+    static constexpr const size_t SOURCE_VERTEX_COMPONENTS = 9u;
+
+    typedef struct CompressedVertex {
+        uint16_t position[3];   //unorm16, relative to the bounding box
+        uint16_t padding;       //Always 0, keeps the texture coordinates 4-byte aligned
+        uint16_t texCoord[2];   //Half floats
+        int16_t normal[2];      //snorm16, octahedral encoded
+    } CompressedVertex;
+    static_assert(sizeof(CompressedVertex) == 16u, "A compressed vertex is expected to be exactly 16 bytes");
+
+    //Byte offsets of each attribute within a CompressedVertex, for setting up the vertex attributes
+    static constexpr const size_t POSITION_OFFSET = 0u;
+    static constexpr const size_t TEX_COORD_OFFSET = 8u;
+    static constexpr const size_t NORMAL_OFFSET = 12u;
+
+    //Names of the uniforms in 'CompressedVertexDecode.glsl' which these parameters are uploaded to
+    static constexpr const char * POSITION_MIN_UNIFORM_NAME = "compressedPositionMin";
+    static constexpr const char * POSITION_EXTENT_UNIFORM_NAME = "compressedPositionExtent";
+    static constexpr const char * SCALE_UNIFORM_NAME = "compressedVertexScale";
+
+    //Everything needed to decode the positions [position = positionMin + (unorm * positionExtent), w = scale]
+    typedef struct DecodeParameters {
+        std::array<float, 3> positionMin;
+        std::array<float, 3> positionExtent;   //Max minus min, which is 0 along any axis the vertices are flat in
+        float scale;
+    } DecodeParameters;
+
+    //Encodes 'vertexCount' vertices laid out as SOURCE_VERTEX_COMPONENTS floats each, replacing the contents
+    //of 'encoded'. Returns false (leaving 'encoded' empty) if the vertices don't all share the same scale.
+    bool encodeVertices(const float * vertices, size_t vertexCount, std::vector<CompressedVertex>& encoded,
+                        DecodeParameters& parameters);
+
+    //The per-value conversions used by the encoder, plus their inverses [which mirror what the GPU and
+    //the decode shader do, for checking how much precision was lost]
+    uint16_t floatToHalf(float value) noexcept;
+    float halfToFloat(uint16_t half) noexcept;
+    void encodeOctahedralNormal(float x, float y, float z, int16_t encoded[2]) noexcept;
+    std::array<float, 3> decodeOctahedralNormal(const int16_t encoded[2]) noexcept;
+    std::array<float, 3> decodePosition(const CompressedVertex& vertex, const DecodeParameters& parameters) noexcept;
+
+} //namespace CompressedVertexFormat
+
+#endif //COMPRESSED_VERTEX_FORMAT_H_
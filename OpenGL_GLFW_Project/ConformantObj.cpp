@@ -0,0 +1,191 @@
+// File:           ConformantObj.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   The body parser steps over the known separators by simply advancing the
+//                          character pointer, since the stamp guarantees there is exactly 1 character
+//                          between any 2 values. The floats are read with the same parser the ObjTokenizer
+//                          uses, so a conformant file produces exactly the same values as its original.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "ConformantObj.h"
+#include "ObjNumberParsing.h"
+#include "ObjMeshCache.h"   //For the hash
+
+#include <cstdio>    //snprintf
+#include <cstring>   //memcpy
+
+namespace AssetLoadingInternal {
+
+    namespace {
+
+        using namespace ObjNumberParsing;
+
+        static constexpr const char STAMP_PREFIX[] = "# ConformantObj 1 ";
+        static constexpr const size_t STAMP_PREFIX_LENGTH = sizeof(STAMP_PREFIX) - 1u;
+        static constexpr const size_t HASH_DIGITS = 16u;
+        //The hash covers everything from here through the end of the text
+        static constexpr const size_t HASHED_REGION_START = STAMP_PREFIX_LENGTH + HASH_DIGITS;
+
+        //Reads ' <key>=<count>' out of the stamp line without ever reading past 'end'
+        bool readStampCount(const char *& c, const char * end, const char * key, size_t& count) noexcept {
+            const size_t keyLength = strlen(key);
+            if ((static_cast<size_t>(end - c) < (keyLength + 2u)) || (c[0] != ' ') ||
+                (memcmp(c + 1, key, keyLength) != 0) || (c[keyLength + 1u] != '='))
+                return false;
+            c += (keyLength + 2u);
+            if ((c == end) || (!isDigit(*c)))
+                return false;
+            count = 0u;
+            while ((c != end) && isDigit(*c)) {
+                count = (count * 10u) + static_cast<size_t>(*c - '0');
+                c++;
+            }
+            return true;
+        }
+
+        //Conformant indices are always positive and never have a sign
+        inline Offset readIndex(const char *& c) noexcept {
+            Offset index = static_cast<Offset>(*c - '0');
+            c++;
+            while (isDigit(*c)) {
+                index = (index * 10u) + static_cast<Offset>(*c - '0');
+                c++;
+            }
+            return index - 1u;
+        }
+
+        //Reads 'count' lines of COMPONENTS floats each. 'c' starts at the beginning of the first
+        //line and the line keyword is 'keywordLength' characters long (counting the space after it).
+        template<size_t COMPONENTS>
+        const char * readVertexLines(const char * c, size_t count, size_t keywordLength,
+                                     VertexAttributeStreams<COMPONENTS>& target) {
+            target.reserve(target.size() + count);
+            float values[COMPONENTS];
+            for (size_t i = 0u; i < count; i++) {
+                c += keywordLength;
+                for (size_t component = 0u; component < COMPONENTS; component++) {
+                    parseFloat(c, values[component]);
+                    c++; //The space between values, or the line's '\n'
+                }
+                target.push_back(values, COMPONENTS);
+            }
+            return c;
+        }
+
+    } //namespace
+
+
+    std::string formatConformantObjStamp(const ConformantObjStamp& stamp) {
+        char line[160];
+        snprintf(line, sizeof(line), "%s%016llx v=%zu vt=%zu vn=%zu f=%zu\n", STAMP_PREFIX, 0ULL,
+            stamp.positionCount, stamp.texCoordCount, stamp.normalCount, stamp.triangleCount);
+        return std::string(line);
+    }
+
+
+    bool sealConformantObjText(std::string& text) {
+        ConformantObjStamp stamp;
+        if (!readConformantObjStamp(text, stamp))
+            return false;
+        const uint64_t hash = hashMeshCacheSource(std::string_view(text).substr(HASHED_REGION_START));
+        char digits[HASH_DIGITS + 1u];
+        snprintf(digits, sizeof(digits), "%016llx", static_cast<unsigned long long>(hash));
+        memcpy(&text[STAMP_PREFIX_LENGTH], digits, HASH_DIGITS);
+        return true;
+    }
+
+
+    bool readConformantObjStamp(std::string_view text, ConformantObjStamp& stamp) noexcept {
+        if ((text.length() <= HASHED_REGION_START) || (text.compare(0u, STAMP_PREFIX_LENGTH, STAMP_PREFIX) != 0))
+            return false;
+
+        const char * c = text.data() + STAMP_PREFIX_LENGTH;
+        const char * const end = text.data() + text.length();
+        uint64_t hash = 0u;
+        for (size_t i = 0u; i < HASH_DIGITS; i++, c++) {
+            const char digit = *c;
+            uint64_t value;
+            if (isDigit(digit))
+                value = static_cast<uint64_t>(digit - '0');
+            else if ((digit >= 'a') && (digit <= 'f'))
+                value = static_cast<uint64_t>(digit - 'a') + 10u;
+            else
+                return false;
+            hash = (hash << 4u) | value;
+        }
+
+        ConformantObjStamp parsed;
+        parsed.hash = hash;
+        if ((!readStampCount(c, end, "v", parsed.positionCount)) ||
+            (!readStampCount(c, end, "vt", parsed.texCoordCount)) ||
+            (!readStampCount(c, end, "vn", parsed.normalCount)) ||
+            (!readStampCount(c, end, "f", parsed.triangleCount)) ||
+            (c == end) || (*c != '\n'))
+            return false;
+        //Every index has to fit in a FaceIndex, larger files are left to the tokenizer (which rejects them)
+        if ((parsed.positionCount > MAX_FACE_INDEX) || (parsed.texCoordCount > MAX_FACE_INDEX) || (parsed.normalCount > MAX_FACE_INDEX))
+            return false;
+        parsed.bodyOffset = static_cast<size_t>(c - text.data()) + 1u;
+        stamp = parsed;
+        return true;
+    }
+
+
+    bool verifyConformantObjStamp(std::string_view text, ConformantObjStamp& stamp) noexcept {
+        ConformantObjStamp parsed;
+        if (!readConformantObjStamp(text, parsed))
+            return false;
+        if (hashMeshCacheSource(text.substr(HASHED_REGION_START)) != parsed.hash)
+            return false;
+        stamp = parsed;
+        return true;
+    }
+
+
+    void parseConformantObj(std::string_view text, const ConformantObjStamp& stamp, ObjParseResult& result) {
+        const char * c = text.data() + stamp.bodyOffset;
+        c = readVertexLines(c, stamp.positionCount, 2u, result.positions);   //"v "
+        c = readVertexLines(c, stamp.texCoordCount, 3u, result.texCoords);   //"vt "
+        c = readVertexLines(c, stamp.normalCount, 3u, result.normals);       //"vn "
+
+        const bool hasTexCoords = (stamp.texCoordCount > 0u);
+        const bool hasNormals = (stamp.normalCount > 0u);
+        result.hasTexCoords = (result.hasTexCoords || hasTexCoords);
+        result.hasNormals = (result.hasNormals || hasNormals);
+
+        ParsedFace face;
+        face.positions = { 0u, 0u, 0u, 0u };
+        face.texCoords = { 0u, 0u, 0u, 0u };
+        face.normals = { 0u, 0u, 0u, 0u };
+        face.nGonIndex = 0u;
+        face.vertexCount = static_cast<uint8_t>(TRIANGLE_VERTICE_COUNT);
+        face.hasTexCoords = hasTexCoords;
+        face.hasNormals = hasNormals;
+
+        //Each corner is followed by either a space or the line's '\n', which is skipped along with it
+        result.faces.reserve(result.faces.size() + stamp.triangleCount);
+        const size_t positionOffset = result.positions.size() - stamp.positionCount;
+        const size_t texCoordOffset = result.texCoords.size() - stamp.texCoordCount;
+        const size_t normalOffset = result.normals.size() - stamp.normalCount;
+        for (size_t i = 0u; i < stamp.triangleCount; i++) {
+            c += 2u; //"f "
+            for (int corner = 0; corner < TRIANGLE_VERTICE_COUNT; corner++) {
+                face.positions[corner] = static_cast<FaceIndex>(positionOffset + readIndex(c));
+                if (hasTexCoords) {
+                    c++; //'/'
+                    face.texCoords[corner] = static_cast<FaceIndex>(texCoordOffset + readIndex(c));
+                }
+                if (hasNormals) {
+                    c += (hasTexCoords ? 1u : 2u); //'/' or "//"
+                    face.normals[corner] = static_cast<FaceIndex>(normalOffset + readIndex(c));
+                }
+                c++;
+            }
+            result.faces.push_back(face);
+        }
+    }
+
+} //namespace AssetLoadingInternal
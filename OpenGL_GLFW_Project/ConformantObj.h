@@ -0,0 +1,84 @@
+// File:           ConformantObj.h
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Reading and writing of the stamp that the WavefrontObjConformanceTool places at the
+//                 top of every '.obj' file it produces, along with the fast parser QuickObj uses for
+//                 those files.
+//
+//                 A conformant file contains nothing but 'v', 'vt', 'vn' and 'f' lines, in exactly
+//                 that order, and every face is a triangle using the same components as every other
+//                 face. Since the file is known to be in this form ahead of time, none of the checks
+//                 the ObjTokenizer has to make on an arbitrary file are needed. The counts in the
+//                 stamp also let every vector be reserved to its exact final size.
+//
+// Stamp Format:   The first line of a conformant file is
+//                      # ConformantObj 1 <hash> v=<count> vt=<count> vn=<count> f=<count>
+//                 where <hash> is 16 hexadecimal digits. The hash covers everything in the file from
+//                 the space following the hash up through the end of the file, so both the counts and
+//                 every line of data are protected by it. The line is an ordinary comment as far as
+//                 any other '.obj' reader is concerned.
+//
+// File Body:      v x y z
+//                 vt s t
+//                 vn x y z
+//                 f a b c        where each corner is 'p', 'p/t', 'p//n' or 'p/t/n' depending on
+//                                which of the 'vt' and 'vn' counts are non-zero
+//                 Every value is separated by exactly 1 space, every line ends with a single '\n'
+//                 and every index is positive (1-based) and in range.
+//
+// Note:           The hash guards against files that were edited (or had their line endings converted)
+//                 after being conformed, it is not a security measure. Anyone able to run the tool can
+//                 produce a valid stamp. The hash is the same one the mesh cache uses, which reads the
+//                 text 8 bytes at a time in native byte order.
+
+#pragma once
+
+#ifndef CONFORMANT_OBJ_H_
+#define CONFORMANT_OBJ_H_
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "ObjTokenizer.h"
+
+namespace AssetLoadingInternal {
+
+    //Everything recorded in a conformant file's stamp
+    typedef struct ConformantObjStamp {
+        uint64_t hash;
+        size_t positionCount;
+        size_t texCoordCount;
+        size_t normalCount;
+        size_t triangleCount;
+        size_t bodyOffset;  //Where the first line following the stamp begins
+    } ConformantObjStamp;
+
+    //Returns the stamp line for a file with the given counts (the stamp's 'hash' and 'bodyOffset' are
+    //ignored). The hash digits are left as zeros, append the file's body and then call
+    //'sealConformantObjText()' to fill them in.
+    std::string formatConformantObjStamp(const ConformantObjStamp& stamp);
+
+    //Computes the hash of a file's text, which must begin with a line created by 'formatConformantObjStamp()',
+    //and writes it into the stamp. Returns false if the text does not begin with a stamp.
+    bool sealConformantObjText(std::string& text);
+
+    //Reads the stamp at the start of 'text' into 'stamp'. Returns false if the text does not begin with
+    //a well-formed stamp. The hash is not checked, use 'verifyConformantObjStamp()' for that.
+    bool readConformantObjStamp(std::string_view text, ConformantObjStamp& stamp) noexcept;
+
+    //Reads the stamp at the start of 'text' and checks its hash against the text. Returns true only
+    //if the stamp was found and the text has not been changed since it was stamped.
+    bool verifyConformantObjStamp(std::string_view text, ConformantObjStamp& stamp) noexcept;
+
+    //Parses the body of a conformant file whose stamp has already been verified, appending everything
+    //onto 'result' exactly as the ObjTokenizer would have [including the 'hasTexCoords' and 'hasNormals'
+    //flags]. Nothing in the text is checked, which is only safe because the verified stamp guarantees
+    //the text is in the form described above. Never pass this text that wasn't verified.
+    void parseConformantObj(std::string_view text, const ConformantObjStamp& stamp, ObjParseResult& result);
+
+} //namespace AssetLoadingInternal
+
+#endif //CONFORMANT_OBJ_H_
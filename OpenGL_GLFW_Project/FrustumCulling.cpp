@@ -0,0 +1,235 @@
+// File:           FrustumCulling.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   Each plane (a, b, c, d) is measured against an object at (x, y, z, w) as
+//                              a*x + b*y + c*z + d*w
+//                          which is scaled by the length of (a, b, c) compared to the true distance, since the planes
+//                          aren't normalized. So the sphere is outside of the plane once that comes out below
+//                          -(radius * length(a, b, c)). The box is tested at the corner that is furthest along the
+//                          plane's normal, which is outside of the plane only when the whole box is.
+//
+//                          The SSE and scalar paths do the same multiplies and adds in the same order and only differ
+//                          in how many objects they do at once, so they always agree on which objects get culled.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "FrustumCulling.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "ParallelRanges.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define FRUSTUM_CULLING_USE_SSE2_ 1
+#endif
+
+namespace AssetLoadingInternal {
+
+    namespace {
+
+        static constexpr const size_t FRUSTUM_PLANE_COUNT = 6u;
+
+        //A frustum plane along with everything about it that doesn't change from object to object
+        typedef struct CullingPlane {
+            float a, b, c, d;
+            float sphereScale;    //length(a, b, c)
+            float boxPadding;     //How far padding moves the box's furthest corner along the plane
+            bool positive[3];     //Which of the box's corners is furthest along the plane's normal
+        } CullingPlane;
+
+        typedef struct CullingPlanes {
+            CullingPlane planes[FRUSTUM_PLANE_COUNT];
+        } CullingPlanes;
+
+        CullingPlanes prepareCullingPlanes(const BVHFrustum& frustum, float padding) noexcept {
+            CullingPlanes prepared;
+            for (size_t i = 0u; i < FRUSTUM_PLANE_COUNT; i++) {
+                const float * plane = frustum.planes[i];
+                CullingPlane& p = prepared.planes[i];
+                p.a = plane[0];
+                p.b = plane[1];
+                p.c = plane[2];
+                p.d = plane[3];
+                p.sphereScale = std::sqrt((p.a * p.a) + (p.b * p.b) + (p.c * p.c));
+                p.boxPadding = ((std::abs(p.a) + std::abs(p.b) + std::abs(p.c)) * padding);
+                p.positive[0] = (p.a >= 0.0f);
+                p.positive[1] = (p.b >= 0.0f);
+                p.positive[2] = (p.c >= 0.0f);
+            }
+            return prepared;
+        }
+
+        bool isPossiblyVisible(const BoundingVolumeSet& volumes, size_t object, const CullingPlanes& planes,
+                               float padding, float wOffset) noexcept {
+            const float w = (volumes.w[object] + wOffset);
+            if (w <= 0.0f) //The bounds can't be placed, so the object is kept
+                return true;
+            const float radius = (volumes.sphereRadius[object] + padding);
+            for (const CullingPlane& p : planes.planes) {
+                const float sphereDistance = ((p.a * volumes.sphereX[object]) + (p.b * volumes.sphereY[object]) +
+                                              (p.c * volumes.sphereZ[object]) + (p.d * w)) + (p.sphereScale * radius);
+                if (!(sphereDistance >= 0.0f))
+                    return false;
+                const float cornerX = (p.positive[0] ? volumes.boxMaxX[object] : volumes.boxMinX[object]);
+                const float cornerY = (p.positive[1] ? volumes.boxMaxY[object] : volumes.boxMinY[object]);
+                const float cornerZ = (p.positive[2] ? volumes.boxMaxZ[object] : volumes.boxMinZ[object]);
+                const float boxDistance = ((p.a * cornerX) + (p.b * cornerY) + (p.c * cornerZ) + (p.d * w)) + p.boxPadding;
+                if (!(boxDistance >= 0.0f))
+                    return false;
+            }
+            return true;
+        }
+
+#ifdef FRUSTUM_CULLING_USE_SSE2_
+
+        //Tests the 4 objects starting at 'first', returning a bit for each one that may be visible
+        int testFourObjects(const BoundingVolumeSet& volumes, size_t first, const CullingPlanes& planes,
+                            float padding, float wOffset) noexcept {
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 w = _mm_add_ps(_mm_loadu_ps(&volumes.w[first]), _mm_set1_ps(wOffset));
+            const __m128 radius = _mm_add_ps(_mm_loadu_ps(&volumes.sphereRadius[first]), _mm_set1_ps(padding));
+            const __m128 sphereX = _mm_loadu_ps(&volumes.sphereX[first]);
+            const __m128 sphereY = _mm_loadu_ps(&volumes.sphereY[first]);
+            const __m128 sphereZ = _mm_loadu_ps(&volumes.sphereZ[first]);
+            const __m128 boxMin[3] = { _mm_loadu_ps(&volumes.boxMinX[first]), _mm_loadu_ps(&volumes.boxMinY[first]),
+                                       _mm_loadu_ps(&volumes.boxMinZ[first]) };
+            const __m128 boxMax[3] = { _mm_loadu_ps(&volumes.boxMaxX[first]), _mm_loadu_ps(&volumes.boxMaxY[first]),
+                                       _mm_loadu_ps(&volumes.boxMaxZ[first]) };
+
+            __m128 inside = _mm_cmpeq_ps(zero, zero); //All bits set
+            for (const CullingPlane& p : planes.planes) {
+                const __m128 a = _mm_set1_ps(p.a);
+                const __m128 b = _mm_set1_ps(p.b);
+                const __m128 c = _mm_set1_ps(p.c);
+                const __m128 dw = _mm_mul_ps(_mm_set1_ps(p.d), w);
+                const __m128 sphereDistance = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(a, sphereX), _mm_mul_ps(b, sphereY)),
+                                                                               _mm_mul_ps(c, sphereZ)), dw),
+                                                         _mm_mul_ps(_mm_set1_ps(p.sphereScale), radius));
+                const __m128 cornerX = (p.positive[0] ? boxMax[0] : boxMin[0]);
+                const __m128 cornerY = (p.positive[1] ? boxMax[1] : boxMin[1]);
+                const __m128 cornerZ = (p.positive[2] ? boxMax[2] : boxMin[2]);
+                const __m128 boxDistance = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(a, cornerX), _mm_mul_ps(b, cornerY)),
+                                                                            _mm_mul_ps(c, cornerZ)), dw),
+                                                      _mm_set1_ps(p.boxPadding));
+                inside = _mm_and_ps(inside, _mm_and_ps(_mm_cmpge_ps(sphereDistance, zero), _mm_cmpge_ps(boxDistance, zero)));
+            }
+            //Objects whose bounds can't be placed are kept, just like in isPossiblyVisible()
+            return _mm_movemask_ps(_mm_or_ps(inside, _mm_cmple_ps(w, zero)));
+        }
+
+#endif //FRUSTUM_CULLING_USE_SSE2_
+
+        size_t cullRange(const BoundingVolumeSet& volumes, size_t begin, size_t end, const CullingPlanes& planes,
+                         float padding, float wOffset, std::vector<uint8_t>& visible) noexcept {
+            size_t visibleCount = 0u;
+            size_t object = begin;
+#ifdef FRUSTUM_CULLING_USE_SSE2_
+            for ( ; (object + 4u) <= end; object += 4u) {
+                const int lanes = testFourObjects(volumes, object, planes, padding, wOffset);
+                for (size_t lane = 0u; lane < 4u; lane++) {
+                    const uint8_t isVisible = static_cast<uint8_t>((lanes >> lane) & 1);
+                    visible[object + lane] = isVisible;
+                    visibleCount += isVisible;
+                }
+            }
+#endif //FRUSTUM_CULLING_USE_SSE2_
+            for ( ; object < end; object++) {
+                const uint8_t isVisible = (isPossiblyVisible(volumes, object, planes, padding, wOffset) ? 1u : 0u);
+                visible[object] = isVisible;
+                visibleCount += isVisible;
+            }
+            return visibleCount;
+        }
+
+        //Appends the bounds of the 'vertexCount' positions given by 'positionOf(vertex)' onto the set
+        template<typename PositionOf>
+        size_t addBounds(BoundingVolumeSet& volumes, size_t vertexCount, const PositionOf& positionOf, float objectW) {
+            float boxMin[3] = { 0.0f, 0.0f, 0.0f };
+            float boxMax[3] = { 0.0f, 0.0f, 0.0f };
+            for (size_t vertex = 0u; vertex < vertexCount; vertex++) {
+                const float * position = positionOf(vertex);
+                for (int axis = 0; axis < 3; axis++) {
+                    boxMin[axis] = ((vertex == 0u) ? position[axis] : std::min(boxMin[axis], position[axis]));
+                    boxMax[axis] = ((vertex == 0u) ? position[axis] : std::max(boxMax[axis], position[axis]));
+                }
+            }
+            float center[3];
+            for (int axis = 0; axis < 3; axis++)
+                center[axis] = (0.5f * (boxMin[axis] + boxMax[axis]));
+            //The sphere only needs to reach the furthest vertex, which is usually well inside of the box's corners
+            float radiusSquared = 0.0f;
+            for (size_t vertex = 0u; vertex < vertexCount; vertex++) {
+                const float * position = positionOf(vertex);
+                const float x = (position[0] - center[0]);
+                const float y = (position[1] - center[1]);
+                const float z = (position[2] - center[2]);
+                radiusSquared = std::max(radiusSquared, ((x * x) + (y * y) + (z * z)));
+            }
+
+            volumes.sphereX.push_back(center[0]);
+            volumes.sphereY.push_back(center[1]);
+            volumes.sphereZ.push_back(center[2]);
+            volumes.sphereRadius.push_back(std::sqrt(radiusSquared));
+            volumes.boxMinX.push_back(boxMin[0]);
+            volumes.boxMinY.push_back(boxMin[1]);
+            volumes.boxMinZ.push_back(boxMin[2]);
+            volumes.boxMaxX.push_back(boxMax[0]);
+            volumes.boxMaxY.push_back(boxMax[1]);
+            volumes.boxMaxZ.push_back(boxMax[2]);
+            volumes.w.push_back(objectW);
+            return (volumes.w.size() - 1u);
+        }
+
+    } //namespace
+
+
+    unsigned int chooseCullingThreadCount(size_t objectCount) noexcept {
+        return chooseParallelThreadCount(objectCount, MIN_OBJECTS_PER_CULLING_THREAD);
+    }
+
+
+    void BoundingVolumeSet::clear() noexcept {
+        for (std::vector<float>* component : { &sphereX, &sphereY, &sphereZ, &sphereRadius, &boxMinX, &boxMinY,
+                                               &boxMinZ, &boxMaxX, &boxMaxY, &boxMaxZ, &w })
+            component->clear();
+    }
+
+    size_t BoundingVolumeSet::addObject(const float * vertices, size_t vertexStride, size_t vertexCount, float objectW) {
+        return addBounds(*this, vertexCount, [=](size_t vertex) { return (vertices + (vertex * vertexStride)); }, objectW);
+    }
+
+    size_t BoundingVolumeSet::addObject(const float * vertices, size_t vertexStride, const uint32_t * vertexIndices,
+                                        size_t vertexCount, float objectW) {
+        return addBounds(*this, vertexCount, [=](size_t vertex) {
+            return (vertices + (static_cast<size_t>(vertexIndices[vertex]) * vertexStride));
+        }, objectW);
+    }
+
+
+    size_t cullBoundingVolumes(const BVHFrustum& frustum, const BoundingVolumeSet& volumes, float padding, float wOffset,
+                               std::vector<uint8_t>& visible, unsigned int threadCount) {
+        const size_t objectCount = volumes.size();
+        visible.resize(objectCount);
+        if (objectCount == 0u)
+            return 0u;
+        if (threadCount == AUTOMATIC_CULLING_THREAD_COUNT)
+            threadCount = chooseCullingThreadCount(objectCount);
+
+        const CullingPlanes planes = prepareCullingPlanes(frustum, padding);
+        const size_t rangeCount = countParallelRanges(threadCount, objectCount);
+        std::vector<size_t> rangeVisibleCounts(rangeCount, 0u);
+        runInParallelRanges(rangeCount, objectCount, [&](size_t range, size_t begin, size_t end) {
+            rangeVisibleCounts[range] = cullRange(volumes, begin, end, planes, padding, wOffset, visible);
+        });
+
+        size_t visibleCount = 0u;
+        for (const size_t count : rangeVisibleCounts)
+            visibleCount += count;
+        return visibleCount;
+    }
+
+} //namespace AssetLoadingInternal
@@ -0,0 +1,76 @@
+// File:           FrustumCulling.h
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Finds which objects of a scene are entirely outside of the view frustum, so that drawing
+//                 them can be skipped. Each object is bounded by both a sphere and a box. The sphere is cheap
+//                 to test and the box fits most objects more tightly, and an object is only culled once either
+//                 of them is found to be entirely outside of one of the frustum's planes. Culling never skips
+//                 an object that could be visible, but may keep an object which is just outside the frustum.
+//
+//                 The bounds are stored as one array per component [a structure of arrays], which lets each
+//                 plane be tested against 4 objects at once with SSE instructions. There is a scalar path which
+//                 gives the same results on platforms without SSE2. Large scenes are split across threads.
+//
+//                 None of this touches the GL Context, so culling can be run (and checked) entirely on the CPU.
+//
+// Positions:      Each object's positions are treated as homogeneous coordinates (x, y, z, w), with 1 value
+//                 of w shared by the whole object. For ordinary positions that is 1. QuickObj stores a model's
+//                 scale as w, so passing each model's scale lets the bounds stay in the same space as the
+//                 vertices that get uploaded.
+
+#pragma once
+
+#ifndef FRUSTUM_CULLING_H_
+#define FRUSTUM_CULLING_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "TriangleBVH.h" //For BVHFrustum and extractFrustumPlanes()
+
+namespace AssetLoadingInternal {
+
+    //Passing this as the thread count lets culling decide how many threads to use
+    static constexpr const unsigned int AUTOMATIC_CULLING_THREAD_COUNT = 0u;
+
+    //Fewer objects per thread than this aren't worth the cost of starting the thread
+    static constexpr const size_t MIN_OBJECTS_PER_CULLING_THREAD = 16384u;
+
+    //Returns how many threads to use when culling the given number of objects
+    unsigned int chooseCullingThreadCount(size_t objectCount) noexcept;
+
+    //The bounding sphere and bounding box of every object in a scene, one entry per object in each array
+    typedef struct BoundingVolumeSet {
+        std::vector<float> sphereX, sphereY, sphereZ, sphereRadius;
+        std::vector<float> boxMinX, boxMinY, boxMinZ;
+        std::vector<float> boxMaxX, boxMaxY, boxMaxZ;
+        std::vector<float> w; //The w shared by all of the object's positions
+
+        size_t size() const noexcept { return w.size(); }
+        void clear() noexcept;
+
+        //Appends the bounds of an object with 'vertexCount' vertices of 'vertexStride' floats each, with the
+        //position in the first 3 floats of each vertex. The box is the tightest one around the positions, and the
+        //sphere is centered on the box. An object without vertices gets bounds of just the origin. Returns the
+        //index of the object.
+        size_t addObject(const float * vertices, size_t vertexStride, size_t vertexCount, float objectW = 1.0f);
+        //Same as above, but for just the 'vertexCount' vertices listed in 'vertexIndices' (e.g. the vertices of 1
+        //meshlet out of a larger mesh)
+        size_t addObject(const float * vertices, size_t vertexStride, const uint32_t * vertexIndices, size_t vertexCount,
+                         float objectW = 1.0f);
+    } BoundingVolumeSet;
+
+    //Tests every object in 'volumes' against the frustum's planes [see BVHFrustum], setting 'visible[i]' to 1 if
+    //object i may be visible or to 0 if it is entirely outside of the frustum. Returns the number that may be visible.
+    //   'padding'  grows every object's bounds by this far in each direction, for when the vertices may be moved
+    //              from where they were when the bounds were computed (e.g. by a vertex shader)
+    //   'wOffset'  is added to every object's w. Objects whose w comes out to 0 or less are always kept.
+    size_t cullBoundingVolumes(const BVHFrustum& frustum, const BoundingVolumeSet& volumes, float padding, float wOffset,
+                               std::vector<uint8_t>& visible, unsigned int threadCount = AUTOMATIC_CULLING_THREAD_COUNT);
+
+} //namespace AssetLoadingInternal
+
+#endif //FRUSTUM_CULLING_H_
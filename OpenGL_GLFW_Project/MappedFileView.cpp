@@ -0,0 +1,166 @@
+// File:           MappedFileView.cpp
+//
+//  See header file for details.
+//
+//  Platform Notes:    All of the platform-specific code for this class lives in this file.
+//                     The Windows path needs <Windows.h>, which is deliberately kept out of the
+//                     header so that it does not leak its macros into the rest of the project.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "MappedFileView.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif //WIN32_LEAN_AND_MEAN
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif //NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>     //open
+#include <unistd.h>    //close
+#include <sys/mman.h>  //mmap, munmap, madvise
+#include <sys/stat.h>  //fstat
+#endif //_WIN32
+
+
+namespace AssetLoadingInternal {
+
+    void MappedFileView::initialize() noexcept {
+        mData_ = nullptr;
+        mSize_ = 0u;
+        mValid_ = false;
+#ifdef _WIN32
+        mFileHandle_ = INVALID_HANDLE_VALUE;
+        mMappingHandle_ = nullptr;
+#endif //_WIN32
+    }
+
+#ifdef _WIN32
+
+    MappedFileView::MappedFileView(const std::string& filepath) {
+        initialize();
+
+        mFileHandle_ = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (mFileHandle_ == INVALID_HANDLE_VALUE) {
+            fprintf(ERRLOG, "\nERROR! Unable to open file \"%s\" for memory mapping!\n", filepath.c_str());
+            return;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(mFileHandle_, &fileSize)) {
+            fprintf(ERRLOG, "\nERROR! Unable to query the size of file \"%s\"!\n", filepath.c_str());
+            release();
+            return;
+        }
+        if (fileSize.QuadPart == 0) { //Empty files can't be mapped, but they aren't an error either
+            mValid_ = true;
+            return;
+        }
+
+        mMappingHandle_ = CreateFileMappingA(mFileHandle_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mMappingHandle_ == nullptr) {
+            fprintf(ERRLOG, "\nERROR! CreateFileMapping() failed for file \"%s\"!\n", filepath.c_str());
+            release();
+            return;
+        }
+
+        mData_ = static_cast<const char*>(MapViewOfFile(mMappingHandle_, FILE_MAP_READ, 0, 0, 0));
+        if (mData_ == nullptr) {
+            fprintf(ERRLOG, "\nERROR! MapViewOfFile() failed for file \"%s\"!\n", filepath.c_str());
+            release();
+            return;
+        }
+        mSize_ = static_cast<size_t>(fileSize.QuadPart);
+        mValid_ = true;
+    }
+
+    void MappedFileView::release() noexcept {
+        if (mData_ != nullptr)
+            UnmapViewOfFile(mData_);
+        if (mMappingHandle_ != nullptr)
+            CloseHandle(mMappingHandle_);
+        if (mFileHandle_ != INVALID_HANDLE_VALUE)
+            CloseHandle(mFileHandle_);
+        initialize();
+    }
+
+#else
+
+    MappedFileView::MappedFileView(const std::string& filepath) {
+        initialize();
+
+        const int fd = open(filepath.c_str(), O_RDONLY);
+        if (fd < 0) {
+            fprintf(ERRLOG, "\nERROR! Unable to open file \"%s\" for memory mapping!\n", filepath.c_str());
+            return;
+        }
+
+        struct stat fileStats;
+        if (fstat(fd, &fileStats) != 0) {
+            fprintf(ERRLOG, "\nERROR! Unable to query the size of file \"%s\"!\n", filepath.c_str());
+            close(fd);
+            return;
+        }
+        if (fileStats.st_size == 0) { //Empty files can't be mapped, but they aren't an error either
+            close(fd);
+            mValid_ = true;
+            return;
+        }
+
+        void* mapping = mmap(nullptr, static_cast<size_t>(fileStats.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd); //The mapping keeps its own reference to the file
+        if (mapping == MAP_FAILED) {
+            fprintf(ERRLOG, "\nERROR! mmap() failed for file \"%s\"!\n", filepath.c_str());
+            return;
+        }
+
+        //The text is always consumed front-to-back, so ask for aggressive readahead. This
+        //is only a hint, so a failure here is harmless and is ignored.
+        madvise(mapping, static_cast<size_t>(fileStats.st_size), MADV_SEQUENTIAL);
+
+        mData_ = static_cast<const char*>(mapping);
+        mSize_ = static_cast<size_t>(fileStats.st_size);
+        mValid_ = true;
+    }
+
+    void MappedFileView::release() noexcept {
+        if (mData_ != nullptr)
+            munmap(const_cast<char*>(mData_), mSize_);
+        initialize();
+    }
+
+#endif //_WIN32
+
+    MappedFileView::~MappedFileView() noexcept {
+        release();
+    }
+
+    void MappedFileView::steal(MappedFileView& that) noexcept {
+        mData_ = that.mData_;
+        mSize_ = that.mSize_;
+        mValid_ = that.mValid_;
+#ifdef _WIN32
+        mFileHandle_ = that.mFileHandle_;
+        mMappingHandle_ = that.mMappingHandle_;
+#endif //_WIN32
+        that.initialize(); //Leave 'that' owning nothing so its destructor is harmless
+    }
+
+    MappedFileView::MappedFileView(MappedFileView&& that) noexcept {
+        steal(that);
+    }
+
+    MappedFileView& MappedFileView::operator=(MappedFileView&& that) noexcept {
+        if (this != &that) {
+            release();
+            steal(that);
+        }
+        return *this;
+    }
+
+} //namespace AssetLoadingInternal
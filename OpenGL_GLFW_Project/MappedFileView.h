@@ -0,0 +1,78 @@
+// File:           MappedFileView.h
+// Class:          MappedFileView
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    A small RAII wrapper around a read-only memory mapping of an entire
+//                 file. The mapped bytes are exposed as a std::string_view, which allows
+//                 ASCII asset text to be walked directly out of the page cache without first
+//                 being copied into a std::string.
+//
+//                 On Windows the mapping is created with CreateFileMapping()/MapViewOfFile(),
+//                 with the file opened using the FILE_FLAG_SEQUENTIAL_SCAN hint. On POSIX systems
+//                 mmap() is used and the kernel is told through madvise(MADV_SEQUENTIAL) that the
+//                 pages will be read front-to-back so that it can perform aggressive readahead.
+//
+// Usage Notes:    The view returned by 'text()' is only valid for as long as this object is
+//                 alive. Objects of this type are move-only, the mapping belongs to exactly one
+//                 owner at a time. [AsciiAsset holds one through a std::shared_ptr so that its
+//                 own copy semantics keep working]
+//
+//                 An empty file is considered to be successfully mapped (mapping a 0-byte file
+//                 is an error on both platforms, so no mapping is actually created), it will just
+//                 have an empty text view.
+
+
+#pragma once
+
+#ifndef MAPPED_FILE_VIEW_H_
+#define MAPPED_FILE_VIEW_H_
+
+#include <string>
+#include <string_view>
+
+#include "LoggingMessageTargets.h"
+
+namespace AssetLoadingInternal {
+
+    class MappedFileView final {
+    public:
+        MappedFileView() = delete;
+        //Attempts to map the file at the provided filepath into memory. Use 'valid()' to check
+        //if the mapping was successful.
+        MappedFileView(const std::string& filepath);
+        ~MappedFileView() noexcept;
+
+        MappedFileView(const MappedFileView&) = delete;
+        MappedFileView& operator=(const MappedFileView&) = delete;
+        MappedFileView(MappedFileView&&) noexcept;
+        MappedFileView& operator=(MappedFileView&&) noexcept;
+
+        //Returns true if the file was mapped (or was found to be empty)
+        bool valid() const noexcept { return mValid_; }
+
+        //Returns a view of the entire mapped file
+        std::string_view text() const noexcept { return std::string_view(mData_, mSize_); }
+
+        //Returns the size of the mapped file in bytes
+        size_t size() const noexcept { return mSize_; }
+
+    private:
+        const char* mData_;
+        size_t mSize_;
+        bool mValid_;
+
+#ifdef _WIN32
+        void* mFileHandle_;
+        void* mMappingHandle_;
+#endif //_WIN32
+
+        void initialize() noexcept;
+        void release() noexcept;
+        void steal(MappedFileView& that) noexcept;
+    };
+
+} //namespace AssetLoadingInternal
+
+#endif //MAPPED_FILE_VIEW_H_
@@ -0,0 +1,429 @@
+// File:           MeshOptimizer.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   The vertex cache optimization keeps each vertex's list of adjacent triangles
+//                          packed into one array (every vertex owns a slice of it). Emitted triangles are
+//                          swapped to the end of their vertices' slices and the slices shrink, so only
+//                          triangles still waiting to be emitted are ever rescored. The next triangle is
+//                          picked from among the triangles touching the simulated cache. When none are
+//                          left (i.e. a piece of the mesh has been finished off) the next triangle which
+//                          hasn't been emitted is taken, in the original order, which is what keeps the
+//                          whole thing linear.
+//
+//                          The FIFO cache simulation records when each vertex was last added to the cache
+//                          instead of keeping an actual queue, a vertex is in the cache if fewer than
+//                          'cacheSize' other vertices have been added since. Emptying the cache is done by
+//                          jumping the clock forward.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "MeshOptimizer.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>     //memcpy
+#include <limits>
+#include <vector>
+
+namespace AssetLoadingInternal {
+
+    namespace {
+
+        static constexpr const uint32_t NO_TRIANGLE = std::numeric_limits<uint32_t>::max();
+        static constexpr const uint32_t UNUSED_VERTEX = std::numeric_limits<uint32_t>::max();
+
+        ///////////////////////////////////////////////////
+        // Forsyth's scoring
+        ///////////////////////////////////////////////////
+
+        //The values suggested by Forsyth's article
+        static constexpr const size_t FORSYTH_CACHE_SIZE = 32u;
+        static constexpr const float CACHE_DECAY_POWER = 1.5f;
+        static constexpr const float LAST_TRIANGLE_SCORE = 0.75f;
+        static constexpr const float VALENCE_BOOST_SCALE = 2.0f;
+        static constexpr const float VALENCE_BOOST_POWER = 0.5f;
+        //Vertices used by more than this many triangles have their valence score computed on the spot
+        static constexpr const uint32_t MAX_TABULATED_VALENCE = 32u;
+
+        class ForsythScoreTables final {
+        public:
+            ForsythScoreTables() {
+                for (size_t position = 0u; position < FORSYTH_CACHE_SIZE; position++) {
+                    //The 3 vertices of the triangle just emitted all get the same score, on purpose, since
+                    //otherwise the next triangle would be biased towards one particular edge of it
+                    if (position < 3u)
+                        mCacheScores_[position] = LAST_TRIANGLE_SCORE;
+                    else {
+                        const float scaler = 1.0f / static_cast<float>(FORSYTH_CACHE_SIZE - 3u);
+                        mCacheScores_[position] = std::pow(1.0f - (static_cast<float>(position - 3u) * scaler), CACHE_DECAY_POWER);
+                    }
+                }
+                mValenceScores_[0] = 0.0f;
+                for (uint32_t valence = 1u; valence <= MAX_TABULATED_VALENCE; valence++)
+                    mValenceScores_[valence] = computeValenceScore(valence);
+            }
+
+            //A vertex with no triangles left to emit is worthless, otherwise vertices are worth more the
+            //more recently they were used and the fewer triangles still need them [finishing off a vertex
+            //that only has a triangle or 2 left keeps it from becoming a lone cache miss later on]
+            float score(int cachePosition, uint32_t remainingTriangles) const noexcept {
+                if (remainingTriangles == 0u)
+                    return -1.0f;
+                float score = ((cachePosition >= 0) ? mCacheScores_[cachePosition] : 0.0f);
+                if (remainingTriangles <= MAX_TABULATED_VALENCE)
+                    score += mValenceScores_[remainingTriangles];
+                else
+                    score += computeValenceScore(remainingTriangles);
+                return score;
+            }
+
+        private:
+            float mCacheScores_[FORSYTH_CACHE_SIZE];
+            float mValenceScores_[MAX_TABULATED_VALENCE + 1u];
+
+            static float computeValenceScore(uint32_t remainingTriangles) noexcept {
+                return (VALENCE_BOOST_SCALE * std::pow(static_cast<float>(remainingTriangles), -VALENCE_BOOST_POWER));
+            }
+        };
+
+
+        ///////////////////////////////////////////////////
+        // FIFO cache simulation
+        ///////////////////////////////////////////////////
+
+        class SimulatedFifoCache final {
+        public:
+            SimulatedFifoCache(size_t vertexCount, size_t cacheSize) : mTimestamps_(vertexCount, 0u),
+                mCacheSize_(static_cast<uint32_t>(cacheSize)), mTime_(static_cast<uint32_t>(cacheSize) + 1u) { ; }
+
+            //Returns the number of the triangle's vertices which were not in the cache
+            size_t drawTriangle(const uint32_t * triangle) noexcept {
+                size_t misses = 0u;
+                for (size_t corner = 0u; corner < 3u; corner++) {
+                    const uint32_t vertex = triangle[corner];
+                    if ((mTime_ - mTimestamps_[vertex]) > mCacheSize_) {
+                        mTimestamps_[vertex] = mTime_++;
+                        misses++;
+                    }
+                }
+                return misses;
+            }
+
+            void empty() noexcept { mTime_ += (mCacheSize_ + 1u); }
+
+        private:
+            std::vector<uint32_t> mTimestamps_;
+            uint32_t mCacheSize_;
+            uint32_t mTime_;
+        };
+
+
+        ///////////////////////////////////////////////////
+        // Overdraw clustering
+        ///////////////////////////////////////////////////
+
+        typedef struct TriangleCluster {
+            size_t firstTriangle;
+            size_t triangleCount;
+            float sortKey;
+        } TriangleCluster;
+
+        //A new cluster starts at every triangle which missed the cache with all 3 of its vertices, since
+        //the cache is effectively starting over there anyways. Each of these clusters is then split up
+        //further, wherever the cache hit rate since the last split has caught back up to within 'threshold'
+        //of the cluster's overall hit rate.
+        std::vector<TriangleCluster> splitIntoClusters(const uint32_t * indices, size_t triangleCount,
+                                                       size_t vertexCount, float threshold) {
+            std::vector<size_t> hardBoundaries;
+            SimulatedFifoCache cache(vertexCount, DEFAULT_SIMULATED_VERTEX_CACHE_SIZE);
+            for (size_t triangle = 0u; triangle < triangleCount; triangle++) {
+                if ((cache.drawTriangle(indices + (3u * triangle)) == 3u) || (triangle == 0u))
+                    hardBoundaries.push_back(triangle);
+            }
+            hardBoundaries.push_back(triangleCount);
+
+            std::vector<TriangleCluster> clusters;
+            for (size_t i = 0u; (i + 1u) < hardBoundaries.size(); i++) {
+                const size_t start = hardBoundaries[i];
+                const size_t end = hardBoundaries[i + 1u];
+
+                cache.empty();
+                size_t clusterMisses = 0u;
+                for (size_t triangle = start; triangle < end; triangle++)
+                    clusterMisses += cache.drawTriangle(indices + (3u * triangle));
+                const float targetMissesPerTriangle = threshold * (static_cast<float>(clusterMisses) / static_cast<float>(end - start));
+
+                cache.empty();
+                size_t pieceStart = start;
+                size_t pieceMisses = 0u;
+                for (size_t triangle = start; triangle < end; triangle++) {
+                    pieceMisses += cache.drawTriangle(indices + (3u * triangle));
+                    const size_t pieceTriangles = (triangle + 1u) - pieceStart;
+                    if (((triangle + 1u) < end) && (static_cast<float>(pieceMisses) <= (targetMissesPerTriangle * static_cast<float>(pieceTriangles)))) {
+                        clusters.push_back({ pieceStart, pieceTriangles, 0.0f });
+                        pieceStart = triangle + 1u;
+                        pieceMisses = 0u;
+                        cache.empty();
+                    }
+                }
+                clusters.push_back({ pieceStart, end - pieceStart, 0.0f });
+            }
+            return clusters;
+        }
+
+        inline void subtract(const float * a, const float * b, float result[3]) noexcept {
+            result[0] = a[0] - b[0];
+            result[1] = a[1] - b[1];
+            result[2] = a[2] - b[2];
+        }
+
+    } //namespace
+
+
+    VertexCacheStatistics analyzeVertexCache(const uint32_t * indices, size_t indexCount, size_t vertexCount, size_t cacheSize) {
+        VertexCacheStatistics statistics = { 0u, 0.0f, 0.0f };
+        const size_t triangleCount = indexCount / 3u;
+        if ((triangleCount == 0u) || (vertexCount == 0u))
+            return statistics;
+
+        SimulatedFifoCache cache(vertexCount, cacheSize);
+        for (size_t triangle = 0u; triangle < triangleCount; triangle++)
+            statistics.vertexShaderInvocations += cache.drawTriangle(indices + (3u * triangle));
+
+        statistics.acmr = static_cast<float>(statistics.vertexShaderInvocations) / static_cast<float>(triangleCount);
+        statistics.atvr = static_cast<float>(statistics.vertexShaderInvocations) / static_cast<float>(vertexCount);
+        return statistics;
+    }
+
+
+    void optimizeVertexCache(uint32_t * indices, size_t indexCount, size_t vertexCount) {
+        const size_t triangleCount = indexCount / 3u;
+        if ((triangleCount < 2u) || (vertexCount == 0u))
+            return;
+
+        static const ForsythScoreTables scoreTables;
+
+        //Each vertex's adjacent triangles are 'adjacency[firstAdjacent[v]]' through 'adjacency[firstAdjacent[v] + remaining[v] - 1]'
+        std::vector<uint32_t> remaining(vertexCount, 0u);
+        for (size_t i = 0u; i < (triangleCount * 3u); i++)
+            remaining[indices[i]]++;
+        std::vector<size_t> firstAdjacent(vertexCount);
+        size_t adjacencyOffset = 0u;
+        for (size_t vertex = 0u; vertex < vertexCount; vertex++) {
+            firstAdjacent[vertex] = adjacencyOffset;
+            adjacencyOffset += remaining[vertex];
+        }
+        std::vector<uint32_t> adjacency(triangleCount * 3u);
+        {
+            std::vector<uint32_t> filled(vertexCount, 0u);
+            for (size_t i = 0u; i < (triangleCount * 3u); i++) {
+                const uint32_t vertex = indices[i];
+                adjacency[firstAdjacent[vertex] + filled[vertex]++] = static_cast<uint32_t>(i / 3u);
+            }
+        }
+
+        std::vector<int> cachePosition(vertexCount, -1);
+        std::vector<float> vertexScore(vertexCount);
+        for (size_t vertex = 0u; vertex < vertexCount; vertex++)
+            vertexScore[vertex] = scoreTables.score(-1, remaining[vertex]);
+
+        std::vector<float> triangleScore(triangleCount);
+        std::vector<bool> emitted(triangleCount, false);
+        uint32_t bestTriangle = NO_TRIANGLE;
+        float bestScore = -1.0f;
+        for (size_t triangle = 0u; triangle < triangleCount; triangle++) {
+            const uint32_t * corners = indices + (3u * triangle);
+            triangleScore[triangle] = vertexScore[corners[0]] + vertexScore[corners[1]] + vertexScore[corners[2]];
+            if (triangleScore[triangle] > bestScore) {
+                bestScore = triangleScore[triangle];
+                bestTriangle = static_cast<uint32_t>(triangle);
+            }
+        }
+
+        //Holds the cache after the emitted triangle's vertices get pushed onto the front of it, before
+        //the (up to 3) vertices pushed off the back are dropped
+        uint32_t cache[FORSYTH_CACHE_SIZE + 3u];
+        uint32_t pushedCache[FORSYTH_CACHE_SIZE + 3u];
+        size_t cacheCount = 0u;
+        size_t nextUnemittedTriangle = 0u;
+
+        std::vector<uint32_t> reordered(triangleCount * 3u);
+        for (size_t output = 0u; output < triangleCount; output++) {
+            if (bestTriangle == NO_TRIANGLE) {
+                while (emitted[nextUnemittedTriangle])
+                    nextUnemittedTriangle++;
+                bestTriangle = static_cast<uint32_t>(nextUnemittedTriangle);
+            }
+
+            const uint32_t * corners = indices + (3u * static_cast<size_t>(bestTriangle));
+            memcpy(reordered.data() + (3u * output), corners, 3u * sizeof(uint32_t));
+            emitted[bestTriangle] = true;
+
+            //Take the triangle out of each of its vertices' adjacency lists
+            for (size_t corner = 0u; corner < 3u; corner++) {
+                const uint32_t vertex = corners[corner];
+                uint32_t * adjacent = adjacency.data() + firstAdjacent[vertex];
+                const uint32_t last = remaining[vertex] - 1u;
+                for (uint32_t i = 0u; i <= last; i++) {
+                    if (adjacent[i] == bestTriangle) {
+                        std::swap(adjacent[i], adjacent[last]);
+                        break;
+                    }
+                }
+                remaining[vertex]--;
+            }
+
+            //The triangle's vertices move to the front of the cache
+            size_t pushedCount = 0u;
+            for (size_t corner = 0u; corner < 3u; corner++) {
+                if (std::find(pushedCache, pushedCache + pushedCount, corners[corner]) == (pushedCache + pushedCount))
+                    pushedCache[pushedCount++] = corners[corner];
+            }
+            for (size_t i = 0u; i < cacheCount; i++) {
+                const uint32_t vertex = cache[i];
+                if ((vertex != corners[0]) && (vertex != corners[1]) && (vertex != corners[2]))
+                    pushedCache[pushedCount++] = vertex;
+            }
+
+            //Rescore every vertex whose cache position changed (including those pushed out), then every
+            //triangle still waiting on one of those vertices
+            for (size_t i = 0u; i < pushedCount; i++) {
+                const uint32_t vertex = pushedCache[i];
+                cachePosition[vertex] = ((i < FORSYTH_CACHE_SIZE) ? static_cast<int>(i) : -1);
+                vertexScore[vertex] = scoreTables.score(cachePosition[vertex], remaining[vertex]);
+            }
+            for (size_t i = 0u; i < pushedCount; i++) {
+                const uint32_t vertex = pushedCache[i];
+                const uint32_t * adjacent = adjacency.data() + firstAdjacent[vertex];
+                for (uint32_t j = 0u; j < remaining[vertex]; j++) {
+                    const uint32_t * triangle = indices + (3u * static_cast<size_t>(adjacent[j]));
+                    triangleScore[adjacent[j]] = vertexScore[triangle[0]] + vertexScore[triangle[1]] + vertexScore[triangle[2]];
+                }
+            }
+
+            cacheCount = std::min(pushedCount, FORSYTH_CACHE_SIZE);
+            memcpy(cache, pushedCache, cacheCount * sizeof(uint32_t));
+
+            //The next triangle is the best one touching the cache
+            bestTriangle = NO_TRIANGLE;
+            bestScore = -1.0f;
+            for (size_t i = 0u; i < cacheCount; i++) {
+                const uint32_t vertex = cache[i];
+                const uint32_t * adjacent = adjacency.data() + firstAdjacent[vertex];
+                for (uint32_t j = 0u; j < remaining[vertex]; j++) {
+                    if (triangleScore[adjacent[j]] > bestScore) {
+                        bestScore = triangleScore[adjacent[j]];
+                        bestTriangle = adjacent[j];
+                    }
+                }
+            }
+        }
+
+        memcpy(indices, reordered.data(), reordered.size() * sizeof(uint32_t));
+    }
+
+
+    void optimizeOverdraw(uint32_t * indices, size_t indexCount, const float * vertices, size_t vertexCount,
+                          size_t vertexStride, float threshold) {
+        const size_t triangleCount = indexCount / 3u;
+        if ((triangleCount < 2u) || (vertexCount == 0u) || (vertexStride < 3u))
+            return;
+
+        std::vector<TriangleCluster> clusters = splitIntoClusters(indices, triangleCount, vertexCount, threshold);
+        if (clusters.size() < 2u)
+            return;
+
+        //Each cluster's area-weighted centroid and its summed (area-weighted) normal
+        std::vector<std::array<float, 3>> centroids(clusters.size());
+        std::vector<std::array<float, 3>> normals(clusters.size());
+        std::vector<float> areas(clusters.size());
+        float meshCentroid[3] = { 0.0f, 0.0f, 0.0f };
+        float meshArea = 0.0f;
+        for (size_t c = 0u; c < clusters.size(); c++) {
+            float centroid[3] = { 0.0f, 0.0f, 0.0f };
+            float normal[3] = { 0.0f, 0.0f, 0.0f };
+            float area = 0.0f;
+            for (size_t triangle = clusters[c].firstTriangle; triangle < (clusters[c].firstTriangle + clusters[c].triangleCount); triangle++) {
+                const float * p0 = vertices + (indices[3u * triangle] * vertexStride);
+                const float * p1 = vertices + (indices[(3u * triangle) + 1u] * vertexStride);
+                const float * p2 = vertices + (indices[(3u * triangle) + 2u] * vertexStride);
+                float edge1[3], edge2[3];
+                subtract(p1, p0, edge1);
+                subtract(p2, p0, edge2);
+                const float cross[3] = { (edge1[1] * edge2[2]) - (edge1[2] * edge2[1]),
+                                         (edge1[2] * edge2[0]) - (edge1[0] * edge2[2]),
+                                         (edge1[0] * edge2[1]) - (edge1[1] * edge2[0]) };
+                const float triangleArea = std::sqrt((cross[0] * cross[0]) + (cross[1] * cross[1]) + (cross[2] * cross[2]));
+                for (size_t axis = 0u; axis < 3u; axis++) {
+                    centroid[axis] += ((p0[axis] + p1[axis] + p2[axis]) / 3.0f) * triangleArea;
+                    normal[axis] += cross[axis];
+                }
+                area += triangleArea;
+            }
+            for (size_t axis = 0u; axis < 3u; axis++) {
+                meshCentroid[axis] += centroid[axis];
+                centroids[c][axis] = ((area > 0.0f) ? (centroid[axis] / area) : 0.0f);
+                normals[c][axis] = normal[axis];
+            }
+            areas[c] = area;
+            meshArea += area;
+        }
+        if (meshArea <= 0.0f)
+            return; //Every triangle is degenerate, so there is nothing to sort by
+        for (size_t axis = 0u; axis < 3u; axis++)
+            meshCentroid[axis] /= meshArea;
+
+        //Clusters facing away from the middle of the mesh are the most likely to be in front of other
+        //clusters, so they get drawn first
+        for (size_t c = 0u; c < clusters.size(); c++) {
+            const float * n = normals[c].data();
+            const float length = std::sqrt((n[0] * n[0]) + (n[1] * n[1]) + (n[2] * n[2]));
+            if ((areas[c] <= 0.0f) || (length <= 0.0f))
+                continue; //Leave degenerate clusters with a key of 0
+            float outwards[3];
+            subtract(centroids[c].data(), meshCentroid, outwards);
+            clusters[c].sortKey = ((outwards[0] * n[0]) + (outwards[1] * n[1]) + (outwards[2] * n[2])) / length;
+        }
+        std::stable_sort(clusters.begin(), clusters.end(), [](const TriangleCluster& a, const TriangleCluster& b) {
+            return (a.sortKey > b.sortKey);
+        });
+
+        std::vector<uint32_t> reordered;
+        reordered.reserve(triangleCount * 3u);
+        for (const TriangleCluster& cluster : clusters) {
+            const uint32_t * first = indices + (3u * cluster.firstTriangle);
+            reordered.insert(reordered.end(), first, first + (3u * cluster.triangleCount));
+        }
+        memcpy(indices, reordered.data(), reordered.size() * sizeof(uint32_t));
+    }
+
+
+    void optimizeVertexFetch(uint32_t * indices, size_t indexCount, float * vertices, size_t vertexCount,
+                             size_t vertexStride) {
+        if ((indexCount == 0u) || (vertexCount == 0u))
+            return;
+
+        std::vector<uint32_t> remap(vertexCount, UNUSED_VERTEX);
+        uint32_t nextVertex = 0u;
+        for (size_t i = 0u; i < indexCount; i++) {
+            if (remap[indices[i]] == UNUSED_VERTEX)
+                remap[indices[i]] = nextVertex++;
+        }
+        for (size_t vertex = 0u; vertex < vertexCount; vertex++) {
+            if (remap[vertex] == UNUSED_VERTEX)
+                remap[vertex] = nextVertex++;
+        }
+
+        std::vector<float> reordered(vertexCount * vertexStride);
+        for (size_t vertex = 0u; vertex < vertexCount; vertex++)
+            memcpy(reordered.data() + (remap[vertex] * vertexStride), vertices + (vertex * vertexStride), vertexStride * sizeof(float));
+        memcpy(vertices, reordered.data(), reordered.size() * sizeof(float));
+
+        for (size_t i = 0u; i < indexCount; i++)
+            indices[i] = remap[indices[i]];
+    }
+
+} //namespace AssetLoadingInternal
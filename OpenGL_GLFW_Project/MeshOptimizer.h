@@ -0,0 +1,82 @@
+// File:           MeshOptimizer.h
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Reorders the triangles and vertices of an indexed mesh so that the GPU does less
+//                 work drawing it. An indexed mesh straight out of an '.obj' file has its triangles in
+//                 whatever order the exporter wrote its faces in, which often jumps all over the mesh.
+//                 The GPU keeps the results of recently run vertex shader invocations in a small
+//                 post-transform cache, so every time a triangle refers to a vertex that has dropped
+//                 out of that cache the vertex shader has to be run for it again.
+//
+//                 There are 3 steps, each of which only ever reorders data (the mesh drawn is identical):
+//                   (i)   'optimizeVertexCache()' reorders triangles so that each one reuses as many
+//                         recently used vertices as possible. This uses Tom Forsyth's "Linear-Speed
+//                         Vertex Cache Optimisation", which greedily picks the next triangle by scoring
+//                         each vertex on how recently it was used and on how many triangles still need it.
+//                   (ii)  'optimizeOverdraw()' (optional) splits the vertex-cache-optimized triangles up
+//                         into clusters and sorts the clusters so that the ones facing outwards from the
+//                         middle of the mesh get drawn first, which lets the depth test reject more of
+//                         what gets drawn behind them. This is the clustering from Sander, Nehab and
+//                         Barczak's "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw".
+//                         Splitting into clusters costs some vertex cache hits, the 'threshold' limits
+//                         how many.
+//                   (iii) 'optimizeVertexFetch()' reorders the vertices themselves into the order the
+//                         triangles first use them in, so that fetching them walks forwards through memory.
+//
+//                 The effect on the vertex cache is measured with 'analyzeVertexCache()', which simulates
+//                 a FIFO cache of the sort most GPUs use. It reports the ACMR (average cache miss ratio,
+//                 which is the number of vertex shader invocations per triangle, between 0.5 and 3.0 with
+//                 lower being better) and the ATVR (average transformed vertex ratio, the number of
+//                 invocations per vertex, with 1.0 being perfect). The number of invocations actually run
+//                 can be checked on the GPU with PipelineObserver's VERTEX_SHADER_INVOCATIONS_QUERY.
+//
+// Note:           Every index must be less than the vertex count. Each function works on 32-bit indices,
+//                 the indices can be narrowed afterwards.
+
+#pragma once
+
+#ifndef MESH_OPTIMIZER_H_
+#define MESH_OPTIMIZER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace AssetLoadingInternal {
+
+    //The size of the FIFO cache simulated by 'analyzeVertexCache()' when no size is given. Real hardware
+    //varies, but 16 entries is a reasonable middle ground which the optimized order isn't tuned to.
+    static constexpr const size_t DEFAULT_SIMULATED_VERTEX_CACHE_SIZE = 16u;
+
+    //How much worse than the vertex-cache-optimized order 'optimizeOverdraw()' lets each cluster get. 1.05 allows
+    //each cluster's ACMR to be up to 5% higher than it was before the triangles were split into clusters.
+    static constexpr const float DEFAULT_OVERDRAW_THRESHOLD = 1.05f;
+
+    typedef struct VertexCacheStatistics {
+        size_t vertexShaderInvocations; //The number of cache misses
+        float acmr;                     //Invocations per triangle
+        float atvr;                     //Invocations per vertex
+    } VertexCacheStatistics;
+
+    //Simulates drawing the triangles through a FIFO post-transform cache with 'cacheSize' entries
+    VertexCacheStatistics analyzeVertexCache(const uint32_t * indices, size_t indexCount, size_t vertexCount,
+                                             size_t cacheSize = DEFAULT_SIMULATED_VERTEX_CACHE_SIZE);
+
+    //Reorders the triangles described by 'indices' (3 per triangle) to make the best use of the vertex cache.
+    //Triangles keep their winding.
+    void optimizeVertexCache(uint32_t * indices, size_t indexCount, size_t vertexCount);
+
+    //Reorders clusters of the triangles described by 'indices' to reduce overdraw. Call this after
+    //'optimizeVertexCache()'. Each vertex is 'vertexStride' floats, with its position in the first 3.
+    void optimizeOverdraw(uint32_t * indices, size_t indexCount, const float * vertices, size_t vertexCount,
+                          size_t vertexStride, float threshold = DEFAULT_OVERDRAW_THRESHOLD);
+
+    //Reorders the vertices (each 'vertexStride' floats) into the order 'indices' first uses them in, and
+    //rewrites the indices to match. Vertices which are never used end up after every used vertex.
+    void optimizeVertexFetch(uint32_t * indices, size_t indexCount, float * vertices, size_t vertexCount,
+                             size_t vertexStride);
+
+} //namespace AssetLoadingInternal
+
+#endif //MESH_OPTIMIZER_H_
@@ -0,0 +1,640 @@
+// File:           MeshSimplifier.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   Before anything is collapsed, vertices that share a position and only differ in
+//                          their attributes by less than the tolerances are welded together (a flat-shaded
+//                          mesh has a separate vertex for every face around each corner, and would otherwise
+//                          have nothing but seams). Whatever vertices are left sharing a position are that
+//                          position's 'wedge'.
+//
+//                          Each vertex is then given a kind, which decides where it is allowed to collapse to:
+//                            MANIFOLD  Surrounded by triangles on every side, can collapse onto any neighbour.
+//                            BORDER    On the edge of an open mesh, can only collapse along that edge.
+//                            SEAM      One of exactly 2 vertices at the same position, joined up along an
+//                                      edge of UV seam. Can only collapse along the seam, and the other
+//                                      vertex of the pair collapses along with it.
+//                            LOCKED    Anything more complicated (corners of seams, non-manifold vertices,
+//                                      3 or more vertices at one position) never moves.
+//                          Which kind a vertex is gets worked out once, from its 'open' edges (half-edges
+//                          with no opposite half-edge going the other way).
+//
+//                          Collapses are done in passes. Each pass finds the cheapest collapse for every
+//                          edge, sorts them by cost and does as many as it can. Every vertex touched by a
+//                          collapse is locked until the next pass so that the flip checks, which only look
+//                          at the triangles around the vertex being moved, stay valid. The indices are
+//                          remapped and the collapsed triangles dropped at the end of each pass.
+//
+//                          Quadrics are kept per position (so both vertices of a seam share one) in double
+//                          precision. Edges on borders and seams add an extra quadric for the plane running
+//                          through the edge at right angles to its triangle, which is what keeps borders
+//                          from shrinking.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "MeshSimplifier.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>     //memcpy
+#include <unordered_map>
+
+#include "PositionKey.h"
+
+namespace AssetLoadingInternal {
+
+    namespace {
+
+        static constexpr const uint32_t NO_VERTEX = std::numeric_limits<uint32_t>::max();
+        //Marks a vertex with more than one open edge leaving it (or arriving at it)
+        static constexpr const uint32_t MULTIPLE_VERTICES = NO_VERTEX - 1u;
+
+        //How much more the planes along borders count for than the planes of the triangles themselves
+        static constexpr const double BORDER_EDGE_WEIGHT = 10.0;
+        static constexpr const double SEAM_EDGE_WEIGHT = 1.0;
+
+        //Vertices at the same position only get welded when their texture coordinates are this close
+        static constexpr const float TEXCOORD_WELD_TOLERANCE = 1.0e-5f;
+
+        static constexpr const double PI = 3.14159265358979323846;
+
+        enum class VertexKind : uint8_t { MANIFOLD, BORDER, SEAM, LOCKED };
+
+        typedef struct Vec3 {
+            double x, y, z;
+        } Vec3;
+
+        inline Vec3 operator-(const Vec3& a, const Vec3& b) noexcept { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+        inline double dot(const Vec3& a, const Vec3& b) noexcept { return (a.x * b.x + a.y * b.y + a.z * b.z); }
+        inline Vec3 cross(const Vec3& a, const Vec3& b) noexcept {
+            return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+        }
+        inline double length(const Vec3& a) noexcept { return std::sqrt(dot(a, a)); }
+
+        //The symmetric 4x4 matrix of a quadric, stored as its upper triangle
+        typedef struct Quadric {
+            double a00, a11, a22, a01, a02, a12;
+            double b0, b1, b2;
+            double c;
+            double weight;
+        } Quadric;
+
+        //The quadric of the plane through 'point' with (unit length) normal 'n'
+        Quadric planeQuadric(const Vec3& n, const Vec3& point, double weight) noexcept {
+            const double d = -dot(n, point);
+            Quadric q;
+            q.a00 = weight * n.x * n.x;
+            q.a11 = weight * n.y * n.y;
+            q.a22 = weight * n.z * n.z;
+            q.a01 = weight * n.x * n.y;
+            q.a02 = weight * n.x * n.z;
+            q.a12 = weight * n.y * n.z;
+            q.b0 = weight * n.x * d;
+            q.b1 = weight * n.y * d;
+            q.b2 = weight * n.z * d;
+            q.c = weight * d * d;
+            q.weight = weight;
+            return q;
+        }
+
+        void addQuadric(Quadric& q, const Quadric& other) noexcept {
+            q.a00 += other.a00;
+            q.a11 += other.a11;
+            q.a22 += other.a22;
+            q.a01 += other.a01;
+            q.a02 += other.a02;
+            q.a12 += other.a12;
+            q.b0 += other.b0;
+            q.b1 += other.b1;
+            q.b2 += other.b2;
+            q.c += other.c;
+            q.weight += other.weight;
+        }
+
+        //The weighted mean of the squared distances from 'p' to the quadric's planes
+        double quadricError(const Quadric& q, const Vec3& p) noexcept {
+            const double rx = q.a00 * p.x + q.a01 * p.y + q.a02 * p.z + q.b0;
+            const double ry = q.a01 * p.x + q.a11 * p.y + q.a12 * p.z + q.b1;
+            const double rz = q.a02 * p.x + q.a12 * p.y + q.a22 * p.z + q.b2;
+            const double error = (rx * p.x + ry * p.y + rz * p.z) + (q.b0 * p.x + q.b1 * p.y + q.b2 * p.z) + q.c;
+            return ((q.weight > 0.0) ? (std::fabs(error) / q.weight) : 0.0);
+        }
+
+        bool isDegenerate(uint32_t a, uint32_t b, uint32_t c) noexcept {
+            return ((a == b) || (b == c) || (a == c));
+        }
+
+        //Every vertex's list of adjacent triangles, packed into one array
+        class TriangleAdjacency final {
+        public:
+            void build(const std::vector<uint32_t>& indices, size_t vertexCount) {
+                mOffsets_.assign(vertexCount + 1u, 0u);
+                for (uint32_t index : indices)
+                    mOffsets_[index + 1u]++;
+                for (size_t i = 0u; i < vertexCount; i++)
+                    mOffsets_[i + 1u] += mOffsets_[i];
+                mTriangles_.resize(indices.size());
+                std::vector<uint32_t> fill(mOffsets_.begin(), mOffsets_.end() - 1);
+                for (size_t i = 0u; i < indices.size(); i++)
+                    mTriangles_[fill[indices[i]]++] = static_cast<uint32_t>(i / 3u);
+            }
+            const uint32_t* begin(uint32_t vertex) const noexcept { return (mTriangles_.data() + mOffsets_[vertex]); }
+            const uint32_t* end(uint32_t vertex) const noexcept { return (mTriangles_.data() + mOffsets_[vertex + 1u]); }
+        private:
+            std::vector<uint32_t> mOffsets_;
+            std::vector<uint32_t> mTriangles_;
+        };
+
+        //The collapse of vertex 'from' onto vertex 'to'
+        typedef struct Collapse {
+            uint32_t from, to;
+            double error;
+        } Collapse;
+
+
+        class Simplifier final {
+        public:
+            Simplifier(const float* vertices, size_t vertexCount, const MeshSimplificationSettings& settings) :
+                mVertices_(vertices), mVertexCount_(vertexCount), mSettings_(settings) {
+                mCosMaxNormalDeviation_ = std::cos(static_cast<double>(settings.maxNormalDeviationDegrees) * PI / 180.0);
+            }
+
+            float run(std::vector<uint32_t>& indices, size_t targetIndexCount) {
+                removeDegenerateTriangles(indices);
+                if (indices.empty())
+                    return 0.0f;
+                buildPositionRemap(indices);
+                weldAttributes(indices);
+                removeDegenerateTriangles(indices);
+                if (indices.empty())
+                    return 0.0f;
+
+                const double extent = computeExtent(indices);
+                const double maxError = static_cast<double>(mSettings_.maxError) * extent;
+
+                mAdjacency_.build(indices, mVertexCount_);
+                buildWedges(indices);
+                classifyVertices(indices);
+                buildQuadrics(indices);
+
+                double largestError = 0.0;
+                const size_t targetTriangleCount = targetIndexCount / 3u;
+                while ((indices.size() / 3u) > targetTriangleCount) {
+                    const size_t collapses = doCollapsePass(indices, targetTriangleCount, maxError, largestError);
+                    if (collapses == 0u)
+                        break;
+                    mAdjacency_.build(indices, mVertexCount_);
+                }
+                return ((extent > 0.0) ? static_cast<float>(std::sqrt(largestError) / extent) : 0.0f);
+            }
+
+        private:
+            const float* mVertices_;
+            size_t mVertexCount_;
+            MeshSimplificationSettings mSettings_;
+            double mCosMaxNormalDeviation_;
+
+            std::vector<uint32_t> mPositionRemap_; //The first vertex at each vertex's position
+            std::vector<uint32_t> mWedge_;         //Circular list of the (welded) vertices at each position
+            std::vector<uint32_t> mOpenOut_, mOpenIn_;
+            std::vector<VertexKind> mKinds_;
+            std::vector<Quadric> mQuadrics_;       //Indexed by position (i.e. by mPositionRemap_)
+            TriangleAdjacency mAdjacency_;
+
+            Vec3 position(uint32_t vertex) const noexcept {
+                const float* v = mVertices_ + static_cast<size_t>(vertex) * mSettings_.vertexStride;
+                return { v[0], v[1], v[2] };
+            }
+
+            Vec3 normal(uint32_t vertex) const noexcept {
+                const float* n = mVertices_ + static_cast<size_t>(vertex) * mSettings_.vertexStride + mSettings_.normalOffset;
+                const Vec3 result = { n[0], n[1], n[2] };
+                const double len = length(result);
+                return ((len > 0.0) ? Vec3{ result.x / len, result.y / len, result.z / len } : result);
+            }
+
+            bool normalsAreClose(uint32_t a, uint32_t b) const noexcept {
+                if (mSettings_.normalOffset == NO_VERTEX_ATTRIBUTE)
+                    return true;
+                return (dot(normal(a), normal(b)) >= mCosMaxNormalDeviation_);
+            }
+
+            bool texCoordsMatch(uint32_t a, uint32_t b) const noexcept {
+                if (mSettings_.texCoordOffset == NO_VERTEX_ATTRIBUTE)
+                    return true;
+                const float* ta = mVertices_ + static_cast<size_t>(a) * mSettings_.vertexStride + mSettings_.texCoordOffset;
+                const float* tb = mVertices_ + static_cast<size_t>(b) * mSettings_.vertexStride + mSettings_.texCoordOffset;
+                return ((std::fabs(ta[0] - tb[0]) <= TEXCOORD_WELD_TOLERANCE) &&
+                        (std::fabs(ta[1] - tb[1]) <= TEXCOORD_WELD_TOLERANCE));
+            }
+
+            void removeDegenerateTriangles(std::vector<uint32_t>& indices) const {
+                size_t kept = 0u;
+                for (size_t i = 0u; i + 2u < indices.size(); i += 3u) {
+                    const uint32_t a = indices[i], b = indices[i + 1u], c = indices[i + 2u];
+                    if (isDegenerate(a, b, c))
+                        continue;
+                    //Triangles whose corners sit on top of each other are just as degenerate
+                    if (!mPositionRemap_.empty() &&
+                        isDegenerate(mPositionRemap_[a], mPositionRemap_[b], mPositionRemap_[c]))
+                        continue;
+                    indices[kept++] = a;
+                    indices[kept++] = b;
+                    indices[kept++] = c;
+                }
+                indices.resize(kept);
+            }
+
+            void buildPositionRemap(const std::vector<uint32_t>& indices) {
+                mPositionRemap_.resize(mVertexCount_);
+                for (size_t i = 0u; i < mVertexCount_; i++)
+                    mPositionRemap_[i] = static_cast<uint32_t>(i);
+
+                std::unordered_map<PositionKey, uint32_t, PositionKeyHash> firstAtPosition;
+                firstAtPosition.reserve(indices.size());
+                for (uint32_t index : indices) {
+                    const PositionKey key = makePositionKey(mVertices_ + static_cast<size_t>(index) * mSettings_.vertexStride);
+                    const auto inserted = firstAtPosition.emplace(key, index);
+                    mPositionRemap_[index] = inserted.first->second;
+                }
+            }
+
+            //Welds vertices at the same position whose attributes are within the tolerances together
+            void weldAttributes(std::vector<uint32_t>& indices) const {
+                //The representatives found so far at each position, as a linked list through 'nextRepresentative'
+                std::vector<uint32_t> firstRepresentative(mVertexCount_, NO_VERTEX);
+                std::vector<uint32_t> nextRepresentative(mVertexCount_, NO_VERTEX);
+                std::vector<uint32_t> weld(mVertexCount_, NO_VERTEX);
+                for (uint32_t& index : indices) {
+                    if (weld[index] == NO_VERTEX) {
+                        const uint32_t positionVertex = mPositionRemap_[index];
+                        uint32_t representative = firstRepresentative[positionVertex];
+                        while ((representative != NO_VERTEX) &&
+                               !(texCoordsMatch(index, representative) && normalsAreClose(index, representative)))
+                            representative = nextRepresentative[representative];
+                        if (representative == NO_VERTEX) {
+                            representative = index;
+                            nextRepresentative[index] = firstRepresentative[positionVertex];
+                            firstRepresentative[positionVertex] = index;
+                        }
+                        weld[index] = representative;
+                    }
+                    index = weld[index];
+                }
+            }
+
+            double computeExtent(const std::vector<uint32_t>& indices) const {
+                Vec3 lo = position(indices[0]);
+                Vec3 hi = lo;
+                for (uint32_t index : indices) {
+                    const Vec3 p = position(index);
+                    lo = { std::min(lo.x, p.x), std::min(lo.y, p.y), std::min(lo.z, p.z) };
+                    hi = { std::max(hi.x, p.x), std::max(hi.y, p.y), std::max(hi.z, p.z) };
+                }
+                return std::max(hi.x - lo.x, std::max(hi.y - lo.y, hi.z - lo.z));
+            }
+
+            //Links up the (welded) vertices in use at each position into circular lists
+            void buildWedges(const std::vector<uint32_t>& indices) {
+                mWedge_.assign(mVertexCount_, NO_VERTEX);
+                std::vector<uint32_t> firstAtPosition(mVertexCount_, NO_VERTEX);
+                for (uint32_t index : indices) {
+                    if (mWedge_[index] != NO_VERTEX)
+                        continue;
+                    uint32_t& first = firstAtPosition[mPositionRemap_[index]];
+                    if (first == NO_VERTEX) {
+                        first = index;
+                        mWedge_[index] = index;
+                    }
+                    else {
+                        mWedge_[index] = mWedge_[first];
+                        mWedge_[first] = index;
+                    }
+                }
+            }
+
+            size_t wedgeSize(uint32_t vertex) const noexcept {
+                size_t size = 1u;
+                for (uint32_t v = mWedge_[vertex]; v != vertex; v = mWedge_[v])
+                    size++;
+                return size;
+            }
+
+            //True if some triangle has the half-edge from 'a' to 'b'
+            bool hasEdge(const std::vector<uint32_t>& indices, uint32_t a, uint32_t b) const noexcept {
+                for (const uint32_t* t = mAdjacency_.begin(a); t != mAdjacency_.end(a); t++) {
+                    const uint32_t* tri = &indices[*t * 3u];
+                    for (int corner = 0; corner < 3; corner++) {
+                        if ((tri[corner] == a) && (tri[(corner + 1) % 3] == b))
+                            return true;
+                    }
+                }
+                return false;
+            }
+
+            //True if some triangle has a half-edge going from 'a's position to 'b's position
+            bool hasPositionEdge(const std::vector<uint32_t>& indices, uint32_t a, uint32_t b) const noexcept {
+                const uint32_t positionB = mPositionRemap_[b];
+                uint32_t v = a;
+                do {
+                    for (const uint32_t* t = mAdjacency_.begin(v); t != mAdjacency_.end(v); t++) {
+                        const uint32_t* tri = &indices[*t * 3u];
+                        for (int corner = 0; corner < 3; corner++) {
+                            if ((tri[corner] == v) && (mPositionRemap_[tri[(corner + 1) % 3]] == positionB))
+                                return true;
+                        }
+                    }
+                    v = mWedge_[v];
+                } while (v != a);
+                return false;
+            }
+
+            void classifyVertices(const std::vector<uint32_t>& indices) {
+                mOpenOut_.assign(mVertexCount_, NO_VERTEX);
+                mOpenIn_.assign(mVertexCount_, NO_VERTEX);
+                std::vector<uint8_t> used(mVertexCount_, 0u);
+                //Borders are the open edges that are also open when only positions are compared
+                std::vector<uint8_t> positionBorder(mVertexCount_, 0u);
+
+                for (size_t i = 0u; i < indices.size(); i += 3u) {
+                    for (int corner = 0; corner < 3; corner++) {
+                        const uint32_t a = indices[i + corner];
+                        const uint32_t b = indices[i + (corner + 1) % 3];
+                        used[a] = 1u;
+                        if (hasEdge(indices, b, a))
+                            continue;
+                        mOpenOut_[a] = ((mOpenOut_[a] == NO_VERTEX) ? b : MULTIPLE_VERTICES);
+                        mOpenIn_[b] = ((mOpenIn_[b] == NO_VERTEX) ? a : MULTIPLE_VERTICES);
+                        if (!hasPositionEdge(indices, b, a)) {
+                            positionBorder[a] = 1u;
+                            positionBorder[b] = 1u;
+                        }
+                    }
+                }
+
+                auto single = [](uint32_t v) { return (v < MULTIPLE_VERTICES); };
+                mKinds_.assign(mVertexCount_, VertexKind::LOCKED);
+                for (uint32_t v = 0u; v < static_cast<uint32_t>(mVertexCount_); v++) {
+                    if (!used[v])
+                        continue;
+                    const size_t wedge = wedgeSize(v);
+                    const bool closed = ((mOpenOut_[v] == NO_VERTEX) && (mOpenIn_[v] == NO_VERTEX));
+                    const bool open = (single(mOpenOut_[v]) && single(mOpenIn_[v]));
+                    if (wedge == 1u) {
+                        if (closed)
+                            mKinds_[v] = VertexKind::MANIFOLD;
+                        else if (open && positionBorder[v])
+                            mKinds_[v] = VertexKind::BORDER;
+                    }
+                    else if ((wedge == 2u) && open && !positionBorder[v]) {
+                        //A seam has the open edges of the 2 vertices running alongside each other in opposite directions
+                        const uint32_t twin = mWedge_[v];
+                        if (single(mOpenOut_[twin]) && single(mOpenIn_[twin]) && !positionBorder[twin] &&
+                            (mPositionRemap_[mOpenOut_[v]] == mPositionRemap_[mOpenIn_[twin]]) &&
+                            (mPositionRemap_[mOpenIn_[v]] == mPositionRemap_[mOpenOut_[twin]]))
+                            mKinds_[v] = VertexKind::SEAM;
+                    }
+                }
+            }
+
+            void buildQuadrics(const std::vector<uint32_t>& indices) {
+                mQuadrics_.assign(mVertexCount_, Quadric{});
+                for (size_t i = 0u; i < indices.size(); i += 3u) {
+                    const uint32_t tri[3] = { indices[i], indices[i + 1u], indices[i + 2u] };
+                    const Vec3 p0 = position(tri[0]), p1 = position(tri[1]), p2 = position(tri[2]);
+                    const Vec3 n = cross(p1 - p0, p2 - p0);
+                    const double area2 = length(n);
+                    if (area2 <= 0.0)
+                        continue;
+                    const Vec3 unitNormal = { n.x / area2, n.y / area2, n.z / area2 };
+                    const Quadric face = planeQuadric(unitNormal, p0, 0.5 * area2);
+                    for (uint32_t v : tri)
+                        addQuadric(mQuadrics_[mPositionRemap_[v]], face);
+
+                    //Borders and seams get a plane through the edge at right angles to the triangle
+                    for (int corner = 0; corner < 3; corner++) {
+                        const uint32_t a = tri[corner], b = tri[(corner + 1) % 3];
+                        if (mOpenOut_[a] == NO_VERTEX)
+                            continue;
+                        if (hasEdge(indices, b, a))
+                            continue;
+                        const Vec3 edge = position(b) - position(a);
+                        const double edgeLength = length(edge);
+                        const Vec3 planeNormal = cross(edge, unitNormal);
+                        const double planeNormalLength = length(planeNormal);
+                        if (planeNormalLength <= 0.0)
+                            continue;
+                        const double weight = (hasPositionEdge(indices, b, a) ? SEAM_EDGE_WEIGHT : BORDER_EDGE_WEIGHT);
+                        const Quadric constraint = planeQuadric({ planeNormal.x / planeNormalLength,
+                                                                  planeNormal.y / planeNormalLength,
+                                                                  planeNormal.z / planeNormalLength },
+                                                                position(a), weight * edgeLength * edgeLength);
+                        addQuadric(mQuadrics_[mPositionRemap_[a]], constraint);
+                        addQuadric(mQuadrics_[mPositionRemap_[b]], constraint);
+                    }
+                }
+            }
+
+            //Returns the vertex that 'from's twin would collapse onto when 'from' collapses onto 'to' along
+            //a seam (or NO_VERTEX if the collapse isn't along the seam)
+            uint32_t seamTwinTarget(uint32_t from, uint32_t to) const noexcept {
+                const uint32_t twin = mWedge_[from];
+                if (twin == NO_VERTEX)
+                    return NO_VERTEX;
+                //The twin's open edges run the other way
+                uint32_t twinTarget = NO_VERTEX;
+                if (mOpenOut_[from] == to)
+                    twinTarget = mOpenIn_[twin];
+                else if (mOpenIn_[from] == to)
+                    twinTarget = mOpenOut_[twin];
+                if ((twinTarget >= MULTIPLE_VERTICES) || (mPositionRemap_[twinTarget] != mPositionRemap_[to]))
+                    return NO_VERTEX;
+                return twinTarget;
+            }
+
+            bool canCollapse(uint32_t from, uint32_t to) const noexcept {
+                switch (mKinds_[from]) {
+                case VertexKind::MANIFOLD:
+                    return normalsAreClose(from, to);
+                case VertexKind::BORDER:
+                    return (((mKinds_[to] == VertexKind::BORDER) || (mKinds_[to] == VertexKind::LOCKED)) &&
+                            ((mOpenOut_[from] == to) || (mOpenIn_[from] == to)) && normalsAreClose(from, to));
+                case VertexKind::SEAM: {
+                    if ((mKinds_[to] != VertexKind::SEAM) && (mKinds_[to] != VertexKind::LOCKED))
+                        return false;
+                    const uint32_t twinTarget = seamTwinTarget(from, to);
+                    return ((twinTarget != NO_VERTEX) && normalsAreClose(from, to) &&
+                            normalsAreClose(mWedge_[from], twinTarget));
+                }
+                default:
+                    return false;
+                }
+            }
+
+            //True if moving 'from' to the position of 'to' would turn any of the triangles around 'from' over
+            bool collapseFlipsTriangles(const std::vector<uint32_t>& indices, uint32_t from, uint32_t to) const noexcept {
+                const uint32_t targetPosition = mPositionRemap_[to];
+                const Vec3 target = position(to);
+                for (const uint32_t* t = mAdjacency_.begin(from); t != mAdjacency_.end(from); t++) {
+                    const uint32_t* tri = &indices[*t * 3u];
+                    int corner = 0;
+                    while (tri[corner] != from)
+                        corner++;
+                    const uint32_t b = tri[(corner + 1) % 3], c = tri[(corner + 2) % 3];
+                    //Triangles along the collapsed edge disappear
+                    if ((mPositionRemap_[b] == targetPosition) || (mPositionRemap_[c] == targetPosition))
+                        continue;
+                    const Vec3 pb = position(b), pc = position(c);
+                    const Vec3 before = cross(pb - position(from), pc - position(from));
+                    const Vec3 after = cross(pb - target, pc - target);
+                    if (dot(before, after) <= 0.0)
+                        return true;
+                }
+                return false;
+            }
+
+            size_t trianglesRemovedBy(const std::vector<uint32_t>& indices, uint32_t from, uint32_t to) const noexcept {
+                size_t removed = 0u;
+                for (const uint32_t* t = mAdjacency_.begin(from); t != mAdjacency_.end(from); t++) {
+                    const uint32_t* tri = &indices[*t * 3u];
+                    removed += ((tri[0] == to) || (tri[1] == to) || (tri[2] == to));
+                }
+                return removed;
+            }
+
+            void lockTriangleRing(const std::vector<uint32_t>& indices, uint32_t vertex, std::vector<uint8_t>& locked) const {
+                for (const uint32_t* t = mAdjacency_.begin(vertex); t != mAdjacency_.end(vertex); t++) {
+                    const uint32_t* tri = &indices[*t * 3u];
+                    locked[tri[0]] = locked[tri[1]] = locked[tri[2]] = 1u;
+                }
+            }
+
+            size_t doCollapsePass(std::vector<uint32_t>& indices, size_t targetTriangleCount, double maxError,
+                                  double& largestError) {
+                //Find the cheapest direction to collapse each edge in
+                const double maxSquaredError = maxError * maxError;
+                std::vector<Collapse> candidates;
+                candidates.reserve(indices.size());
+                for (size_t i = 0u; i < indices.size(); i += 3u) {
+                    for (int corner = 0; corner < 3; corner++) {
+                        const uint32_t a = indices[i + corner];
+                        const uint32_t b = indices[i + (corner + 1) % 3];
+                        //Each edge only needs to be looked at from one of its 2 triangles
+                        if ((a > b) && hasEdge(indices, b, a))
+                            continue;
+                        Collapse best = { NO_VERTEX, NO_VERTEX, 0.0 };
+                        if (canCollapse(a, b))
+                            best = { a, b, quadricError(mQuadrics_[mPositionRemap_[a]], position(b)) };
+                        if (canCollapse(b, a)) {
+                            const double error = quadricError(mQuadrics_[mPositionRemap_[b]], position(a));
+                            if ((best.from == NO_VERTEX) || (error < best.error))
+                                best = { b, a, error };
+                        }
+                        if ((best.from != NO_VERTEX) && (best.error <= maxSquaredError))
+                            candidates.push_back(best);
+                    }
+                }
+                std::stable_sort(candidates.begin(), candidates.end(),
+                                 [](const Collapse& x, const Collapse& y) { return (x.error < y.error); });
+
+                std::vector<uint32_t> collapseRemap(mVertexCount_);
+                for (size_t i = 0u; i < mVertexCount_; i++)
+                    collapseRemap[i] = static_cast<uint32_t>(i);
+                std::vector<uint8_t> locked(mVertexCount_, 0u);
+
+                size_t triangleCount = indices.size() / 3u;
+                size_t collapses = 0u;
+                for (const Collapse& collapse : candidates) {
+                    if (triangleCount <= targetTriangleCount)
+                        break;
+                    const uint32_t from = collapse.from, to = collapse.to;
+                    const bool seam = (mKinds_[from] == VertexKind::SEAM);
+                    const uint32_t twin = (seam ? mWedge_[from] : NO_VERTEX);
+                    const uint32_t twinTarget = (seam ? seamTwinTarget(from, to) : NO_VERTEX);
+                    if (locked[from] || locked[to] || (seam && (locked[twin] || locked[twinTarget])))
+                        continue;
+                    if (collapseFlipsTriangles(indices, from, to) ||
+                        (seam && collapseFlipsTriangles(indices, twin, twinTarget)))
+                        continue;
+
+                    triangleCount -= std::min(triangleCount, trianglesRemovedBy(indices, from, to));
+                    lockTriangleRing(indices, from, locked);
+                    collapseRemap[from] = to;
+                    if (seam) {
+                        triangleCount -= std::min(triangleCount, trianglesRemovedBy(indices, twin, twinTarget));
+                        lockTriangleRing(indices, twin, locked);
+                        collapseRemap[twin] = twinTarget;
+                    }
+                    //Both vertices of a seam share one quadric, since they share a position
+                    addQuadric(mQuadrics_[mPositionRemap_[to]], mQuadrics_[mPositionRemap_[from]]);
+                    largestError = std::max(largestError, collapse.error);
+                    collapses++;
+                }
+                if (collapses == 0u)
+                    return 0u;
+
+                for (uint32_t& index : indices)
+                    index = collapseRemap[index];
+                removeDegenerateTriangles(indices);
+
+                //Open edges that led to a collapsed vertex now lead to where it collapsed to
+                for (size_t v = 0u; v < mVertexCount_; v++) {
+                    if (mOpenOut_[v] < MULTIPLE_VERTICES) {
+                        mOpenOut_[v] = collapseRemap[mOpenOut_[v]];
+                        if (mOpenOut_[v] == v)
+                            mOpenOut_[v] = NO_VERTEX;
+                    }
+                    if (mOpenIn_[v] < MULTIPLE_VERTICES) {
+                        mOpenIn_[v] = collapseRemap[mOpenIn_[v]];
+                        if (mOpenIn_[v] == v)
+                            mOpenIn_[v] = NO_VERTEX;
+                    }
+                }
+                return collapses;
+            }
+        };
+
+    } //namespace
+
+    size_t simplifyMesh(uint32_t * destination, const uint32_t * indices, size_t indexCount, const float * vertices,
+                        size_t vertexCount, size_t targetIndexCount, const MeshSimplificationSettings& settings,
+                        float * resultError) {
+        std::vector<uint32_t> working(indices, indices + (indexCount - (indexCount % 3u)));
+        Simplifier simplifier(vertices, vertexCount, settings);
+        const float error = simplifier.run(working, targetIndexCount);
+        if (!working.empty())
+            memcpy(destination, working.data(), working.size() * sizeof(uint32_t));
+        if (resultError)
+            *resultError = error;
+        return working.size();
+    }
+
+    std::vector<MeshLod> buildLodChain(const uint32_t * indices, size_t indexCount, const float * vertices,
+                                       size_t vertexCount, const float * triangleRatios, size_t ratioCount,
+                                       const MeshSimplificationSettings& settings) {
+        std::vector<MeshLod> chain;
+        const size_t triangleCount = indexCount / 3u;
+        const uint32_t* previous = indices;
+        size_t previousCount = indexCount;
+        float previousError = 0.0f;
+        for (size_t i = 0u; i < ratioCount; i++) {
+            const size_t targetIndexCount = 3u * static_cast<size_t>(static_cast<double>(triangleCount) * triangleRatios[i]);
+            MeshLod lod;
+            lod.indices.resize(previousCount);
+            float error = 0.0f;
+            lod.indices.resize(simplifyMesh(lod.indices.data(), previous, previousCount, vertices, vertexCount,
+                                            targetIndexCount, settings, &error));
+            if (lod.indices.empty() || (lod.indices.size() >= previousCount))
+                break;
+            //Each level is measured against the level before it, so the errors add up along the chain
+            lod.error = previousError + error;
+            chain.push_back(std::move(lod));
+            previous = chain.back().indices.data();
+            previousCount = chain.back().indices.size();
+            previousError = chain.back().error;
+        }
+        return chain;
+    }
+
+} //namespace AssetLoadingInternal
@@ -0,0 +1,86 @@
+// File:           MeshSimplifier.h
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Reduces the number of triangles in an indexed mesh by collapsing edges, which is how
+//                 the levels of detail (LODs) of a model get made automatically instead of having to be
+//                 decimated by hand in a modeling program (the way 'obj/AbstractShapeDecimated.obj' was).
+//
+//                 Each edge collapse moves one vertex onto a neighbouring vertex, which removes the
+//                 (usually 2) triangles that shared that edge. The cost of each collapse is measured with
+//                 Garland and Heckbert's quadric error metric: every vertex accumulates the planes of the
+//                 triangles around it, and the cost of moving it is the sum of its squared distances to
+//                 those planes. The cheapest collapses are done first.
+//
+//                 Only the indices change. A collapse always moves a vertex onto one that already exists,
+//                 so every level of detail can be drawn out of the same vertex buffer as the full mesh.
+//
+//                 What gets preserved:
+//                   -Vertices at the same position with different texture coordinates or normals are
+//                    kept apart as they were (i.e. UV seams and hard edges stay put) unless their normals
+//                    are within 'maxNormalDeviationDegrees' of each other, in which case they are welded.
+//                    Edges along a seam can only collapse along the seam, with both sides moving together.
+//                   -Vertices on the border of an open mesh can only slide along the border.
+//                   -No collapse is allowed to flip a triangle over or to move a vertex onto one whose
+//                    normal is further than 'maxNormalDeviationDegrees' away from its own.
+//                   -No collapse is allowed to cost more than 'maxError', so a mesh which can't be reduced
+//                    far enough without visibly changing shape stops early.
+//
+// Note:           Degenerate triangles in the input (such as the ones QuickObj uses for line primitives)
+//                 are not kept. Every index must be less than the vertex count.
+
+#pragma once
+
+#ifndef MESH_SIMPLIFIER_H_
+#define MESH_SIMPLIFIER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace AssetLoadingInternal {
+
+    //Marks a vertex attribute as missing (for meshes without normals)
+    static constexpr const size_t NO_VERTEX_ATTRIBUTE = std::numeric_limits<size_t>::max();
+
+    //The largest error allowed by default, as a fraction of the size of the mesh's bounding box
+    static constexpr const float DEFAULT_SIMPLIFICATION_MAX_ERROR = 0.02f;
+    //How far (in degrees) a vertex's normal is allowed to be from the normal of the vertex it collapses onto
+    static constexpr const float DEFAULT_SIMPLIFICATION_MAX_NORMAL_DEVIATION = 35.0f;
+
+    typedef struct MeshSimplificationSettings {
+        size_t vertexStride = 3u;                      //Floats per vertex, with the position in the first 3
+        size_t texCoordOffset = NO_VERTEX_ATTRIBUTE;   //Offset (in floats) of each vertex's 2 texture coordinates
+        size_t normalOffset = NO_VERTEX_ATTRIBUTE;     //Offset (in floats) of each vertex's normal
+        float maxError = DEFAULT_SIMPLIFICATION_MAX_ERROR;
+        float maxNormalDeviationDegrees = DEFAULT_SIMPLIFICATION_MAX_NORMAL_DEVIATION;
+    } MeshSimplificationSettings;
+
+    //One simplified level of detail
+    typedef struct MeshLod {
+        std::vector<uint32_t> indices;
+        float error;                   //The largest error of any collapse, relative to the mesh's size
+    } MeshLod;
+
+    //Simplifies the triangles described by 'indices' (3 per triangle) down towards 'targetIndexCount'
+    //indices, writing the result to 'destination' (which must have room for 'indexCount' indices and may
+    //be the same array as 'indices'). Returns the number of indices written, which will be more than the
+    //target if the target couldn't be reached within the settings' limits. If 'resultError' is not null it
+    //is set to the largest error (relative to the mesh's size) of any collapse that was done.
+    size_t simplifyMesh(uint32_t * destination, const uint32_t * indices, size_t indexCount, const float * vertices,
+                        size_t vertexCount, size_t targetIndexCount, const MeshSimplificationSettings& settings,
+                        float * resultError = nullptr);
+
+    //Builds a chain of levels of detail, one per entry of 'triangleRatios' (which should be decreasing, with
+    //each ratio being the fraction of the full mesh's triangles to aim for). Each level is simplified from
+    //the one before it. Levels which fail to get any simpler than the level before them are left out, so
+    //the chain can come back shorter than 'ratioCount'.
+    std::vector<MeshLod> buildLodChain(const uint32_t * indices, size_t indexCount, const float * vertices,
+                                       size_t vertexCount, const float * triangleRatios, size_t ratioCount,
+                                       const MeshSimplificationSettings& settings);
+
+} //namespace AssetLoadingInternal
+
+#endif //MESH_SIMPLIFIER_H_
@@ -0,0 +1,354 @@
+// File:           MeshletBuilder.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   The candidates for the next triangle are the triangles touching a vertex of the meshlet
+//                          being built, found through a table of which triangles use each position. Positions are
+//                          welded by their exact bits first, since a flat shaded mesh has every triangle using its own
+//                          vertices and would otherwise look like it has no neighbors at all. Only the triangles
+//                          around the current meshlet are ever considered, so picking each triangle costs about the
+//                          same no matter how big the mesh is. A new meshlet starts from whichever leftover neighbor
+//                          of the last meshlet is closest to it. When there are no neighbors left at all, the meshlet
+//                          carries on with the first triangle (in the original order) not yet used.
+//
+//                          The normal cone follows the usual construction: the axis is the average of the triangles'
+//                          unit normals, and the cutoff is the sine of the widest angle between the axis and any of
+//                          the normals. The apex is moved back along the axis from the middle of the meshlet until it
+//                          is behind every triangle's plane, so the cone test can treat the meshlet as a point.
+//                          Cones which would have to be wider than MIN_CONE_AXIS_DOT allows are never able to cull
+//                          anything in practice, so those meshlets just get a cone which never culls them.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "MeshletBuilder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+#include "PositionKey.h"
+
+namespace AssetLoadingInternal {
+
+    namespace {
+
+        static constexpr const uint32_t NO_SLOT = std::numeric_limits<uint32_t>::max();
+        static constexpr const uint32_t NO_TRIANGLE = std::numeric_limits<uint32_t>::max();
+        //Every triangle's normal has to be at least this close to the cone's axis (as a dot product)
+        static constexpr const float MIN_CONE_AXIS_DOT = 0.1f;
+
+        //Everything shared by the steps of building the meshlets
+        class MeshletBuildState {
+        public:
+            MeshletBuildState(const uint32_t * indices, size_t triangleCount, const float * vertices, size_t vertexStride,
+                              size_t vertexCount, size_t maxVertices, size_t maxTriangles) :
+                mIndices_(indices), mVertices_(vertices), mVertexStride_(vertexStride), mMaxVertices_(maxVertices),
+                mMaxTriangles_(maxTriangles), mUsed_(triangleCount, 0u), mSlots_(vertexCount, NO_SLOT) {
+                mCentroidSum_[0] = mCentroidSum_[1] = mCentroidSum_[2] = 0.0f;
+                mAnchor_[0] = mAnchor_[1] = mAnchor_[2] = 0.0f;
+                mHasAnchor_ = false;
+                mRemaining_ = 0u;
+                for (size_t triangle = 0u; triangle < triangleCount; triangle++) {
+                    const uint32_t * corners = (indices + (triangle * 3u));
+                    if ((corners[0] < vertexCount) && (corners[1] < vertexCount) && (corners[2] < vertexCount))
+                        mRemaining_++;
+                    else
+                        mUsed_[triangle] = 1u; //Never picked
+                }
+                buildAdjacency(triangleCount, vertexCount);
+            }
+
+            void build(MeshletMesh& mesh) {
+                size_t nextSeed = 0u;
+                while (mRemaining_ > 0u) {
+                    uint32_t chosen = pickCandidate();
+                    if (chosen == NO_TRIANGLE) {
+                        while (mUsed_[nextSeed] != 0u)
+                            nextSeed++;
+                        //Neighbors which didn't fit end the meshlet, and get to seed the next one
+                        if ((!mCandidates_.empty()) || ((!mTriangles_.empty()) &&
+                                                        ((mMeshletVertices_.size() + countNewVertices(static_cast<uint32_t>(nextSeed))) > mMaxVertices_))) {
+                            finishMeshlet(mesh);
+                            continue;
+                        }
+                        chosen = static_cast<uint32_t>(nextSeed);
+                    }
+                    if (mTriangles_.empty())
+                        mCandidates_.clear(); //The new meshlet only looks around itself from here on
+                    addTriangle(chosen);
+                    if (mTriangles_.size() == mMaxTriangles_)
+                        finishMeshlet(mesh);
+                }
+                if (!mTriangles_.empty())
+                    finishMeshlet(mesh);
+            }
+
+        private:
+            const uint32_t * mIndices_;
+            const float * mVertices_;
+            size_t mVertexStride_;
+            size_t mMaxVertices_;
+            size_t mMaxTriangles_;
+            std::vector<uint8_t> mUsed_;              //1 for each triangle which is already in a meshlet
+            std::vector<uint32_t> mSlots_;            //Each vertex's place in the current meshlet, if it is in it
+            std::vector<uint32_t> mWelded_;           //Each used vertex's welded position
+            std::vector<uint32_t> mAdjacencyOffsets_; //Where each welded position's triangles start in mAdjacency_
+            std::vector<uint32_t> mAdjacency_;        //The triangles using each welded position
+            size_t mRemaining_;                       //Triangles not yet in a meshlet
+
+            //The meshlet being built
+            std::vector<uint32_t> mMeshletVertices_;
+            std::vector<uint32_t> mTriangles_;
+            float mCentroidSum_[3];
+            std::vector<uint32_t> mCandidates_;
+            //Where the last meshlet was, which the first triangle of the next meshlet is picked to be close to
+            float mAnchor_[3];
+            bool mHasAnchor_;
+
+            std::vector<float> mNormals_; //Reused by computeNormalCone()
+
+            void buildAdjacency(size_t triangleCount, size_t vertexCount) {
+                //Positions get numbered in the order the triangles first use them
+                mWelded_.assign(vertexCount, NO_SLOT);
+                std::unordered_map<PositionKey, uint32_t, PositionKeyHash> weldedPositions;
+                weldedPositions.reserve(vertexCount);
+                for (size_t triangle = 0u; triangle < triangleCount; triangle++) {
+                    if (mUsed_[triangle] != 0u)
+                        continue;
+                    for (size_t corner = 0u; corner < 3u; corner++) {
+                        const uint32_t vertex = mIndices_[(triangle * 3u) + corner];
+                        if (mWelded_[vertex] != NO_SLOT)
+                            continue;
+                        const float * position = positionOf(vertex);
+                        const PositionKey key = makePositionKey(position);
+                        mWelded_[vertex] = weldedPositions.emplace(key, static_cast<uint32_t>(weldedPositions.size())).first->second;
+                    }
+                }
+                const size_t positionCount = weldedPositions.size();
+
+                mAdjacencyOffsets_.assign(positionCount + 1u, 0u);
+                for (size_t triangle = 0u; triangle < triangleCount; triangle++) {
+                    if (mUsed_[triangle] != 0u)
+                        continue;
+                    for (size_t corner = 0u; corner < 3u; corner++)
+                        mAdjacencyOffsets_[mWelded_[mIndices_[(triangle * 3u) + corner]] + 1u]++;
+                }
+                for (size_t position = 0u; position < positionCount; position++)
+                    mAdjacencyOffsets_[position + 1u] += mAdjacencyOffsets_[position];
+                mAdjacency_.resize(mAdjacencyOffsets_[positionCount]);
+                std::vector<uint32_t> filled(mAdjacencyOffsets_.cbegin(), mAdjacencyOffsets_.cend() - 1);
+                for (size_t triangle = 0u; triangle < triangleCount; triangle++) {
+                    if (mUsed_[triangle] != 0u)
+                        continue;
+                    for (size_t corner = 0u; corner < 3u; corner++)
+                        mAdjacency_[filled[mWelded_[mIndices_[(triangle * 3u) + corner]]]++] = static_cast<uint32_t>(triangle);
+                }
+            }
+
+            const float * positionOf(uint32_t vertex) const noexcept {
+                return (mVertices_ + (static_cast<size_t>(vertex) * mVertexStride_));
+            }
+
+            void centroidOf(uint32_t triangle, float centroid[3]) const noexcept {
+                const float * p0 = positionOf(mIndices_[(triangle * 3u)]);
+                const float * p1 = positionOf(mIndices_[(triangle * 3u) + 1u]);
+                const float * p2 = positionOf(mIndices_[(triangle * 3u) + 2u]);
+                for (int axis = 0; axis < 3; axis++)
+                    centroid[axis] = ((p0[axis] + p1[axis] + p2[axis]) * (1.0f / 3.0f));
+            }
+
+            //How many of the triangle's vertices aren't in the current meshlet yet
+            size_t countNewVertices(uint32_t triangle) const noexcept {
+                const uint32_t * corners = (mIndices_ + (triangle * 3u));
+                size_t newVertices = 0u;
+                for (size_t corner = 0u; corner < 3u; corner++) {
+                    const bool repeated = (((corner > 0u) && (corners[corner] == corners[0])) ||
+                                           ((corner > 1u) && (corners[corner] == corners[1])));
+                    if ((!repeated) && (mSlots_[corners[corner]] == NO_SLOT))
+                        newVertices++;
+                }
+                return newVertices;
+            }
+
+            //Returns the candidate which fits into the current meshlet with the fewest new vertices, closest to
+            //the meshlet's middle, or NO_TRIANGLE if none fit. Candidates already used are dropped along the way.
+            uint32_t pickCandidate() {
+                float middle[3] = { mAnchor_[0], mAnchor_[1], mAnchor_[2] };
+                const bool hasMiddle = ((!mTriangles_.empty()) || mHasAnchor_);
+                if (!mTriangles_.empty()) {
+                    for (int axis = 0; axis < 3; axis++)
+                        middle[axis] = (mCentroidSum_[axis] / static_cast<float>(mTriangles_.size()));
+                }
+
+                uint32_t best = NO_TRIANGLE;
+                size_t bestNewVertices = 4u;
+                float bestDistance = std::numeric_limits<float>::max();
+                size_t kept = 0u;
+                for (const uint32_t candidate : mCandidates_) {
+                    if (mUsed_[candidate] != 0u)
+                        continue;
+                    mCandidates_[kept++] = candidate;
+                    const size_t newVertices = countNewVertices(candidate);
+                    if ((mMeshletVertices_.size() + newVertices) > mMaxVertices_)
+                        continue;
+                    float distance = 0.0f;
+                    if (hasMiddle) {
+                        float centroid[3];
+                        centroidOf(candidate, centroid);
+                        const float x = (centroid[0] - middle[0]);
+                        const float y = (centroid[1] - middle[1]);
+                        const float z = (centroid[2] - middle[2]);
+                        distance = ((x * x) + (y * y) + (z * z));
+                    }
+                    if ((newVertices < bestNewVertices) || ((newVertices == bestNewVertices) && (distance < bestDistance))) {
+                        best = candidate;
+                        bestNewVertices = newVertices;
+                        bestDistance = distance;
+                    }
+                }
+                mCandidates_.resize(kept);
+                return best;
+            }
+
+            void addTriangle(uint32_t triangle) {
+                mUsed_[triangle] = 1u;
+                mRemaining_--;
+                for (size_t corner = 0u; corner < 3u; corner++) {
+                    const uint32_t vertex = mIndices_[(triangle * 3u) + corner];
+                    if (mSlots_[vertex] != NO_SLOT)
+                        continue;
+                    mSlots_[vertex] = static_cast<uint32_t>(mMeshletVertices_.size());
+                    mMeshletVertices_.push_back(vertex);
+                    const uint32_t position = mWelded_[vertex];
+                    for (uint32_t i = mAdjacencyOffsets_[position]; i < mAdjacencyOffsets_[position + 1u]; i++) {
+                        if (mUsed_[mAdjacency_[i]] == 0u)
+                            mCandidates_.push_back(mAdjacency_[i]);
+                    }
+                }
+                mTriangles_.push_back(triangle);
+                float centroid[3];
+                centroidOf(triangle, centroid);
+                for (int axis = 0; axis < 3; axis++)
+                    mCentroidSum_[axis] += centroid[axis];
+            }
+
+            void computeNormalCone(const float center[3], Meshlet& meshlet) {
+                meshlet.coneApex[0] = center[0];
+                meshlet.coneApex[1] = center[1];
+                meshlet.coneApex[2] = center[2];
+                meshlet.coneAxis[0] = meshlet.coneAxis[1] = 0.0f;
+                meshlet.coneAxis[2] = 1.0f;
+                meshlet.coneCutoff = MESHLET_CONE_NEVER_CULLS;
+
+                mNormals_.resize(mTriangles_.size() * 3u);
+                float axis[3] = { 0.0f, 0.0f, 0.0f };
+                for (size_t i = 0u; i < mTriangles_.size(); i++) {
+                    const uint32_t * corners = (mIndices_ + (mTriangles_[i] * 3u));
+                    const float * p0 = positionOf(corners[0]);
+                    const float * p1 = positionOf(corners[1]);
+                    const float * p2 = positionOf(corners[2]);
+                    const float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+                    const float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+                    float * normal = &mNormals_[i * 3u];
+                    normal[0] = ((e1[1] * e2[2]) - (e1[2] * e2[1]));
+                    normal[1] = ((e1[2] * e2[0]) - (e1[0] * e2[2]));
+                    normal[2] = ((e1[0] * e2[1]) - (e1[1] * e2[0]));
+                    const float length = std::sqrt((normal[0] * normal[0]) + (normal[1] * normal[1]) + (normal[2] * normal[2]));
+                    if (!((length > 0.0f) && std::isfinite(length)))
+                        return; //There is no telling which way this triangle faces
+                    for (int a = 0; a < 3; a++) {
+                        normal[a] /= length;
+                        axis[a] += normal[a];
+                    }
+                }
+                const float axisLength = std::sqrt((axis[0] * axis[0]) + (axis[1] * axis[1]) + (axis[2] * axis[2]));
+                if (!(axisLength > 0.0f))
+                    return;
+                for (int a = 0; a < 3; a++)
+                    axis[a] /= axisLength;
+
+                float minAxisDot = 1.0f;
+                for (size_t i = 0u; i < mTriangles_.size(); i++) {
+                    const float * normal = &mNormals_[i * 3u];
+                    minAxisDot = std::min(minAxisDot, ((axis[0] * normal[0]) + (axis[1] * normal[1]) + (axis[2] * normal[2])));
+                }
+                if (minAxisDot <= MIN_CONE_AXIS_DOT)
+                    return;
+
+                //How far back along the axis the apex has to go to be behind every triangle
+                float apexDistance = 0.0f;
+                for (size_t i = 0u; i < mTriangles_.size(); i++) {
+                    const float * normal = &mNormals_[i * 3u];
+                    const float * p0 = positionOf(mIndices_[mTriangles_[i] * 3u]);
+                    const float centerDistance = (((center[0] - p0[0]) * normal[0]) + ((center[1] - p0[1]) * normal[1]) +
+                                                  ((center[2] - p0[2]) * normal[2]));
+                    const float axisDot = ((axis[0] * normal[0]) + (axis[1] * normal[1]) + (axis[2] * normal[2]));
+                    apexDistance = std::max(apexDistance, (centerDistance / axisDot));
+                }
+                for (int a = 0; a < 3; a++) {
+                    meshlet.coneApex[a] = (center[a] - (axis[a] * apexDistance));
+                    meshlet.coneAxis[a] = axis[a];
+                }
+                meshlet.coneCutoff = std::sqrt(1.0f - (minAxisDot * minAxisDot));
+            }
+
+            void finishMeshlet(MeshletMesh& mesh) {
+                Meshlet meshlet;
+                meshlet.firstVertex = static_cast<uint32_t>(mesh.meshletVertices.size());
+                meshlet.vertexCount = static_cast<uint32_t>(mMeshletVertices_.size());
+                meshlet.firstTriangle = static_cast<uint32_t>(mesh.meshletTriangles.size() / 3u);
+                meshlet.triangleCount = static_cast<uint32_t>(mTriangles_.size());
+                meshlet.firstIndex = static_cast<uint32_t>(mesh.indices.size());
+
+                mesh.meshletVertices.insert(mesh.meshletVertices.end(), mMeshletVertices_.cbegin(), mMeshletVertices_.cend());
+                for (const uint32_t triangle : mTriangles_) {
+                    for (size_t corner = 0u; corner < 3u; corner++) {
+                        const uint32_t vertex = mIndices_[(triangle * 3u) + corner];
+                        mesh.meshletTriangles.push_back(static_cast<uint8_t>(mSlots_[vertex]));
+                        mesh.indices.push_back(vertex);
+                    }
+                }
+
+                const size_t bounds = mesh.bounds.addObject(mVertices_, mVertexStride_, mMeshletVertices_.data(),
+                                                            mMeshletVertices_.size());
+                const float center[3] = { mesh.bounds.sphereX[bounds], mesh.bounds.sphereY[bounds], mesh.bounds.sphereZ[bounds] };
+                computeNormalCone(center, meshlet);
+                mesh.meshlets.push_back(meshlet);
+
+                //The next meshlet starts out near this one
+                for (int axis = 0; axis < 3; axis++) {
+                    mAnchor_[axis] = (mCentroidSum_[axis] / static_cast<float>(mTriangles_.size()));
+                    mCentroidSum_[axis] = 0.0f;
+                }
+                mHasAnchor_ = true;
+                for (const uint32_t vertex : mMeshletVertices_)
+                    mSlots_[vertex] = NO_SLOT;
+                mMeshletVertices_.clear();
+                mTriangles_.clear();
+            }
+        };
+
+    } //namespace
+
+
+    void MeshletMesh::clear() noexcept {
+        meshlets.clear();
+        meshletVertices.clear();
+        meshletTriangles.clear();
+        indices.clear();
+        bounds.clear();
+    }
+
+    bool buildMeshlets(const uint32_t * indices, size_t indexCount, const float * vertices, size_t vertexStride,
+                       size_t vertexCount, MeshletMesh& mesh, size_t maxVertices, size_t maxTriangles) {
+        mesh.clear();
+        if ((maxVertices < 3u) || (maxVertices > 256u) || (maxTriangles < 1u) || (vertexStride < 3u))
+            return false;
+        MeshletBuildState state(indices, (indexCount / 3u), vertices, vertexStride, vertexCount, maxVertices, maxTriangles);
+        state.build(mesh);
+        return true;
+    }
+
+} //namespace AssetLoadingInternal
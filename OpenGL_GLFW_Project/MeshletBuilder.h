@@ -0,0 +1,89 @@
+// File:           MeshletBuilder.h
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Splits an indexed triangle mesh up into meshlets [small clusters of neighboring triangles],
+//                 each using at most MAX_MESHLET_VERTICES vertices and MAX_MESHLET_TRIANGLES triangles. A mesh
+//                 drawn as 1 big range can only be drawn or skipped as a whole, while its meshlets can each be
+//                 skipped on their own once they are outside of the view or facing away from the camera
+//                 [see MeshletCulling.h].
+//
+//                 Meshlets are grown 1 triangle at a time, always picking the neighboring triangle which brings
+//                 in the fewest new vertices, and out of those the one closest to the middle of the meshlet. This
+//                 keeps each meshlet compact, which makes its bounds tight. Once no neighbor fits, the next meshlet
+//                 starts from a neighbor of the last one.
+//
+//                 Each meshlet gets:
+//                      -   Its bounding sphere and box, stored in a BoundingVolumeSet [see FrustumCulling.h] so the
+//                          meshlets can be frustum culled exactly the way the scene's objects are
+//                      -   A normal cone, which bounds the directions its triangles face. When the camera is
+//                          within the back side of the cone, every triangle of the meshlet faces away from it.
+//
+// Layout:         The meshlets are described 2 ways, for 2 ways of drawing them:
+//                      -   'indices' is the mesh's triangles rearranged meshlet by meshlet, so each meshlet is 1
+//                          contiguous range of the original vertices' indices. This is what glDrawElements() and
+//                          glMultiDrawElements() draw from.
+//                      -   'meshletVertices' and 'meshletTriangles' give each meshlet its own small list of
+//                          vertices, and its triangles as 8-bit indices into that list, the way a mesh shader
+//                          would want them.
+//
+// Note:           Triangles are front facing when their corners go counter-clockwise [OpenGL's default], and
+//                 positions are the first 3 floats of each vertex. A meshlet with a triangle that has no area
+//                 (such as the ones QuickObj stores line primitives as) gets a cone which never culls it, since
+//                 there is no telling which way such a triangle faces. Triangles with an index past the end of
+//                 the vertices are left out.
+
+#pragma once
+
+#ifndef MESHLET_BUILDER_H_
+#define MESHLET_BUILDER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "FrustumCulling.h" //For BoundingVolumeSet
+
+namespace AssetLoadingInternal {
+
+    static constexpr const size_t MAX_MESHLET_VERTICES = 64u;
+    static constexpr const size_t MAX_MESHLET_TRIANGLES = 124u;
+
+    //A cone cutoff above 1 means the meshlet can never be culled by its cone
+    static constexpr const float MESHLET_CONE_NEVER_CULLS = 2.0f;
+
+    typedef struct Meshlet {
+        uint32_t firstVertex;     //Into MeshletMesh::meshletVertices
+        uint32_t vertexCount;
+        uint32_t firstTriangle;   //Into MeshletMesh::meshletTriangles, which has 3 entries per triangle
+        uint32_t triangleCount;
+        uint32_t firstIndex;      //Into MeshletMesh::indices, which has (3 * triangleCount) entries for the meshlet
+        //Every triangle faces away from a camera at position 'c' once
+        //      dot(coneApex - c, coneAxis) >= coneCutoff * length(coneApex - c)
+        float coneApex[3];
+        float coneAxis[3];
+        float coneCutoff;
+    } Meshlet;
+
+    typedef struct MeshletMesh {
+        std::vector<Meshlet> meshlets;
+        std::vector<uint32_t> meshletVertices;  //Indices of the mesh's vertices, each meshlet's in 1 run
+        std::vector<uint8_t> meshletTriangles;  //Indices into each meshlet's run of meshletVertices, 3 per triangle
+        std::vector<uint32_t> indices;          //The mesh's triangles, meshlet by meshlet
+        BoundingVolumeSet bounds;               //1 entry per meshlet, with a w of 1
+
+        void clear() noexcept;
+    } MeshletMesh;
+
+    //Splits the 'indexCount' / 3 triangles of 'indices' up into meshlets of at most 'maxVertices' vertices and
+    //'maxTriangles' triangles, replacing whatever 'mesh' held. Each vertex is 'vertexStride' floats. Returns false
+    //(leaving 'mesh' empty) if the limits or the stride can't be used: 'maxVertices' has to be from 3 to 256 [so that
+    //a vertex fits in 8 bits] and 'maxTriangles' has to be at least 1.
+    bool buildMeshlets(const uint32_t * indices, size_t indexCount, const float * vertices, size_t vertexStride,
+                       size_t vertexCount, MeshletMesh& mesh, size_t maxVertices = MAX_MESHLET_VERTICES,
+                       size_t maxTriangles = MAX_MESHLET_TRIANGLES);
+
+} //namespace AssetLoadingInternal
+
+#endif //MESHLET_BUILDER_H_
@@ -0,0 +1,56 @@
+// File:           MeshletCulling.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   The frustum test runs first over every meshlet at once, since it is the one that is
+//                          vectorized and split across threads. The cone test is then only done on the meshlets
+//                          which survived it, in the same pass that builds the draw list.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "MeshletCulling.h"
+
+#include <cmath>
+
+namespace AssetLoadingInternal {
+
+    bool isMeshletBackfacing(const Meshlet& meshlet, const float * cameraPosition) noexcept {
+        if (meshlet.coneCutoff > 1.0f)
+            return false;
+        const float x = (meshlet.coneApex[0] - cameraPosition[0]);
+        const float y = (meshlet.coneApex[1] - cameraPosition[1]);
+        const float z = (meshlet.coneApex[2] - cameraPosition[2]);
+        const float alongAxis = ((x * meshlet.coneAxis[0]) + (y * meshlet.coneAxis[1]) + (z * meshlet.coneAxis[2]));
+        return (alongAxis >= (meshlet.coneCutoff * std::sqrt((x * x) + (y * y) + (z * z))));
+    }
+
+    MeshletCullingResult cullMeshlets(const MeshletMesh& mesh, const BVHFrustum& frustum, const float * cameraPosition,
+                                      std::vector<uint8_t>& visible, std::vector<MeshletDrawRange>& drawList,
+                                      unsigned int threadCount) {
+        MeshletCullingResult result = { 0u, 0u, 0u, 0u };
+        drawList.clear();
+        const size_t insideFrustum = cullBoundingVolumes(frustum, mesh.bounds, 0.0f, 0.0f, visible, threadCount);
+        result.frustumCulledMeshlets = (mesh.meshlets.size() - insideFrustum);
+
+        for (size_t i = 0u; i < mesh.meshlets.size(); i++) {
+            if (visible[i] == 0u)
+                continue;
+            const Meshlet& meshlet = mesh.meshlets[i];
+            if ((cameraPosition != nullptr) && isMeshletBackfacing(meshlet, cameraPosition)) {
+                visible[i] = 0u;
+                result.backfaceCulledMeshlets++;
+                continue;
+            }
+            result.drawnMeshlets++;
+            result.drawnTriangles += meshlet.triangleCount;
+            const uint32_t indexCount = (3u * meshlet.triangleCount);
+            if ((!drawList.empty()) && ((drawList.back().firstIndex + drawList.back().indexCount) == meshlet.firstIndex))
+                drawList.back().indexCount += indexCount;
+            else
+                drawList.push_back({ meshlet.firstIndex, indexCount });
+        }
+        return result;
+    }
+
+} //namespace AssetLoadingInternal
@@ -0,0 +1,57 @@
+// File:           MeshletCulling.h
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Decides which meshlets of a MeshletMesh [see MeshletBuilder.h] need to be drawn from a given
+//                 camera, and packs the ones that do into a draw list of index ranges. 2 tests are done:
+//                      frustum     --  the meshlet's bounding sphere and box are tested against the view frustum,
+//                                      using the same SSE (and multi-threaded) test as cullBoundingVolumes()
+//                      backface    --  the meshlet's normal cone is tested against the camera's position, which
+//                                      culls meshlets whose every triangle faces away from the camera
+//                 Meshlets which are next to each other in the mesh's index list and both get drawn are merged
+//                 into 1 range, so a mesh which is entirely visible comes out as a single draw.
+//
+// Note:           The backface test is only correct when back faces aren't going to be drawn anyway (i.e. with
+//                 GL_CULL_FACE enabled for GL_BACK) and the vertices are drawn where the positions say they are.
+//                 Pass nullptr as the camera's position to only do the frustum test.
+
+#pragma once
+
+#ifndef MESHLET_CULLING_H_
+#define MESHLET_CULLING_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "MeshletBuilder.h"
+
+namespace AssetLoadingInternal {
+
+    //A run of MeshletMesh::indices to draw
+    typedef struct MeshletDrawRange {
+        uint32_t firstIndex;
+        uint32_t indexCount;
+    } MeshletDrawRange;
+
+    typedef struct MeshletCullingResult {
+        size_t drawnMeshlets;
+        size_t drawnTriangles;
+        size_t frustumCulledMeshlets;
+        size_t backfaceCulledMeshlets;
+    } MeshletCullingResult;
+
+    //Replaces 'drawList' with the ranges of the mesh's indices which need to be drawn from a camera with the given
+    //frustum [see BVHFrustum] and position (in the same space as the mesh). 'visible' is filled in with 1 for each
+    //meshlet which is drawn and 0 for each which is culled, and is only passed in so that it can be reused.
+    MeshletCullingResult cullMeshlets(const MeshletMesh& mesh, const BVHFrustum& frustum, const float * cameraPosition,
+                                      std::vector<uint8_t>& visible, std::vector<MeshletDrawRange>& drawList,
+                                      unsigned int threadCount = AUTOMATIC_CULLING_THREAD_COUNT);
+
+    //Returns true if every triangle of the meshlet faces away from a camera at 'cameraPosition'
+    bool isMeshletBackfacing(const Meshlet& meshlet, const float * cameraPosition) noexcept;
+
+} //namespace AssetLoadingInternal
+
+#endif //MESHLET_CULLING_H_
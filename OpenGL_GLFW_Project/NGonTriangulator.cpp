@@ -0,0 +1,246 @@
+// File:           NGonTriangulator.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   The polygon's corners are kept in a circular doubly-linked list
+//                          (stored as 'previous'/'next' index arrays) so that clipping off an ear
+//                          is O(1). Corners with a cross product of exactly 0 (collinear with their
+//                          neighbors) are treated as reflex, since they can't be the tip of an ear
+//                          but they can still be sitting on the edge of one.
+//
+//                          If a full trip around the remaining corners finds no ear at all, the
+//                          polygon must be degenerate (or self-intersecting), at which point the
+//                          entire polygon is redone as a fan.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "NGonTriangulator.h"
+
+#include <cmath>
+
+namespace AssetLoadingInternal {
+
+    bool NGonTriangulator::triangulate(const std::array<float, 3>* corners, size_t cornerCount, std::vector<uint32_t>& triangleCorners) {
+        triangleCorners.clear();
+        if (cornerCount < 3u)
+            return false;
+        triangleCorners.reserve((cornerCount - 2u) * 3u);
+        if (cornerCount == 3u) {
+            triangleCorners.insert(triangleCorners.end(), { 0u, 1u, 2u });
+            return true;
+        }
+
+        if (!projectOntoDominantPlane(corners, cornerCount)) {
+            triangulateAsFan(cornerCount, triangleCorners);
+            return false;
+        }
+
+        const uint32_t n = static_cast<uint32_t>(cornerCount);
+        mPrevious_.resize(n);
+        mNext_.resize(n);
+        mIsReflex_.resize(n);
+        mReflexCorners_.clear();
+        for (uint32_t i = 0u; i < n; i++) {
+            mPrevious_[i] = ((i == 0u) ? (n - 1u) : (i - 1u));
+            mNext_[i] = ((i == (n - 1u)) ? 0u : (i + 1u));
+        }
+        for (uint32_t i = 0u; i < n; i++) {
+            mIsReflex_[i] = (cross(mPrevious_[i], i, mNext_[i]) <= 0.0f);
+            if (mIsReflex_[i])
+                mReflexCorners_.push_back(i);
+        }
+
+        //Re-checks whether a corner is reflex after one of its neighbors was clipped away
+        auto updateCorner = [this](uint32_t corner) {
+            const bool reflex = (cross(mPrevious_[corner], corner, mNext_[corner]) <= 0.0f);
+            if (reflex && (!mIsReflex_[corner])) //Can only happen through rounding, but must still be tested against ears
+                mReflexCorners_.push_back(corner);
+            mIsReflex_[corner] = reflex;
+        };
+
+        uint32_t remaining = n;
+        uint32_t current = 0u;
+        uint32_t cornersVisitedWithoutAnEar = 0u;
+        while (remaining > 3u) {
+            if (isEar(current)) {
+                const uint32_t previous = mPrevious_[current];
+                const uint32_t next = mNext_[current];
+                triangleCorners.insert(triangleCorners.end(), { previous, current, next });
+
+                mNext_[previous] = next;
+                mPrevious_[next] = previous;
+                mIsReflex_[current] = false; //Keeps the clipped corner out of all future ear tests
+                updateCorner(previous);
+                updateCorner(next);
+
+                remaining--;
+                cornersVisitedWithoutAnEar = 0u;
+                current = next;
+            }
+            else {
+                current = mNext_[current];
+                if (++cornersVisitedWithoutAnEar > remaining) {
+                    triangulateAsFan(cornerCount, triangleCorners);
+                    return false;
+                }
+            }
+        }
+        triangleCorners.insert(triangleCorners.end(), { mPrevious_[current], current, mNext_[current] });
+        return true;
+    }
+
+
+    bool NGonTriangulator::projectOntoDominantPlane(const std::array<float, 3>* corners, size_t cornerCount) {
+        //Newell's method, which gives a reasonable normal even for a polygon that isn't quite planar
+        float nx = 0.0f, ny = 0.0f, nz = 0.0f;
+        for (size_t i = 0u; i < cornerCount; i++) {
+            const std::array<float, 3>& a = corners[i];
+            const std::array<float, 3>& b = corners[((i + 1u) == cornerCount) ? 0u : (i + 1u)];
+            nx += (a[1] - b[1]) * (a[2] + b[2]);
+            ny += (a[2] - b[2]) * (a[0] + b[0]);
+            nz += (a[0] - b[0]) * (a[1] + b[1]);
+        }
+
+        //Each projection keeps the axes in cyclic order (xy, yz, zx), so the projected polygon winds
+        //counter-clockwise exactly when the dropped axis's normal component is positive
+        const float ax = std::fabs(nx), ay = std::fabs(ny), az = std::fabs(nz);
+        int uAxis, vAxis;
+        float dominantComponent;
+        if ((az >= ax) && (az >= ay)) {
+            uAxis = 0; vAxis = 1; dominantComponent = nz;
+        }
+        else if (ax >= ay) {
+            uAxis = 1; vAxis = 2; dominantComponent = nx;
+        }
+        else {
+            uAxis = 2; vAxis = 0; dominantComponent = ny;
+        }
+        if (!(std::fabs(dominantComponent) > 0.0f)) //Also catches NaN
+            return false;
+
+        const float flip = ((dominantComponent > 0.0f) ? 1.0f : -1.0f);
+        mU_.resize(cornerCount);
+        mV_.resize(cornerCount);
+        for (size_t i = 0u; i < cornerCount; i++) {
+            mU_[i] = flip * corners[i][uAxis];
+            mV_[i] = corners[i][vAxis];
+        }
+        return true;
+    }
+
+
+    //Twice the signed area of triangle (a, b, c), which is positive if the triangle winds counter-clockwise
+    float NGonTriangulator::cross(uint32_t a, uint32_t b, uint32_t c) const noexcept {
+        return (((mU_[b] - mU_[a]) * (mV_[c] - mV_[a])) - ((mV_[b] - mV_[a]) * (mU_[c] - mU_[a])));
+    }
+
+
+    bool NGonTriangulator::isEar(uint32_t corner) const noexcept {
+        if (mIsReflex_[corner])
+            return false;
+        const uint32_t previous = mPrevious_[corner];
+        const uint32_t next = mNext_[corner];
+        for (const uint32_t reflex : mReflexCorners_) {
+            if ((!mIsReflex_[reflex]) || (reflex == previous) || (reflex == next))
+                continue;
+            //Corners that share a position with one of the ear's corners (which happens with
+            //'keyhole' shaped faces) can't block the ear
+            if (((mU_[reflex] == mU_[previous]) && (mV_[reflex] == mV_[previous])) ||
+                ((mU_[reflex] == mU_[next]) && (mV_[reflex] == mV_[next])) ||
+                ((mU_[reflex] == mU_[corner]) && (mV_[reflex] == mV_[corner])))
+                continue;
+            if ((cross(previous, corner, reflex) >= 0.0f) && (cross(corner, next, reflex) >= 0.0f) &&
+                (cross(next, previous, reflex) >= 0.0f))
+                return false;
+        }
+        return true;
+    }
+
+
+    void NGonTriangulator::triangulateAsFan(size_t cornerCount, std::vector<uint32_t>& triangleCorners) {
+        triangleCorners.clear();
+        for (uint32_t i = 1u; (i + 1u) < static_cast<uint32_t>(cornerCount); i++)
+            triangleCorners.insert(triangleCorners.end(), { 0u, i, i + 1u });
+    }
+
+
+    size_t triangulateNGons(ObjParseResult& result) {
+        if (result.nGons.empty())
+            return 0u;
+
+        size_t extraTriangles = 0u;
+        for (const ParsedNGon& nGon : result.nGons)
+            extraTriangles += (nGon.cornerCount - 3u);
+
+        ParsedFaceList faces;
+        faces.reserve(result.faces.size() + extraTriangles);
+
+        NGonTriangulator triangulator;
+        std::vector<std::array<float, 3>> cornerPositions;
+        std::vector<uint32_t> triangleCorners;
+        size_t degenerateNGons = 0u;
+
+        //Splitting n-gons up shifts every face that comes after them, so each tag is moved along to wherever
+        //its first face ends up
+        size_t nextTag = 0u;
+        auto moveTagsUpTo = [&result, &faces, &nextTag](size_t originalFace) {
+            while ((nextTag < result.subMeshTags.size()) && (result.subMeshTags[nextTag].firstFace <= originalFace))
+                result.subMeshTags[nextTag++].firstFace = faces.size();
+        };
+
+        for (size_t faceIndex = 0u; faceIndex < result.faces.size(); faceIndex++) {
+            const ParsedFace face = result.faces[faceIndex];
+            moveTagsUpTo(faceIndex);
+            if (!face.isNGon()) {
+                faces.push_back(face);
+                continue;
+            }
+
+            const ParsedNGon& nGon = result.nGons[face.nGonIndex];
+            const ParsedNGonCorner * const corners = result.nGonCorners.data() + nGon.firstCorner;
+
+            //A face referring to positions that don't exist can't be triangulated by its shape, it still gets
+            //split up though so that QuickObj reports (and skips) it just like any other bad face
+            bool positionsInRange = true;
+            cornerPositions.resize(nGon.cornerCount);
+            for (size_t i = 0u; i < nGon.cornerCount; i++) {
+                if (corners[i].position >= result.positions.size()) {
+                    positionsInRange = false;
+                    break;
+                }
+                cornerPositions[i] = result.positions.get(corners[i].position);
+            }
+            if (positionsInRange) {
+                if (!triangulator.triangulate(cornerPositions.data(), nGon.cornerCount, triangleCorners))
+                    degenerateNGons++;
+            }
+            else {
+                triangleCorners.clear();
+                for (uint32_t i = 1u; (i + 1u) < static_cast<uint32_t>(nGon.cornerCount); i++)
+                    triangleCorners.insert(triangleCorners.end(), { 0u, i, i + 1u });
+            }
+
+            ParsedFace triangle = face;
+            triangle.nGonIndex = 0u;
+            triangle.vertexCount = static_cast<uint8_t>(TRIANGLE_VERTICE_COUNT);
+            triangle.positions[3] = triangle.texCoords[3] = triangle.normals[3] = 0u;
+            for (size_t i = 0u; i < triangleCorners.size(); i += 3u) {
+                for (int corner = 0; corner < TRIANGLE_VERTICE_COUNT; corner++) {
+                    const ParsedNGonCorner& source = corners[triangleCorners[i + corner]];
+                    triangle.positions[corner] = source.position;
+                    triangle.texCoords[corner] = (face.hasTexCoords ? source.texCoord : 0u);
+                    triangle.normals[corner] = (face.hasNormals ? source.normal : 0u);
+                }
+                faces.push_back(triangle);
+            }
+        }
+
+        moveTagsUpTo(result.faces.size());
+        result.faces.swap(faces);
+        std::vector<ParsedNGon>().swap(result.nGons);
+        std::vector<ParsedNGonCorner>().swap(result.nGonCorners);
+        return degenerateNGons;
+    }
+
+} //namespace AssetLoadingInternal
@@ -0,0 +1,82 @@
+// File:           NGonTriangulator.h
+// Class:          NGonTriangulator
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Splits faces with more than 4 vertices (n-gons) into triangles. This is what
+//                 the experimental code in 'QuickObj_NGonParser' was originally working towards.
+//                 The ObjTokenizer stores every corner of an n-gon, and once the whole file has
+//                 been parsed (so that every position an n-gon refers to is known) each n-gon is
+//                 replaced by its triangles right where it appeared in the list of faces.
+//
+// Algorithm:      An n-gon's corners are not guaranteed to lie in a plane, so the face's normal is
+//                 first estimated with Newell's method and the corners are projected onto whichever
+//                 coordinate plane (xy, yz or zx) is most closely facing that normal. The projected
+//                 polygon is then triangulated by ear clipping.
+//
+//                 Only reflex (i.e. concave) corners can ever be inside of a candidate ear, and a
+//                 corner that starts out convex never becomes reflex as ears are clipped away, so
+//                 the reflex corners are gathered once up front and they are the only corners ever
+//                 tested against an ear. This makes the cost O(n * r) for a face with 'r' reflex
+//                 corners, which is linear for the convex n-gons that make up the large majority of
+//                 n-gons in practice (i.e. the caps of cylinders and circles).
+//
+//                 Triangles are always emitted in the face's original winding order.
+//
+// Degenerate Faces: Faces that are too degenerate to triangulate (for example if every corner is
+//                 collinear, or if the face crosses over itself) are split into a fan of triangles
+//                 instead. A fan always covers a convex face correctly, so this is a reasonable guess.
+
+#pragma once
+
+#ifndef NGON_TRIANGULATOR_H_
+#define NGON_TRIANGULATOR_H_
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "ObjTokenizer.h"
+
+namespace AssetLoadingInternal {
+
+    class NGonTriangulator final {
+    public:
+        NGonTriangulator() = default;
+        ~NGonTriangulator() = default;
+
+        NGonTriangulator(const NGonTriangulator&) = delete;
+        NGonTriangulator& operator=(const NGonTriangulator&) = delete;
+
+        //Triangulates the polygon with the provided corner positions. The triangles are written into
+        //'triangleCorners' (which is cleared first) as 3 corner numbers each, with each corner number being
+        //in the range [0, cornerCount). There are always exactly (cornerCount - 2) triangles. Returns false
+        //if the polygon was degenerate and had to be split into a fan instead.
+        bool triangulate(const std::array<float, 3>* corners, size_t cornerCount, std::vector<uint32_t>& triangleCorners);
+
+    private:
+        //Scratch space which is reused between calls, so that triangulating many n-gons does not
+        //allocate for each one
+        std::vector<float> mU_, mV_;
+        std::vector<uint32_t> mPrevious_, mNext_;
+        std::vector<uint8_t> mIsReflex_;
+        std::vector<uint32_t> mReflexCorners_;
+
+        //Projects the corners into 2D, flipped if needed so that the polygon winds counter-clockwise.
+        //Returns false if the polygon has no area.
+        bool projectOntoDominantPlane(const std::array<float, 3>* corners, size_t cornerCount);
+        float cross(uint32_t a, uint32_t b, uint32_t c) const noexcept;
+        bool isEar(uint32_t corner) const noexcept;
+        static void triangulateAsFan(size_t cornerCount, std::vector<uint32_t>& triangleCorners);
+    };
+
+    //Replaces every n-gon in 'result.faces' with the triangles it is split into, keeping all of
+    //the faces in file order (sub-mesh tags are moved along with their faces). The n-gon arrays in
+    //'result' are emptied afterwards. Returns the number of n-gons that were too degenerate to be
+    //triangulated and were split into a fan instead.
+    size_t triangulateNGons(ObjParseResult& result);
+
+} //namespace AssetLoadingInternal
+
+#endif //NGON_TRIANGULATOR_H_
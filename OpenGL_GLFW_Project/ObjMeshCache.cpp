@@ -0,0 +1,542 @@
+// File:           ObjMeshCache.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   The header is a plain struct of fixed-width values which is written
+//                          and read back with a single memcpy. Every section's length is recorded
+//                          in the header, so a truncated or otherwise damaged cache is caught by
+//                          checking that the section lengths add up to the exact size of the file.
+//
+//                          std::vector has no way to adopt memory it did not allocate, so the mapped
+//                          sections are copied into the vectors. That is one bulk copy per section,
+//                          which keeps loading from a cache limited by I/O rather than by parsing.
+//
+//                          The materials section is tiny next to the mesh data, so it is simply written
+//                          out one value at a time and read back through a reader which checks every
+//                          read against the end of the section. The whole section is read (and every
+//                          library's stamp checked) before any of the hashes are computed.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "ObjMeshCache.h"
+
+#include <array>
+#include <atomic>
+#include <cstdio>        //snprintf
+#include <cstring>       //memcpy, memcmp
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <type_traits>
+
+#include "FilepathWrapper.h"
+#include "MappedFileView.h"
+
+namespace AssetLoadingInternal {
+
+    namespace {
+
+        static constexpr const char MESH_CACHE_MAGIC[8] = { 'Q', 'O', 'B', 'J', 'M', 'S', 'H', '\0' };
+        //Version 2 added n-gon support, version 3 sorts faces by material, version 4 optimizes indexed meshes,
+        //version 5 generates smooth normals, version 6 can add packed tangents,
+        //version 7 welds duplicate positions, version 8 caches the material draw ranges,
+        //version 9 only welds positions when asked to and records the weld tolerance,
+        //version 10 never holds randomly generated texture coordinates
+        static constexpr const uint32_t MESH_CACHE_FORMAT_VERSION = 10u;
+        static constexpr const char * MESH_CACHE_EXTENSION = ".qobjcache";
+        static constexpr const char * MESH_CACHE_TEMPORARY_EXTENSION = ".tmp";
+
+        //Models can be loaded concurrently, and the same model (with the same options) may be loaded
+        //more than once at the same time. Every write gets its own temporary file so that 2 writers
+        //never interleave their data, whichever write is renamed into place last wins.
+        std::atomic<unsigned int> temporaryFileCounter{ 0u };
+
+        //Bits for MeshCacheHeader::layoutFlags
+        static constexpr const uint32_t LAYOUT_HAS_TEX_COORDS = 1u << 0u;
+        static constexpr const uint32_t LAYOUT_HAS_NORMALS = 1u << 1u;
+        static constexpr const uint32_t LAYOUT_IS_INDEXED = 1u << 2u;
+        static constexpr const uint32_t LAYOUT_16_BIT_INDICES = 1u << 3u;
+        static constexpr const uint32_t LAYOUT_HAS_TANGENTS = 1u << 4u;
+
+        //Bits for MeshCacheHeader::optionFlags
+        static constexpr const uint32_t OPTION_GENERATE_MISSING_COMPONENTS = 1u << 0u;
+        static constexpr const uint32_t OPTION_RANDOMIZE_TEX_COORDS = 1u << 1u;
+        static constexpr const uint32_t OPTION_INDEXED = 1u << 2u;
+        static constexpr const uint32_t OPTION_OPTIMIZE_VERTEX_CACHE = 1u << 3u;
+        static constexpr const uint32_t OPTION_OPTIMIZE_OVERDRAW = 1u << 4u;
+        static constexpr const uint32_t OPTION_GENERATE_TANGENTS = 1u << 5u;
+
+        struct MeshCacheHeader {
+            char magic[8];
+            uint32_t formatVersion;
+            uint32_t layoutFlags;
+            uint32_t optionFlags;
+            float scale;
+            float s;
+            float t;
+            float positionWeldTolerance;
+            uint64_t sourceSize;
+            uint64_t sourceHash;
+            int64_t sourceLastWriteTime;
+            uint64_t vertexFloatCount;
+            uint64_t lineEndpointFloatCount;
+            uint64_t indexCount;
+            uint64_t materialSectionSize; //In bytes
+        };
+        static_assert(std::is_trivially_copyable<MeshCacheHeader>::value, "The cache header is written out with memcpy");
+
+        //Recorded in place of a library's size when the library could not be found
+        static constexpr const uint64_t MISSING_MATERIAL_LIBRARY = std::numeric_limits<uint64_t>::max();
+
+        struct MaterialLibraryStamp {
+            uint64_t size;
+            int64_t lastWriteTime;
+            uint64_t hash;
+        };
+        static_assert(std::is_trivially_copyable<MaterialLibraryStamp>::value, "Library stamps are written out with memcpy");
+
+        uint32_t packOptionFlags(const MeshCacheLoadOptions& options) noexcept {
+            uint32_t flags = 0u;
+            if (options.generateMissingComponents)
+                flags |= OPTION_GENERATE_MISSING_COMPONENTS;
+            if (options.randomizeTextureCoords)
+                flags |= OPTION_RANDOMIZE_TEX_COORDS;
+            if (options.indexed)
+                flags |= OPTION_INDEXED;
+            if (options.optimizeVertexCache)
+                flags |= OPTION_OPTIMIZE_VERTEX_CACHE;
+            if (options.optimizeOverdraw)
+                flags |= OPTION_OPTIMIZE_OVERDRAW;
+            if (options.generateTangents)
+                flags |= OPTION_GENERATE_TANGENTS;
+            return flags;
+        }
+
+        //The options are compared bit-for-bit, a cache is never used for even a slightly different scale
+        bool optionsMatch(const MeshCacheHeader& header, const MeshCacheLoadOptions& options) noexcept {
+            return ((header.optionFlags == packOptionFlags(options)) &&
+                    (memcmp(&header.scale, &options.scale, sizeof(float)) == 0) &&
+                    (memcmp(&header.s, &options.s, sizeof(float)) == 0) &&
+                    (memcmp(&header.t, &options.t, sizeof(float)) == 0) &&
+                    (memcmp(&header.positionWeldTolerance, &options.positionWeldTolerance, sizeof(float)) == 0));
+        }
+
+        //Looks up the source file's size and 'last_write_time'. Returns false if either is unavailable.
+        bool getSourceFileStamp(const std::string& sourceFilepath, uint64_t& size, int64_t& lastWriteTime) {
+            std::filesystem::file_time_type writeTime;
+            if (!FilepathWrapper::getTimeOfFilesMostRecentUpdate(sourceFilepath, writeTime))
+                return false;
+            std::error_code errorCodeFromOS;
+            const std::uintmax_t fileSize = std::filesystem::file_size(sourceFilepath, errorCodeFromOS);
+            if (errorCodeFromOS)
+                return false;
+            size = static_cast<uint64_t>(fileSize);
+            lastWriteTime = static_cast<int64_t>(writeTime.time_since_epoch().count());
+            return true;
+        }
+
+        //Looks up a material library's size and 'last_write_time', a library which doesn't exist gets
+        //MISSING_MATERIAL_LIBRARY as its size. Returns false if a library exists but can't be stamped.
+        bool getMaterialLibraryStamp(const std::string& libraryFilepath, MaterialLibraryStamp& stamp) {
+            stamp = { MISSING_MATERIAL_LIBRARY, 0, 0u };
+            if (!FilepathWrapper::file_exists(libraryFilepath.c_str()))
+                return true;
+            return getSourceFileStamp(libraryFilepath, stamp.size, stamp.lastWriteTime);
+        }
+
+        template<typename T>
+        void appendValue(std::string& section, const T& value) {
+            static_assert(std::is_trivially_copyable<T>::value, "Values are written out with memcpy");
+            section.append(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+
+        void appendString(std::string& section, const std::string& text) {
+            appendValue(section, static_cast<uint32_t>(text.length()));
+            section.append(text);
+        }
+
+        void appendMaterial(std::string& section, const WavefrontMaterial& material) {
+            appendString(section, material.name);
+            appendValue(section, material.phong.getAmbient());
+            appendValue(section, material.phong.getDiffuse());
+            appendValue(section, material.phong.getSpecular());
+            appendValue(section, material.phong.getShiny());
+            appendValue(section, material.phong.getOpacity());
+            appendValue(section, static_cast<uint32_t>(material.illuminationModel));
+            appendValue(section, material.emissive);
+            appendValue(section, material.opticalDensity);
+            appendString(section, material.ambientTextureMap);
+            appendString(section, material.diffuseTextureMap);
+            appendString(section, material.specularTextureMap);
+            appendString(section, material.alphaTextureMap);
+            appendString(section, material.bumpMap);
+        }
+
+        //Reads values back out of the materials section. Every read fails once the section runs out.
+        class MaterialSectionReader {
+        public:
+            MaterialSectionReader(const char * start, uint64_t size) : mPosition_(start), mRemaining_(size) { }
+
+            template<typename T>
+            bool read(T& value) noexcept {
+                static_assert(std::is_trivially_copyable<T>::value, "Values are read back with memcpy");
+                if (mRemaining_ < sizeof(T))
+                    return false;
+                memcpy(&value, mPosition_, sizeof(T));
+                mPosition_ += sizeof(T);
+                mRemaining_ -= sizeof(T);
+                return true;
+            }
+
+            bool readString(std::string& text) {
+                uint32_t length = 0u;
+                if ((!read(length)) || (mRemaining_ < length))
+                    return false;
+                text.assign(mPosition_, length);
+                mPosition_ += length;
+                mRemaining_ -= length;
+                return true;
+            }
+
+            bool readMaterial(WavefrontMaterial& material) {
+                std::array<float, 3> ambient, diffuse, specular;
+                float shiny = 0.0f;
+                float opacity = 0.0f;
+                uint32_t illuminationModel = 0u;
+                if (!(readString(material.name) && read(ambient) && read(diffuse) && read(specular) && read(shiny) &&
+                      read(opacity) && read(illuminationModel) && read(material.emissive) && read(material.opticalDensity) &&
+                      readString(material.ambientTextureMap) && readString(material.diffuseTextureMap) &&
+                      readString(material.specularTextureMap) && readString(material.alphaTextureMap) &&
+                      readString(material.bumpMap)))
+                    return false;
+                if (illuminationModel > static_cast<uint32_t>(MTL_ILLUM_MODEL::UNRECOGNIZED_ILLUM_MODEL))
+                    return false;
+                material.phong = PhongShadingParameterSet(ambient, diffuse, specular, shiny, opacity);
+                material.illuminationModel = static_cast<MTL_ILLUM_MODEL>(illuminationModel);
+                return true;
+            }
+
+            bool finished() const noexcept { return (mRemaining_ == 0u); }
+
+        private:
+            const char * mPosition_;
+            uint64_t mRemaining_;
+        };
+
+        //Reads the whole materials section. Returns false if the section is damaged.
+        bool readMaterialSection(MaterialSectionReader& reader, MeshCacheMaterials& materials,
+                                 std::vector<MaterialLibraryStamp>& libraryStamps) {
+            uint64_t libraryCount = 0u;
+            if (!reader.read(libraryCount))
+                return false;
+            for (uint64_t i = 0u; i < libraryCount; i++) {
+                std::string filepath;
+                MaterialLibraryStamp stamp;
+                if ((!reader.readString(filepath)) || (!reader.read(stamp)))
+                    return false;
+                materials.libraryFilepaths.push_back(std::move(filepath));
+                libraryStamps.push_back(stamp);
+            }
+
+            uint64_t rangeCount = 0u;
+            if (!reader.read(rangeCount))
+                return false;
+            for (uint64_t i = 0u; i < rangeCount; i++) {
+                MeshCacheMaterialRange range;
+                if ((!reader.read(range.first)) || (!reader.read(range.count)) || (!reader.readMaterial(range.material)))
+                    return false;
+                materials.drawRanges.push_back(std::move(range));
+            }
+            return reader.finished();
+        }
+
+        template<typename T>
+        void copySection(const char * sectionStart, uint64_t count, std::vector<T>& destination) {
+            destination.resize(static_cast<size_t>(count));
+            if (count > 0u)
+                memcpy(destination.data(), sectionStart, static_cast<size_t>(count) * sizeof(T));
+        }
+
+        template<typename T>
+        void writeSection(std::ofstream& out, const std::vector<T>& section) {
+            if (!section.empty())
+                out.write(reinterpret_cast<const char *>(section.data()), static_cast<std::streamsize>(section.size() * sizeof(T)));
+        }
+
+        inline uint64_t rotateLeft(uint64_t x, unsigned int r) noexcept {
+            return ((x << r) | (x >> (64u - r)));
+        }
+
+    } //namespace
+
+
+    std::string getMeshCacheFilepath(const std::string& sourceFilepath, const MeshCacheLoadOptions& options) {
+        char packedOptions[5u * sizeof(uint32_t)];
+        const uint32_t optionFlags = packOptionFlags(options);
+        memcpy(packedOptions, &optionFlags, sizeof(uint32_t));
+        memcpy(packedOptions + sizeof(uint32_t), &options.scale, sizeof(float));
+        memcpy(packedOptions + (2u * sizeof(uint32_t)), &options.s, sizeof(float));
+        memcpy(packedOptions + (3u * sizeof(uint32_t)), &options.t, sizeof(float));
+        memcpy(packedOptions + (4u * sizeof(uint32_t)), &options.positionWeldTolerance, sizeof(float));
+        const uint64_t optionsHash = hashMeshCacheSource(std::string_view(packedOptions, sizeof(packedOptions)));
+
+        char optionsTag[16];
+        snprintf(optionsTag, sizeof(optionsTag), ".%08x", static_cast<unsigned int>(optionsHash & 0xFFFFFFFFu));
+        return (sourceFilepath + optionsTag + MESH_CACHE_EXTENSION);
+    }
+
+
+    //4 independent lanes each consume 8 bytes per step, so the multiplies from different lanes
+    //overlap with each other. The lanes are folded together (along with any leftover bytes) at the end.
+    uint64_t hashMeshCacheSource(std::string_view text) noexcept {
+        static constexpr const uint64_t PRIME_1 = 0x9E3779B185EBCA87ULL;
+        static constexpr const uint64_t PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+
+        const char * data = text.data();
+        const size_t length = text.length();
+        uint64_t lanes[4] = { PRIME_1, PRIME_2, ~PRIME_1, ~PRIME_2 };
+
+        size_t position = 0u;
+        for (; (position + 32u) <= length; position += 32u) {
+            for (int lane = 0; lane < 4; lane++) {
+                uint64_t word;
+                memcpy(&word, data + position + (lane * 8u), sizeof(uint64_t));
+                lanes[lane] = rotateLeft(lanes[lane] + (word * PRIME_2), 31u) * PRIME_1;
+            }
+        }
+
+        uint64_t h = static_cast<uint64_t>(length) * PRIME_1;
+        for (int lane = 0; lane < 4; lane++)
+            h = (rotateLeft(h ^ lanes[lane], 27u) * PRIME_1) + PRIME_2;
+        for (; position < length; position++)
+            h = rotateLeft(h ^ (static_cast<uint64_t>(static_cast<unsigned char>(data[position])) * PRIME_1), 11u) * PRIME_2;
+
+        h ^= (h >> 33u);
+        h *= PRIME_2;
+        h ^= (h >> 29u);
+        return h;
+    }
+
+
+    bool readMeshCache(const std::string& sourceFilepath, const MeshCacheLoadOptions& options,
+                       MeshCacheLayout& layout, std::vector<float>& vertices, std::vector<float>& lineEndpoints,
+                       std::vector<uint16_t>& indices16, std::vector<uint32_t>& indices32,
+                       MeshCacheMaterials& materials) {
+        const std::string cacheFilepath = getMeshCacheFilepath(sourceFilepath, options);
+        if (!FilepathWrapper::file_exists(cacheFilepath.c_str()))
+            return false;
+
+        const MappedFileView cache(cacheFilepath);
+        if ((!cache.valid()) || (cache.size() < sizeof(MeshCacheHeader)))
+            return false;
+
+        MeshCacheHeader header;
+        memcpy(&header, cache.text().data(), sizeof(MeshCacheHeader));
+        if ((memcmp(header.magic, MESH_CACHE_MAGIC, sizeof(MESH_CACHE_MAGIC)) != 0) ||
+            (header.formatVersion != MESH_CACHE_FORMAT_VERSION)) {
+            fprintf(MSGLOG, "\nIgnoring mesh cache \"%s\" because it was written by a different version.\n", cacheFilepath.c_str());
+            return false;
+        }
+        if (!optionsMatch(header, options))
+            return false;
+
+        uint64_t sourceSize = 0u;
+        int64_t sourceLastWriteTime = 0;
+        if (!getSourceFileStamp(sourceFilepath, sourceSize, sourceLastWriteTime))
+            return false;
+        if ((sourceSize != header.sourceSize) || (sourceLastWriteTime != header.sourceLastWriteTime)) {
+            fprintf(MSGLOG, "\nMesh cache \"%s\" is out of date, the model will be re-parsed.\n", cacheFilepath.c_str());
+            return false;
+        }
+
+        const bool indices16Bit = ((header.layoutFlags & LAYOUT_16_BIT_INDICES) != 0u);
+        const uint64_t indexSize = (indices16Bit ? sizeof(uint16_t) : sizeof(uint32_t));
+        const uint64_t expectedCacheSize = sizeof(MeshCacheHeader) + (header.vertexFloatCount * sizeof(float)) +
+            (header.lineEndpointFloatCount * sizeof(float)) + (header.indexCount * indexSize) + header.materialSectionSize;
+        if (expectedCacheSize != static_cast<uint64_t>(cache.size())) {
+            fprintf(WRNLOG, "\nWarning! Mesh cache \"%s\" is damaged, the model will be re-parsed.\n", cacheFilepath.c_str());
+            return false;
+        }
+
+        MeshCacheMaterials cachedMaterials;
+        std::vector<MaterialLibraryStamp> libraryStamps;
+        MaterialSectionReader materialReader(cache.text().data() + (cache.size() - header.materialSectionSize),
+                                             header.materialSectionSize);
+        if (!readMaterialSection(materialReader, cachedMaterials, libraryStamps)) {
+            fprintf(WRNLOG, "\nWarning! Mesh cache \"%s\" is damaged, the model will be re-parsed.\n", cacheFilepath.c_str());
+            return false;
+        }
+        for (size_t i = 0u; i < libraryStamps.size(); i++) {
+            MaterialLibraryStamp current;
+            if ((!getMaterialLibraryStamp(cachedMaterials.libraryFilepaths[i], current)) ||
+                (current.size != libraryStamps[i].size) || (current.lastWriteTime != libraryStamps[i].lastWriteTime)) {
+                fprintf(MSGLOG, "\nMesh cache \"%s\" is out of date because material library \"%s\" has changed, "
+                    "the model will be re-parsed.\n", cacheFilepath.c_str(), cachedMaterials.libraryFilepaths[i].c_str());
+                return false;
+            }
+        }
+
+        //Hashing requires reading the entire source file, so it is saved for last
+        {
+            const MappedFileView source(sourceFilepath);
+            if ((!source.valid()) || (hashMeshCacheSource(source.text()) != header.sourceHash)) {
+                fprintf(MSGLOG, "\nMesh cache \"%s\" does not match its source file, the model will be re-parsed.\n",
+                    cacheFilepath.c_str());
+                return false;
+            }
+        }
+        for (size_t i = 0u; i < libraryStamps.size(); i++) {
+            if (libraryStamps[i].size == MISSING_MATERIAL_LIBRARY)
+                continue;
+            const MappedFileView library(cachedMaterials.libraryFilepaths[i]);
+            if ((!library.valid()) || (hashMeshCacheSource(library.text()) != libraryStamps[i].hash)) {
+                fprintf(MSGLOG, "\nMesh cache \"%s\" does not match material library \"%s\", the model will be re-parsed.\n",
+                    cacheFilepath.c_str(), cachedMaterials.libraryFilepaths[i].c_str());
+                return false;
+            }
+        }
+
+        const char * section = cache.text().data() + sizeof(MeshCacheHeader);
+        copySection(section, header.vertexFloatCount, vertices);
+        section += header.vertexFloatCount * sizeof(float);
+        copySection(section, header.lineEndpointFloatCount, lineEndpoints);
+        section += header.lineEndpointFloatCount * sizeof(float);
+        if (indices16Bit) {
+            copySection(section, header.indexCount, indices16);
+            indices32.clear();
+        }
+        else {
+            copySection(section, header.indexCount, indices32);
+            indices16.clear();
+        }
+
+        layout.hasTexCoords = ((header.layoutFlags & LAYOUT_HAS_TEX_COORDS) != 0u);
+        layout.hasNormals = ((header.layoutFlags & LAYOUT_HAS_NORMALS) != 0u);
+        layout.isIndexed = ((header.layoutFlags & LAYOUT_IS_INDEXED) != 0u);
+        layout.hasTangents = ((header.layoutFlags & LAYOUT_HAS_TANGENTS) != 0u);
+        materials = std::move(cachedMaterials);
+        return true;
+    }
+
+
+    bool writeMeshCache(const std::string& sourceFilepath,
+                        const MeshCacheLoadOptions& options, const MeshCacheLayout& layout,
+                        const std::vector<float>& vertices, const std::vector<float>& lineEndpoints,
+                        const std::vector<uint16_t>& indices16, const std::vector<uint32_t>& indices32,
+                        const MeshCacheMaterials& materials) {
+        const std::string cacheFilepath = getMeshCacheFilepath(sourceFilepath, options);
+        const std::string temporaryFilepath = cacheFilepath + "." + std::to_string(temporaryFileCounter++) +
+            MESH_CACHE_TEMPORARY_EXTENSION;
+
+        MeshCacheHeader header;
+        memset(&header, 0, sizeof(MeshCacheHeader));
+        memcpy(header.magic, MESH_CACHE_MAGIC, sizeof(MESH_CACHE_MAGIC));
+        header.formatVersion = MESH_CACHE_FORMAT_VERSION;
+        header.optionFlags = packOptionFlags(options);
+        header.scale = options.scale;
+        header.s = options.s;
+        header.t = options.t;
+        header.positionWeldTolerance = options.positionWeldTolerance;
+
+        const bool indices16Bit = (layout.isIndexed && indices32.empty());
+        header.layoutFlags = 0u;
+        if (layout.hasTexCoords)
+            header.layoutFlags |= LAYOUT_HAS_TEX_COORDS;
+        if (layout.hasNormals)
+            header.layoutFlags |= LAYOUT_HAS_NORMALS;
+        if (layout.isIndexed)
+            header.layoutFlags |= LAYOUT_IS_INDEXED;
+        if (indices16Bit)
+            header.layoutFlags |= LAYOUT_16_BIT_INDICES;
+        if (layout.hasTangents)
+            header.layoutFlags |= LAYOUT_HAS_TANGENTS;
+
+        if (!getSourceFileStamp(sourceFilepath, header.sourceSize, header.sourceLastWriteTime)) {
+            fprintf(WRNLOG, "\nWarning! Unable to write a mesh cache for \"%s\" because the file's\n"
+                "size and time of last modification could not be determined!\n", sourceFilepath.c_str());
+            return false;
+        }
+        {
+            const MappedFileView source(sourceFilepath);
+            if (!source.valid()) {
+                fprintf(WRNLOG, "\nWarning! Unable to write a mesh cache for \"%s\" because the file could not be read!\n",
+                    sourceFilepath.c_str());
+                return false;
+            }
+            header.sourceHash = hashMeshCacheSource(source.text());
+        }
+        header.vertexFloatCount = vertices.size();
+        header.lineEndpointFloatCount = lineEndpoints.size();
+        header.indexCount = (layout.isIndexed ? (indices16Bit ? indices16.size() : indices32.size()) : 0u);
+
+        std::string materialSection;
+        appendValue(materialSection, static_cast<uint64_t>(materials.libraryFilepaths.size()));
+        for (const std::string& libraryFilepath : materials.libraryFilepaths) {
+            MaterialLibraryStamp stamp;
+            if (!getMaterialLibraryStamp(libraryFilepath, stamp)) {
+                fprintf(WRNLOG, "\nWarning! Unable to write a mesh cache for \"%s\" because the size and time of last\n"
+                    "modification of its material library \"%s\" could not be determined!\n",
+                    sourceFilepath.c_str(), libraryFilepath.c_str());
+                return false;
+            }
+            if (stamp.size != MISSING_MATERIAL_LIBRARY) {
+                const MappedFileView library(libraryFilepath);
+                if (!library.valid()) {
+                    fprintf(WRNLOG, "\nWarning! Unable to write a mesh cache for \"%s\" because its material library\n"
+                        "\"%s\" could not be read!\n", sourceFilepath.c_str(), libraryFilepath.c_str());
+                    return false;
+                }
+                stamp.hash = hashMeshCacheSource(library.text());
+            }
+            appendString(materialSection, libraryFilepath);
+            appendValue(materialSection, stamp);
+        }
+        appendValue(materialSection, static_cast<uint64_t>(materials.drawRanges.size()));
+        for (const MeshCacheMaterialRange& range : materials.drawRanges) {
+            appendValue(materialSection, range.first);
+            appendValue(materialSection, range.count);
+            appendMaterial(materialSection, range.material);
+        }
+        header.materialSectionSize = materialSection.size();
+
+        {
+            std::ofstream out(temporaryFilepath, std::ios::out | std::ios::binary | std::ios::trunc);
+            if (!out) {
+                fprintf(WRNLOG, "\nWarning! Unable to create mesh cache file \"%s\"!\n", temporaryFilepath.c_str());
+                return false;
+            }
+            out.write(reinterpret_cast<const char *>(&header), sizeof(MeshCacheHeader));
+            writeSection(out, vertices);
+            writeSection(out, lineEndpoints);
+            if (layout.isIndexed) {
+                if (indices16Bit)
+                    writeSection(out, indices16);
+                else
+                    writeSection(out, indices32);
+            }
+            out.write(materialSection.data(), static_cast<std::streamsize>(materialSection.size()));
+            if (!out) {
+                fprintf(WRNLOG, "\nWarning! An error occurred while writing mesh cache file \"%s\"!\n", temporaryFilepath.c_str());
+                out.close();
+                std::error_code ignored;
+                std::filesystem::remove(temporaryFilepath, ignored);
+                return false;
+            }
+        }
+
+        std::error_code errorCodeFromOS;
+        std::filesystem::rename(temporaryFilepath, cacheFilepath, errorCodeFromOS);
+        if (errorCodeFromOS) {
+            fprintf(WRNLOG, "\nWarning! Unable to move mesh cache into place at \"%s\"!\nError Message: %s\n",
+                cacheFilepath.c_str(), errorCodeFromOS.message().c_str());
+            std::error_code ignored;
+            std::filesystem::remove(temporaryFilepath, ignored);
+            return false;
+        }
+
+        fprintf(MSGLOG, "Wrote mesh cache \"%s\"\n", cacheFilepath.c_str());
+        return true;
+    }
+
+} //namespace AssetLoadingInternal
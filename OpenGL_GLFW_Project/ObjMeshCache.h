@@ -0,0 +1,120 @@
+// File:           ObjMeshCache.h
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    A compact binary cache of the final mesh data that QuickObj builds from an '.obj'
+//                 file. The first time a model is loaded, the assembled vertices (and indices, line
+//                 endpoints and layout flags) are written out to a cache file sitting right next to
+//                 the '.obj' file. Every load after that memory-maps the cache and copies each section 
+//                 straight into its vector, which skips parsing entirely.
+//
+//                 Each different set of load options gets its own cache file, named after the '.obj'
+//                 file plus a hash of the options (i.e. "Model.obj" gets "Model.obj.1a2b3c4d.qobjcache"),
+//                 so loading the same model in 2 different ways doesn't keep overwriting one cache.
+//
+//                 A cache is only used if it is still valid, which requires all of the following:
+//                     -The cache's format version matches the version this code writes
+//                     -The options the mesh was loaded with (scale, component generation, output
+//                        format, etc.) exactly match the options of the current load
+//                     -The size and 'last_write_time' of the '.obj' file (as reported through
+//                        FilepathWrapper) match what was recorded when the cache was written
+//                     -A hash of the '.obj' file's text matches the recorded hash
+//                     -Every material library the model looked for has the same size, 'last_write_time'
+//                        and hash as when the cache was written, and every library which could not be
+//                        found back then still can't be found
+//                 The hashes are only computed once the cheaper checks have all passed.
+//
+// File Format:    [MeshCacheHeader] [vertex floats] [line endpoint floats] [indices] [materials]
+//                 All values are written in the machine's native byte order. Caches are meant to
+//                 speed up loading on the machine that wrote them, they are not a distribution format.
+//                 The indices are either 16-bit or 32-bit values, depending on the layout flags.
+//                 The materials section holds the stamp of each material library followed by each
+//                 material draw range, with every string written as its length followed by its bytes.
+//
+// Note:           The format version needs to be bumped any time a change is made to the way QuickObj
+//                 assembles its data, otherwise stale caches will keep getting used.
+
+#pragma once
+
+#ifndef OBJ_MESH_CACHE_H_
+#define OBJ_MESH_CACHE_H_
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "LoggingMessageTargets.h"
+#include "WavefrontMtl.h"
+
+namespace AssetLoadingInternal {
+
+    //Everything that changes the data QuickObj produces for a given file. A cache written
+    //with one set of options will never be used for a load with a different set of options.
+    struct MeshCacheLoadOptions {
+        float scale;
+        bool generateMissingComponents;
+        bool randomizeTextureCoords;
+        float s, t;
+        bool indexed;
+        //Only ever set for indexed loads (see MeshOptimizer.h)
+        bool optimizeVertexCache;
+        bool optimizeOverdraw;
+        bool generateTangents;
+        float positionWeldTolerance; //0 when positions aren't welded
+    };
+
+    //The layout of the cached mesh data
+    struct MeshCacheLayout {
+        bool hasTexCoords;
+        bool hasNormals;
+        bool isIndexed;
+        bool hasTangents;
+    };
+
+    //One material's share of the cached mesh [see QuickObj's MaterialDrawRange]
+    struct MeshCacheMaterialRange {
+        WavefrontMaterial material;
+        uint64_t first;
+        uint64_t count;
+    };
+
+    //The materials of the cached mesh, along with every material library they were looked up in
+    struct MeshCacheMaterials {
+        //Includes the libraries which could not be found, so a cache gets replaced once they show up
+        std::vector<std::string> libraryFilepaths;
+        std::vector<MeshCacheMaterialRange> drawRanges;
+    };
+
+    //Returns the filepath of the cache file that goes with the '.obj' file at 'sourceFilepath' when
+    //it is loaded with 'options'
+    std::string getMeshCacheFilepath(const std::string& sourceFilepath, const MeshCacheLoadOptions& options);
+
+    //Hashes the text of a source file. Processes 32 bytes per step, so it runs much faster
+    //than the file can be read from disk.
+    uint64_t hashMeshCacheSource(std::string_view text) noexcept;
+
+    //Attempts to load the cached mesh data for the '.obj' file at 'sourceFilepath'. Returns true
+    //and fills in all of the output parameters if a valid cache was found, otherwise returns false
+    //and leaves the output parameters untouched.
+    bool readMeshCache(const std::string& sourceFilepath, const MeshCacheLoadOptions& options,
+                       MeshCacheLayout& layout, std::vector<float>& vertices, std::vector<float>& lineEndpoints,
+                       std::vector<uint16_t>& indices16, std::vector<uint32_t>& indices32,
+                       MeshCacheMaterials& materials);
+
+    //Writes out a cache file for the '.obj' file at 'sourceFilepath'. The source file is hashed
+    //exactly as it sits on disk [the same bytes 'readMeshCache()' hashes], which isn't always the
+    //text it was parsed from, since AsciiAsset adds a newline onto files that don't end with one.
+    //The cache is first written to a temporary file which is then renamed, so a partially written
+    //cache is never left behind. Returns false (after printing a warning) if the cache could not
+    //be written.
+    bool writeMeshCache(const std::string& sourceFilepath,
+                        const MeshCacheLoadOptions& options, const MeshCacheLayout& layout,
+                        const std::vector<float>& vertices, const std::vector<float>& lineEndpoints,
+                        const std::vector<uint16_t>& indices16, const std::vector<uint32_t>& indices32,
+                        const MeshCacheMaterials& materials);
+
+} //namespace AssetLoadingInternal
+
+#endif //OBJ_MESH_CACHE_H_
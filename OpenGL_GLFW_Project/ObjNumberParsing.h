@@ -0,0 +1,175 @@
+// File:           ObjNumberParsing.h
+// Namespace:      AssetLoadingInternal::ObjNumberParsing
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    The character and number parsing helpers used to read '.obj' text. These were
+//                 originally private to ObjTokenizer.cpp, they were moved out here so that the
+//                 parser for conformant '.obj' files (see ConformantObj.h) reads numbers exactly the
+//                 same way the tokenizer does. Both parsers have to produce bit-identical floats from
+//                 the same text, otherwise a conformed file would load differently than its original.
+//                 The '.mtl' parser (see WavefrontMtl.h) reads its numbers with these as well.
+//
+//                 Every function here expects the text to be terminated by a character that can't
+//                 be part of a number [an '.obj' file's text always ends with '\n'], so none of them
+//                 need to know where the text ends.
+
+#pragma once
+
+#ifndef OBJ_NUMBER_PARSING_H_
+#define OBJ_NUMBER_PARSING_H_
+
+#include <cstdint>
+#include <cstdlib>   //strtof
+
+namespace AssetLoadingInternal {
+
+    namespace ObjNumberParsing {
+
+        //Exact powers of ten that can be represented in a double (10^22 is the largest)
+        static constexpr const double EXACT_POWERS_OF_TEN[] = {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+        static constexpr const int MAX_EXACT_POWER_OF_TEN = 22;
+
+        //A mantissa with up to 19 decimal digits always fits in a uint64_t. To be converted to
+        //a double without any rounding it additionally must not exceed 2^53.
+        static constexpr const int MAX_FAST_PATH_DIGITS = 19;
+        static constexpr const uint64_t MAX_EXACT_DOUBLE_MANTISSA = (1ULL << 53);
+
+        inline bool isDigit(char c) noexcept { return (static_cast<unsigned char>(c - '0') < 10u); }
+
+        //Treats '\r' as whitespace so that files with Windows line endings still parse
+        inline bool isBlank(char c) noexcept { return ((c == ' ') || (c == '\t') || (c == '\r')); }
+
+        inline const char * skipBlanks(const char * c) noexcept {
+            while (isBlank(*c))
+                c++;
+            return c;
+        }
+
+        //Parses a float beginning at 'c'. On success, 'c' is advanced past the number and true is
+        //returned. If no number is present, 'c' is left unmodified and false is returned.
+        //
+        //Fast Path: If the number has at most 19 significant digits, its mantissa fits in a uint64_t.
+        //           If that mantissa is also no larger than 2^53 and the decimal exponent is within
+        //           [-22, 22], then both the mantissa and the power of 10 are exactly representable
+        //           as doubles and a single multiplication/division produces the correctly rounded
+        //           double [this is Clinger's fast path]. That double is then narrowed to a float.
+        //Slow Path: Everything else (very long mantissas, large exponents, 'inf'/'nan') goes through strtof().
+        inline bool parseFloat(const char *& c, float& value) noexcept {
+            const char * start = c;
+            const char * p = c;
+            bool negative = false;
+            if ((*p == '-') || (*p == '+')) {
+                negative = (*p == '-');
+                p++;
+            }
+
+            uint64_t mantissa = 0u;
+            int significantDigits = 0;
+            int exponent = 0;
+            bool sawDigit = false;
+
+            while (isDigit(*p)) {
+                sawDigit = true;
+                if (significantDigits < MAX_FAST_PATH_DIGITS) {
+                    mantissa = (mantissa * 10u) + static_cast<uint64_t>(*p - '0');
+                    if (mantissa != 0u)
+                        significantDigits++;
+                }
+                else {
+                    exponent++; //Digit dropped, but it still affects the magnitude
+                }
+                p++;
+            }
+            if (*p == '.') {
+                p++;
+                while (isDigit(*p)) {
+                    sawDigit = true;
+                    if (significantDigits < MAX_FAST_PATH_DIGITS) {
+                        mantissa = (mantissa * 10u) + static_cast<uint64_t>(*p - '0');
+                        if (mantissa != 0u)
+                            significantDigits++;
+                        exponent--;
+                    }
+                    p++;
+                }
+            }
+            if (!sawDigit) {
+                //Might be something like 'inf' or 'nan', let strtof decide
+                char * parseEnd = nullptr;
+                value = strtof(start, &parseEnd);
+                if (parseEnd == start)
+                    return false;
+                c = parseEnd;
+                return true;
+            }
+
+            bool useSlowPath = (significantDigits >= MAX_FAST_PATH_DIGITS);
+            if ((*p == 'e') || (*p == 'E')) {
+                const char * exponentStart = p;
+                p++;
+                bool negativeExponent = false;
+                if ((*p == '-') || (*p == '+')) {
+                    negativeExponent = (*p == '-');
+                    p++;
+                }
+                if (!isDigit(*p)) {
+                    p = exponentStart; //Not actually an exponent, so the number ended at the 'e'
+                }
+                else {
+                    int explicitExponent = 0;
+                    while (isDigit(*p)) {
+                        if (explicitExponent < 10000)
+                            explicitExponent = (explicitExponent * 10) + (*p - '0');
+                        p++;
+                    }
+                    exponent += (negativeExponent ? -explicitExponent : explicitExponent);
+                }
+            }
+
+            if ((!useSlowPath) && (mantissa <= MAX_EXACT_DOUBLE_MANTISSA) &&
+                (exponent >= -MAX_EXACT_POWER_OF_TEN) && (exponent <= MAX_EXACT_POWER_OF_TEN)) {
+                double result = static_cast<double>(mantissa);
+                if (exponent < 0)
+                    result /= EXACT_POWERS_OF_TEN[-exponent];
+                else
+                    result *= EXACT_POWERS_OF_TEN[exponent];
+                value = static_cast<float>(negative ? -result : result);
+                c = p;
+                return true;
+            }
+
+            char * parseEnd = nullptr;
+            value = strtof(start, &parseEnd);
+            c = parseEnd;
+            return true;
+        }
+
+        //Parses a (possibly negative) integer beginning at 'c'. Returns false without advancing 'c' if
+        //there is no integer there.
+        inline bool parseInteger(const char *& c, int64_t& value) noexcept {
+            const char * p = c;
+            bool negative = false;
+            if (*p == '-') {
+                negative = true;
+                p++;
+            }
+            if (!isDigit(*p))
+                return false;
+            int64_t result = 0;
+            while (isDigit(*p)) {
+                result = (result * 10) + (*p - '0');
+                p++;
+            }
+            value = (negative ? -result : result);
+            c = p;
+            return true;
+        }
+
+    } //namespace ObjNumberParsing
+
+} //namespace AssetLoadingInternal
+
+#endif //OBJ_NUMBER_PARSING_H_
@@ -0,0 +1,511 @@
+// File:           ObjTokenizer.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   Every line of the text is guaranteed to end with '\n', which means every
+//                          inner loop can stop on the newline without also having to compare against
+//                          the end of the buffer. Only the SIMD newline scan needs to know where the
+//                          buffer ends, since it reads 16 (or 32) bytes at a time.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "ObjTokenizer.h"
+#include "ObjNumberParsing.h"
+
+#include <cstring>   //memchr, strncmp
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define OBJ_TOKENIZER_USE_AVX2_ 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define OBJ_TOKENIZER_USE_SSE2_ 1
+#endif
+
+namespace AssetLoadingInternal {
+
+    namespace {
+
+        using namespace ObjNumberParsing;
+
+        //Vertex lines can't have more than 4 components (x, y, z, w)
+        static constexpr const int MAX_VERTEX_LINE_VALUES = 4;
+
+        //Returns a pointer to the first '\n' at or after 'c'. The SIMD loops only ever load
+        //whole blocks which lie entirely before 'end', the remaining tail is handled by memchr.
+        inline const char * findNewline(const char * c, const char * end) noexcept {
+#ifdef OBJ_TOKENIZER_USE_AVX2_
+            const __m256i newlines32 = _mm256_set1_epi8('\n');
+            while ((end - c) >= 32) {
+                const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c));
+                const unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, newlines32)));
+                if (mask != 0u) {
+#ifdef _MSC_VER
+                    unsigned long firstBit;
+                    _BitScanForward(&firstBit, mask);
+                    return c + firstBit;
+#else
+                    return c + __builtin_ctz(mask);
+#endif //_MSC_VER
+                }
+                c += 32;
+            }
+#endif //OBJ_TOKENIZER_USE_AVX2_
+#ifdef OBJ_TOKENIZER_USE_SSE2_
+            const __m128i newlines16 = _mm_set1_epi8('\n');
+            while ((end - c) >= 16) {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c));
+                const unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, newlines16)));
+                if (mask != 0u) {
+#ifdef _MSC_VER
+                    unsigned long firstBit;
+                    _BitScanForward(&firstBit, mask);
+                    return c + firstBit;
+#else
+                    return c + __builtin_ctz(mask);
+#endif //_MSC_VER
+                }
+                c += 16;
+            }
+#endif //OBJ_TOKENIZER_USE_SSE2_
+            const char * found = static_cast<const char *>(memchr(c, '\n', end - c));
+            return (found != nullptr) ? found : end;
+        }
+
+        //Maps a face corner target onto the matching n-gon corner target
+        inline RelativeIndexTarget toNGonTarget(RelativeIndexTarget target) noexcept {
+            switch (target) {
+            case RelativeIndexTarget::POSITION:
+                return RelativeIndexTarget::NGON_POSITION;
+            case RelativeIndexTarget::TEX_COORD:
+                return RelativeIndexTarget::NGON_TEX_COORD;
+            case RelativeIndexTarget::NORMAL:
+                return RelativeIndexTarget::NGON_NORMAL;
+            default:
+                return target;
+            }
+        }
+
+    } //namespace
+
+
+    ObjTokenizer::ObjTokenizer(std::string_view filepathForMessages, bool deferRelativeIndices) {
+        mFilepath_ = filepathForMessages;
+        mLineNumber_ = 0u;
+        mErrorCount_ = 0u;
+        mFreeformGeometryWarningIssued_ = false;
+        mDeferRelativeIndices_ = deferRelativeIndices;
+    }
+
+
+    size_t ObjTokenizer::tokenize(std::string_view text, ObjParseResult& result, size_t firstLineNumber) {
+        mErrorCount_ = 0u;
+        mLineNumber_ = ((firstLineNumber > 0u) ? (firstLineNumber - 1u) : 0u); //Incremented before each line
+        if (text.empty())
+            return 0u;
+        if (text.back() != '\n') {
+            fprintf(ERRLOG, "\nERROR! The text passed to the ObjTokenizer for file \"%.*s\" does not end with a newline!\n",
+                static_cast<int>(mFilepath_.length()), mFilepath_.data());
+            return 1u;
+        }
+
+        const char * c = text.data();
+        const char * const end = c + text.length();
+
+        while (c < end) {
+            mLineNumber_++;
+            c = skipBlanks(c);
+
+            switch (*c) {
+            case '\n':
+                c++; //Empty line
+                continue;
+            case 'v':
+                if (isBlank(c[1])) {
+                    c = parseVertexLine(c + 1, result.positions);
+                }
+                else if ((c[1] == 't') && isBlank(c[2])) {
+                    result.hasTexCoords = true;
+                    c = parseVertexLine(c + 2, result.texCoords);
+                }
+                else if ((c[1] == 'n') && isBlank(c[2])) {
+                    result.hasNormals = true;
+                    c = parseVertexLine(c + 2, result.normals);
+                }
+                else if (c[1] == 'p') {
+                    if (!mFreeformGeometryWarningIssued_) {
+                        fprintf(MSGLOG, "\n\nWhoah! Freeform geometry data encountered! This is quite unexpected!\n"
+                            "It looks like you are trying to load an Advanced OBJ file.\n"
+                            "Unfortunately freeform geometry is not supported at this time...\n"
+                            "\t  [All freeform geometry in this file will be skipped]\n");
+                        mFreeformGeometryWarningIssued_ = true;
+                    }
+                    c = findNewline(c, end) + 1;
+                }
+                else {
+                    reportLineError(c, "Unrecognized vertex data type");
+                    c = findNewline(c, end) + 1;
+                }
+                continue;
+            case 'f':
+            case 'F':
+                c = parseFaceLine(c + 1, result);
+                continue;
+            case 'l':
+            case 'L':
+                c = parseLineLine(c + 1, result);
+                continue;
+            case 'o':  //Object tags
+                if (isBlank(c[1]) || (c[1] == '\n'))
+                    c = parseSubMeshTagLine(c + 1, findNewline(c, end), SubMeshTagType::OBJECT, result);
+                else
+                    c = findNewline(c, end) + 1;
+                continue;
+            case 'g':  //Group tags
+                if (isBlank(c[1]) || (c[1] == '\n'))
+                    c = parseSubMeshTagLine(c + 1, findNewline(c, end), SubMeshTagType::GROUP, result);
+                else
+                    c = findNewline(c, end) + 1;
+                continue;
+            case 'u':  //'usemtl' (only the material's name is recorded, see WavefrontMtl.h for the materials themselves)
+                if ((strncmp(c, "usemtl", 6u) == 0) && (isBlank(c[6]) || (c[6] == '\n')))
+                    c = parseSubMeshTagLine(c + 6, findNewline(c, end), SubMeshTagType::MATERIAL, result);
+                else
+                    c = findNewline(c, end) + 1;
+                continue;
+            case 's':  //Smoothing group tags (only used when normals have to be generated, see VertexNormalGenerator.h)
+                if (isBlank(c[1]) || (c[1] == '\n'))
+                    c = parseSubMeshTagLine(c + 1, findNewline(c, end), SubMeshTagType::SMOOTHING_GROUP, result);
+                else
+                    c = findNewline(c, end) + 1;
+                continue;
+            case '#':  //Comments
+                c = findNewline(c, end) + 1;
+                continue;
+            case 'm':
+            {
+                const char * lineEnd = findNewline(c, end);
+                if (c[1] == 'g') { //Lines starting with "mg" are merging groups
+                    fprintf(MSGLOG, "Skipping Merging Group: %.*s\n", static_cast<int>(lineEnd - c), c);
+                    c = lineEnd + 1;
+                }
+                else if ((strncmp(c, "mtllib", 6u) == 0) && (isBlank(c[6]) || (c[6] == '\n')))
+                    c = parseMaterialLibraryLine(c + 6, lineEnd, result);
+                else {
+                    fprintf(MSGLOG, "\nUnable to parse line %.*s\n", static_cast<int>(lineEnd - c), c);
+                    c = lineEnd + 1;
+                }
+                continue;
+            }
+            default:
+            {
+                const char * lineEnd = findNewline(c, end);
+                fprintf(MSGLOG, "\nUnable to parse line %.*s\n", static_cast<int>(lineEnd - c), c);
+                c = lineEnd + 1;
+                continue;
+            }
+            }
+        }
+        return mErrorCount_;
+    }
+
+
+    template<size_t COMPONENTS>
+    const char * ObjTokenizer::parseVertexLine(const char * c, VertexAttributeStreams<COMPONENTS>& target) {
+        const char * const lineStart = c;
+        float values[MAX_VERTEX_LINE_VALUES] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        int valuesRead = 0;
+
+        c = skipBlanks(c);
+        while (*c != '\n') {
+            float value;
+            if (!parseFloat(c, value)) {
+                reportLineError(lineStart, "Unrecognized data in vertex line");
+                while (*c != '\n')
+                    c++;
+                break;
+            }
+            if (valuesRead < MAX_VERTEX_LINE_VALUES)
+                values[valuesRead] = value;
+            valuesRead++;
+            c = skipBlanks(c);
+        }
+
+        //To keep the vertex ordering intact, a vertex is always added even if the line was bad. Any
+        //components the line didn't have are left as 0.
+        if (valuesRead == 0)
+            reportLineError(lineStart, "No data was loaded for vertex line, a dummy vertex will be substituted");
+        target.push_back(values, static_cast<size_t>(valuesRead));
+        return c + 1;
+    }
+
+
+    const char * ObjTokenizer::parseFaceLine(const char * c, ObjParseResult& result) {
+        const char * const lineStart = c;
+        ParsedFace face;
+        face.positions = { 0u, 0u, 0u, 0u };
+        face.texCoords = { 0u, 0u, 0u, 0u };
+        face.normals = { 0u, 0u, 0u, 0u };
+        face.nGonIndex = 0u;
+        face.vertexCount = 0u;
+        face.hasTexCoords = false;
+        face.hasNormals = false;
+
+        //If the face turns out to be bad, any relative indices or n-gon corners recorded for it must be discarded
+        const size_t pendingCountAtStart = result.pendingRelativeIndices.size();
+        const size_t nGonCornerCountAtStart = result.nGonCorners.size();
+
+        int corner = 0;
+        bool faceValid = true;
+        c = skipBlanks(c);
+        while (*c != '\n') {
+            int64_t index;
+            if (!parseInteger(c, index)) {
+                faceValid = false;
+                break;
+            }
+            const bool storeCorner = (corner < QUAD_VERTICE_COUNT);
+            if (corner == QUAD_VERTICE_COUNT) //The face is an n-gon, so move the 4 corners read so far over
+                beginNGon(face, pendingCountAtStart, result);
+            if (!storeCorner)
+                result.nGonCorners.push_back({ 0u, 0u, 0u });
+
+            FaceIndex resolved = 0u;
+            if (!resolveFaceIndex(index, result.positions.size(), RelativeIndexTarget::POSITION, corner, result, resolved)) {
+                faceValid = false;
+                break;
+            }
+            if (storeCorner)
+                face.positions[corner] = resolved;
+            else
+                result.nGonCorners.back().position = resolved;
+
+            bool cornerHasTexCoord = false;
+            bool cornerHasNormal = false;
+            if (*c == '/') {
+                c++;
+                if (*c != '/') { // 'v/t' or 'v/t/n'
+                    if ((!parseInteger(c, index)) || 
+                        (!resolveFaceIndex(index, result.texCoords.size(), RelativeIndexTarget::TEX_COORD, corner, result, resolved))) {
+                        faceValid = false;
+                        break;
+                    }
+                    if (storeCorner)
+                        face.texCoords[corner] = resolved;
+                    else
+                        result.nGonCorners.back().texCoord = resolved;
+                    cornerHasTexCoord = true;
+                }
+                if (*c == '/') { // 'v//n' or 'v/t/n'
+                    c++;
+                    if ((!parseInteger(c, index)) || 
+                        (!resolveFaceIndex(index, result.normals.size(), RelativeIndexTarget::NORMAL, corner, result, resolved))) {
+                        faceValid = false;
+                        break;
+                    }
+                    if (storeCorner)
+                        face.normals[corner] = resolved;
+                    else
+                        result.nGonCorners.back().normal = resolved;
+                    cornerHasNormal = true;
+                }
+            }
+
+            //Every corner of a face must specify the same set of components
+            if (corner == 0) {
+                face.hasTexCoords = cornerHasTexCoord;
+                face.hasNormals = cornerHasNormal;
+            }
+            else if ((face.hasTexCoords != cornerHasTexCoord) || (face.hasNormals != cornerHasNormal)) {
+                faceValid = false;
+                break;
+            }
+            corner++;
+            c = skipBlanks(c);
+        }
+
+        while (*c != '\n') //Make sure 'c' ends on the newline in the event of a parse error
+            c++;
+
+        if ((!faceValid) || (corner < TRIANGLE_VERTICE_COUNT)) {
+            result.pendingRelativeIndices.resize(pendingCountAtStart);
+            result.nGonCorners.resize(nGonCornerCountAtStart);
+        }
+
+        if (!faceValid) {
+            reportLineError(lineStart - 1, "Malformed face");
+            return c + 1;
+        }
+        if (corner < TRIANGLE_VERTICE_COUNT) {
+            reportLineError(lineStart - 1, "Not enough vertices were parsed for face");
+            return c + 1;
+        }
+
+        if (corner > QUAD_VERTICE_COUNT) {
+            face.nGonIndex = static_cast<uint32_t>(result.nGons.size());
+            face.vertexCount = NGON_VERTEX_COUNT;
+            result.nGons.push_back({ nGonCornerCountAtStart, static_cast<size_t>(corner) });
+        }
+        else {
+            face.vertexCount = static_cast<uint8_t>(corner);
+        }
+        result.faces.push_back(face);
+        return c + 1;
+    }
+
+
+    void ObjTokenizer::beginNGon(const ParsedFace& face, size_t pendingCountAtStart, ObjParseResult& result) {
+        const size_t firstCorner = result.nGonCorners.size();
+        for (int corner = 0; corner < QUAD_VERTICE_COUNT; corner++)
+            result.nGonCorners.push_back({ face.positions[corner], face.texCoords[corner], face.normals[corner] });
+
+        //Any deferred indices already recorded for the face now need to patch the n-gon's corners instead
+        for (size_t i = pendingCountAtStart; i < result.pendingRelativeIndices.size(); i++) {
+            PendingRelativeIndex& pending = result.pendingRelativeIndices[i];
+            pending.location = firstCorner + pending.corner;
+            pending.target = toNGonTarget(pending.target);
+        }
+    }
+
+
+    const char * ObjTokenizer::parseLineLine(const char * c, ObjParseResult& result) {
+        const char * const lineStart = c;
+        Offset previousPoint = 0u;
+        int64_t previousPointDeferredIndex = 0;
+        bool previousPointDeferred = false;
+        int pointsRead = 0;
+
+        //Records a line endpoint, along with its pending fix-up if its index was deferred
+        auto addEndpoint = [&result](Offset point, bool deferred, int64_t deferredIndex) {
+            if (deferred) {
+                result.pendingRelativeIndices.push_back({ result.lineEndpoints.size(), deferredIndex,
+                    RelativeIndexTarget::LINE_ENDPOINT, 0u });
+            }
+            result.lineEndpoints.push_back(point);
+        };
+
+        c = skipBlanks(c);
+        while (*c != '\n') {
+            int64_t index;
+            Offset resolved = 0u;
+            bool deferred = false;
+            int64_t deferredIndex = 0;
+            bool pointValid = parseInteger(c, index);
+            if (pointValid) {
+                if ((index < 0) && mDeferRelativeIndices_) {
+                    deferred = true;
+                    deferredIndex = static_cast<int64_t>(result.positions.size()) + index;
+                }
+                else {
+                    pointValid = resolveIndex(index, result.positions.size(), resolved);
+                }
+            }
+            if (!pointValid) {
+                reportLineError(lineStart - 1, "Malformed line primitive");
+                while (*c != '\n')
+                    c++;
+                return c + 1;
+            }
+            //Line primitives can technically reference texture coordinates ('l 1/1 2/2'), which are ignored
+            if (*c == '/') {
+                c++;
+                parseInteger(c, index);
+            }
+            if (pointsRead > 0) {
+                addEndpoint(previousPoint, previousPointDeferred, previousPointDeferredIndex);
+                addEndpoint(resolved, deferred, deferredIndex);
+            }
+            previousPoint = resolved;
+            previousPointDeferred = deferred;
+            previousPointDeferredIndex = deferredIndex;
+            pointsRead++;
+            c = skipBlanks(c);
+        }
+        if (pointsRead < 2)
+            reportLineError(lineStart - 1, "A line primitive needs at least 2 vertices");
+        return c + 1;
+    }
+
+
+    //Tags are rare compared to every other kind of line, so allocating a string for each name is fine.
+    //A tag without a name gets the name "default", which is what the '.obj' format calls the group
+    //faces belong to before any 'g' tag appears.
+    const char * ObjTokenizer::parseSubMeshTagLine(const char * c, const char * lineEnd, SubMeshTagType type, ObjParseResult& result) {
+        const char * nameStart = skipBlanks(c);
+        const char * nameEnd = lineEnd;
+        while ((nameEnd > nameStart) && isBlank(nameEnd[-1]))
+            nameEnd--;
+        if (nameEnd == nameStart)
+            result.subMeshTags.push_back({ result.faces.size(), std::string("default"), type });
+        else
+            result.subMeshTags.push_back({ result.faces.size(), std::string(nameStart, nameEnd), type });
+        return lineEnd + 1;
+    }
+
+
+    const char * ObjTokenizer::parseMaterialLibraryLine(const char * c, const char * lineEnd, ObjParseResult& result) {
+        const char * nameStart = skipBlanks(c);
+        const char * nameEnd = lineEnd;
+        while ((nameEnd > nameStart) && isBlank(nameEnd[-1]))
+            nameEnd--;
+        if (nameEnd == nameStart)
+            reportLineError(c - 6, "Material library line is missing its filename");
+        else
+            result.materialLibraries.emplace_back(nameStart, nameEnd);
+        return lineEnd + 1;
+    }
+
+
+    //Positive indices are not range checked here because the pools might not yet be complete
+    //(for instance if the text being tokenized is only a piece of a larger file). QuickObj checks
+    //every index against the final pool sizes when it assembles the vertices.
+    bool ObjTokenizer::resolveIndex(int64_t parsed, size_t currentCount, Offset& resolved) noexcept {
+        if (parsed > 0) {
+            resolved = static_cast<Offset>(parsed - 1);
+            return true;
+        }
+        else if (parsed < 0) {
+            const int64_t relative = static_cast<int64_t>(currentCount) + parsed;
+            if (relative < 0)
+                return false;
+            resolved = static_cast<Offset>(relative);
+            return true;
+        }
+        return false; //An index of 0 is never valid in an '.obj' file
+    }
+
+
+    bool ObjTokenizer::resolveFaceIndex(int64_t parsed, size_t currentCount, RelativeIndexTarget target, int corner,
+                                        ObjParseResult& result, FaceIndex& resolved) {
+        if ((parsed < 0) && mDeferRelativeIndices_) {
+            resolved = 0u; //Placeholder until the fix-up is applied
+            if (corner < QUAD_VERTICE_COUNT) {
+                result.pendingRelativeIndices.push_back({ result.faces.size(), static_cast<int64_t>(currentCount) + parsed,
+                    target, static_cast<uint8_t>(corner) });
+            }
+            else {
+                result.pendingRelativeIndices.push_back({ result.nGonCorners.size() - 1u, static_cast<int64_t>(currentCount) + parsed,
+                    toNGonTarget(target), 0u });
+            }
+            return true;
+        }
+        Offset wideIndex = 0u;
+        if ((!resolveIndex(parsed, currentCount, wideIndex)) || (wideIndex > MAX_FACE_INDEX))
+            return false;
+        resolved = static_cast<FaceIndex>(wideIndex);
+        return true;
+    }
+
+
+    void ObjTokenizer::reportLineError(const char * lineStart, const char * reason) {
+        mErrorCount_++;
+        const char * lineEnd = lineStart;
+        while (*lineEnd != '\n')
+            lineEnd++;
+        fprintf(ERRLOG, "\nERROR! %s on line %zu of file \"%.*s\":\n\t%.*s\n", reason, mLineNumber_,
+            static_cast<int>(mFilepath_.length()), mFilepath_.data(), static_cast<int>(lineEnd - lineStart), lineStart);
+    }
+
+} //namespace AssetLoadingInternal
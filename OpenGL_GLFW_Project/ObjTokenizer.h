@@ -0,0 +1,180 @@
+// File:           ObjTokenizer.h
+// Class:          ObjTokenizer
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    A single-pass tokenizer for the text of a '.obj' file. It replaces the
+//                 line-by-line approach QuickObj originally used, where every line was handed
+//                 to either 'loadLineIntoVertex()', the character state machine inside of the
+//                 'Face' constructor or the 'Line' constructor.
+//
+//                 The tokenizer walks the entire file text exactly once and writes parsed values
+//                 straight into the position/texCoord/normal pools and into plain index arrays,
+//                 without ever constructing 'Face' or 'Line' objects.
+//
+// How It's Fast:
+//                 (i)   Lines that are skipped (comments, smoothing group tags, anything
+//                       unrecognized) are jumped over using an SSE2 (or AVX2 if the compiler
+//                       is targeting it) scan for the next newline character.
+//                 (ii)  Numbers are parsed with a 'from_chars'-style fast path. Integers (face
+//                       indices) are accumulated directly. Floats with 19 or fewer significant
+//                       digits and a small exponent are assembled from an integer mantissa and an
+//                       exact power of 10. Anything more exotic falls back to strtof().
+//                 (iii) There is no per-line allocation at all. The only allocations are the
+//                       amortized growth of the output vectors (which can be pre-reserved).
+//
+// Supported Syntax:
+//                   v x y z [w]           (w is ignored)
+//                   vt s [t] [r]          (r is ignored)
+//                   vn x y z
+//                   f  p p p [p]          with each p being one of  'v', 'v/t', 'v//n' or 'v/t/n'
+//                   l  p p [p ...]        (each consecutive pair of points becomes a line segment)
+//                 Negative (relative) indices are supported for both faces and lines. When only a
+//                 piece of a file is being tokenized they can be deferred (see ParallelObjTokenizer).
+//                 Faces with more than 4 vertices (n-gons) have all of their corners stored in the
+//                 result's n-gon arrays, they get triangulated once every position is known (see
+//                 NGonTriangulator.h).
+//                   o name / g name / usemtl name / s group
+//                                         (recorded as ParsedSubMeshTags, see WavefrontObj.h)
+//                   mtllib filename       (recorded in the result's 'materialLibraries', see WavefrontMtl.h)
+//
+// Text Requirements:
+//                 The text must end with a newline character. AsciiAsset guarantees this for both
+//                 its copied and its memory-mapped text. Carriage returns are treated as whitespace.
+
+#pragma once
+
+#ifndef OBJ_TOKENIZER_H_
+#define OBJ_TOKENIZER_H_
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Face.h"    //For the 'Offset' type and the face vertex count constants
+#include "ParsedFaceList.h"
+#include "VertexAttributeStreams.h"
+
+#include "LoggingMessageTargets.h"
+
+namespace AssetLoadingInternal {
+
+    //The order in which every loader writes out the corners of a face as triangles. A quad is split along
+    //its 1-3 diagonal into the triangles (0, 1, 3) and (3, 1, 2), which both keep the quad's winding.
+    static constexpr const int QUAD_TRIANGULATION_CORNERS[TRIANGLE_VERTICE_COUNT * 2] = { 0, 1, 3, 3, 1, 2 };
+    static constexpr const int TRIANGLE_CORNERS[TRIANGLE_VERTICE_COUNT] = { 0, 1, 2 };
+
+    //One corner of an n-gon
+    typedef struct ParsedNGonCorner {
+        FaceIndex position;
+        FaceIndex texCoord;
+        FaceIndex normal;
+    } ParsedNGonCorner;
+
+    //The corners of an n-gon are the 'cornerCount' entries of 'nGonCorners' starting at 'firstCorner'
+    typedef struct ParsedNGon {
+        size_t firstCorner;
+        size_t cornerCount;
+    } ParsedNGon;
+
+    //The kinds of tags which split the faces of a file up into named pieces
+    //(smoothing groups don't name a piece of the mesh, but they are tracked the same way)
+    enum class SubMeshTagType : uint8_t { OBJECT, GROUP, MATERIAL, SMOOTHING_GROUP };
+
+    //An 'o', 'g', 'usemtl' or 's' tag. The tag applies to every face from 'firstFace' up until the next
+    //tag of the same type (an 'o' tag also ends the current group).
+    typedef struct ParsedSubMeshTag {
+        size_t firstFace;   //Index into 'faces' of the first face following the tag
+        std::string name;   //Everything after the keyword, with the surrounding whitespace trimmed
+        SubMeshTagType type;
+    } ParsedSubMeshTag;
+
+    //Which index array a deferred relative index belongs to
+    enum class RelativeIndexTarget : uint8_t { POSITION, TEX_COORD, NORMAL, LINE_ENDPOINT,
+                                               NGON_POSITION, NGON_TEX_COORD, NGON_NORMAL };
+
+    //When only a piece of a file is tokenized, a negative (relative) index can't be resolved since
+    //the number of vertices that came before the piece is not yet known. Instead the index is recorded
+    //here relative to the start of the piece, to be fixed up once all of the pieces are stitched together.
+    typedef struct PendingRelativeIndex {
+        size_t location;              //Which face (or which entry of 'lineEndpoints' or 'nGonCorners') to patch
+        int64_t pieceRelativeIndex;   //Relative to the first vertex of the piece, may be negative
+        RelativeIndexTarget target;
+        uint8_t corner;               //Which corner of the face (unused for line endpoints)
+    } PendingRelativeIndex;
+
+    //Everything the tokenizer extracts from an '.obj' file's text
+    typedef struct ObjParseResult {
+        PositionStreams positions;         //See VertexAttributeStreams.h for how these are stored
+        TexCoordStreams texCoords;
+        NormalStreams normals;
+        ParsedFaceList faces;              //See ParsedFaceList.h for how these are stored
+        std::vector<Offset> lineEndpoints; //Every 2 consecutive values form one line segment
+        std::vector<ParsedNGon> nGons;
+        std::vector<ParsedNGonCorner> nGonCorners;
+        std::vector<ParsedSubMeshTag> subMeshTags; //In file order
+        //Everything after each 'mtllib' keyword (with the surrounding whitespace trimmed), in file order
+        std::vector<std::string> materialLibraries;
+        //Only ever filled in by a tokenizer that is deferring relative indices
+        std::vector<PendingRelativeIndex> pendingRelativeIndices;
+        bool hasTexCoords = false;
+        bool hasNormals = false;
+    } ObjParseResult;
+
+
+    class ObjTokenizer final {
+    public:
+        //The filepath is only used for error messages. Set 'deferRelativeIndices' when the text being
+        //tokenized is only a piece of a file, in which case negative indices are recorded in the result's
+        //'pendingRelativeIndices' instead of being resolved.
+        ObjTokenizer(std::string_view filepathForMessages, bool deferRelativeIndices = false);
+        ~ObjTokenizer() = default;
+
+        ObjTokenizer(const ObjTokenizer&) = delete;
+        ObjTokenizer& operator=(const ObjTokenizer&) = delete;
+
+        //Parses all of the text, appending everything found onto the end of 'result'. The text must
+        //end with a '\n'. Returns the number of lines which could not be parsed (0 means everything
+        //recognized was parsed successfully). 'firstLineNumber' is only used for error messages.
+        size_t tokenize(std::string_view text, ObjParseResult& result, size_t firstLineNumber = 1u);
+
+    private:
+        std::string_view mFilepath_;
+        size_t mLineNumber_;
+        size_t mErrorCount_;
+        bool mFreeformGeometryWarningIssued_;
+        bool mDeferRelativeIndices_;
+
+        //Each of these parses the rest of a line beginning at 'c' and return a pointer
+        //to the character following the line's newline
+        template<size_t COMPONENTS>
+        const char * parseVertexLine(const char * c, VertexAttributeStreams<COMPONENTS>& target);
+        const char * parseFaceLine(const char * c, ObjParseResult& result);
+        const char * parseLineLine(const char * c, ObjParseResult& result);
+        const char * parseSubMeshTagLine(const char * c, const char * lineEnd, SubMeshTagType type, ObjParseResult& result);
+        const char * parseMaterialLibraryLine(const char * c, const char * lineEnd, ObjParseResult& result);
+
+        //Called once a face is found to have a 5th corner. Copies the face's first 4 corners into
+        //'result.nGonCorners' and re-targets any of their deferred relative indices.
+        void beginNGon(const ParsedFace& face, size_t pendingCountAtStart, ObjParseResult& result);
+
+        //Resolves a parsed (1-based, possibly negative) index into a 0-based offset. Returns false
+        //if the index is out of range.
+        static bool resolveIndex(int64_t parsed, size_t currentCount, Offset& resolved) noexcept;
+
+        //Same as 'resolveIndex()', except that when relative indices are being deferred a negative
+        //index is recorded as a PendingRelativeIndex for the face about to be added to 'result' (or,
+        //for corners past the 4th, for the n-gon corner most recently added to 'result'). Also returns false
+        //for an index too large to be stored as a FaceIndex.
+        bool resolveFaceIndex(int64_t parsed, size_t currentCount, RelativeIndexTarget target, int corner,
+                              ObjParseResult& result, FaceIndex& resolved);
+
+        void reportLineError(const char * lineStart, const char * reason);
+    };
+
+} //namespace AssetLoadingInternal
+
+#endif //OBJ_TOKENIZER_H_
@@ -0,0 +1,221 @@
+// File:           ParallelObjTokenizer.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   The first chunk is always tokenized on the calling thread while the
+//                          other chunks run as async tasks, so parsing with N threads only ever
+//                          launches N-1 new threads.
+//
+//                          A relative index that reaches back past the very start of the file can
+//                          only be detected once the chunks are stitched together. Rather than trying
+//                          to remove the offending face at that point, its index is set to a value
+//                          that is guaranteed to be out of range, which QuickObj already checks for
+//                          (and skips) when it assembles the vertices.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "ParallelObjTokenizer.h"
+
+#include <algorithm>
+#include <future>
+#include <limits>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "ForceBeginAsyncTask.h"
+
+namespace AssetLoadingInternal {
+
+    namespace {
+
+        static constexpr const Offset INVALID_OFFSET = std::numeric_limits<Offset>::max();
+
+        //Appends all of the elements of 'source' onto the end of 'destination'
+        template<typename T>
+        inline void appendVector(std::vector<T>& destination, const std::vector<T>& source) {
+            destination.insert(destination.end(), source.cbegin(), source.cend());
+        }
+
+        //Resolves each of the chunk's pending relative indices now that the number of positions, texCoords
+        //and normals parsed before the chunk (which are the current sizes of the pools in 'stitched') is
+        //known. Returns the number of indices which turned out to be out of range.
+        size_t applyPendingRelativeIndices(ObjParseResult& chunk, const ObjParseResult& stitched) {
+            size_t invalidIndices = 0u;
+            for (const PendingRelativeIndex& pending : chunk.pendingRelativeIndices) {
+                size_t base = 0u;
+                switch (pending.target) {
+                case RelativeIndexTarget::POSITION:
+                case RelativeIndexTarget::LINE_ENDPOINT:
+                case RelativeIndexTarget::NGON_POSITION:
+                    base = stitched.positions.size();
+                    break;
+                case RelativeIndexTarget::TEX_COORD:
+                case RelativeIndexTarget::NGON_TEX_COORD:
+                    base = stitched.texCoords.size();
+                    break;
+                case RelativeIndexTarget::NORMAL:
+                case RelativeIndexTarget::NGON_NORMAL:
+                    base = stitched.normals.size();
+                    break;
+                }
+
+                const int64_t resolved = static_cast<int64_t>(base) + pending.pieceRelativeIndex;
+                const bool valid = ((resolved >= 0) && (resolved <= static_cast<int64_t>(MAX_FACE_INDEX)));
+                if (!valid)
+                    invalidIndices++;
+                const FaceIndex index = (valid ? static_cast<FaceIndex>(resolved) : INVALID_FACE_INDEX);
+
+                switch (pending.target) {
+                case RelativeIndexTarget::POSITION:
+                    chunk.faces.setPosition(pending.location, pending.corner, index);
+                    break;
+                case RelativeIndexTarget::TEX_COORD:
+                    chunk.faces.setTexCoord(pending.location, pending.corner, index);
+                    break;
+                case RelativeIndexTarget::NORMAL:
+                    chunk.faces.setNormal(pending.location, pending.corner, index);
+                    break;
+                case RelativeIndexTarget::LINE_ENDPOINT:
+                    chunk.lineEndpoints[pending.location] = (valid ? static_cast<Offset>(resolved) : INVALID_OFFSET);
+                    break;
+                case RelativeIndexTarget::NGON_POSITION:
+                    chunk.nGonCorners[pending.location].position = index;
+                    break;
+                case RelativeIndexTarget::NGON_TEX_COORD:
+                    chunk.nGonCorners[pending.location].texCoord = index;
+                    break;
+                case RelativeIndexTarget::NGON_NORMAL:
+                    chunk.nGonCorners[pending.location].normal = index;
+                    break;
+                }
+            }
+            chunk.pendingRelativeIndices.clear();
+            return invalidIndices;
+        }
+
+        //A chunk's n-gons are numbered from the start of the chunk, so they need to be shifted
+        //past all of the n-gons (and n-gon corners) from the chunks that came before
+        void offsetNGonReferences(ObjParseResult& chunk, const ObjParseResult& stitched) {
+            if (chunk.nGons.empty())
+                return;
+            const uint32_t nGonOffset = static_cast<uint32_t>(stitched.nGons.size());
+            for (size_t i = 0u; i < chunk.faces.size(); i++) {
+                if (chunk.faces.isNGon(i))
+                    chunk.faces.setNGonIndex(i, chunk.faces.nGonIndex(i) + nGonOffset);
+            }
+            for (ParsedNGon& nGon : chunk.nGons)
+                nGon.firstCorner += stitched.nGonCorners.size();
+        }
+
+        //Same idea for the tags, which refer to faces by their position within the chunk. The tags own
+        //their names, so they are moved rather than copied over (along with the material library names).
+        void appendSubMeshTags(ObjParseResult& chunk, ObjParseResult& stitched) {
+            for (ParsedSubMeshTag& tag : chunk.subMeshTags) {
+                tag.firstFace += stitched.faces.size();
+                stitched.subMeshTags.push_back(std::move(tag));
+            }
+            for (std::string& library : chunk.materialLibraries)
+                stitched.materialLibraries.push_back(std::move(library));
+        }
+
+    } //namespace
+
+
+    unsigned int chooseObjParseThreadCount(size_t textLength) noexcept {
+        const unsigned int hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        const size_t worthwhileChunks = std::max(textLength / MIN_BYTES_PER_OBJ_PARSE_CHUNK, static_cast<size_t>(1u));
+        return static_cast<unsigned int>(std::min(static_cast<size_t>(hardwareThreads), worthwhileChunks));
+    }
+
+
+    size_t tokenizeObjInParallel(const AsciiAsset& file, ObjParseResult& result, unsigned int threadCount) {
+        const std::string filepath = file.getFilepath();
+        const std::string_view text = file.getTextView();
+        const int lineCount = file.getNumberOfLines();
+
+        //Never split into more chunks than there are lines or than is worthwhile for the text's size
+        size_t chunkCount = std::min(static_cast<size_t>(std::max(threadCount, 1u)),
+                                     std::max(text.length() / MIN_BYTES_PER_OBJ_PARSE_CHUNK, static_cast<size_t>(1u)));
+        chunkCount = std::min(chunkCount, static_cast<size_t>(std::max(lineCount, 1)));
+
+        if (chunkCount <= 1u) {
+            ObjTokenizer tokenizer(filepath);
+            return tokenizer.tokenize(text, result);
+        }
+
+        //Each chunk begins at the start of a line, so every chunk is newline-terminated
+        std::vector<size_t> chunkFirstLines(chunkCount);
+        std::vector<std::string_view> chunkTexts(chunkCount);
+        for (size_t i = 0u; i < chunkCount; i++) {
+            chunkFirstLines[i] = (i * static_cast<size_t>(lineCount)) / chunkCount;
+        }
+        for (size_t i = 0u; i < chunkCount; i++) {
+            const size_t begin = static_cast<size_t>(file.getLineView(static_cast<int>(chunkFirstLines[i])).data() - text.data());
+            const size_t end = ((i + 1u) < chunkCount) ?
+                static_cast<size_t>(file.getLineView(static_cast<int>(chunkFirstLines[i + 1u])).data() - text.data()) :
+                text.length();
+            chunkTexts[i] = text.substr(begin, end - begin);
+        }
+
+        std::vector<ObjParseResult> chunkResults(chunkCount);
+        auto tokenizeChunk = [&filepath, &chunkTexts, &chunkResults, &chunkFirstLines](size_t chunk) -> size_t {
+            ObjTokenizer tokenizer(filepath, true);
+            return tokenizer.tokenize(chunkTexts[chunk], chunkResults[chunk], chunkFirstLines[chunk] + 1u);
+        };
+
+        std::vector<std::future<size_t>> chunkTasks;
+        chunkTasks.reserve(chunkCount - 1u);
+        for (size_t i = 1u; i < chunkCount; i++)
+            chunkTasks.push_back(forceBeginAsyncTask(tokenizeChunk, i));
+
+        size_t linesWithErrors = tokenizeChunk(0u);
+        for (auto& task : chunkTasks)
+            linesWithErrors += task.get();
+
+        //Stitch the chunks back together in file order
+        size_t positionCount = 0u, texCoordCount = 0u, normalCount = 0u, faceCount = 0u, lineEndpointCount = 0u;
+        size_t nGonCount = 0u, nGonCornerCount = 0u;
+        for (const ObjParseResult& chunk : chunkResults) {
+            positionCount += chunk.positions.size();
+            texCoordCount += chunk.texCoords.size();
+            normalCount += chunk.normals.size();
+            faceCount += chunk.faces.size();
+            lineEndpointCount += chunk.lineEndpoints.size();
+            nGonCount += chunk.nGons.size();
+            nGonCornerCount += chunk.nGonCorners.size();
+        }
+        result.positions.reserve(result.positions.size() + positionCount);
+        result.texCoords.reserve(result.texCoords.size() + texCoordCount);
+        result.normals.reserve(result.normals.size() + normalCount);
+        result.faces.reserve(result.faces.size() + faceCount);
+        result.lineEndpoints.reserve(result.lineEndpoints.size() + lineEndpointCount);
+        result.nGons.reserve(result.nGons.size() + nGonCount);
+        result.nGonCorners.reserve(result.nGonCorners.size() + nGonCornerCount);
+
+        size_t invalidRelativeIndices = 0u;
+        for (ObjParseResult& chunk : chunkResults) {
+            invalidRelativeIndices += applyPendingRelativeIndices(chunk, result);
+            offsetNGonReferences(chunk, result);
+            appendSubMeshTags(chunk, result);
+            result.positions.append(chunk.positions);
+            result.texCoords.append(chunk.texCoords);
+            result.normals.append(chunk.normals);
+            result.faces.append(chunk.faces);
+            appendVector(result.lineEndpoints, chunk.lineEndpoints);
+            appendVector(result.nGons, chunk.nGons);
+            appendVector(result.nGonCorners, chunk.nGonCorners);
+            result.hasTexCoords = (result.hasTexCoords || chunk.hasTexCoords);
+            result.hasNormals = (result.hasNormals || chunk.hasNormals);
+        }
+
+        if (invalidRelativeIndices > 0u) {
+            fprintf(ERRLOG, "\nERROR! %zu relative indices in file \"%s\" refer to vertices before the start of the file!\n",
+                invalidRelativeIndices, filepath.c_str());
+            linesWithErrors += invalidRelativeIndices;
+        }
+        return linesWithErrors;
+    }
+
+} //namespace AssetLoadingInternal
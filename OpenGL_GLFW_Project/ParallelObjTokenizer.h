@@ -0,0 +1,50 @@
+// File:           ParallelObjTokenizer.h
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Runs the ObjTokenizer over an '.obj' file using multiple threads. The file's
+//                 text is split into newline-aligned chunks (the chunk boundaries come straight
+//                 from the AsciiAsset's table of line locations, so no extra scan is needed), and
+//                 each chunk is tokenized on its own thread into its own local ObjParseResult.
+//
+//                 Once every chunk is finished, the chunks are stitched back together in file
+//                 order. Positive indices in an '.obj' file are absolute so they need no changes,
+//                 but a negative (relative) index inside of a chunk can only be resolved relative
+//                 to the start of that chunk. These are recorded by the tokenizer as pending and are
+//                 fixed up during stitching by adding the running prefix sum of the number of
+//                 positions/texCoords/normals from all of the chunks that came before.
+//
+//                 The stitched result is identical to what a single ObjTokenizer would produce
+//                 for the whole file, so the vertex data QuickObj builds from it is byte-identical
+//                 to the serial path.
+//
+// Threading:      Chunk tasks are launched with 'forceBeginAsyncTask()'. The calling thread
+//                 blocks until every chunk has been parsed.
+
+#pragma once
+
+#ifndef PARALLEL_OBJ_TOKENIZER_H_
+#define PARALLEL_OBJ_TOKENIZER_H_
+
+#include "ObjTokenizer.h"
+#include "AsciiAsset.h"
+
+namespace AssetLoadingInternal {
+
+    //Chunks smaller than this aren't worth the cost of launching a thread for
+    static constexpr const size_t MIN_BYTES_PER_OBJ_PARSE_CHUNK = 512u * 1024u;
+
+    //Returns how many threads to use when parsing text of the given length. Small files always
+    //get 1 thread, larger files get up to one thread per hardware thread.
+    unsigned int chooseObjParseThreadCount(size_t textLength) noexcept;
+
+    //Tokenizes the entire text of 'file' using up to 'threadCount' threads, appending everything
+    //parsed onto the end of 'result' (which is expected to start out empty). A 'threadCount' of 1
+    //(or a file too small to be split) simply tokenizes on the calling thread. Returns the number
+    //of lines which could not be parsed.
+    size_t tokenizeObjInParallel(const AsciiAsset& file, ObjParseResult& result, unsigned int threadCount);
+
+} //namespace AssetLoadingInternal
+
+#endif //PARALLEL_OBJ_TOKENIZER_H_
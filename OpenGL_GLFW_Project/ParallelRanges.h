@@ -0,0 +1,58 @@
+// File:           ParallelRanges.h
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Small helpers shared by the mesh processing steps that split their work up across
+//                 threads (see VertexNormalGenerator.h and TangentGenerator.h). Each step picks its thread
+//                 count the same way, from its own minimum items per thread. The items are split into
+//                 contiguous ranges of as close to the same size as possible, one range per thread. Which
+//                 items land in which range only depends on the item count and the range count, so a
+//                 step can keep per-range results and combine them in range order afterwards.
+
+#pragma once
+
+#ifndef PARALLEL_RANGES_H_
+#define PARALLEL_RANGES_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "ForceBeginAsyncTask.h"
+
+namespace AssetLoadingInternal {
+
+    //Returns how many threads are worth using on 'itemCount' items, which is as many as the hardware has but
+    //never so many that a thread gets fewer than 'minItemsPerThread' items (and always at least 1). Each step
+    //passes its own minimum, since how much work one item is differs from step to step.
+    inline unsigned int chooseParallelThreadCount(size_t itemCount, size_t minItemsPerThread) noexcept {
+        const unsigned int hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        const size_t worthwhileThreads = std::max(itemCount / std::max(minItemsPerThread, static_cast<size_t>(1u)), static_cast<size_t>(1u));
+        return static_cast<unsigned int>(std::min(static_cast<size_t>(hardwareThreads), worthwhileThreads));
+    }
+
+    //Returns how many ranges to split 'count' items into when 'threadCount' threads are available
+    //(never more ranges than there are items, and always at least 1)
+    inline size_t countParallelRanges(unsigned int threadCount, size_t count) noexcept {
+        return std::max(std::min(static_cast<size_t>(threadCount), count), static_cast<size_t>(1u));
+    }
+
+    //Runs 'task(range, begin, end)' for each of the 'rangeCount' ranges of 'count' items. The first range is
+    //done on the calling thread while the others run, and this only returns once every range is done.
+    template<typename Task>
+    void runInParallelRanges(size_t rangeCount, size_t count, const Task& task) {
+        std::vector<std::future<void>> rangeTasks;
+        rangeTasks.reserve(rangeCount - 1u);
+        for (size_t i = 1u; i < rangeCount; i++)
+            rangeTasks.push_back(forceBeginAsyncTask(task, i, ((count * i) / rangeCount), ((count * (i + 1u)) / rangeCount)));
+        task(static_cast<size_t>(0u), static_cast<size_t>(0u), (count / rangeCount));
+        for (auto& rangeTask : rangeTasks)
+            rangeTask.get();
+    }
+
+} //namespace AssetLoadingInternal
+
+#endif //PARALLEL_RANGES_H_
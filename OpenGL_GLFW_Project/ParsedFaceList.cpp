@@ -0,0 +1,170 @@
+// File:           ParsedFaceList.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   An unallocated texCoord or normal stream reads as all 0s, which is exactly what
+//                          faces without that component store anyway. So whenever a stream has to come into
+//                          existence (a face using it is added, or a list that has it is appended) it is
+//                          first filled with 0s for all of the faces already in the list.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "ParsedFaceList.h"
+
+#include <algorithm>
+
+namespace AssetLoadingInternal {
+
+    namespace {
+
+        static constexpr const std::array<FaceIndex, QUAD_VERTICE_COUNT> NO_INDICES = { 0u, 0u, 0u, 0u };
+
+        //Brings a stream into existence, covering every face already in the list with 0s
+        inline void allocateStream(std::vector<FaceIndex>& stream, const std::vector<FaceIndex>& positions) {
+            stream.reserve(positions.capacity());
+            stream.resize(positions.size(), 0u);
+        }
+
+        //Appends 'source' (which covers 'sourceSlots' slots, and which may be unallocated) onto 'destination'
+        //(which covers 'destinationSlots' slots, and which may also be unallocated)
+        inline void appendStream(std::vector<FaceIndex>& destination, size_t destinationSlots,
+                                 const std::vector<FaceIndex>& source, size_t sourceSlots) {
+            if (source.empty()) {
+                if (!destination.empty())
+                    destination.resize(destinationSlots + sourceSlots, 0u);
+                return;
+            }
+            if (destination.empty()) {
+                destination.reserve(destinationSlots + sourceSlots);
+                destination.resize(destinationSlots, 0u);
+            }
+            destination.insert(destination.end(), source.cbegin(), source.cend());
+        }
+
+        //Compares 2 streams covering the same number of slots, with an unallocated stream counting as all 0s
+        inline bool streamsAreEqual(const std::vector<FaceIndex>& a, const std::vector<FaceIndex>& b) noexcept {
+            if (a.empty() || b.empty()) {
+                const std::vector<FaceIndex>& allocated = (a.empty() ? b : a);
+                return std::all_of(allocated.cbegin(), allocated.cend(), [](FaceIndex index) { return (index == 0u); });
+            }
+            return (a == b);
+        }
+
+    } //namespace
+
+
+    void ParsedFaceList::reserve(size_t faceCount) {
+        mPositions_.reserve(faceCount * QUAD_VERTICE_COUNT);
+        if (!mTexCoords_.empty())
+            mTexCoords_.reserve(faceCount * QUAD_VERTICE_COUNT);
+        if (!mNormals_.empty())
+            mNormals_.reserve(faceCount * QUAD_VERTICE_COUNT);
+        mVertexCounts_.reserve(faceCount);
+        mComponents_.reserve(faceCount);
+    }
+
+
+    void ParsedFaceList::clear() noexcept {
+        mPositions_.clear();
+        mTexCoords_.clear();
+        mNormals_.clear();
+        mVertexCounts_.clear();
+        mComponents_.clear();
+    }
+
+
+    void ParsedFaceList::shrink_to_fit() {
+        mPositions_.shrink_to_fit();
+        mTexCoords_.shrink_to_fit();
+        mNormals_.shrink_to_fit();
+        mVertexCounts_.shrink_to_fit();
+        mComponents_.shrink_to_fit();
+    }
+
+
+    void ParsedFaceList::swap(ParsedFaceList& other) noexcept {
+        mPositions_.swap(other.mPositions_);
+        mTexCoords_.swap(other.mTexCoords_);
+        mNormals_.swap(other.mNormals_);
+        mVertexCounts_.swap(other.mVertexCounts_);
+        mComponents_.swap(other.mComponents_);
+    }
+
+
+    void ParsedFaceList::push_back(const ParsedFace& face) {
+        //(an empty stream is also what an allocated stream looks like while the list is empty, which is why
+        //whether to write into each stream is decided up front)
+        const bool storeTexCoords = (face.hasTexCoords || (!mTexCoords_.empty()));
+        const bool storeNormals = (face.hasNormals || (!mNormals_.empty()));
+        if (face.hasTexCoords && mTexCoords_.empty())
+            allocateStream(mTexCoords_, mPositions_);
+        if (face.hasNormals && mNormals_.empty())
+            allocateStream(mNormals_, mPositions_);
+
+        if (face.isNGon()) {
+            mPositions_.insert(mPositions_.end(), { face.nGonIndex, 0u, 0u, 0u });
+            if (storeTexCoords)
+                mTexCoords_.insert(mTexCoords_.end(), NO_INDICES.cbegin(), NO_INDICES.cend());
+            if (storeNormals)
+                mNormals_.insert(mNormals_.end(), NO_INDICES.cbegin(), NO_INDICES.cend());
+        }
+        else {
+            mPositions_.insert(mPositions_.end(), face.positions.cbegin(), face.positions.cend());
+            if (storeTexCoords) {
+                const std::array<FaceIndex, QUAD_VERTICE_COUNT>& texCoords = (face.hasTexCoords ? face.texCoords : NO_INDICES);
+                mTexCoords_.insert(mTexCoords_.end(), texCoords.cbegin(), texCoords.cend());
+            }
+            if (storeNormals) {
+                const std::array<FaceIndex, QUAD_VERTICE_COUNT>& normals = (face.hasNormals ? face.normals : NO_INDICES);
+                mNormals_.insert(mNormals_.end(), normals.cbegin(), normals.cend());
+            }
+        }
+        mVertexCounts_.push_back(face.vertexCount);
+        mComponents_.push_back(static_cast<uint8_t>((face.hasTexCoords ? HAS_TEX_COORDS : 0u) | (face.hasNormals ? HAS_NORMALS : 0u)));
+    }
+
+
+    void ParsedFaceList::append(const ParsedFaceList& other) {
+        appendStream(mTexCoords_, mPositions_.size(), other.mTexCoords_, other.mPositions_.size());
+        appendStream(mNormals_, mPositions_.size(), other.mNormals_, other.mPositions_.size());
+        mPositions_.insert(mPositions_.end(), other.mPositions_.cbegin(), other.mPositions_.cend());
+        mVertexCounts_.insert(mVertexCounts_.end(), other.mVertexCounts_.cbegin(), other.mVertexCounts_.cend());
+        mComponents_.insert(mComponents_.end(), other.mComponents_.cbegin(), other.mComponents_.cend());
+    }
+
+
+    ParsedFace ParsedFaceList::operator[](size_t faceIndex) const noexcept {
+        const size_t firstSlot = faceIndex * QUAD_VERTICE_COUNT;
+        ParsedFace face;
+        face.vertexCount = mVertexCounts_[faceIndex];
+        face.hasTexCoords = hasTexCoords(faceIndex);
+        face.hasNormals = hasNormals(faceIndex);
+        if (face.isNGon()) {
+            face.nGonIndex = mPositions_[firstSlot];
+            face.positions = face.texCoords = face.normals = NO_INDICES;
+            return face;
+        }
+        face.nGonIndex = 0u;
+        std::copy_n(mPositions_.data() + firstSlot, QUAD_VERTICE_COUNT, face.positions.data());
+        if (mTexCoords_.empty())
+            face.texCoords = NO_INDICES;
+        else
+            std::copy_n(mTexCoords_.data() + firstSlot, QUAD_VERTICE_COUNT, face.texCoords.data());
+        if (mNormals_.empty())
+            face.normals = NO_INDICES;
+        else
+            std::copy_n(mNormals_.data() + firstSlot, QUAD_VERTICE_COUNT, face.normals.data());
+        return face;
+    }
+
+
+    bool ParsedFaceList::operator==(const ParsedFaceList& other) const noexcept {
+        return ((mVertexCounts_ == other.mVertexCounts_) &&
+                (mComponents_ == other.mComponents_) &&
+                (mPositions_ == other.mPositions_) &&
+                streamsAreEqual(mTexCoords_, other.mTexCoords_) &&
+                streamsAreEqual(mNormals_, other.mNormals_));
+    }
+
+} //namespace AssetLoadingInternal
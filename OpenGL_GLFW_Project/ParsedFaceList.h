@@ -0,0 +1,152 @@
+// File:           ParsedFaceList.h
+// Class:          ParsedFaceList
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Compact storage for every face the ObjTokenizer parses out of a file. The faces used
+//                 to be held in a 'std::vector<ParsedFace>', which costs 104 bytes a face on x64 (every
+//                 index was a size_t, and every face carries room for 4 corners of all 3 components
+//                 whether it uses them or not). For the multi-million face meshes that was the single
+//                 largest piece of memory held between parsing a file and assembling its vertices.
+//
+//                 The faces are instead stored as a structure of arrays:
+//                      -A position, a texCoord and a normal stream of 32-bit indices, with 4 slots
+//                       per face in each stream [a triangle leaves its 4th slots as 0]
+//                      -A vertex count byte and a components byte per face
+//                 The texCoord and normal streams are only ever allocated once a face actually uses
+//                 them, so the common files that have only positions (or positions and normals) don't
+//                 pay for them at all. This comes to between 18 and 50 bytes a face.
+//
+//                 An n-gon's corners are stored in the parse result's n-gon arena ('nGonCorners' in
+//                 ObjParseResult), so the n-gon's first slot in the position stream holds its n-gon
+//                 index instead. The rest of its slots are unused.
+//
+//                 Faces are read back one at a time as (unpacked) ParsedFace values, or straight out of
+//                 the streams through the per-face accessors. The setters only exist for the fix-ups
+//                 which are applied after parsing (see ParallelObjTokenizer).
+//
+// Index Limits:   Indices are stored as 32 bits, which covers over 4 billion of each kind of vertex. An
+//                 '.obj' file would have to be well over 100 GB to reach that, so the tokenizer simply
+//                 treats any index beyond MAX_FACE_INDEX as malformed.
+
+#pragma once
+
+#ifndef PARSED_FACE_LIST_H_
+#define PARSED_FACE_LIST_H_
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include "Face.h"    //For the face vertex count constants
+
+namespace AssetLoadingInternal {
+
+    //The type of every index stored for a face or an n-gon corner
+    using FaceIndex = uint32_t;
+
+    //Never a valid index. Used to mark indices which turned out to be out of range, which guarantees
+    //the face is skipped when the vertices get assembled.
+    static constexpr const FaceIndex INVALID_FACE_INDEX = std::numeric_limits<FaceIndex>::max();
+    static constexpr const FaceIndex MAX_FACE_INDEX = INVALID_FACE_INDEX - 1u;
+
+    //The 'vertexCount' given to a face which has more than 4 vertices
+    static constexpr const uint8_t NGON_VERTEX_COUNT = 0xFFu;
+
+    //Plain-data description of one parsed face. Indices have already been converted to begin at 0.
+    //Components which the face did not specify are left as 0 and flagged through 'hasTexCoords' and
+    //'hasNormals'. An n-gon keeps its place in the list of faces (so that file order is kept), but its
+    //corners are stored in the parse result's n-gon arrays, with 'nGonIndex' saying which n-gon it is.
+    typedef struct ParsedFace {
+        std::array<FaceIndex, QUAD_VERTICE_COUNT> positions;
+        std::array<FaceIndex, QUAD_VERTICE_COUNT> texCoords;
+        std::array<FaceIndex, QUAD_VERTICE_COUNT> normals;
+        uint32_t nGonIndex;
+        uint8_t vertexCount;
+        bool hasTexCoords;
+        bool hasNormals;
+        bool isQuad() const noexcept { return (vertexCount == QUAD_VERTICE_COUNT); }
+        bool isNGon() const noexcept { return (vertexCount == NGON_VERTEX_COUNT); }
+    } ParsedFace;
+
+
+    class ParsedFaceList final {
+    public:
+        //Iterates over the faces in order, unpacking each one as it goes
+        class const_iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = ParsedFace;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const ParsedFace *;
+            using reference = ParsedFace;
+
+            const_iterator(const ParsedFaceList * list, size_t faceIndex) noexcept : mList_(list), mFaceIndex_(faceIndex) { ; }
+            ParsedFace operator*() const noexcept { return (*mList_)[mFaceIndex_]; }
+            const_iterator& operator++() noexcept { mFaceIndex_++; return *this; }
+            const_iterator operator++(int) noexcept { const_iterator previous = *this; mFaceIndex_++; return previous; }
+            bool operator==(const const_iterator& other) const noexcept { return (mFaceIndex_ == other.mFaceIndex_); }
+            bool operator!=(const const_iterator& other) const noexcept { return (mFaceIndex_ != other.mFaceIndex_); }
+        private:
+            const ParsedFaceList * mList_;
+            size_t mFaceIndex_;
+        };
+
+        ParsedFaceList() = default;
+        ~ParsedFaceList() = default;
+        ParsedFaceList(const ParsedFaceList&) = default;
+        ParsedFaceList(ParsedFaceList&&) = default;
+        ParsedFaceList& operator=(const ParsedFaceList&) = default;
+        ParsedFaceList& operator=(ParsedFaceList&&) = default;
+
+        size_t size() const noexcept { return mVertexCounts_.size(); }
+        bool empty() const noexcept { return mVertexCounts_.empty(); }
+        void reserve(size_t faceCount);
+        void clear() noexcept;
+        void shrink_to_fit();
+        void swap(ParsedFaceList& other) noexcept;
+
+        void push_back(const ParsedFace& face);
+        //Appends every face of 'other' onto the end of this list
+        void append(const ParsedFaceList& other);
+
+        //Unpacks a single face
+        ParsedFace operator[](size_t faceIndex) const noexcept;
+        const_iterator begin() const noexcept { return const_iterator(this, 0u); }
+        const_iterator end() const noexcept { return const_iterator(this, size()); }
+
+        //Per-face accessors which read straight out of the streams
+        uint8_t vertexCount(size_t faceIndex) const noexcept { return mVertexCounts_[faceIndex]; }
+        bool isQuad(size_t faceIndex) const noexcept { return (mVertexCounts_[faceIndex] == QUAD_VERTICE_COUNT); }
+        bool isNGon(size_t faceIndex) const noexcept { return (mVertexCounts_[faceIndex] == NGON_VERTEX_COUNT); }
+        bool hasTexCoords(size_t faceIndex) const noexcept { return ((mComponents_[faceIndex] & HAS_TEX_COORDS) != 0u); }
+        bool hasNormals(size_t faceIndex) const noexcept { return ((mComponents_[faceIndex] & HAS_NORMALS) != 0u); }
+        uint32_t nGonIndex(size_t faceIndex) const noexcept { return mPositions_[faceIndex * QUAD_VERTICE_COUNT]; }
+
+        //Only valid for corners of faces which have that component (and for the 4 corners of faces that aren't n-gons)
+        void setPosition(size_t faceIndex, int corner, FaceIndex index) noexcept { mPositions_[(faceIndex * QUAD_VERTICE_COUNT) + corner] = index; }
+        void setTexCoord(size_t faceIndex, int corner, FaceIndex index) noexcept { mTexCoords_[(faceIndex * QUAD_VERTICE_COUNT) + corner] = index; }
+        void setNormal(size_t faceIndex, int corner, FaceIndex index) noexcept { mNormals_[(faceIndex * QUAD_VERTICE_COUNT) + corner] = index; }
+        void setNGonIndex(size_t faceIndex, uint32_t nGonIndex) noexcept { mPositions_[faceIndex * QUAD_VERTICE_COUNT] = nGonIndex; }
+
+        //Faces are equal if every face unpacks to the same values, regardless of which streams are allocated
+        bool operator==(const ParsedFaceList& other) const noexcept;
+        bool operator!=(const ParsedFaceList& other) const noexcept { return !(*this == other); }
+
+    private:
+        static constexpr const uint8_t HAS_TEX_COORDS = 0x01u;
+        static constexpr const uint8_t HAS_NORMALS = 0x02u;
+
+        std::vector<FaceIndex> mPositions_;
+        std::vector<FaceIndex> mTexCoords_;  //Left empty until the first face with texCoords is added
+        std::vector<FaceIndex> mNormals_;    //Left empty until the first face with normals is added
+        std::vector<uint8_t> mVertexCounts_;
+        std::vector<uint8_t> mComponents_;
+    };
+
+} //namespace AssetLoadingInternal
+
+#endif //PARSED_FACE_LIST_H_
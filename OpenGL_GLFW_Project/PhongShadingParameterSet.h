@@ -51,6 +51,12 @@ public:
 		return 
 	}*/
 
+	const std::array<float, 3>& getAmbient() const { return kA; }
+	const std::array<float, 3>& getDiffuse() const { return kD; }
+	const std::array<float, 3>& getSpecular() const { return kS; }
+	float getShiny() const { return shiny; }
+	float getOpacity() const { return opacity; }
+
 private:
 	std::array<float, 3> kA;
 	std::array<float, 3> kD;
@@ -0,0 +1,60 @@
+// File:           PositionKey.h
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    The one definition of "the same position" used to find every vertex sitting at exactly
+//                 the same spot, which is how the normal generator, the tangent generator, the mesh
+//                 simplifier, the triangle outlines and the meshlet builder tell which triangles are
+//                 connected to each other across vertices that were split apart.
+//
+//                 Positions are compared by the bits of their 3 components, with -0.0 counted as 0.0.
+//                 Positions which are only within some tolerance of each other are never the same
+//                 position here, welding those together is VertexWelder.h's job.
+
+#pragma once
+
+#ifndef POSITION_KEY_H_
+#define POSITION_KEY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>   //memcpy
+
+namespace AssetLoadingInternal {
+
+    //Returns the bits a component of a position is compared by
+    inline uint32_t positionBits(float value) noexcept {
+        uint32_t bits = 0u;
+        memcpy(&bits, &value, sizeof(bits));
+        return ((bits == 0x80000000u) ? 0u : bits); //-0.0 and 0.0 are the same position
+    }
+
+    typedef struct PositionKey {
+        uint32_t x, y, z;
+        bool operator==(const PositionKey& other) const noexcept {
+            return ((x == other.x) && (y == other.y) && (z == other.z));
+        }
+    } PositionKey;
+
+    //Makes the key of the position in the first 3 floats of 'position'
+    inline PositionKey makePositionKey(const float * position) noexcept {
+        return { positionBits(position[0]), positionBits(position[1]), positionBits(position[2]) };
+    }
+
+    struct PositionKeyHash {
+        size_t operator()(const PositionKey& key) const noexcept {
+            return static_cast<size_t>(hash(key));
+        }
+        //The full 64-bit hash, which keys holding a position plus something more can mix their other values into
+        static uint64_t hash(const PositionKey& key) noexcept {
+            uint64_t hash = (static_cast<uint64_t>(key.x) * 0x9E3779B97F4A7C15ull);
+            hash ^= (static_cast<uint64_t>(key.y) + 0x7F4A7C159E3779B9ull + (hash << 6) + (hash >> 2));
+            hash ^= (static_cast<uint64_t>(key.z) + 0x94D049BB133111EBull + (hash << 6) + (hash >> 2));
+            return hash;
+        }
+    };
+
+} //namespace AssetLoadingInternal
+
+#endif //POSITION_KEY_H_
@@ -2,15 +2,16 @@
 //
 //  See Header file for more details
 //
-//  Known Issues:      Currently a face must be either 3 or 4 vertices. Any more than this 
-//                     will not parse correctly. I have tried to implement a work-around class
-//                     for n-gons, but I have been unable to complete this class due to needing
-//                     to pay my rent rather than writing the code to fix the issue. 
+//  Known Issues:      [Resolved October 2026] Faces used to have to be either 3 or 4 vertices.
+//                     Faces with more vertices than this (n-gons) are now split into triangles
+//                     after parsing, see NGonTriangulator.h.
 //                   
 //                    In a file with multiple objects, it is possible for some to have texture coordinates/normals
 //                     and others to not. The way this class is currently implemented did not account for this possibility,
 //                     and at this point there does not seem to me to be an easy way to remedy this.
 //
+//                    [Partially resolved October 2026, the parsed faces are now stored as 32-bit indices (see
+//                     ParsedFaceList.h)]
 //                    [Adding this one after having been using this class within my codebase for some time now]
 //                     WAY TOO MUCH OVER-RELIANCE ON THE SIZE_T TYPE FOR INTEGERS. This code has very different 
 //                     compiled results between x86 and x64. Ideally all appearances of size_t should be changed
@@ -23,32 +24,41 @@
 
 #include "QuickObj.h"
 
-#include "QuickObj_NGonParser.h"
+#include "ConformantObj.h"
+#include "FilepathWrapper.h"
+#include "MeshOptimizer.h"
+#include "NGonTriangulator.h"
+#include "ParallelObjTokenizer.h"
+#include "TangentGenerator.h"
+#include "VertexDeduplicationTable.h"
+#include "VertexNormalGenerator.h"
+#include "VertexWelder.h"
+
+#include <algorithm> //std::copy_n
+#include <cstring>   //memcpy
+#include <filesystem>
+#include <iterator>  //std::size
+#include <memory>
+#include <unordered_map>
 
 namespace { //An anonymous namespace is used to prevent these constants from polluting the global namespace
-    static constexpr const size_t POSITION_INDEX = 0u;
-    static constexpr const size_t TEXTURE_COORD_INDEX = 1u;
-    static constexpr const size_t NORMAL_INDEX = 2u;
-
     static constexpr const size_t POSITION_COMPONENTS = 4u;
     static constexpr const size_t TEXTURE_COORDINATE_COMPONENTS = 2u;
     static constexpr const size_t NORMAL_COMPONENTS = 3u;
+    static constexpr const size_t PACKED_TANGENT_COMPONENTS = 1u; //See 'packTangent()' in TangentGenerator.h
 
     static constexpr const size_t POSITION_VERTEX_SIZE = POSITION_COMPONENTS;
     static constexpr const size_t POSITION_TEXCOORD_VERTEX_SIZE = POSITION_COMPONENTS + TEXTURE_COORDINATE_COMPONENTS;
     static constexpr const size_t POSITION_NORMAL_VERTEX_SIZE = POSITION_COMPONENTS + NORMAL_COMPONENTS;
     static constexpr const size_t POSITION_TEXCOORD_NORMAL_VERTEX_SIZE = POSITION_COMPONENTS + TEXTURE_COORDINATE_COMPONENTS + NORMAL_COMPONENTS;
+    static constexpr const size_t POSITION_TEXCOORD_NORMAL_TANGENT_VERTEX_SIZE = POSITION_TEXCOORD_NORMAL_VERTEX_SIZE + PACKED_TANGENT_COMPONENTS;
 
     static constexpr const size_t VERTICES_IN_A_TRIANGLE = 3u; 
     static constexpr const size_t TRIANGLES_IN_A_QUAD = 2u;
+    //[Faces are split into triangles in the order given by QUAD_TRIANGULATION_CORNERS and TRIANGLE_CORNERS, see ObjTokenizer.h]
 
-    //It turns out that the triangles within a Quad have a 0-1-3-2 ordering to them. Thus the following 
-    //constants are defined to attempt to avert additional confusion within the already-pretty-hairy 
-    //parsing logic
-    static constexpr const size_t QUAD_CORNER_0_OFFSETS = 0u;
-    static constexpr const size_t QUAD_CORNER_1_OFFSETS = 1u;
-    static constexpr const size_t QUAD_CORNER_3_OFFSETS = 3u; //Is 3u to accommodate triangle winding order 
-    static constexpr const size_t QUAD_CORNER_2_OFFSETS = 2u; //Is 2u to accommodate triangle winding order
+    //Indices can be stored as 16-bit values as long as there are no more than this many vertices
+    static constexpr const size_t MAX_VERTICES_FOR_16_BIT_INDICES = 65536u;
 }
 
 
@@ -58,12 +68,17 @@ QuickObj::QuickObj(std::string filepath, float scale, bool generateMissingCompon
     mScale_ = scale;
     mHasTexCoords_ = false;
     mHasNormals_ = false;
-    //Load the file as an AsciiAsset object
-    mFile_ = std::make_unique<AssetLoadingInternal::AsciiAsset>(filepath);
+    mHasTangents_ = false;
+    mIsIndexed_ = false;
+    mLoadedFromCache_ = false;
+    mParsedFromConformantFile_ = false;
+
+    //Load the file as an AsciiAsset object (memory-mapped, so lines are parsed without being copied)
+    mFile_ = std::make_unique<AssetLoadingInternal::AsciiAsset>(filepath, true, true);
 
     if (mFile_->getStoredTextLength() > 1u) { //Was 0u
         //preparseFile(); //This is unnecessary 
-        parseFile();
+        parseFile(AUTOMATIC_PARSE_THREAD_COUNT, OutputFormat::EXPANDED, generateMissingComponents, false, NO_POSITION_WELDING);
     }
     else {
         fprintf(ERRLOG, "\nERROR acquiring file: %s!\n", filepath.c_str());
@@ -73,11 +88,11 @@ QuickObj::QuickObj(std::string filepath, float scale, bool generateMissingCompon
 
     if (generateMissingComponents) {
         if (mVertices_.size() > 0u) { //Only generate components if some data has been loaded
-            addMissingComponents(true, 0.0f, 1.0f);
+            addMissingComponents(true, 0.0f, 1.0f, AUTOMATIC_PARSE_THREAD_COUNT);
         }
     }
 
-    if (mLines_.size() > 0u)
+    if (mParsedData_.lineEndpoints.size() > 0u)
         addParsedLinePrimitivesToEndOfMeshData();
 
     mVertices_.shrink_to_fit();
@@ -87,32 +102,77 @@ QuickObj::QuickObj(std::string filepath, float scale, bool generateMissingCompon
 //The current implementation here is not the most efficient, since essentially it follows the exact same steps as 
 //the non-texCoord-Normal-generating constructor before filling in the missing data. A better implementation would
 //fill in the missing data as it goes.
-QuickObj::QuickObj(const std::string filepath, float scale, bool generateMissingComponents, bool randomizeTextureCoords, float s, float t) {
+QuickObj::QuickObj(const std::string filepath, float scale, bool generateMissingComponents, bool randomizeTextureCoords, float s, float t,
+                   unsigned int parseThreadCount, OutputFormat outputFormat, bool useMeshCache,
+                   MeshOptimization meshOptimization, bool generateTangents, float positionWeldTolerance) {
     mError_ = false;
     mScale_ = scale;
     mHasTexCoords_ = false;
     mHasNormals_ = false;
-    mFile_ = std::make_unique<AssetLoadingInternal::AsciiAsset>(filepath);
+    mHasTangents_ = false;
+    mIsIndexed_ = false;
+    mLoadedFromCache_ = false;
+    mParsedFromConformantFile_ = false;
+
+    const bool indexed = (outputFormat == OutputFormat::INDEXED);
+    const AssetLoadingInternal::MeshCacheLoadOptions cacheOptions = { scale, generateMissingComponents, randomizeTextureCoords, s, t, indexed,
+        (indexed && (meshOptimization != MeshOptimization::NONE)), (indexed && (meshOptimization == MeshOptimization::VERTEX_CACHE_AND_OVERDRAW)),
+        generateTangents, ((positionWeldTolerance > 0.0f) ? positionWeldTolerance : NO_POSITION_WELDING) };
+    if (useMeshCache && loadFromMeshCache(filepath, cacheOptions))
+        return;
+
+    //The file is memory-mapped so that each line can be parsed straight out of the mapped pages
+    mFile_ = std::make_unique<AssetLoadingInternal::AsciiAsset>(filepath, true, true);
 
     if (mFile_->getStoredTextLength() > 0u) {
         //preparseFile(); //This is unnecessary 
-        parseFile();
+        parseFile(parseThreadCount, outputFormat, generateMissingComponents, generateTangents, positionWeldTolerance);
     }
     else {
         fprintf(ERRLOG, "\nERROR acquiring the file: \"%s\"\n", filepath.c_str());
         mError_ = true;
         return;
     }
-    if (generateMissingComponents) {
+    //Random texture coordinates are never cached, otherwise every later load would replay the first load's coordinates
+    const bool generatesRandomTexCoords = (generateMissingComponents && randomizeTextureCoords && (!mHasTexCoords_));
+    if ((generateMissingComponents) && (!mIsIndexed_)) {
         if (mVertices_.size() > 0u) { //Only generate components if some data has been loaded
-            addMissingComponents(randomizeTextureCoords, s, t);
+            addMissingComponents(randomizeTextureCoords, s, t, parseThreadCount);
         }
     }
+    if (generateTangents && (!mError_) && (!mIsIndexed_) && (mVertices_.size() > 0u))
+        addTangents(parseThreadCount);
     
-    if (mLines_.size() > 0u)
+    //Every vertex (or index) up to this point belongs to a face, any line primitives get added after them
+    const size_t faceIndexCount = (mIsIndexed_ ? mIndices32_.size() : (mVertices_.size() / getVertexSize()));
+    if (mParsedData_.lineEndpoints.size() > 0u)
         addParsedLinePrimitivesToEndOfMeshData();
 
+    if ((outputFormat == OutputFormat::INDEXED) && (mVertices_.size() > 0u)) {
+        if (!mIsIndexed_) 
+            convertExpandedVerticesToIndexed();
+        if (mIsIndexed_ && (meshOptimization != MeshOptimization::NONE))
+            optimizeIndexedMesh(faceIndexCount, meshOptimization);
+        narrowIndicesIfPossible();
+        if (mIsIndexed_) {
+            const size_t indexSize = (uses16BitIndices() ? sizeof(uint16_t) : sizeof(uint32_t));
+            const size_t expandedBytes = getIndexCount() * getVertexSize() * sizeof(float);
+            const size_t indexedBytes = (mVertices_.size() * sizeof(float)) + (getIndexCount() * indexSize);
+            fprintf(MSGLOG, "Indexed mesh uses %zu bytes (%zu-bit indices) compared to %zu bytes as expanded vertices\n",
+                indexedBytes, indexSize * 8u, expandedBytes);
+        }
+    }
+
     mVertices_.shrink_to_fit();
+
+    if (useMeshCache && (!mError_) && (mVertices_.size() > 0u) && (!generatesRandomTexCoords))
+        writeMeshCache(cacheOptions);
+}
+
+
+QuickObj::QuickObj(const std::string filepath, float scale, OutputFormat outputFormat) :
+    QuickObj(filepath, scale, true, false, 0.5f, 0.5f, AUTOMATIC_PARSE_THREAD_COUNT, outputFormat) {
+
 }
 
 
@@ -124,129 +184,335 @@ QuickObj::QuickObj(const std::string filepath, float scale, bool generateMissing
 
 
 
-//This is a very quick and dirty implementation. Not clean
-void QuickObj::parseFile() {
-    //TODO  Calculate required space for each vector and reserve said space ahead of time
-    /*size_t tempFilesize = mFile_->getNumberOfLines();
-    mPositions_.reserve(tempFilesize);
-    mNormals_.reserve(tempFilesize);
-    mTexCoords_.reserve(tempFilesize);
-    */
-
-    //////////////////////////////////////////////
-    //TODO  finish this idea
-    //To test task-based computing, I am going to handle ngons as a separate task from parsing the 
-    //rest of the file. Any parsed ngon vertex data will then be appended onto the end of any loaded 
-    //data at the end of this function.
-    //auto ngons = findNGons(*mFile_);
-    //fprintf(MSGLOG, "\nTesting NGON Finder... Found %u NGons!\n\n", ngons.size());
-    ////////////////////////////////////
-
-    //In case a line starting with "vp" is parsed (representing freeform geometry data),
-    //we only need to print out a warning about parser not supporting freeform geometry 
-    //one time. 
-    bool freeformGeometryWarningMessageFlag = false; 
-
-    size_t fileSize = mFile_->getNumberOfLines();
-    for (size_t i = 0; i < fileSize; i++) {
-        std::string line = mFile_->getLine(i);
-        const char * lineIter = line.c_str();
-
-        switch (*lineIter) {
-        case '\n':
-            continue; //If it's an empty line, skip it
-        case 'o':
-            continue; //Skip object tags
-        case 'g':
-            continue; //Skip group tags
-        case 's': 
-            continue; //Skip smoothing group tags
-        case '#':
-            //Skip comments for now...
-            continue;
-        case 'u':
-            //Line probably is a "usemtl ____"  instruction
-            //No material using for now
-            break;
-        case 'v':
-            lineIter++;
-            if (*lineIter == ' ') {
-                eatWhitespace(lineIter);
-                loadLineIntoVertex(lineIter, mPositions_);
-            }
-            else if (*lineIter == 't') {
-                mHasTexCoords_ = true;
-                lineIter++; //move past the 't'
-                eatWhitespace(lineIter);
-                loadLineIntoVertex(lineIter, mTexCoords_);
-            }
-            else if (*lineIter == 'n') {
-                mHasNormals_ = true;
-                lineIter++;
-                eatWhitespace(lineIter);
-                loadLineIntoVertex(lineIter, mNormals_);
-            }
-            else if (*lineIter == 'p') {
-                if (!freeformGeometryWarningMessageFlag) {
-                    fprintf(MSGLOG, "\n\nWhoah! Freeform geometry data encountered! This is quite unexpected!\n"
-                        "It looks like you are trying to load an Advanced OBJ file.\n"
-                        "Unfortunately freeform geometry is not supported at this time...\n"
-                        "\t  [All freeform geometry in this file will be skipped]\n");
-                    freeformGeometryWarningMessageFlag = true;
-                }
-                continue;
-            }
-            else {
-                fprintf(ERRLOG, "\nERROR parsing line %s\n", line.c_str());
-            }
-            break;
-        case 'f': [[fallthrough]]; //If not c++17 then just comment out the '[[fallthrough]]' statement
-        case 'F':
-            mFaces_.emplace_back(AssetLoadingInternal::Face{ lineIter, true });
-            break;
-        case 'l': [[fallthrough]]; //If not c++17 then just comment out the '[[fallthrough]]' statement
-        case 'L':
-            mLines_.emplace_back(AssetLoadingInternal::Line(lineIter, true));
-            break;
-        case 'm':
-            if (*(lineIter + 1u) == 'g') { //If line starts with "mg", then
-                //It's a merging group, which we will skip
-                fprintf(MSGLOG, "Skipping Merging Group: %s", line.c_str());
-            }
-            else {
-                //It's the name of a material, which currently are not implemented
-                fprintf(MSGLOG, "Skipping Material: %s", line.c_str());
-            }
+bool QuickObj::loadFromMeshCache(const std::string& filepath, const AssetLoadingInternal::MeshCacheLoadOptions& options) {
+    AssetLoadingInternal::MeshCacheLayout layout;
+    AssetLoadingInternal::MeshCacheMaterials materials;
+    if (!AssetLoadingInternal::readMeshCache(filepath, options, layout, mVertices_, mLineEndpoints_, mIndices16_, mIndices32_, materials))
+        return false;
+
+    mMaterialDrawRanges_.clear();
+    mMaterialDrawRanges_.reserve(materials.drawRanges.size());
+    for (AssetLoadingInternal::MeshCacheMaterialRange& range : materials.drawRanges)
+        mMaterialDrawRanges_.push_back({ std::move(range.material), static_cast<size_t>(range.first), static_cast<size_t>(range.count) });
+    mMaterialLibraryFilepaths_ = std::move(materials.libraryFilepaths);
+
+    mHasTexCoords_ = layout.hasTexCoords;
+    mHasNormals_ = layout.hasNormals;
+    mIsIndexed_ = layout.isIndexed;
+    mHasTangents_ = layout.hasTangents;
+    mLoadedFromCache_ = true;
+    fprintf(MSGLOG, "\nLoaded model \"%s\" from its mesh cache  [%zu floats of vertex data, %zu indices]\n",
+        filepath.c_str(), mVertices_.size(), getIndexCount());
+    return true;
+}
+
+
+void QuickObj::writeMeshCache(const AssetLoadingInternal::MeshCacheLoadOptions& options) const {
+    const AssetLoadingInternal::MeshCacheLayout layout = { mHasTexCoords_, mHasNormals_, mIsIndexed_, mHasTangents_ };
+    AssetLoadingInternal::MeshCacheMaterials materials;
+    materials.libraryFilepaths = mMaterialLibraryFilepaths_;
+    materials.drawRanges.reserve(mMaterialDrawRanges_.size());
+    for (const MaterialDrawRange& range : mMaterialDrawRanges_)
+        materials.drawRanges.push_back({ range.material, static_cast<uint64_t>(range.first), static_cast<uint64_t>(range.count) });
+    AssetLoadingInternal::writeMeshCache(mFile_->getFilepath(), options, layout,
+        mVertices_, mLineEndpoints_, mIndices16_, mIndices32_, materials);
+}
+
+
+void QuickObj::parseFile(unsigned int parseThreadCount, OutputFormat outputFormat, bool generateMissingComponents, bool generateTangents,
+                         float positionWeldTolerance) {
+    //Files which went through the WavefrontObjConformanceTool (and haven't been touched since) are
+    //known to be in a form that can be read without any of the tokenizer's checks
+    AssetLoadingInternal::ConformantObjStamp stamp;
+    if (AssetLoadingInternal::verifyConformantObjStamp(mFile_->getTextView(), stamp)) {
+        AssetLoadingInternal::parseConformantObj(mFile_->getTextView(), stamp, mParsedData_);
+        mParsedFromConformantFile_ = true;
+        fprintf(MSGLOG, "\nFile \"%s\" is conformant, it was loaded through the fast path\n", mFile_->getFilepath().c_str());
+    }
+    else
+        tokenizeFile(parseThreadCount);
+
+    if (positionWeldTolerance > 0.0f)
+        weldParsedPositions(positionWeldTolerance);
+
+    //Smoothing groups only matter for generated normals. They have to be picked out of the tags before
+    //the faces get sorted by material, since the sort throws the tags away.
+    if (generateMissingComponents && (!mParsedData_.hasNormals))
+        assignFaceSmoothingGroups();
+
+    //Conformant files never have any 'usemtl' lines
+    for (const AssetLoadingInternal::ParsedSubMeshTag& tag : mParsedData_.subMeshTags) {
+        if (tag.type == AssetLoadingInternal::SubMeshTagType::MATERIAL) {
+            sortFacesByMaterial();
             break;
-        
-        default:
-            fprintf(MSGLOG, "\nUnable to parse line %s\n", line.c_str());
         }
     }
 
-    if (mPositions_.size() > 0) {
-        constructVerticesFromParsedData();
+    mHasTexCoords_ = mParsedData_.hasTexCoords;
+    mHasNormals_ = mParsedData_.hasNormals;
+
+    if (mParsedData_.positions.size() > 0) {
+        //Indexed meshes are built straight from the parsed index tuples, unless components need to be generated 
+        //(generated normals and tangents are computed from the expanded triangles, so they can only be added to already-expanded vertices)
+        const bool nothingToGenerate = (((!generateMissingComponents) || (mHasTexCoords_ && mHasNormals_)) && (!generateTangents));
+        if ((outputFormat == OutputFormat::INDEXED) && nothingToGenerate && facesHaveUniformComponents())
+            constructIndexedVerticesFromParsedData();
+        else 
+            constructVerticesFromParsedData();
     }
     else {
         fprintf(ERRLOG, "\nERROR! Unable to parse file %s!\n", mFile_->getFilepath().c_str());
     }
 }
 
-//
-//void QuickObj::preparseFile() {
-//	//Remove comments
-//	mFile_->removeLinesBeginningWithCharacter('#');
-//
-//	//I know this is wrong, each vector is way too big:
-//	size_t dataSize = mFile_->getNumberOfLinesThatBeginWith('v'); //I forgot to add a function that checks the character after the 'v'
-//	mPositions_.reserve(dataSize);
-//	mTexCoords_.reserve(dataSize);
-//	mNormals_.reserve(dataSize);
-//
-//	//These next 2 are correct though
-//	mFaces_.reserve(mFile_->getNumberOfLinesThatBeginWith('f'));
-//	mLines_.reserve(mFile_->getNumberOfLinesThatBeginWith('l'));
-//}
+
+//Hands the file's entire text to the ObjTokenizer, which parses it in a single pass (split
+//across multiple threads for large files)
+void QuickObj::tokenizeFile(unsigned int parseThreadCount) {
+    //The number of faces is known exactly ahead of time thanks to the AsciiAsset's leading
+    //character counts. Vertex data lines all begin with 'v', which over-counts each individual 
+    //vertex pool, so only the position pool gets reserved (it is usually the largest one anyways).
+    mParsedData_.faces.reserve(mFile_->getNumberOfLinesThatBeginWith('f') + mFile_->getNumberOfLinesThatBeginWith('F'));
+    mParsedData_.positions.reserve(mFile_->getNumberOfLinesThatBeginWith('v'));
+
+    if (parseThreadCount == AUTOMATIC_PARSE_THREAD_COUNT)
+        parseThreadCount = AssetLoadingInternal::chooseObjParseThreadCount(mFile_->getStoredTextLength());
+
+    const size_t linesWithErrors = AssetLoadingInternal::tokenizeObjInParallel(*mFile_, mParsedData_, parseThreadCount);
+    if (linesWithErrors > 0u) {
+        fprintf(WRNLOG, "\nWarning! %zu lines of file \"%s\" could not be parsed!\n", linesWithErrors,
+            mFile_->getFilepath().c_str());
+    }
+
+    if (mParsedData_.nGons.size() > 0u) {
+        const size_t nGonCount = mParsedData_.nGons.size();
+        const size_t degenerateNGons = AssetLoadingInternal::triangulateNGons(mParsedData_);
+        fprintf(MSGLOG, "\nTriangulated %zu NGons in file \"%s\"\n", nGonCount, mFile_->getFilepath().c_str());
+        if (degenerateNGons > 0u) {
+            fprintf(WRNLOG, "Warning! %zu of these NGons were degenerate and were split into a fan of triangles instead!\n",
+                degenerateNGons);
+        }
+    }
+}
+
+
+//The welded positions replace the parsed ones, and every face, n-gon corner and line endpoint is pointed at the new positions.
+//Out of range indices stay out of range, since there are never more positions after welding than before.
+void QuickObj::weldParsedPositions(float tolerance) {
+    const size_t positionCount = mParsedData_.positions.size();
+    std::vector<uint32_t> remap;
+    const size_t weldedCount = AssetLoadingInternal::weldPositions(mParsedData_.positions, tolerance, remap);
+    if (weldedCount == positionCount)
+        return;
+
+    AssetLoadingInternal::PositionStreams weldedPositions;
+    weldedPositions.reserve(weldedCount);
+    for (size_t i = 0u; i < positionCount; i++) {
+        if (remap[i] == weldedPositions.size()) //Kept positions are numbered in order
+            weldedPositions.push_back(mParsedData_.positions.get(i));
+    }
+    mParsedData_.positions = std::move(weldedPositions);
+
+    auto remapIndex = [&remap, positionCount](size_t index) {
+        return ((index < positionCount) ? static_cast<size_t>(remap[index]) : index);
+    };
+    AssetLoadingInternal::ParsedFaceList& faces = mParsedData_.faces;
+    for (size_t face = 0u; face < faces.size(); face++) {
+        if (faces.isNGon(face))
+            continue; //The n-gon's corners are remapped below
+        const AssetLoadingInternal::ParsedFace parsed = faces[face];
+        for (int corner = 0; corner < static_cast<int>(parsed.vertexCount); corner++)
+            faces.setPosition(face, corner, static_cast<AssetLoadingInternal::FaceIndex>(remapIndex(parsed.positions[corner])));
+    }
+    for (AssetLoadingInternal::ParsedNGonCorner& corner : mParsedData_.nGonCorners)
+        corner.position = static_cast<AssetLoadingInternal::FaceIndex>(remapIndex(corner.position));
+    for (AssetLoadingInternal::Offset& endpoint : mParsedData_.lineEndpoints)
+        endpoint = remapIndex(endpoint);
+
+    fprintf(MSGLOG, "\nWelded %zu duplicate positions in file \"%s\"  [%zu -> %zu positions]\n", (positionCount - weldedCount),
+        mFile_->getFilepath().c_str(), positionCount, weldedCount);
+}
+
+
+//Every face is given the ID of the material it uses, with IDs handed out in order of first use. The faces
+//are then counting-sorted by their IDs, which keeps each material's faces in the order they appeared in the
+//file. Each face turns into either 3 or 6 vertices/indices no matter which output format is used (and faces
+//that are out of range turn into none), so the draw ranges can be worked out here before any vertices exist.
+void QuickObj::sortFacesByMaterial() {
+    using AssetLoadingInternal::ParsedFace;
+    using AssetLoadingInternal::ParsedSubMeshTag;
+    using AssetLoadingInternal::SubMeshTagType;
+
+    static constexpr const char * UNNAMED_MATERIAL = "default";
+
+    std::vector<std::string> materialNames;
+    std::unordered_map<std::string, uint32_t> idsByName;
+    auto findOrAddMaterial = [&materialNames, &idsByName](const std::string& name) {
+        const auto found = idsByName.find(name);
+        if (found != idsByName.cend())
+            return found->second;
+        const uint32_t id = static_cast<uint32_t>(materialNames.size());
+        idsByName.emplace(name, id);
+        materialNames.push_back(name);
+        return id;
+    };
+
+    const size_t faceCount = mParsedData_.faces.size();
+    std::vector<uint32_t> faceMaterials(faceCount);
+    std::vector<size_t> facesPerMaterial;
+    std::vector<size_t> cornersPerMaterial;
+    auto nextTag = mParsedData_.subMeshTags.cbegin();
+    uint32_t currentMaterial = 0u;
+    bool haveMaterial = false;
+    for (size_t i = 0u; i < faceCount; i++) {
+        for (; (nextTag != mParsedData_.subMeshTags.cend()) && (nextTag->firstFace <= i); nextTag++) {
+            if (nextTag->type == SubMeshTagType::MATERIAL) {
+                currentMaterial = findOrAddMaterial(nextTag->name);
+                haveMaterial = true;
+            }
+        }
+        if (!haveMaterial) {
+            currentMaterial = findOrAddMaterial(UNNAMED_MATERIAL);
+            haveMaterial = true;
+        }
+        if (currentMaterial == facesPerMaterial.size()) {
+            facesPerMaterial.push_back(0u);
+            cornersPerMaterial.push_back(0u);
+        }
+        const ParsedFace face = mParsedData_.faces[i];
+        faceMaterials[i] = currentMaterial;
+        facesPerMaterial[currentMaterial]++;
+        if (faceIndicesAreInRange(face))
+            cornersPerMaterial[currentMaterial] += (face.isQuad() ? (VERTICES_IN_A_TRIANGLE * TRIANGLES_IN_A_QUAD) : VERTICES_IN_A_TRIANGLE);
+    }
+
+    //Only materials that actually have faces get a draw range
+    std::vector<size_t> nextFaceOfMaterial(facesPerMaterial.size());
+    size_t firstFace = 0u;
+    size_t firstCorner = 0u;
+    const std::vector<WavefrontMtl> libraries = loadMaterialLibraries();
+    size_t materialsNotFound = 0u;
+    for (size_t id = 0u; id < facesPerMaterial.size(); id++) {
+        nextFaceOfMaterial[id] = firstFace;
+        firstFace += facesPerMaterial[id];
+
+        const WavefrontMaterial * material = nullptr;
+        for (auto library = libraries.cbegin(); (library != libraries.cend()) && (material == nullptr); library++)
+            material = library->findMaterial(materialNames[id]);
+        if ((material == nullptr) && (materialNames[id] != UNNAMED_MATERIAL)) {
+            fprintf(WRNLOG, "\nWarning! Material \"%s\" used by file \"%s\" was not found in any of its material libraries!\n",
+                materialNames[id].c_str(), mFile_->getFilepath().c_str());
+            materialsNotFound++;
+        }
+        if (facesPerMaterial[id] == 0u)
+            continue;
+        mMaterialDrawRanges_.push_back({ ((material != nullptr) ? *material : WavefrontMtl::makeDefaultMaterial(materialNames[id])),
+                                         firstCorner, cornersPerMaterial[id] });
+        firstCorner += cornersPerMaterial[id];
+    }
+
+    std::vector<size_t> sortedOrder(faceCount);
+    for (size_t i = 0u; i < faceCount; i++)
+        sortedOrder[nextFaceOfMaterial[faceMaterials[i]]++] = i;
+    AssetLoadingInternal::ParsedFaceList sortedFaces;
+    sortedFaces.reserve(faceCount);
+    for (const size_t i : sortedOrder)
+        sortedFaces.push_back(mParsedData_.faces[i]);
+    mParsedData_.faces.swap(sortedFaces);
+    if (!mFaceSmoothingGroups_.empty()) {
+        std::vector<uint32_t> sortedSmoothingGroups;
+        sortedSmoothingGroups.reserve(faceCount);
+        for (const size_t i : sortedOrder)
+            sortedSmoothingGroups.push_back(mFaceSmoothingGroups_[i]);
+        mFaceSmoothingGroups_.swap(sortedSmoothingGroups);
+    }
+    //The tags refer to faces by their original positions, so they no longer mean anything
+    mParsedData_.subMeshTags.clear();
+
+    fprintf(MSGLOG, "\nSorted the faces of file \"%s\" into %zu material draw ranges%s\n", mFile_->getFilepath().c_str(),
+        mMaterialDrawRanges_.size(), ((materialsNotFound > 0u) ? "  [some materials were given the default material]" : ""));
+}
+
+
+//Group names are given IDs in order of first use, starting from 1 (0 is reserved for flat shading). The 
+//names are usually numbers but any name is allowed, so they are compared as strings.
+void QuickObj::assignFaceSmoothingGroups() {
+    using AssetLoadingInternal::ParsedSubMeshTag;
+    using AssetLoadingInternal::SubMeshTagType;
+    using AssetLoadingInternal::FLAT_SHADED_SMOOTHING_GROUP;
+
+    bool hasSmoothingGroups = false;
+    for (const ParsedSubMeshTag& tag : mParsedData_.subMeshTags)
+        hasSmoothingGroups = (hasSmoothingGroups || (tag.type == SubMeshTagType::SMOOTHING_GROUP));
+    if (!hasSmoothingGroups)
+        return;
+
+    std::unordered_map<std::string, uint32_t> idsByName;
+    const size_t faceCount = mParsedData_.faces.size();
+    mFaceSmoothingGroups_.resize(faceCount);
+    auto nextTag = mParsedData_.subMeshTags.cbegin();
+    uint32_t currentGroup = FLAT_SHADED_SMOOTHING_GROUP;
+    for (size_t i = 0u; i < faceCount; i++) {
+        for (; (nextTag != mParsedData_.subMeshTags.cend()) && (nextTag->firstFace <= i); nextTag++) {
+            if (nextTag->type != SubMeshTagType::SMOOTHING_GROUP)
+                continue;
+            if ((nextTag->name == "off") || (nextTag->name == "0"))
+                currentGroup = FLAT_SHADED_SMOOTHING_GROUP;
+            else
+                currentGroup = idsByName.emplace(nextTag->name, static_cast<uint32_t>(idsByName.size() + 1u)).first->second;
+        }
+        mFaceSmoothingGroups_[i] = currentGroup;
+    }
+}
+
+
+std::vector<uint32_t> QuickObj::computeTriangleSmoothingGroups() const {
+    std::vector<uint32_t> triangleSmoothingGroups;
+    if (mFaceSmoothingGroups_.size() != mParsedData_.faces.size())
+        return triangleSmoothingGroups;
+
+    triangleSmoothingGroups.reserve(mParsedData_.faces.size() * TRIANGLES_IN_A_QUAD);
+    for (size_t i = 0u; i < mParsedData_.faces.size(); i++) {
+        const AssetLoadingInternal::ParsedFace face = mParsedData_.faces[i];
+        if (!faceIndicesAreInRange(face))
+            continue;
+        triangleSmoothingGroups.push_back(mFaceSmoothingGroups_[i]);
+        if (face.isQuad())
+            triangleSmoothingGroups.push_back(mFaceSmoothingGroups_[i]);
+    }
+    return triangleSmoothingGroups;
+}
+
+
+std::vector<WavefrontMtl> QuickObj::loadMaterialLibraries() {
+    std::vector<WavefrontMtl> libraries;
+    mMaterialLibraryFilepaths_.clear();
+    const std::filesystem::path objDirectory = std::filesystem::path(mFile_->getFilepath()).parent_path();
+    for (const std::string& library : mParsedData_.materialLibraries) {
+        //A 'mtllib' line may name more than one library, but it may also name a single library which happens
+        //to have spaces in its name. The whole line is tried as one filename first.
+        std::vector<std::string> filenames = { library };
+        if ((!FilepathWrapper::file_exists((objDirectory / library).string().c_str())) &&
+            (library.find_first_of(" \t") != std::string::npos)) {
+            //The cache has to notice if the whole line starts naming a file
+            mMaterialLibraryFilepaths_.push_back((objDirectory / library).string());
+            filenames.clear();
+            size_t wordStart = library.find_first_not_of(" \t");
+            while (wordStart != std::string::npos) {
+                const size_t wordEnd = library.find_first_of(" \t", wordStart);
+                filenames.push_back(library.substr(wordStart, wordEnd - wordStart));
+                wordStart = library.find_first_not_of(" \t", wordEnd);
+            }
+        }
+        for (const std::string& filename : filenames) {
+            mMaterialLibraryFilepaths_.push_back((objDirectory / filename).string());
+            WavefrontMtl loaded(mMaterialLibraryFilepaths_.back());
+            if (!loaded.error())
+                libraries.push_back(std::move(loaded));
+        }
+    }
+    return libraries;
+}
 
 
 void QuickObj::constructVerticesFromParsedData() {
@@ -260,9 +526,9 @@ void QuickObj::constructVerticesFromParsedData() {
 
     int triangleFaces = 0;
     int quadFaces = 0;
-    const size_t linePrimitives = mLines_.size();
-    for (auto faceIter = mFaces_.begin(); faceIter != mFaces_.end(); faceIter++) {
-        if (faceIter->isQuad()) {
+    const size_t linePrimitives = mParsedData_.lineEndpoints.size() / 2u;
+    for (size_t i = 0u; i < mParsedData_.faces.size(); i++) {
+        if (mParsedData_.faces.isQuad(i)) {
             quadFaces++;
         }
         else {
@@ -277,481 +543,307 @@ void QuickObj::constructVerticesFromParsedData() {
 
     mVertices_.reserve(spaceToReserve);
 
-    fprintf(MSGLOG, "\n*** Model Statistics ***\nPrimitive Counts:  Lines: %u\tTriangles: %d\tQuads: %d\n",
+    fprintf(MSGLOG, "\n*** Model Statistics ***\nPrimitive Counts:  Lines: %zu\tTriangles: %d\tQuads: %d\n",
         linePrimitives, triangleFaces, quadFaces);
-    fprintf(MSGLOG, "Parsed  Positions: %d\tTexCoords: %d\tNormals: %d\n", mPositions_.size(),
-        mTexCoords_.size(), mNormals_.size());
-
-
-    //Construct each face from the parsed data into the mVertices_ vector, with positions/textureCoords/Normals interlaced
-    for (auto faceIter = mFaces_.begin(); faceIter != mFaces_.end(); faceIter++) {
-        if (faceIter->isQuad()) { //Quads will be triangulated here:
-            auto offsets = faceIter->getQuadFace(); //Get the quad face (note variable 'offsets' is an array of arrays)
-            auto quadCorner0 = offsets[QUAD_CORNER_0_OFFSETS]; //Get the quad's 4 corners
-            auto quadCorner1 = offsets[QUAD_CORNER_1_OFFSETS];
-            auto quadCorner2 = offsets[QUAD_CORNER_3_OFFSETS];
-            auto quadCorner3 = offsets[QUAD_CORNER_2_OFFSETS];
-
-            //If we just have to worry about position data since there was no texture or normal data:
-            if (!(faceIter->hasTexCoord() || faceIter->hasNormals())) {
-
-                //Triangle 1
-                auto qc0_pos = mPositions_[quadCorner0[POSITION_INDEX]]; //quad corner 0 _ positions
-                mVertices_.push_back(qc0_pos[0]); //corner0 x
-                mVertices_.push_back(qc0_pos[1]); //corner0 y
-                mVertices_.push_back(qc0_pos[2]); //corner0 z
-                mVertices_.push_back(mScale_);    //zoom / w component of position
-
-                auto qc1_pos = mPositions_[quadCorner1[POSITION_INDEX]]; //quad corner 1 _ positions
-                mVertices_.push_back(qc1_pos[0]); //corner1 x
-                mVertices_.push_back(qc1_pos[1]); //corner1 y
-                mVertices_.push_back(qc1_pos[2]); //corner1 z
-                mVertices_.push_back(mScale_);   //zoom
-
-                auto qc2_pos = mPositions_[quadCorner2[POSITION_INDEX]]; //quad corner 2 _ positions
-                mVertices_.push_back(qc2_pos[0]); //corner2 x
-                mVertices_.push_back(qc2_pos[1]); //corner2 y
-                mVertices_.push_back(qc2_pos[2]); //corner2 z
-                mVertices_.push_back(mScale_);    //zoom / w component of position
-
-                //Triangle 2
-                mVertices_.push_back(qc2_pos[0]); //corner2 x
-                mVertices_.push_back(qc2_pos[1]); //corner2 y
-                mVertices_.push_back(qc2_pos[2]); //corner2 z
-                mVertices_.push_back(mScale_);    //zoom / w component of position
-
-
-                mVertices_.push_back(qc1_pos[0]); //corner1 x
-                mVertices_.push_back(qc1_pos[1]); //corner1 y
-                mVertices_.push_back(qc1_pos[2]); //corner1 z
-                mVertices_.push_back(mScale_);    //zoom 
-
-                auto qc3_pos = mPositions_[quadCorner3[POSITION_INDEX]]; //quad corner 3 _ positions
-                mVertices_.push_back(qc3_pos[0]); //corner3 x
-                mVertices_.push_back(qc3_pos[1]); //corner3 y
-                mVertices_.push_back(qc3_pos[2]); //corner3 z
-                mVertices_.push_back(mScale_);    //zoom / w component of position
-
+    fprintf(MSGLOG, "Parsed  Positions: %zu\tTexCoords: %zu\tNormals: %zu\n", mParsedData_.positions.size(),
+        mParsedData_.texCoords.size(), mParsedData_.normals.size());
+
+    size_t facesSkipped = 0u;
+
+    //Construct each face from the parsed data into the mVertices_ vector, with positions/textureCoords/Normals interlaced.
+    //When every face has the same components the corners are gathered out of the parsed attribute streams a block
+    //at a time, otherwise each corner has to be written out according to its own face's components.
+    if (facesHaveUniformComponents()) {
+        std::unique_ptr<CornerIndexBlock> block = std::make_unique<CornerIndexBlock>();
+        for (const AssetLoadingInternal::ParsedFace face : mParsedData_.faces) {
+            if (!faceIndicesAreInRange(face)) {
+                facesSkipped++;
+                continue;
+            }
+            if (!block->hasRoomFor(std::size(AssetLoadingInternal::QUAD_TRIANGULATION_CORNERS)))
+                gatherCornersIntoVertexData(*block);
+            if (face.isQuad()) { //Quads will be triangulated here:
+                for (int corner : AssetLoadingInternal::QUAD_TRIANGULATION_CORNERS)
+                    block->add(face, corner);
+            }
+            else { //Else we have a triangular face
+                for (int corner : AssetLoadingInternal::TRIANGLE_CORNERS)
+                    block->add(face, corner);
+            }
+        }
+        gatherCornersIntoVertexData(*block);
+    }
+    else {
+        for (const AssetLoadingInternal::ParsedFace face : mParsedData_.faces) {
+            if (!faceIndicesAreInRange(face)) {
+                facesSkipped++;
+                continue;
+            }
+            if (face.isQuad()) { //Quads will be triangulated here:
+                for (int corner : AssetLoadingInternal::QUAD_TRIANGULATION_CORNERS)
+                    addFaceCornerToVertexData(face, corner);
+            }
+            else { //Else we have a triangular face
+                for (int corner : AssetLoadingInternal::TRIANGLE_CORNERS)
+                    addFaceCornerToVertexData(face, corner);
             }
+        }
+    }
 
+    if (facesSkipped > 0u) {
+        fprintf(ERRLOG, "\nERROR! %zu faces in file \"%s\" referenced vertex data that does not exist!\n"
+            "  [These faces were skipped]\n", facesSkipped, mFile_->getFilepath().c_str());
+    }
+}
 
 
-            else if (faceIter->hasTexCoord()) {
-                if (!(faceIter->hasNormals())) { //Only texture coords, no normals
-
-                    //Triangle 1
-                    auto qc0_pos = mPositions_[quadCorner0[POSITION_INDEX]]; //quad corner 0 _ positions
-                    mVertices_.push_back(qc0_pos[0]); //corner0 x
-                    mVertices_.push_back(qc0_pos[1]); //corner0 y
-                    mVertices_.push_back(qc0_pos[2]); //corner0 z
-                    mVertices_.push_back(mScale_);    //zoom / w component of position
-                    auto qc0_tex = mTexCoords_[quadCorner0[TEXTURE_COORD_INDEX]]; //quad corner 0 _ texture coords
-                    mVertices_.push_back(qc0_tex[0]);      //Corner 0 tex coord s
-                    mVertices_.push_back(1.0f-qc0_tex[1]); //Corner 0 tex coord t
-
-
-                    auto qc1_pos = mPositions_[quadCorner1[POSITION_INDEX]]; //quad corner 1 _ positions
-                    mVertices_.push_back(qc1_pos[0]); //corner1 x
-                    mVertices_.push_back(qc1_pos[1]); //corner1 y
-                    mVertices_.push_back(qc1_pos[2]); //corner1 z
-                    mVertices_.push_back(mScale_);   //zoom
-                    auto qc1_tex = mTexCoords_[quadCorner1[TEXTURE_COORD_INDEX]]; //quad corner 1 _ texture coords
-                    mVertices_.push_back(qc1_tex[0]);      //Corner 1 tex coord s
-                    mVertices_.push_back(1.0f-qc1_tex[1]); //Corner 1 tex coord t
-
-
-                    auto qc2_pos = mPositions_[quadCorner2[POSITION_INDEX]]; //quad corner 2 _ positions
-                    mVertices_.push_back(qc2_pos[0]); //corner2 x
-                    mVertices_.push_back(qc2_pos[1]); //corner2 y
-                    mVertices_.push_back(qc2_pos[2]); //corner2 z
-                    mVertices_.push_back(mScale_);    //zoom / w component of position
-                    auto qc2_tex = mTexCoords_[quadCorner2[TEXTURE_COORD_INDEX]]; //quad corner 2 _ texture coords
-                    mVertices_.push_back(qc2_tex[0]);      //Corner 2 tex coord s
-                    mVertices_.push_back(1.0f-qc2_tex[1]); //Corner 2 tex coord t
-
-
-
-                    //Triangle 2
-                    mVertices_.push_back(qc2_pos[0]); //corner2 x
-                    mVertices_.push_back(qc2_pos[1]); //corner2 y
-                    mVertices_.push_back(qc2_pos[2]); //corner2 z
-                    mVertices_.push_back(mScale_);    //zoom / w component of position
-                    mVertices_.push_back(qc2_tex[0]);      //Corner 2 tex coord s
-                    mVertices_.push_back(1.0f-qc2_tex[1]); //Corner 2 tex coord t
-
-                    mVertices_.push_back(qc1_pos[0]); //corner1 x
-                    mVertices_.push_back(qc1_pos[1]); //corner1 y
-                    mVertices_.push_back(qc1_pos[2]); //corner1 z
-                    mVertices_.push_back(mScale_);
-                    mVertices_.push_back(qc1_tex[0]);      //Corner 1 tex coord s
-                    mVertices_.push_back(1.0f-qc1_tex[1]); //Corner 1 tex coord t
-
-                    auto qc3_pos = mPositions_[quadCorner3[POSITION_INDEX]]; //quad corner 3 _ positions
-                    mVertices_.push_back(qc3_pos[0]); //corner3 x
-                    mVertices_.push_back(qc3_pos[1]); //corner3 y
-                    mVertices_.push_back(qc3_pos[2]); //corner3 z
-                    mVertices_.push_back(mScale_);    //zoom / w component of position
-                    auto qc3_tex = mTexCoords_[quadCorner3[TEXTURE_COORD_INDEX]]; //quad corner 3 _ texture coords
-                    mVertices_.push_back(qc3_tex[0]);      //Corner 3 tex coord s
-                    mVertices_.push_back(1.0f-qc3_tex[1]); //Corner 3 tex coord t
-
-                }
-
-
-
-                else { //There are both normals and texture coords
-                       //Triangle 1
-                    auto qc0_pos = mPositions_[quadCorner0[POSITION_INDEX]]; //quad corner 0 _ positions
-                    mVertices_.push_back(qc0_pos[0]); //corner0 x
-                    mVertices_.push_back(qc0_pos[1]); //corner0 y
-                    mVertices_.push_back(qc0_pos[2]); //corner0 z
-                    mVertices_.push_back(mScale_);    //zoom / w component of position
-                    auto qc0_tex = mTexCoords_[quadCorner0[TEXTURE_COORD_INDEX]]; //quad corner 0 _ texture coords
-                    mVertices_.push_back(qc0_tex[0]);      //Corner 0 tex coord s
-                    mVertices_.push_back(1.0f-qc0_tex[1]); //Corner 0 tex coord t
-                    auto qc0_nrml = mNormals_[quadCorner0[NORMAL_INDEX]]; //quad corner 0 _ normal
-                    mVertices_.push_back(qc0_nrml[0]); //Corner 0 normal x
-                    mVertices_.push_back(qc0_nrml[1]); //Corner 0 normal y
-                    mVertices_.push_back(qc0_nrml[2]); //Corner 0 normal z
-
-
-                    auto qc1_pos = mPositions_[quadCorner1[POSITION_INDEX]]; //quad corner 1 _ positions
-                    mVertices_.push_back(qc1_pos[0]); //corner1 x
-                    mVertices_.push_back(qc1_pos[1]); //corner1 y
-                    mVertices_.push_back(qc1_pos[2]); //corner1 z
-                    mVertices_.push_back(mScale_);   //zoom
-                    auto qc1_tex = mTexCoords_[quadCorner1[TEXTURE_COORD_INDEX]]; //quad corner 1 _ texture coords
-                    mVertices_.push_back(qc1_tex[0]);      //Corner 1 tex coord s
-                    mVertices_.push_back(1.0f-qc1_tex[1]); //Corner 1 tex coord t
-                    auto qc1_nrml = mNormals_[quadCorner1[NORMAL_INDEX]]; //quad corner 1 _ normal
-                    mVertices_.push_back(qc1_nrml[0]); //Corner 1 normal x
-                    mVertices_.push_back(qc1_nrml[1]); //Corner 1 normal y
-                    mVertices_.push_back(qc1_nrml[2]); //Corner 1 normal z
-
-                    auto qc2_pos = mPositions_[quadCorner2[POSITION_INDEX]]; //quad corner 2 _ positions
-                    mVertices_.push_back(qc2_pos[0]); //corner2 x
-                    mVertices_.push_back(qc2_pos[1]); //corner2 y
-                    mVertices_.push_back(qc2_pos[2]); //corner2 z
-                    mVertices_.push_back(mScale_);    //zoom / w component of position
-                    auto qc2_tex = mTexCoords_[quadCorner2[TEXTURE_COORD_INDEX]]; //quad corner 2 _ texture coords
-                    mVertices_.push_back(qc2_tex[0]);      //Corner 2 tex coord s
-                    mVertices_.push_back(1.0f-qc2_tex[1]); //Corner 2 tex coord t
-                    auto qc2_nrml = mNormals_[quadCorner2[NORMAL_INDEX]]; //quad corner 2 _ normal
-                    mVertices_.push_back(qc2_nrml[0]); //Corner 2 normal x
-                    mVertices_.push_back(qc2_nrml[1]); //Corner 2 normal y
-                    mVertices_.push_back(qc2_nrml[2]); //Corner 2 normal z
-
-
-                        //Triangle 2
-                    mVertices_.push_back(qc2_pos[0]); //corner2 x
-                    mVertices_.push_back(qc2_pos[1]); //corner2 y
-                    mVertices_.push_back(qc2_pos[2]); //corner2 z
-                    mVertices_.push_back(mScale_);    //zoom / w component of position
-                    mVertices_.push_back(qc2_tex[0]);      //Corner 2 tex coord s
-                    mVertices_.push_back(1.0f-qc2_tex[1]); //Corner 2 tex coord t
-                    mVertices_.push_back(qc2_nrml[0]); //Corner 2 normal x
-                    mVertices_.push_back(qc2_nrml[1]); //Corner 2 normal y
-                    mVertices_.push_back(qc2_nrml[2]); //Corner 2 normal z
-
-                    mVertices_.push_back(qc1_pos[0]); //corner1 x
-                    mVertices_.push_back(qc1_pos[1]); //corner1 y
-                    mVertices_.push_back(qc1_pos[2]); //corner1 z
-                    mVertices_.push_back(mScale_);   //zoom
-                    mVertices_.push_back(qc1_tex[0]);      //Corner 1 tex coord s
-                    mVertices_.push_back(1.0f-qc1_tex[1]); //Corner 1 tex coord t
-                    mVertices_.push_back(qc1_nrml[0]); //Corner 1 normal x
-                    mVertices_.push_back(qc1_nrml[1]); //Corner 1 normal y
-                    mVertices_.push_back(qc1_nrml[2]); //Corner 1 normal z
-
-                    auto qc3_pos = mPositions_[quadCorner3[POSITION_INDEX]]; //quad corner 3 _ positions
-                    mVertices_.push_back(qc3_pos[0]); //corner3 x
-                    mVertices_.push_back(qc3_pos[1]); //corner3 y
-                    mVertices_.push_back(qc3_pos[2]); //corner3 z
-                    mVertices_.push_back(mScale_);    //zoom / w component of position
-                    auto qc3_tex = mTexCoords_[quadCorner3[TEXTURE_COORD_INDEX]]; //quad corner 3 _ texture coords
-                    mVertices_.push_back(qc3_tex[0]);      //Corner 3 tex coord s
-                    mVertices_.push_back(1.0f-qc3_tex[1]); //Corner 3 tex coord t
-                    auto qc3_nrml = mNormals_[quadCorner3[NORMAL_INDEX]]; //quad corner 3 _ normal
-                    mVertices_.push_back(qc3_nrml[0]); //Corner 3 normal x
-                    mVertices_.push_back(qc3_nrml[1]); //Corner 3 normal y
-                    mVertices_.push_back(qc3_nrml[2]); //Corner 3 normal z
-
-                }
-            }
-            else { //There must be normals but no texture coords
-                   //Triangle 1
-                auto qc0_pos = mPositions_[quadCorner0[POSITION_INDEX]]; //quad corner 0 _ positions
-                mVertices_.push_back(qc0_pos[0]); //corner0 x
-                mVertices_.push_back(qc0_pos[1]); //corner0 y
-                mVertices_.push_back(qc0_pos[2]); //corner0 z
-                mVertices_.push_back(mScale_);    //zoom / w component of position
-                auto qc0_nrml = mNormals_[quadCorner0[NORMAL_INDEX]]; //quad corner 0 _ normal
-                mVertices_.push_back(qc0_nrml[0]); //Corner 0 normal x
-                mVertices_.push_back(qc0_nrml[1]); //Corner 0 normal y
-                mVertices_.push_back(qc0_nrml[2]); //Corner 0 normal z
-
-
-                auto qc1_pos = mPositions_[quadCorner1[POSITION_INDEX]]; //quad corner 1 _ positions
-                mVertices_.push_back(qc1_pos[0]); //corner1 x
-                mVertices_.push_back(qc1_pos[1]); //corner1 y
-                mVertices_.push_back(qc1_pos[2]); //corner1 z
-                mVertices_.push_back(mScale_);   //zoom
-                auto qc1_nrml = mNormals_[quadCorner1[NORMAL_INDEX]]; //quad corner 1 _ normal
-                mVertices_.push_back(qc1_nrml[0]); //Corner 1 normal x
-                mVertices_.push_back(qc1_nrml[1]); //Corner 1 normal y
-                mVertices_.push_back(qc1_nrml[2]); //Corner 1 normal z
-
-                auto qc2_pos = mPositions_[quadCorner2[POSITION_INDEX]]; //quad corner 2 _ positions
-                mVertices_.push_back(qc2_pos[0]); //corner2 x
-                mVertices_.push_back(qc2_pos[1]); //corner2 y
-                mVertices_.push_back(qc2_pos[2]); //corner2 z
-                mVertices_.push_back(mScale_);    //zoom / w component of position
-                auto qc2_nrml = mNormals_[quadCorner2[NORMAL_INDEX]]; //quad corner 2 _ normal
-                mVertices_.push_back(qc2_nrml[0]); //Corner 2 normal x
-                mVertices_.push_back(qc2_nrml[1]); //Corner 2 normal y
-                mVertices_.push_back(qc2_nrml[2]); //Corner 2 normal z
-
-
-                //Triangle 2
-                mVertices_.push_back(qc2_pos[0]); //corner2 x
-                mVertices_.push_back(qc2_pos[1]); //corner2 y
-                mVertices_.push_back(qc2_pos[2]); //corner2 z
-                mVertices_.push_back(mScale_);    //zoom / w component of position
-                mVertices_.push_back(qc2_nrml[0]); //Corner 2 normal x
-                mVertices_.push_back(qc2_nrml[1]); //Corner 2 normal y
-                mVertices_.push_back(qc2_nrml[2]); //Corner 2 normal z
-
-
-                mVertices_.push_back(qc1_pos[0]); //corner1 x
-                mVertices_.push_back(qc1_pos[1]); //corner1 y
-                mVertices_.push_back(qc1_pos[2]); //corner1 z
-                mVertices_.push_back(mScale_);
-                mVertices_.push_back(qc1_nrml[0]); //Corner 1 normal x
-                mVertices_.push_back(qc1_nrml[1]); //Corner 1 normal y
-                mVertices_.push_back(qc1_nrml[2]); //Corner 1 normal z
-
-
-                auto qc3_pos = mPositions_[quadCorner3[POSITION_INDEX]]; //quad corner 3 _ positions
-                mVertices_.push_back(qc3_pos[0]); //corner3 x
-                mVertices_.push_back(qc3_pos[1]); //corner3 y
-                mVertices_.push_back(qc3_pos[2]); //corner3 z
-                mVertices_.push_back(mScale_);    //zoom / w component of position
-                auto qc3_nrml = mNormals_[quadCorner3[NORMAL_INDEX]]; //quad corner 3 _ normal
-                mVertices_.push_back(qc3_nrml[0]); //Corner 3 normal x
-                mVertices_.push_back(qc3_nrml[1]); //Corner 3 normal y
-                mVertices_.push_back(qc3_nrml[2]); //Corner 3 normal z
+bool QuickObj::faceIndicesAreInRange(const AssetLoadingInternal::ParsedFace& face) const noexcept {
+    if (mParsedFromConformantFile_) //Guaranteed by the file's stamp
+        return true;
+    const size_t positionCount = mParsedData_.positions.size();
+    const size_t texCoordCount = mParsedData_.texCoords.size();
+    const size_t normalCount = mParsedData_.normals.size();
+    for (int i = 0; i < face.vertexCount; i++) {
+        if (face.positions[i] >= positionCount)
+            return false;
+        if (face.hasTexCoords && (face.texCoords[i] >= texCoordCount))
+            return false;
+        if (face.hasNormals && (face.normals[i] >= normalCount))
+            return false;
+    }
+    return true;
+}
 
-            }
-        }
 
-        //Else we have a triangular face
-        else {
-            auto offsets = faceIter->getTriangleFace(); //Get the triangle face (note 'offsets' is an array of arrays)
-            auto corner0 = offsets[0]; //Get the 3 corners
-            auto corner1 = offsets[1];
-            auto corner2 = offsets[2];
-
-            //If we just have to worry about position data since there was no texture or normal data:
-            if (!(faceIter->hasTexCoord() || faceIter->hasNormals())) {
-                //Triangle:
-                auto c0_pos = mPositions_[corner0[POSITION_INDEX]]; //corner 0 _ positions
-                mVertices_.push_back(c0_pos[0]); //corner0 x
-                mVertices_.push_back(c0_pos[1]); //corner0 y
-                mVertices_.push_back(c0_pos[2]); //corner0 z
-                mVertices_.push_back(mScale_);    //zoom / w component of position
-
-                auto c1_pos = mPositions_[corner1[POSITION_INDEX]]; //corner 1 _ positions
-                mVertices_.push_back(c1_pos[0]); //corner1 x
-                mVertices_.push_back(c1_pos[1]); //corner1 y
-                mVertices_.push_back(c1_pos[2]); //corner1 z
-                mVertices_.push_back(mScale_);   //zoom
-
-                auto c2_pos = mPositions_[corner2[POSITION_INDEX]]; //corner 2 _ positions
-                mVertices_.push_back(c2_pos[0]); //corner2 x
-                mVertices_.push_back(c2_pos[1]); //corner2 y
-                mVertices_.push_back(c2_pos[2]); //corner2 z
-                mVertices_.push_back(mScale_);    //zoom / w component of position
+//Each corner is written as position (with the scale as the 'w' component), then the
+//texture coordinates (with 't' flipped for OpenGL) and then the normal, skipping 
+//whichever components the face did not provide.
+void QuickObj::addFaceCornerToVertexData(const AssetLoadingInternal::ParsedFace& face, int corner) {
+    const size_t position = face.positions[corner];
+    mVertices_.push_back(mParsedData_.positions.get(position, 0u)); 
+    mVertices_.push_back(mParsedData_.positions.get(position, 1u)); 
+    mVertices_.push_back(mParsedData_.positions.get(position, 2u)); 
+    mVertices_.push_back(mScale_);    //zoom / w component of position
+
+    if (face.hasTexCoords) {
+        const size_t texCoord = face.texCoords[corner];
+        mVertices_.push_back(mParsedData_.texCoords.get(texCoord, 0u));        //tex coord s
+        mVertices_.push_back(1.0f - mParsedData_.texCoords.get(texCoord, 1u)); //tex coord t
+    }
+    if (face.hasNormals) {
+        const size_t normal = face.normals[corner];
+        mVertices_.push_back(mParsedData_.normals.get(normal, 0u)); //normal x
+        mVertices_.push_back(mParsedData_.normals.get(normal, 1u)); //normal y
+        mVertices_.push_back(mParsedData_.normals.get(normal, 2u)); //normal z
+    }
+}
 
-            }
 
-            else if (faceIter->hasTexCoord()) {
-                if (!(faceIter->hasNormals())) { //Only texture coords, no normals
-                    //Triangle:
-                    auto c0_pos = mPositions_[corner0[POSITION_INDEX]]; //corner 0 _ positions
-                    mVertices_.push_back(c0_pos[0]); //corner0 x
-                    mVertices_.push_back(c0_pos[1]); //corner0 y
-                    mVertices_.push_back(c0_pos[2]); //corner0 z
-                    mVertices_.push_back(mScale_);    //zoom / w component of position
-                    auto c0_tex = mTexCoords_[corner0[TEXTURE_COORD_INDEX]]; //corner 0 _ texture coords
-                    mVertices_.push_back(c0_tex[0]);      //Corner 0 tex coord s
-                    mVertices_.push_back(1.0f-c0_tex[1]); //Corner 0 tex coord t
-
-                    auto c1_pos = mPositions_[corner1[POSITION_INDEX]]; //corner 1 _ positions
-                    mVertices_.push_back(c1_pos[0]); //corner1 x
-                    mVertices_.push_back(c1_pos[1]); //corner1 y
-                    mVertices_.push_back(c1_pos[2]); //corner1 z
-                    mVertices_.push_back(mScale_);   //zoom
-                    auto c1_tex = mTexCoords_[corner1[TEXTURE_COORD_INDEX]]; //corner 1 _ texture coords
-                    mVertices_.push_back(c1_tex[0]);      //Corner 1 tex coord s
-                    mVertices_.push_back(1.0f-c1_tex[1]); //Corner 1 tex coord t
-
-                    auto c2_pos = mPositions_[corner2[POSITION_INDEX]]; //corner 2 _ positions
-                    mVertices_.push_back(c2_pos[0]); //corner2 x
-                    mVertices_.push_back(c2_pos[1]); //corner2 y
-                    mVertices_.push_back(c2_pos[2]); //corner2 z
-                    mVertices_.push_back(mScale_);    //zoom / w component of position
-                    auto c2_tex = mTexCoords_[corner2[TEXTURE_COORD_INDEX]]; //corner 2 _ texture coords
-                    mVertices_.push_back(c2_tex[0]);      //Corner 2 tex coord s
-                    mVertices_.push_back(1.0f-c2_tex[1]); //Corner 2 tex coord t
-                }
-
-                else { //Else we have both Texture and Normal data to deal with
-                       //Triangle:
-                       auto c0_pos = mPositions_[corner0[POSITION_INDEX]]; //corner 0 _ positions
-                       mVertices_.push_back(c0_pos[0]); //corner0 x
-                       mVertices_.push_back(c0_pos[1]); //corner0 y
-                       mVertices_.push_back(c0_pos[2]); //corner0 z
-                       mVertices_.push_back(mScale_);    //zoom / w component of position
-                       auto c0_tex = mTexCoords_[corner0[TEXTURE_COORD_INDEX]]; //corner 0 _ texture coords
-                       mVertices_.push_back(c0_tex[0]);      //Corner 0 tex coord s
-                       mVertices_.push_back(1.0f-c0_tex[1]); //Corner 0 tex coord t
-                       auto c0_nrml = mNormals_[corner0[NORMAL_INDEX]]; // corner 0 _ normal
-                       mVertices_.push_back(c0_nrml[0]); //Corner 0 normal x
-                       mVertices_.push_back(c0_nrml[1]); //Corner 0 normal y
-                       mVertices_.push_back(c0_nrml[2]); //Corner 0 normal z
-
-
-                       auto c1_pos = mPositions_[corner1[POSITION_INDEX]]; //corner 1 _ positions
-                       mVertices_.push_back(c1_pos[0]); //corner1 x
-                       mVertices_.push_back(c1_pos[1]); //corner1 y
-                       mVertices_.push_back(c1_pos[2]); //corner1 z
-                       mVertices_.push_back(mScale_);   //zoom
-                       auto c1_tex = mTexCoords_[corner1[TEXTURE_COORD_INDEX]]; //corner 1 _ texture coords
-                       mVertices_.push_back(c1_tex[0]);      //Corner 1 tex coord s
-                       mVertices_.push_back(1.0f-c1_tex[1]); //Corner 1 tex coord t
-                       auto c1_nrml = mNormals_[corner1[NORMAL_INDEX]]; // corner 1 _ normal
-                       mVertices_.push_back(c1_nrml[0]); //Corner 1 normal x
-                       mVertices_.push_back(c1_nrml[1]); //Corner 1 normal y
-                       mVertices_.push_back(c1_nrml[2]); //Corner 1 normal z
-
-
-                       auto c2_pos = mPositions_[corner2[POSITION_INDEX]]; //corner 2 _ positions
-                       mVertices_.push_back(c2_pos[0]); //corner2 x
-                       mVertices_.push_back(c2_pos[1]); //corner2 y
-                       mVertices_.push_back(c2_pos[2]); //corner2 z
-                       mVertices_.push_back(mScale_);    //zoom / w component of position
-                       auto c2_tex = mTexCoords_[corner2[TEXTURE_COORD_INDEX]]; //corner 2 _ texture coords
-                       mVertices_.push_back(c2_tex[0]);      //Corner 2 tex coord s
-                       mVertices_.push_back(1.0f-c2_tex[1]); //Corner 2 tex coord t
-                       auto c2_nrml = mNormals_[corner2[NORMAL_INDEX]]; // corner 2 _ normal
-                       mVertices_.push_back(c2_nrml[0]); //Corner 2 normal x
-                       mVertices_.push_back(c2_nrml[1]); //Corner 2 normal y
-                       mVertices_.push_back(c2_nrml[2]); //Corner 2 normal z
-                }
-            }
+//Same layout as 'addFaceCornerToVertexData()', except every vertex of the block is written at once. Each
+//component is gathered straight out of its parsed attribute stream into its place within the vertices.
+void QuickObj::gatherCornersIntoVertexData(CornerIndexBlock& block) {
+    if (block.count == 0u)
+        return;
+    const size_t vertexSize = getVertexSize();
+    const size_t firstValue = mVertices_.size();
+    mVertices_.resize(firstValue + (block.count * vertexSize));
+    float * const vertices = mVertices_.data() + firstValue;
 
-            //Else there is just Position and normal data to worry about 
-            else {
-                //Triangle:
-                auto c0_pos = mPositions_[corner0[POSITION_INDEX]]; //corner 0 _ positions
-                mVertices_.push_back(c0_pos[0]); //corner0 x
-                mVertices_.push_back(c0_pos[1]); //corner0 y
-                mVertices_.push_back(c0_pos[2]); //corner0 z
-                mVertices_.push_back(mScale_);    //zoom / w component of position
-                //auto c0_tex = mTexCoords_[corner0[TEXTURE_COORD_INDEX]]; //corner 0 _ texture coords
-                //mVertices_.push_back(c0_tex[0]); //Corner 0 tex coord s
-                //mVertices_.push_back(c0_tex[1]); //Corner 0 tex coord t
-                auto c0_nrml = mNormals_[corner0[NORMAL_INDEX]]; // corner 0 _ normal
-                mVertices_.push_back(c0_nrml[0]); //Corner 0 normal x
-                mVertices_.push_back(c0_nrml[1]); //Corner 0 normal y
-                mVertices_.push_back(c0_nrml[2]); //Corner 0 normal z
-
-
-                auto c1_pos = mPositions_[corner1[POSITION_INDEX]]; //corner 1 _ positions
-                mVertices_.push_back(c1_pos[0]); //corner1 x
-                mVertices_.push_back(c1_pos[1]); //corner1 y
-                mVertices_.push_back(c1_pos[2]); //corner1 z
-                mVertices_.push_back(mScale_);   //zoom
-                //auto c1_tex = mTexCoords_[corner1[TEXTURE_COORD_INDEX]]; //corner 1 _ texture coords
-                //mVertices_.push_back(c1_tex[0]); //Corner 1 tex coord s
-                //mVertices_.push_back(c1_tex[1]); //Corner 1 tex coord t
-                auto c1_nrml = mNormals_[corner1[NORMAL_INDEX]]; // corner 1 _ normal
-                mVertices_.push_back(c1_nrml[0]); //Corner 1 normal x
-                mVertices_.push_back(c1_nrml[1]); //Corner 1 normal y
-                mVertices_.push_back(c1_nrml[2]); //Corner 1 normal z
-
-
-                auto c2_pos = mPositions_[corner2[POSITION_INDEX]]; //corner 2 _ positions
-                mVertices_.push_back(c2_pos[0]); //corner2 x
-                mVertices_.push_back(c2_pos[1]); //corner2 y
-                mVertices_.push_back(c2_pos[2]); //corner2 z
-                mVertices_.push_back(mScale_);    //zoom / w component of position
-                //auto c2_tex = mTexCoords_[corner2[TEXTURE_COORD_INDEX]]; //corner 2 _ texture coords
-                //mVertices_.push_back(c2_tex[0]); //Corner 2 tex coord s
-                //mVertices_.push_back(c2_tex[1]); //Corner 2 tex coord t
-                auto c2_nrml = mNormals_[corner2[NORMAL_INDEX]]; // corner 2 _ normal
-                mVertices_.push_back(c2_nrml[0]); //Corner 2 normal x
-                mVertices_.push_back(c2_nrml[1]); //Corner 2 normal y
-                mVertices_.push_back(c2_nrml[2]); //Corner 2 normal z
-            }
+    mParsedData_.positions.gather(block.positions.data(), block.count, vertices, vertexSize);
+    for (size_t i = 0u; i < block.count; i++)
+        vertices[(i * vertexSize) + OFFSET_TO_W] = mScale_;   //zoom / w component of position
+    size_t offset = POSITION_COMPONENTS;
+
+    if (mHasTexCoords_) {
+        mParsedData_.texCoords.gather(block.texCoords.data(), block.count, vertices + offset, vertexSize);
+        for (size_t i = 0u; i < block.count; i++) {
+            float& t = vertices[(i * vertexSize) + offset + 1u];
+            t = 1.0f - t;   //'t' is flipped for OpenGL
         }
+        offset += TEXTURE_COORDINATE_COMPONENTS;
     }
+    if (mHasNormals_)
+        mParsedData_.normals.gather(block.normals.data(), block.count, vertices + offset, vertexSize);
+    block.count = 0u;
 }
 
-//This function handles parsing vertex data by inserting the numerical values it reads into a 'Vertex' object 
-//and then adding that object to the end of 
-void QuickObj::loadLineIntoVertex(const char * line, std::vector<Vertex>& verts) {
-    float values[3u];
-    int vertComponent = 0;
-    const char * strIter = line;
-
-    while ((*strIter != '\n') && (*strIter != '\0')) {
-        if (isNumber(strIter) || (*strIter == '-')) {
-            if (vertComponent > 2) {
-                fprintf(ERRLOG, "\nERROR! Read too many values!\n");
-                return;
-            }
-            else {
-                char * temp; //see http://www.cplusplus.com/reference/cstdlib/strtof/
-                values[vertComponent++] = strtof(strIter, &temp);
-                strIter = temp;
-            }
+
+
+bool QuickObj::facesHaveUniformComponents() const noexcept {
+    if (mParsedFromConformantFile_) //Guaranteed by the file's stamp
+        return true;
+    for (size_t i = 0u; i < mParsedData_.faces.size(); i++) {
+        if ((mParsedData_.faces.hasTexCoords(i) != mHasTexCoords_) || (mParsedData_.faces.hasNormals(i) != mHasNormals_))
+            return false;
+    }
+    return true;
+}
+
+
+//Each face corner is looked up by its (position, texCoord, normal) index tuple. Only the first
+//appearance of a tuple gets written out as a vertex, every appearance gets written as an index.
+void QuickObj::constructIndexedVerticesFromParsedData() {
+    size_t triangleFaces = 0u;
+    size_t quadFaces = 0u;
+    for (size_t i = 0u; i < mParsedData_.faces.size(); i++) {
+        if (mParsedData_.faces.isQuad(i))
+            quadFaces++;
+        else
+            triangleFaces++;
+    }
+    const size_t linePrimitives = mParsedData_.lineEndpoints.size() / 2u;
+
+    fprintf(MSGLOG, "\n*** Model Statistics ***\nPrimitive Counts:  Lines: %zu\tTriangles: %zu\tQuads: %zu\n",
+        linePrimitives, triangleFaces, quadFaces);
+    fprintf(MSGLOG, "Parsed  Positions: %zu\tTexCoords: %zu\tNormals: %zu\n", mParsedData_.positions.size(),
+        mParsedData_.texCoords.size(), mParsedData_.normals.size());
+
+    //Most meshes end up with roughly as many unique vertices as they have positions
+    AssetLoadingInternal::VertexDeduplicationTable<3u> uniqueVertices(mParsedData_.positions.size());
+    mVertices_.reserve(mParsedData_.positions.size() * getVertexSize());
+    mIndices32_.reserve((quadFaces * VERTICES_IN_A_TRIANGLE * TRIANGLES_IN_A_QUAD) +
+                        ((triangleFaces + linePrimitives) * VERTICES_IN_A_TRIANGLE));
+
+    size_t facesSkipped = 0u;
+    //Every face is known to have the same components, so new vertices are gathered a block at a time
+    std::unique_ptr<CornerIndexBlock> newVertices = std::make_unique<CornerIndexBlock>();
+    auto addCorner = [this, &uniqueVertices, &newVertices](const AssetLoadingInternal::ParsedFace& face, int corner) {
+        const AssetLoadingInternal::VertexDeduplicationTable<3u>::Key key = {
+            face.positions[corner],
+            (face.hasTexCoords ? face.texCoords[corner] : 0u),
+            (face.hasNormals ? face.normals[corner] : 0u) };
+        bool isNewVertex = false;
+        const uint32_t index = uniqueVertices.findOrInsert(key, isNewVertex);
+        if (isNewVertex) {
+            if (!newVertices->hasRoomFor(1u))
+                gatherCornersIntoVertexData(*newVertices);
+            newVertices->add(face, corner);
         }
-        else if (*strIter == ' ') {
-            strIter++;
+        mIndices32_.push_back(index);
+    };
+
+    for (const AssetLoadingInternal::ParsedFace face : mParsedData_.faces) {
+        if (!faceIndicesAreInRange(face)) {
+            facesSkipped++;
+            continue;
+        }
+        if (face.isQuad()) {
+            for (int corner : AssetLoadingInternal::QUAD_TRIANGULATION_CORNERS)
+                addCorner(face, corner);
         }
         else {
-            fprintf(ERRLOG, "\nERROR! Unrecognized data: %s\n", strIter);
+            for (int corner : AssetLoadingInternal::TRIANGLE_CORNERS)
+                addCorner(face, corner);
         }
     }
+    gatherCornersIntoVertexData(*newVertices);
 
-    switch (vertComponent) {
-    case 0:
-        fprintf(ERRLOG, "\nERROR! No data was loaded for the line %s", line);
-        fprintf(ERRLOG, "\nTo keep the vertex ordering intact, a dummy vertex will be substituted!\n");
-        verts.emplace_back(Vertex(0.0f));
-        break;
-    case 1:
-        fprintf(WRNLOG, "\nWarning! Only 1 data value was read from line %s", line);
-        verts.emplace_back(Vertex(values[0])); //emplace_back might be faster than push_back
-        break;
-    case 2:
-        //verts.push_back(Vertex(values[0], values[1]));
-        verts.emplace_back(Vertex(values[0], values[1]));
-        break;
-    case 3:
-        //verts.push_back(Vertex(values[0], values[1], values[2]));
-        verts.emplace_back(Vertex(values[0], values[1], values[2]));
-        break;
-    default:
-        fprintf(ERRLOG, "\nERROR! Too many data values were read for a vertex. Only the first 3 values will be used!\n");
-        verts.emplace_back(Vertex(values[0], values[1], values[2]));
-        break;
+    if (facesSkipped > 0u) {
+        fprintf(ERRLOG, "\nERROR! %zu faces in file \"%s\" referenced vertex data that does not exist!\n"
+            "  [These faces were skipped]\n", facesSkipped, mFile_->getFilepath().c_str());
     }
+
+    mIsIndexed_ = true;
+    fprintf(MSGLOG, "Indexed  Unique Vertices: %zu\tIndices: %zu\n", uniqueVertices.size(), mIndices32_.size());
+}
+
+
+//Used when missing components had to be generated. The fully assembled vertices are compared
+//bit-for-bit, so only vertices which are exactly identical get merged together.
+void QuickObj::convertExpandedVerticesToIndexed() {
+    static constexpr const size_t MAX_VERTEX_SIZE = POSITION_TEXCOORD_NORMAL_TANGENT_VERTEX_SIZE;
+
+    const size_t vertexSize = getVertexSize();
+    if (!verifyVertexComponents(mVertices_.size(), vertexSize)) {
+        fprintf(ERRLOG, "\nERROR! Unable to build an indexed mesh for file \"%s\" because the loaded data\n"
+            "is not made up of whole vertices! The data will be left as expanded vertices.\n", mFile_->getFilepath().c_str());
+        return;
+    }
+    const size_t expandedVertexCount = mVertices_.size() / vertexSize;
+
+    AssetLoadingInternal::VertexDeduplicationTable<MAX_VERTEX_SIZE> uniqueVertices(expandedVertexCount / 2u);
+    std::vector<float> uniqueVertexData;
+    uniqueVertexData.reserve(mVertices_.size() / 2u);
+    mIndices32_.clear();
+    mIndices32_.reserve(expandedVertexCount);
+
+    AssetLoadingInternal::VertexDeduplicationTable<MAX_VERTEX_SIZE>::Key key = {};
+    for (size_t i = 0u; i < expandedVertexCount; i++) {
+        const float * vertex = mVertices_.data() + (i * vertexSize);
+        memcpy(key.data(), vertex, vertexSize * sizeof(float));
+        bool isNewVertex = false;
+        const uint32_t index = uniqueVertices.findOrInsert(key, isNewVertex);
+        if (isNewVertex)
+            uniqueVertexData.insert(uniqueVertexData.end(), vertex, vertex + vertexSize);
+        mIndices32_.push_back(index);
+    }
+
+    fprintf(MSGLOG, "Indexed  %zu expanded vertices down to %zu unique vertices\n", expandedVertexCount, uniqueVertices.size());
+    mVertices_.swap(uniqueVertexData);
+    mIsIndexed_ = true;
+}
+
+
+//The statistics are for a simulated 16-entry FIFO cache, which is smaller than the cache the triangles are
+//ordered for, so that the improvement shown isn't just a product of the simulation matching the optimizer
+void QuickObj::optimizeIndexedMesh(size_t faceIndexCount, MeshOptimization meshOptimization) {
+    const size_t vertexSize = getVertexSize();
+    const size_t vertexCount = mVertices_.size() / vertexSize;
+    faceIndexCount = std::min(faceIndexCount, mIndices32_.size());
+    const AssetLoadingInternal::VertexCacheStatistics before =
+        AssetLoadingInternal::analyzeVertexCache(mIndices32_.data(), faceIndexCount, vertexCount);
+
+    //The draw ranges are worked out from the faces before any vertices exist, so they are clamped to the
+    //indices which were actually produced
+    auto optimizeTriangles = [this, meshOptimization, faceIndexCount, vertexSize, vertexCount](size_t first, size_t count) {
+        first = std::min(first, faceIndexCount);
+        count = std::min(count, faceIndexCount - first);
+        AssetLoadingInternal::optimizeVertexCache(mIndices32_.data() + first, count, vertexCount);
+        if (meshOptimization == MeshOptimization::VERTEX_CACHE_AND_OVERDRAW)
+            AssetLoadingInternal::optimizeOverdraw(mIndices32_.data() + first, count, mVertices_.data(), vertexCount, vertexSize);
+    };
+    if (hasMaterials()) {
+        for (const MaterialDrawRange& range : mMaterialDrawRanges_)
+            optimizeTriangles(range.first, range.count);
+    }
+    else
+        optimizeTriangles(0u, faceIndexCount);
+
+    AssetLoadingInternal::optimizeVertexFetch(mIndices32_.data(), mIndices32_.size(), mVertices_.data(), vertexCount, vertexSize);
+
+    const AssetLoadingInternal::VertexCacheStatistics after =
+        AssetLoadingInternal::analyzeVertexCache(mIndices32_.data(), faceIndexCount, vertexCount);
+    fprintf(MSGLOG, "Optimized the mesh for the vertex cache%s:  ACMR %.3f -> %.3f   ATVR %.3f -> %.3f   "
+        "[%zu -> %zu vertex shader invocations]\n",
+        ((meshOptimization == MeshOptimization::VERTEX_CACHE_AND_OVERDRAW) ? " and overdraw" : ""),
+        before.acmr, after.acmr, before.atvr, after.atvr, before.vertexShaderInvocations, after.vertexShaderInvocations);
 }
 
 
-void QuickObj::addMissingComponents(bool randomizeTextureCoords, float s, float t) {
+void QuickObj::narrowIndicesIfPossible() {
+    if ((!mIsIndexed_) || ((mVertices_.size() / getVertexSize()) > MAX_VERTICES_FOR_16_BIT_INDICES))
+        return;
+    mIndices16_.clear();
+    mIndices16_.reserve(mIndices32_.size());
+    for (const uint32_t index : mIndices32_)
+        mIndices16_.push_back(static_cast<uint16_t>(index));
+    std::vector<uint32_t>().swap(mIndices32_); //Release the 32-bit indices' memory
+}
+
+
+size_t QuickObj::getVertexSize() const noexcept {
+    size_t vertexSize = POSITION_COMPONENTS;
+    if (mHasTexCoords_)
+        vertexSize += TEXTURE_COORDINATE_COMPONENTS;
+    if (mHasNormals_)
+        vertexSize += NORMAL_COMPONENTS;
+    if (mHasTangents_)
+        vertexSize += PACKED_TANGENT_COMPONENTS;
+    return vertexSize;
+}
+
+
+void QuickObj::addMissingComponents(bool randomizeTextureCoords, float s, float t, unsigned int threadCount) {
     
     if (mHasTexCoords_ && mHasNormals_) {
         return; //There is nothing missing, so return
@@ -767,7 +859,7 @@ void QuickObj::addMissingComponents(bool randomizeTextureCoords, float s, float
                 "vertex size (6-components per vertex [4 position + 2 tex])!\n", mFile_->getFilepath().c_str(), loadedDataSize);
             return;
         }
-        generateMissingNormals();
+        generateMissingNormals(threadCount);
     }
     else if (mHasNormals_) {
         if (!verifyVertexComponents(loadedDataSize, POSITION_COMPONENTS + NORMAL_COMPONENTS)) {
@@ -787,7 +879,7 @@ void QuickObj::addMissingComponents(bool randomizeTextureCoords, float s, float
                 "vertex size (4-components expected per vertex [4 position])!\n", mFile_->getFilepath().c_str(), loadedDataSize);
             return;
         }
-        generateMissingTextureCoordsAndNormals(randomizeTextureCoords, s, t);
+        generateMissingTextureCoordsAndNormals(randomizeTextureCoords, s, t, threadCount);
     }
 
     fprintf(MSGLOG, "Missing data was generated for the model loaded from file: %s\n", mFile_->getFilepath().c_str());
@@ -796,54 +888,35 @@ void QuickObj::addMissingComponents(bool randomizeTextureCoords, float s, float
 }
 
 
-//The idea behind this function is to iterate through the loaded data and fill in the missing components
+//The idea behind this function is to iterate through the loaded data and fill in the missing components.
+//The output is sized up front and every vertex is written into its place, rather than pushed back value by value.
 void QuickObj::generateMissingTextureCoords(bool randomizeTextureCoords, float s, float t) {
-
-    int currentVertexComponent = -1; //Will be incremented to 0 in first iteration
-    std::vector<float> verticesWithTexCoords; //Data is to be filled into this vector which will then swap with mVertices_
-    verticesWithTexCoords.reserve( (mVertices_.size()/POSITION_TEXCOORD_VERTEX_SIZE) * POSITION_TEXCOORD_NORMAL_VERTEX_SIZE); //Reserve the required space 
-
-    auto vertsEnd = mVertices_.end(); //Iterator to end of vertices
-    auto vertsBegin = mVertices_.begin(); //Iterator to start of vertices
-    
-    if (!randomizeTextureCoords) {
-        for (auto componentIter = vertsBegin; componentIter != vertsEnd; componentIter++) {
-            currentVertexComponent = ((currentVertexComponent + 1u) % POSITION_NORMAL_VERTEX_SIZE);
-            if (currentVertexComponent == 3) {
-                //Add the fourth position component (scale) to vector
-                verticesWithTexCoords.push_back(*componentIter);
-                //Add the s texture coord to the vector
-                verticesWithTexCoords.push_back(s);
-                //Add the t texture coord to the vector
-                verticesWithTexCoords.push_back(t);
-            }
-            else {
-                verticesWithTexCoords.push_back(*componentIter);
-            }
+    const size_t vertexCount = mVertices_.size() / POSITION_NORMAL_VERTEX_SIZE;
+    std::vector<float> verticesWithTexCoords(vertexCount * POSITION_TEXCOORD_NORMAL_VERTEX_SIZE); //Data is to be filled into this vector which will then swap with mVertices_
+
+    for (size_t i = 0u; i < vertexCount; i++) {
+        const float * const source = mVertices_.data() + (i * POSITION_NORMAL_VERTEX_SIZE);
+        float * const destination = verticesWithTexCoords.data() + (i * POSITION_TEXCOORD_NORMAL_VERTEX_SIZE);
+        //Copy over the position (including the fourth position component, the scale)
+        std::copy_n(source, POSITION_COMPONENTS, destination);
+        //Add the s and t texture coords [the random values are generated s first, then t]
+        if (randomizeTextureCoords) {
+            destination[4] = MathFunc::getRandomInRangef(0.0f, 1.0f);
+            destination[5] = MathFunc::getRandomInRangef(0.0f, 1.0f);
         }
-    }
-    else {
-        for (auto componentIter = vertsBegin; componentIter != vertsEnd; componentIter++) {
-            currentVertexComponent = ((currentVertexComponent + 1u) % POSITION_NORMAL_VERTEX_SIZE);
-            if (currentVertexComponent == 3) {
-                //Add the fourth position component (scale) to vector
-                verticesWithTexCoords.push_back(*componentIter);
-                //Add the random s texture coord to the vector
-                verticesWithTexCoords.push_back(MathFunc::getRandomInRangef(0.0f, 1.0f));
-                //Add the random t texture coord to the vector
-                verticesWithTexCoords.push_back(MathFunc::getRandomInRangef(0.0f, 1.0f));
-            }
-            else {
-                verticesWithTexCoords.push_back(*componentIter);
-            }
+        else {
+            destination[4] = s;
+            destination[5] = t;
         }
+        //Copy over the normal
+        std::copy_n(source + POSITION_COMPONENTS, NORMAL_COMPONENTS, destination + POSITION_COMPONENTS + TEXTURE_COORDINATE_COMPONENTS);
     }
     verticesWithTexCoords.swap(mVertices_);
     mHasTexCoords_ = true;
 }
 
 
-void QuickObj::generateMissingNormals() {
+void QuickObj::generateMissingNormals(unsigned int threadCount) {
     if (!verifyVertexComponents(mVertices_.size(), POSITION_TEXCOORD_VERTEX_SIZE * VERTICES_IN_A_TRIANGLE)) {
         fprintf(ERRLOG, "\nError! Unable to generate triangle normals for model from file: \"%s\"!\n"
             "The data was loaded fine (positions and textures) but the number of values loaded does not match\n"
@@ -853,46 +926,23 @@ void QuickObj::generateMissingNormals() {
         return;
     }
 
-    glm::vec3 v0, v1, v2, computedNormal;
-
-    std::vector<float> verticesWithNormals;
-    verticesWithNormals.reserve((mVertices_.size() / POSITION_TEXCOORD_VERTEX_SIZE) * POSITION_TEXCOORD_NORMAL_VERTEX_SIZE); //Reserve the required space 
-
-
-    //Count the number of triangles for the object
-    size_t numberOfTriangles = (mVertices_.size() / (POSITION_TEXCOORD_VERTEX_SIZE * VERTICES_IN_A_TRIANGLE));
-
-    //Loop through the object's data triangle by triangle
-    for (size_t i = 0u; i < numberOfTriangles; i++) {
-        auto triangleStart = (mVertices_.begin() + (i * (POSITION_TEXCOORD_VERTEX_SIZE * VERTICES_IN_A_TRIANGLE)));
-
-        v0 = glm::vec3(*(triangleStart), *(triangleStart + 1u), *(triangleStart + 2u));  //skip w, s, t (located at indices 3-5)
-        v1 = glm::vec3(*(triangleStart + 6u), *(triangleStart + 7u), *(triangleStart + 8u)); //skip w, s, t (located at indices 9-11)
-        v2 = glm::vec3(*(triangleStart + 12u), *(triangleStart + 13u), *(triangleStart + 14u)); //skip w, s, t (located at indices 15-17)
-
-        computedNormal = MeshFunc::computeNormalizedVertexNormalsForTriangle(v0, v1, v2);
+    const size_t vertexCount = (mVertices_.size() / POSITION_TEXCOORD_VERTEX_SIZE);
+    std::vector<float> verticesWithNormals(vertexCount * POSITION_TEXCOORD_NORMAL_VERTEX_SIZE);
 
-        for (size_t i = 0u; i < VERTICES_IN_A_TRIANGLE; i++) { //For each of the 3 vertices of the triangle
-            //Copy over the existing Position and TexCoord data  
-            verticesWithNormals.push_back(*(triangleStart + (i *  POSITION_TEXCOORD_VERTEX_SIZE)));            //x
-            verticesWithNormals.push_back(*(triangleStart + ((i *  POSITION_TEXCOORD_VERTEX_SIZE) + 1u)));     //y
-            verticesWithNormals.push_back(*(triangleStart + ((i *  POSITION_TEXCOORD_VERTEX_SIZE) + 2u)));     //z
-            verticesWithNormals.push_back(*(triangleStart + ((i *  POSITION_TEXCOORD_VERTEX_SIZE) + 3u)));     //w (aka 'scale')
-            verticesWithNormals.push_back(*(triangleStart + ((i *  POSITION_TEXCOORD_VERTEX_SIZE) + 4u)));     //s
-            verticesWithNormals.push_back(*(triangleStart + ((i *  POSITION_TEXCOORD_VERTEX_SIZE) + 5u)));     //t
-            //Add the 3 components of the computed normal		
-            verticesWithNormals.push_back(computedNormal.x);       
-            verticesWithNormals.push_back(computedNormal.y);
-            verticesWithNormals.push_back(computedNormal.z);
-        }
+    //Copy over the existing Position and TexCoord data (x, y, z, w, s, t) of every vertex
+    for (size_t i = 0u; i < vertexCount; i++) {
+        std::copy_n(mVertices_.data() + (i * POSITION_TEXCOORD_VERTEX_SIZE), POSITION_TEXCOORD_VERTEX_SIZE,
+            verticesWithNormals.data() + (i * POSITION_TEXCOORD_NORMAL_VERTEX_SIZE));
     }
+    //Then add the 3 components of each vertex's normal
+    generateSmoothNormals(verticesWithNormals, threadCount);
 
     verticesWithNormals.swap(mVertices_); 
     mHasNormals_ = true;
 }
 
 
-void QuickObj::generateMissingTextureCoordsAndNormals(bool randomizeTextureCoords, float s, float t) {
+void QuickObj::generateMissingTextureCoordsAndNormals(bool randomizeTextureCoords, float s, float t, unsigned int threadCount) {
     if (!verifyVertexComponents(mVertices_.size(), POSITION_COMPONENTS * VERTICES_IN_A_TRIANGLE)) {
         fprintf(ERRLOG, "\nError! Unable to generate triangle normals for model from file: \"%s\"!\n"
             "The data was loaded fine (positions and textures) but the number of values loaded does not match\n"
@@ -902,73 +952,83 @@ void QuickObj::generateMissingTextureCoordsAndNormals(bool randomizeTextureCoord
         return;
     }
 
+    const size_t vertexCount = (mVertices_.size() / POSITION_VERTEX_SIZE);
+    std::vector<float> verticesWithTexCoordAndNormals(vertexCount * POSITION_TEXCOORD_NORMAL_VERTEX_SIZE);
+
+    for (size_t i = 0u; i < vertexCount; i++) {
+        float * const vertex = verticesWithTexCoordAndNormals.data() + (i * POSITION_TEXCOORD_NORMAL_VERTEX_SIZE);
+        //Copy over the existing Position data (x, y, z, w)
+        std::copy_n(mVertices_.data() + (i * POSITION_VERTEX_SIZE), POSITION_VERTEX_SIZE, vertex);
+        //Add the 2 texture coordinates, generating random ones if requested [s first, then t]
+        if (randomizeTextureCoords) {
+            vertex[4] = MathFunc::getRandomInRangef(0.0f, 1.0f);
+            vertex[5] = MathFunc::getRandomInRangef(0.0f, 1.0f);
+        }
+        else {
+            vertex[4] = s;
+            vertex[5] = t;
+        }
+    }
+    //Then add the 3 components of each vertex's normal
+    generateSmoothNormals(verticesWithTexCoordAndNormals, threadCount);
 
-    glm::vec3 v0, v1, v2, computedNormal;
+    verticesWithTexCoordAndNormals.swap(mVertices_);
+    mHasNormals_ = true;
+    mHasTexCoords_ = true;
+}
 
-    std::vector<float> verticesWithTexCoordAndNormals;
-    verticesWithTexCoordAndNormals.reserve((mVertices_.size() / POSITION_COMPONENTS) * VERTICES_IN_A_TRIANGLE); //Reserve the required space 
 
+//Files without any 's' lines are smoothed as a single group, which leaves it up to the crease angle to
+//decide which edges are hard
+void QuickObj::generateSmoothNormals(std::vector<float>& vertices, unsigned int threadCount) const {
+    const size_t triangleCount = (vertices.size() / (POSITION_TEXCOORD_NORMAL_VERTEX_SIZE * VERTICES_IN_A_TRIANGLE));
+    const std::vector<uint32_t> triangleSmoothingGroups = computeTriangleSmoothingGroups();
+    const bool hasSmoothingGroups = (triangleSmoothingGroups.size() == triangleCount);
+    if (threadCount == AUTOMATIC_PARSE_THREAD_COUNT)
+        threadCount = AssetLoadingInternal::chooseNormalGenerationThreadCount(triangleCount);
 
-    //Count the number of triangles for the object              //4 position-components per vertex * 3 Vertices per triangle => 12 position-components per triangle
-    size_t numberOfTriangles = (mVertices_.size() / (POSITION_COMPONENTS * VERTICES_IN_A_TRIANGLE)); 
+    AssetLoadingInternal::generateVertexNormals(vertices.data(), POSITION_TEXCOORD_NORMAL_VERTEX_SIZE, triangleCount,
+        (hasSmoothingGroups ? triangleSmoothingGroups.data() : nullptr), AssetLoadingInternal::DEFAULT_NORMAL_CREASE_ANGLE,
+        threadCount, vertices.data() + POSITION_COMPONENTS + TEXTURE_COORDINATE_COMPONENTS, POSITION_TEXCOORD_NORMAL_VERTEX_SIZE);
+}
 
-    if (!randomizeTextureCoords ) {
-        //Loop through the object's data triangle by triangle
-        for (size_t i = 0u; i < numberOfTriangles; i++) {
-            auto triangleStart = (mVertices_.begin() + (i * (POSITION_COMPONENTS * VERTICES_IN_A_TRIANGLE)));
 
-            v0 = glm::vec3(*(triangleStart), *(triangleStart + 1u), *(triangleStart + 2u));  //skip w (located at index 3)
-            v1 = glm::vec3(*(triangleStart + 4u), *(triangleStart + 5u), *(triangleStart + 6u)); //skip w (located at index 7)
-            v2 = glm::vec3(*(triangleStart + 8u), *(triangleStart + 9u), *(triangleStart + 10u)); //skip w (located at index 11)
+//The tangents are packed into a single float which is added onto the end of each vertex, so that the vertices
+//only grow from 36 to 40 bytes. Run this before any line primitives are added, every vertex must be part of a triangle.
+void QuickObj::addTangents(unsigned int threadCount) {
+    if ((!mHasTexCoords_) || (!mHasNormals_)) {
+        fprintf(WRNLOG, "\nWarning! Unable to generate tangents for model from file: \"%s\" because it has no %s!\n"
+            "[Load it with 'generateMissingComponents' set to have them generated first]\n", mFile_->getFilepath().c_str(),
+            (mHasTexCoords_ ? "normals" : "texture coordinates"));
+        return;
+    }
+    if (!verifyVertexComponents(mVertices_.size(), POSITION_TEXCOORD_NORMAL_VERTEX_SIZE * VERTICES_IN_A_TRIANGLE)) {
+        fprintf(ERRLOG, "\nError! Unable to generate tangents for model from file: \"%s\"!\n"
+            "The number of values loaded (%zu) does not make up a whole number of triangles!\n", mFile_->getFilepath().c_str(), mVertices_.size());
+        mError_ = true;
+        return;
+    }
 
-            computedNormal = MeshFunc::computeNormalizedVertexNormalsForTriangle(v0, v1, v2);
-            for (size_t j = 0u; j < VERTICES_IN_A_TRIANGLE; j++) { //For each of the 3 vertices of the triangle
-                //Copy over the existing Position data 
-                verticesWithTexCoordAndNormals.push_back(*(triangleStart + (j *  POSITION_VERTEX_SIZE)));            //x
-                verticesWithTexCoordAndNormals.push_back(*(triangleStart + ((j *  POSITION_VERTEX_SIZE) + 1u)));     //y
-                verticesWithTexCoordAndNormals.push_back(*(triangleStart + ((j *  POSITION_VERTEX_SIZE) + 2u)));     //z
-                verticesWithTexCoordAndNormals.push_back(*(triangleStart + ((j *  POSITION_VERTEX_SIZE) + 3u)));     //w (aka 'scale')
-                //Add the 2 texture coordinates
-                verticesWithTexCoordAndNormals.push_back(s);                                                                  //s
-                verticesWithTexCoordAndNormals.push_back(t);                                                                  //t
-                //Add the 3-components of the computed normal
-                verticesWithTexCoordAndNormals.push_back(computedNormal.x);                                                   //normal.x
-                verticesWithTexCoordAndNormals.push_back(computedNormal.y);                                                   //normal.y
-                verticesWithTexCoordAndNormals.push_back(computedNormal.z);                                                   //normal.z
-            }
-        }
-    } 
-
-    else {  //Do the same as above, except instead generate random texture coordinates
-        //Loop through the object's data triangle by triangle
-        for (size_t i = 0u; i < numberOfTriangles; i++) {
-            auto triangleStart = (mVertices_.begin() + (i * (POSITION_COMPONENTS * VERTICES_IN_A_TRIANGLE)));
-
-            v0 = glm::vec3(*(triangleStart), *(triangleStart + 1u), *(triangleStart + 2u));  //skip w (located at index 3)
-            v1 = glm::vec3(*(triangleStart + 4u), *(triangleStart + 5u), *(triangleStart + 6u)); //skip w (located at index 7)
-            v2 = glm::vec3(*(triangleStart + 8u), *(triangleStart + 9u), *(triangleStart + 10u)); //skip w (located at index 11)
-
-            computedNormal = MeshFunc::computeNormalizedVertexNormalsForTriangle(v0, v1, v2);
-            for (size_t i = 0u; i < VERTICES_IN_A_TRIANGLE; i++) { //For each of the 3 vertices of the triangle
-                //Copy over the existing Position data 
-                verticesWithTexCoordAndNormals.push_back(*(triangleStart + (i *  POSITION_VERTEX_SIZE)));            //x
-                verticesWithTexCoordAndNormals.push_back(*(triangleStart + ((i *  POSITION_VERTEX_SIZE) + 1u)));     //y
-                verticesWithTexCoordAndNormals.push_back(*(triangleStart + ((i *  POSITION_VERTEX_SIZE) + 2u)));     //z
-                verticesWithTexCoordAndNormals.push_back(*(triangleStart + ((i *  POSITION_VERTEX_SIZE) + 3u)));     //w (aka 'scale')
-                //Generate random values for then add the 2 texture coordinates
-                verticesWithTexCoordAndNormals.push_back(MathFunc::getRandomInRangef(0.0f, 1.0f));                            //Randomized s
-                verticesWithTexCoordAndNormals.push_back(MathFunc::getRandomInRangef(0.0f, 1.0f));                            //Randomized t
-                //Add the 3-components of the computed normal
-                verticesWithTexCoordAndNormals.push_back(computedNormal.x);                                                   //normal.x
-                verticesWithTexCoordAndNormals.push_back(computedNormal.y);                                                   //normal.y
-                verticesWithTexCoordAndNormals.push_back(computedNormal.z);                                                   //normal.z
-            }
-        }
+    const size_t vertexCount = (mVertices_.size() / POSITION_TEXCOORD_NORMAL_VERTEX_SIZE);
+    const size_t triangleCount = (vertexCount / VERTICES_IN_A_TRIANGLE);
+    if (threadCount == AUTOMATIC_PARSE_THREAD_COUNT)
+        threadCount = AssetLoadingInternal::chooseTangentGenerationThreadCount(triangleCount);
+
+    std::vector<float> tangents(vertexCount * AssetLoadingInternal::TANGENT_COMPONENTS);
+    AssetLoadingInternal::generateTangents(mVertices_.data(), POSITION_TEXCOORD_NORMAL_VERTEX_SIZE, POSITION_COMPONENTS,
+        POSITION_COMPONENTS + TEXTURE_COORDINATE_COMPONENTS, triangleCount, threadCount, tangents.data(), AssetLoadingInternal::TANGENT_COMPONENTS);
+
+    std::vector<float> verticesWithTangents(vertexCount * POSITION_TEXCOORD_NORMAL_TANGENT_VERTEX_SIZE);
+    for (size_t i = 0u; i < vertexCount; i++) {
+        float * const vertex = verticesWithTangents.data() + (i * POSITION_TEXCOORD_NORMAL_TANGENT_VERTEX_SIZE);
+        const float * const tangent = tangents.data() + (i * AssetLoadingInternal::TANGENT_COMPONENTS);
+        std::copy_n(mVertices_.data() + (i * POSITION_TEXCOORD_NORMAL_VERTEX_SIZE), POSITION_TEXCOORD_NORMAL_VERTEX_SIZE, vertex);
+        vertex[POSITION_TEXCOORD_NORMAL_VERTEX_SIZE] = AssetLoadingInternal::packTangent(tangent[0], tangent[1], tangent[2], tangent[3]);
     }
 
-    verticesWithTexCoordAndNormals.swap(mVertices_);
-    mHasNormals_ = true;
-    mHasTexCoords_ = true;
+    verticesWithTangents.swap(mVertices_);
+    mHasTangents_ = true;
+    fprintf(MSGLOG, "Generated tangents for the %zu triangles of the model loaded from file: %s\n", triangleCount, mFile_->getFilepath().c_str());
 }
 
 
@@ -979,22 +1039,33 @@ void QuickObj::addParsedLinePrimitivesToEndOfMeshData() {
         expectedVertexSize += 2u;
     if (mHasNormals_)
         expectedVertexSize += 3u;
+    if (mHasTangents_)
+        expectedVertexSize += PACKED_TANGENT_COMPONENTS;
 
 
-    const size_t MAX_POS_INDEX = mPositions_.size();
+    const size_t MAX_POS_INDEX = mParsedData_.positions.size();
+    const auto& endpoints = mParsedData_.lineEndpoints;
 
-    //For each parsed line primitive
-    for (auto lineIter = mLines_.cbegin(); lineIter != mLines_.cend(); lineIter++) {
-        if (lineIter->dataValid()) { //Only add if data is valid
-            const auto endpoints = lineIter->get();
-            if ((endpoints[0] < MAX_POS_INDEX) && (endpoints[1] < MAX_POS_INDEX)) {
-                Vertex p0 = mPositions_[endpoints[0]];
-                Vertex p1 = mPositions_[endpoints[1]];
+    //For each parsed line segment (every 2 consecutive endpoints form one segment)
+    for (size_t i = 0u; (i + 1u) < endpoints.size(); i += 2u) {
+        if ((endpoints[i] < MAX_POS_INDEX) && (endpoints[i + 1u] < MAX_POS_INDEX)) {
+            const AssetLoadingInternal::PositionStreams::Element e0 = mParsedData_.positions.get(endpoints[i]);
+            const AssetLoadingInternal::PositionStreams::Element e1 = mParsedData_.positions.get(endpoints[i + 1u]);
+            Vertex p0(e0[0], e0[1], e0[2]);
+            Vertex p1(e1[0], e1[1], e1[2]);
 
+            if (mIsIndexed_) { //Both endpoints only need to be written out once
+                const uint32_t p0Index = static_cast<uint32_t>(mVertices_.size() / expectedVertexSize);
+                addLineEndpointToVertexData(p0, expectedVertexSize);
+                addLineEndpointToVertexData(p1, expectedVertexSize);
+                mIndices32_.push_back(p0Index);
+                mIndices32_.push_back(p0Index + 1u);
+                mIndices32_.push_back(p0Index);
+            }
+            else {
                 addLineEndpointToVertexData(p0, expectedVertexSize);
                 addLineEndpointToVertexData(p1, expectedVertexSize);
                 addLineEndpointToVertexData(p0, expectedVertexSize);
-
             }
         }
     }
@@ -1013,6 +1084,8 @@ void QuickObj::addLineEndpointToVertexData(Vertex p, size_t expectedVertexCompon
             mVertices_.push_back(p.wVal());
         else if (i == OFFSET_TO_NRML_X)
             mVertices_.push_back(1.0f);
+        else if (i == POSITION_TEXCOORD_NORMAL_VERTEX_SIZE) //Only reached when there are tangents
+            mVertices_.push_back(AssetLoadingInternal::packTangent(1.0f, 0.0f, 0.0f, 1.0f));
         else
             mVertices_.push_back(0.0f);
     }
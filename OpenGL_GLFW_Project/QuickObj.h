@@ -20,13 +20,39 @@
 //             which are each stored in their own vector and are used to store Line and Face 
 //             data from the Obj file. Note that the actual parsing of the data is done by these
 //             two classes. Final assembly of the data is handled by this class. 
+//
+//        Update (October 2026):
+//             Parsing is now done in a single pass over the file's text by the ObjTokenizer
+//             class. The Line and Face classes are no longer used by QuickObj, the tokenizer
+//             writes plain index data (see 'ParsedFace') straight into an ObjParseResult.
+//             Large files are split into chunks which are tokenized on multiple threads 
+//             (see ParallelObjTokenizer.h).
+//             The final mesh data is also written out to a binary cache file next to the '.obj'
+//             file, so that later loads of an unchanged file can skip parsing entirely (see
+//             ObjMeshCache.h).
+//             Files that have been run through the WavefrontObjConformanceTool are recognized by the
+//             stamp on their first line and are read by a much simpler parser (see ConformantObj.h).
+//             WavefrontObj has also finally been finished. Use it instead of this class when a
+//             model's objects or groups need to be drawn individually.
+//             Materials are now supported. When a file uses materials, its faces are reordered so
+//             that every face using the same material is contiguous, and each material's share of
+//             the mesh is described by a MaterialDrawRange (see 'getMaterialDrawRanges()').
+//             Indexed meshes have their triangles and vertices reordered for the GPU's post-transform
+//             vertex cache before they are cached (see 'MeshOptimization' and MeshOptimizer.h).
+//             Generated normals are now smooth (weighted by each triangle's area and corner angle) instead
+//             of flat, and they follow the file's smoothing groups ('s' lines) and a crease angle so that
+//             hard edges stay hard (see VertexNormalGenerator.h).
+//             Tangents for normal mapping can be generated at load time (see 'generateTangents' and
+//             TangentGenerator.h). They are packed into one extra float at the end of each vertex.
+//             Parsed positions which are equal within a requested tolerance can be welded together before
+//             anything else is built from them (see 'positionWeldTolerance' and VertexWelder.h).
 
 //I am getting the sense that I do not have the time I would like to write
 //the '.obj' wrapper class I would like, so this is a quick and dirty implementation
 //just to get something working. No objects or groups will be marked, and only data 
 //already found in the file will be generated. No fancy functionality, just construct 
 //with a filepath and get the loaded mesh data from the object.
-//No material support either (as of for now)
+//No material support either (as of for now)  [Update: see 'getMaterialDrawRanges()']
 //
 //This class is not safe! It can easily be put into an invalid state through improper use. 
 
@@ -36,9 +62,10 @@
 #ifndef QUCIK_OBJ_H_
 #define QUICK_OBJ_H_
 
-#include "Line.h"           //Used internally by class
-#include "Face.h"           //Used internally by class
+#include "ObjTokenizer.h"   //Used internally by class
 #include "AsciiAsset.h"     //Used internally by class
+#include "ObjMeshCache.h"   //Used internally by class
+#include "WavefrontMtl.h"   //Used to load the materials named by the file
 #include "Vertex.h"         //Used to store data
 
 #include "MathFunctions.h"  //For random number generation
@@ -47,6 +74,45 @@
 
 class QuickObj final{
 public:
+	//Passing this as the parse thread count lets QuickObj decide how many threads to parse with
+	static constexpr const unsigned int AUTOMATIC_PARSE_THREAD_COUNT = 0u;
+	//Passing this as the position weld tolerance leaves every parsed position as it is
+	static constexpr const float NO_POSITION_WELDING = 0.0f;
+
+	//EXPANDED  --  Every corner of every triangle is written out into mVertices_ as its own full vertex,
+	//              ready to be drawn with glDrawArrays(). This is the original behavior.
+	//INDEXED   --  Each unique vertex is written into mVertices_ only once, and the triangles are described
+	//              by an index buffer (see 'uses16BitIndices()'), ready to be drawn with glDrawElements().
+	//              Vertices are deduplicated by their (position, texCoord, normal) index tuple whenever the
+	//              file supplies every component. If components had to be generated, the assembled vertices 
+	//              are instead deduplicated by value [note that randomly generated texture coordinates make 
+	//              every vertex unique, so use constant texture coordinates to get any benefit].
+	enum class OutputFormat { EXPANDED, INDEXED };
+
+	//How an INDEXED mesh gets reordered once it has been built [see MeshOptimizer.h]. These have no effect
+	//on EXPANDED output. The triangles of each material's draw range are only reordered within that range.
+	//The reordering only happens when the file actually gets parsed. With the mesh cache in use, that is the first
+	//load and any load after the file or one of its material libraries has changed, and the reordered mesh is
+	//what gets cached, so loads from the cache never pay for it. Without the cache, every load pays for it.
+	//NONE                        --  Triangles are left in the order of the faces in the file
+	//VERTEX_CACHE                --  Triangles are reordered for the GPU's post-transform vertex cache, then the
+	//                                vertices are reordered into the order the triangles use them
+	//VERTEX_CACHE_AND_OVERDRAW   --  Same as VERTEX_CACHE, plus clusters of triangles are sorted so that the ones
+	//                                facing outwards are drawn first [trades a few cache hits for less overdraw]
+	enum class MeshOptimization { NONE, VERTEX_CACHE, VERTEX_CACHE_AND_OVERDRAW };
+
+	//One material's share of the mesh. Faces are sorted so that each material covers a single contiguous
+	//run of the mesh, which means each material can be drawn with one draw call after one change of state.
+	//The run is measured in vertices for EXPANDED output (for glDrawArrays()) and in indices for INDEXED
+	//output (for glDrawElements()). Materials are in the order they are first used in the file. Faces
+	//appearing before the file's first 'usemtl' line use a material named "default". Materials that
+	//could not be found in any of the file's material libraries are given DEFAULT_PHONG_ILLUMINATION.
+	typedef struct MaterialDrawRange {
+		WavefrontMaterial material;
+		size_t first;
+		size_t count;
+	} MaterialDrawRange;
+
 	//////////////////////////
 	////   Constructors   ////
 	//////////////////////////
@@ -57,17 +123,43 @@ public:
 	//hasTexCoords() and hasNormals() to determine what was loaded from the file. Each loaded vertex will
 	//consist of 4 position components plus 2 texture components (if texture coordinates were part of the loaded 
 	//data) and 3 normal components (if normals were loaded). These values are all interleaved. 
+	//[This constructor never touches the binary mesh cache, so every load parses the file and generates fresh random
+	//texture coordinates. Use one of the constructors below to load through the cache]
 	QuickObj(const std::string filepath, float scale = 1.0f, bool generateMissingComponents = true);
 	//Tries to parse and load the '.obj' resource file into this object's memory. If the object is missing either normal and/or 
 	//texture-coordinate data, appropriate data will be loaded in their place. Normals are computed on a triangle-by-triangle basis. 
 	//Texture coordinates can either be randomly assigned from within the closed interval [0.0, 1.0] or all assigned the same value as 
 	//determined by the parameters s and t. 
+	//The file is parsed using up to 'parseThreadCount' threads. Leave it as AUTOMATIC_PARSE_THREAD_COUNT to have the
+	//thread count chosen based off the size of the file, or use 1 to force the file to be parsed on only the calling thread.
+	//The loaded data is identical no matter how many threads are used.
+	//If 'useMeshCache' is true, the data is loaded from the binary cache next to the '.obj' file when that cache is still 
+	//valid, otherwise the file is parsed and the cache is (re)written afterwards. The exception is a file without texture
+	//coordinates loaded with 'randomizeTextureCoords', which is never cached, so that every load gets fresh random texture
+	//coordinates rather than the ones generated by the first load.
+	//INDEXED meshes are optimized as requested by 'meshOptimization' each time the file is parsed, and the optimized
+	//mesh is what gets written to the cache [a load from the cache is never optimized again].
+	//If 'generateTangents' is true (and the mesh has or generated both texture coordinates and normals), a MikkTSpace
+	//style tangent is packed into an extra float at the end of every vertex [see 'hasTangents()' and TangentGenerator.h].
+	//The tangents are computed once, when the file is parsed, and are stored in the mesh cache along with everything else.
+	//If 'positionWeldTolerance' is greater than 0, parsed positions which are within that tolerance of each other are
+	//welded together before anything is built from them, which reconnects meshes that an exporter split apart by writing
+	//a position out more than once [see VertexWelder.h]. Welding is off unless a tolerance is given.
 	QuickObj(const std::string filepath,
              const float scale,
              const bool generateMissingComponents,
              const bool randomizeTextureCoords = true,
              const float s = 0.5f,
-             const float t = 0.5f);
+             const float t = 0.5f,
+             const unsigned int parseThreadCount = AUTOMATIC_PARSE_THREAD_COUNT,
+             const OutputFormat outputFormat = OutputFormat::EXPANDED,
+             const bool useMeshCache = true,
+             const MeshOptimization meshOptimization = MeshOptimization::VERTEX_CACHE,
+             const bool generateTangents = false,
+             const float positionWeldTolerance = NO_POSITION_WELDING);
+	//Loads the '.obj' resource file in the requested output format. Missing components are generated, 
+	//with missing texture coordinates all assigned the constant value (0.5, 0.5). 
+	QuickObj(const std::string filepath, const float scale, const OutputFormat outputFormat);
 
 
 	//////////////////////////
@@ -83,51 +175,141 @@ public:
 
 	bool hasTexCoords() const { return mHasTexCoords_; }
 	bool hasNormals() const { return mHasNormals_; }
+	//When true, each vertex ends with 1 float holding its packed tangent and bitangent sign, after the 
+	//position, texture coordinates and normal [unpack it with 'PackedTangentDecode.glsl' in a shader]
+	bool hasTangents() const { return mHasTangents_; }
 
 	bool error() const { return mError_; }
 
+	//Returns true if the data was loaded from the binary mesh cache rather than being parsed
+	bool wasLoadedFromCache() const { return mLoadedFromCache_; }
+	//Returns true if the file had been run through the WavefrontObjConformanceTool and was parsed
+	//through the fast path for conformant files
+	bool wasParsedFromConformantFile() const { return mParsedFromConformantFile_; }
+
+	//Returns true if the data was loaded as an indexed mesh
+	bool isIndexed() const { return mIsIndexed_; }
+	//Indices are stored as 16-bit values whenever every vertex can be addressed with 16 bits,
+	//otherwise they are stored as 32-bit values. Only one of mIndices16_ or mIndices32_ is ever used.
+	bool uses16BitIndices() const { return (mIsIndexed_ && mIndices32_.empty()); }
+	size_t getIndexCount() const { return (uses16BitIndices() ? mIndices16_.size() : mIndices32_.size()); }
+	//Returns the number of floats in each vertex of mVertices_
+	size_t getVertexSize() const noexcept;
+
 	//Returns the scale [the 'w' component of each vertex position] of the model.
 	float getScale() const { return mScale_; }
 
+	//Returns true if the file used materials, in which case the mesh data is sorted by material
+	bool hasMaterials() const { return (!mMaterialDrawRanges_.empty()); }
+	//Empty unless the file used materials. Any line primitives come after every range.
+	const std::vector<MaterialDrawRange>& getMaterialDrawRanges() const { return mMaterialDrawRanges_; }
+
 	//The vertices will be public information for fast/easy access. Quick and dirty.
 	//Note that vertices should not be modified by external code (unless you really know 
 	//what you are doing). The reason these are not encapsulated within the class is to 
 	//provide a quick way to access the data with a pointer for OpenGL's C API. 
 	std::vector<float> mVertices_; 
 	std::vector<float> mLineEndpoints_; 
+	//Only filled in for indexed meshes
+	std::vector<uint16_t> mIndices16_;
+	std::vector<uint32_t> mIndices32_;
 
 private:
 	bool mError_;
 	float mScale_; 
 	bool mHasTexCoords_, mHasNormals_;
+	bool mHasTangents_;
+	bool mIsIndexed_;
+	bool mLoadedFromCache_;
+	//Set when the file carried a valid conformance stamp, in which case every face is already known to be
+	//a triangle with in-range indices and the same components as every other face (see ConformantObj.h)
+	bool mParsedFromConformantFile_;
 
 	std::unique_ptr<AssetLoadingInternal::AsciiAsset> mFile_;
-	std::vector<AssetLoadingInternal::Face> mFaces_;
-	std::vector<AssetLoadingInternal::Line> mLines_;
-	
-	std::vector<Vertex> mPositions_;
-	std::vector<Vertex> mTexCoords_;
-	std::vector<Vertex> mNormals_;
-	//This fourth type is probably very rare and won't ever be encountered...
-	//std::vector<Vertex> mFreeformGeometryCoords_; //If line is of format "vp u v w\n", then it is freeform geometry.
-
-	void parseFile();
-	//void preparseFile();
-	void loadLineIntoVertex(const char * line, std::vector<Vertex>& verts);
+	//Holds the positions, texture coordinates, normals, faces and line segments exactly
+	//as they were read from the file (with indices already converted to begin at 0)
+	AssetLoadingInternal::ObjParseResult mParsedData_;
+	//Freeform geometry ("vp u v w\n") is very rare and is skipped by the tokenizer
+	std::vector<MaterialDrawRange> mMaterialDrawRanges_;
+	//Every material library filepath the materials were looked up in, including the ones that weren't found
+	std::vector<std::string> mMaterialLibraryFilepaths_;
+	//The smoothing group of each parsed face (0 is flat shaded), only filled in when normals need to be
+	//generated for a file that has 's' lines. Kept in the same order as the parsed faces.
+	std::vector<uint32_t> mFaceSmoothingGroups_;
+
+	void parseFile(unsigned int parseThreadCount, OutputFormat outputFormat, bool generateMissingComponents, bool generateTangents,
+	               float positionWeldTolerance);
+	//The parse path for files that aren't conformant
+	void tokenizeFile(unsigned int parseThreadCount);
+	//Welds together the parsed positions which are equal within 'tolerance', and points every face and line
+	//endpoint at the welded positions. This gives the mesh back the connections an exporter split apart by
+	//writing a position out more than once (see VertexWelder.h).
+	void weldParsedPositions(float tolerance);
+
+	//Reorders the parsed faces so that every face using the same material is contiguous (keeping each
+	//material's faces in file order) and records each material's draw range. Only call this when the
+	//file has 'usemtl' lines, and call it before any vertices are constructed.
+	void sortFacesByMaterial();
+	//Gives every parsed face the smoothing group from the 's' line before it, with 's off' (or 's 0') and any
+	//faces before the first 's' line being flat shaded. Does nothing if the file has no 's' lines. Call it
+	//before 'sortFacesByMaterial()', which throws away the tags.
+	void assignFaceSmoothingGroups();
+	//Returns the smoothing group of every triangle that the in-range faces expand into (in vertex order), or
+	//an empty vector if the file had no smoothing groups
+	std::vector<uint32_t> computeTriangleSmoothingGroups() const;
+	//Loads every library named on the file's 'mtllib' lines. Relative paths are relative to the '.obj' file.
+	//Every filepath that was looked at (found or not) is recorded in mMaterialLibraryFilepaths_.
+	std::vector<WavefrontMtl> loadMaterialLibraries();
+
+	//Returns true if valid cached data was found and loaded
+	bool loadFromMeshCache(const std::string& filepath, const AssetLoadingInternal::MeshCacheLoadOptions& options);
+	//Writes the loaded data out to the cache. Failing to write the cache is not an error. The material draw
+	//ranges are cached too, along with a stamp of each material library so that changing one replaces the cache.
+	void writeMeshCache(const AssetLoadingInternal::MeshCacheLoadOptions& options) const;
 	void constructVerticesFromParsedData();
 
-	//Helper functions (borrowed from subclasses 'Face' and 'Line'):
-	//Checks to see if a string character is between '0' (i.e. 48u in ASCII) and '9' (i.e. 57u in ASCII) (i.e. if it's a number)
-	inline bool isNumber(const char * c) const { return ((*c >= static_cast<char>(48u)) && (*c <= static_cast<char>(57u))); }
-	//Checks to see if a character is the number '0'  (to make sure a face that might look like "10/0/3" is marked invalid) 
-	inline bool isZero(const char * c) const { return (*c == static_cast<char>(48u)); }
+	/////////////////////////////////////////////////////////////////////
+	// Functions for indexed output
+	/////////////////////////////////////////////////////////////////////
 
-    //TODO verify if this function actually works as intended
-	inline void eatWhitespace(const char * c) {
-		while (*c == ' ') {
-			c++; 
+	//Returns true if every face supplies exactly the components that were found in the file,
+	//which is required to be able to deduplicate vertices by their index tuples
+	bool facesHaveUniformComponents() const noexcept;
+	//Builds the unique vertices and the indices straight from the parsed index tuples, without 
+	//ever expanding the vertices
+	void constructIndexedVerticesFromParsedData();
+	//Converts already-expanded vertices in mVertices_ into unique vertices plus indices
+	void convertExpandedVerticesToIndexed();
+	//Reorders the triangles described by the first 'faceIndexCount' indices of mIndices32_ (which are the
+	//faces, any line primitives come after them) and then reorders the vertices. Reports the simulated
+	//vertex cache statistics from before and after.
+	void optimizeIndexedMesh(size_t faceIndexCount, MeshOptimization meshOptimization);
+	//Moves the indices in mIndices32_ into mIndices16_ if every vertex is addressable with 16 bits
+	void narrowIndicesIfPossible();
+
+	//Returns true if every index used by the face refers to data that was actually parsed
+	bool faceIndicesAreInRange(const AssetLoadingInternal::ParsedFace& face) const noexcept;
+	//Appends the interleaved data for one corner of a face onto the end of mVertices_
+	void addFaceCornerToVertexData(const AssetLoadingInternal::ParsedFace& face, int corner);
+
+	//Face corners waiting to be gathered out of the parsed attribute streams by 'gatherCornersIntoVertexData()'.
+	//Only usable when every face has the same components.
+	struct CornerIndexBlock {
+		static constexpr const size_t CAPACITY = 1536u; //A multiple of the 6 corners a quad expands to
+		std::array<uint32_t, CAPACITY> positions;
+		std::array<uint32_t, CAPACITY> texCoords;
+		std::array<uint32_t, CAPACITY> normals;
+		size_t count = 0u;
+		bool hasRoomFor(size_t corners) const noexcept { return ((count + corners) <= CAPACITY); }
+		void add(const AssetLoadingInternal::ParsedFace& face, int corner) noexcept {
+			positions[count] = face.positions[corner];
+			texCoords[count] = face.texCoords[corner];
+			normals[count] = face.normals[corner];
+			count++;
 		}
-	}
+	};
+	//Appends the interleaved data for every corner in the block onto the end of mVertices_, then empties the block
+	void gatherCornersIntoVertexData(CornerIndexBlock& block);
 
 	//Checks to make sure the number of data points in the vector of vertex data is divisible by
 	//the expected vertex size
@@ -139,8 +321,9 @@ private:
 	// Functions for missing component (normal/textCoord) generation 
 	/////////////////////////////////////////////////////////////////////
 	
-	//Will determine which components are missing and generate them
-	void addMissingComponents(bool randomizeTextureCoords, float s, float t);
+	//Will determine which components are missing and generate them. Normals are generated using up
+	//to 'threadCount' threads (AUTOMATIC_PARSE_THREAD_COUNT picks a count based on the mesh's size).
+	void addMissingComponents(bool randomizeTextureCoords, float s, float t, unsigned int threadCount);
 	
 	//Call this function only once it has been verified that 4-positions and 3-normals
 	//exist for each vertex in mVertices_.
@@ -148,11 +331,17 @@ private:
 
 	//Call this function only once it has been verified that 4-positions and 2-textureCoordinates
 	//exist for each vertex in mVertices_.
-	void generateMissingNormals();
+	void generateMissingNormals(unsigned int threadCount);
 
 	//Call this function only once it has been verified that only 4-positions
 	//exist for each vertex in mVertices_.
-	void generateMissingTextureCoordsAndNormals(bool randomizeTextureCoords, float s, float t);
+	void generateMissingTextureCoordsAndNormals(bool randomizeTextureCoords, float s, float t, unsigned int threadCount);
+	//Fills in the normals (at offset 6 of each 9-float vertex) of the already-expanded triangles in 'vertices'
+	void generateSmoothNormals(std::vector<float>& vertices, unsigned int threadCount) const;
+
+	//Appends a packed tangent onto each of the already-expanded 9-float vertices in mVertices_, using up to
+	//'threadCount' threads (AUTOMATIC_PARSE_THREAD_COUNT picks a count based on the mesh's size)
+	void addTangents(unsigned int threadCount);
 
     void addParsedLinePrimitivesToEndOfMeshData();
 
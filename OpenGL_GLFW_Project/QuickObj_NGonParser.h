@@ -1,6 +1,8 @@
 
 //WARNING! 
-//This feature is incomplete and (Probably) not used anywhere within the QuickObj implementation.
+//This feature is incomplete and is not used anywhere within the QuickObj implementation.
+//[October 2026: N-gons are now supported by QuickObj. The ObjTokenizer stores every corner of an
+// n-gon and NGonTriangulator splits them into triangles. This file is only kept for reference.]
 
 //Experimental code for parsing ngon's (i.e. faces of more than 4 vertices). 
 
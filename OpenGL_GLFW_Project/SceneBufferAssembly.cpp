@@ -0,0 +1,105 @@
+// File:           SceneBufferAssembly.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   4 vertices take up exactly 'vertexStride' groups of 4 floats, so the offsets to add to
+//                          4 vertices at a time are laid out once per object as an 'offset pattern' of that many
+//                          floats. Every float which isn't part of a position gets -0.0 added to it rather than
+//                          0.0, since x + (-0.0) is exactly x for every x [where -0.0 + 0.0 would come out as 0.0],
+//                          so the rest of the vertex is copied over bit for bit.
+//
+//                          The SSE and scalar paths add the same pattern to the same floats, so they always give
+//                          the same results. The vertices left over after the last group of 4 use the scalar path.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "SceneBufferAssembly.h"
+
+#include <algorithm>
+
+#include "ParallelRanges.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define SCENE_BUFFER_ASSEMBLY_USE_SSE2_ 1
+#endif
+
+namespace AssetLoadingInternal {
+
+    namespace {
+
+        static constexpr const size_t VERTICES_PER_GROUP = 4u;
+
+        //Lays out the offsets to add to a group of 4 of the object's vertices
+        void fillOffsetPattern(const SceneBufferObject& object, size_t vertexStride, std::vector<float>& pattern) {
+            pattern.assign(VERTICES_PER_GROUP * vertexStride, -0.0f);
+            for (size_t vertex = 0u; vertex < VERTICES_PER_GROUP; vertex++) {
+                for (size_t axis = 0u; axis < 3u; axis++)
+                    pattern[(vertex * vertexStride) + axis] = object.positionOffset[axis];
+            }
+        }
+
+        //Copies 'floatCount' floats, which begin at the start of a vertex, adding the pattern along the way
+        void copyWithOffsets(const float * source, float * destination, size_t floatCount, const std::vector<float>& pattern) {
+            const size_t patternSize = pattern.size();
+            size_t copied = 0u;
+#ifdef SCENE_BUFFER_ASSEMBLY_USE_SSE2_
+            for ( ; (copied + patternSize) <= floatCount; copied += patternSize) {
+                for (size_t i = 0u; i < patternSize; i += 4u) {
+                    const __m128 values = _mm_loadu_ps(source + copied + i);
+                    _mm_storeu_ps(destination + copied + i, _mm_add_ps(values, _mm_loadu_ps(pattern.data() + i)));
+                }
+            }
+#endif //SCENE_BUFFER_ASSEMBLY_USE_SSE2_
+            for (size_t i = 0u; copied < floatCount; copied++, i = ((i + 1u) % patternSize))
+                destination[copied] = (source[copied] + pattern[i]);
+        }
+
+        //Copies every vertex in [beginVertex, endVertex) of the scene buffer from whichever objects they belong to
+        void assembleRange(const SceneBufferObject * objects, size_t objectCount, const std::vector<size_t>& firstVertices,
+                           size_t vertexStride, float * destination, size_t beginVertex, size_t endVertex) {
+            //The first object which ends past beginVertex
+            size_t object = static_cast<size_t>(std::upper_bound(firstVertices.cbegin(), firstVertices.cbegin() + objectCount,
+                                                                 beginVertex) - firstVertices.cbegin());
+            object = ((object > 0u) ? (object - 1u) : 0u);
+
+            std::vector<float> pattern;
+            for ( ; (object < objectCount) && (firstVertices[object] < endVertex); object++) {
+                const size_t first = std::max(firstVertices[object], beginVertex);
+                const size_t last = std::min(firstVertices[object] + objects[object].vertexCount, endVertex);
+                if (first >= last)
+                    continue;
+                fillOffsetPattern(objects[object], vertexStride, pattern);
+                copyWithOffsets(objects[object].vertices + ((first - firstVertices[object]) * vertexStride),
+                                destination + (first * vertexStride), (last - first) * vertexStride, pattern);
+            }
+        }
+
+    } //namespace
+
+
+    size_t computeSceneBufferLayout(const SceneBufferObject * objects, size_t objectCount, std::vector<size_t>& firstVertices) {
+        firstVertices.resize(objectCount);
+        size_t vertexCount = 0u;
+        for (size_t object = 0u; object < objectCount; object++) {
+            firstVertices[object] = vertexCount;
+            vertexCount += objects[object].vertexCount;
+        }
+        return vertexCount;
+    }
+
+    void assembleSceneBuffer(const SceneBufferObject * objects, size_t objectCount, const std::vector<size_t>& firstVertices,
+                             size_t vertexStride, float * destination, unsigned int threadCount) {
+        if ((objectCount == 0u) || (vertexStride < 3u) || (firstVertices.size() < objectCount))
+            return;
+        const size_t vertexCount = (firstVertices[objectCount - 1u] + objects[objectCount - 1u].vertexCount);
+        if (threadCount == AUTOMATIC_ASSEMBLY_THREAD_COUNT)
+            threadCount = chooseParallelThreadCount(vertexCount, MIN_VERTICES_PER_ASSEMBLY_THREAD);
+
+        runInParallelRanges(countParallelRanges(threadCount, vertexCount), vertexCount, [&](size_t, size_t begin, size_t end) {
+            assembleRange(objects, objectCount, firstVertices, vertexStride, destination, begin, end);
+        });
+    }
+
+} //namespace AssetLoadingInternal
@@ -0,0 +1,55 @@
+// File:           SceneBufferAssembly.h
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Puts the vertices of many objects together into 1 scene buffer, moving each object's
+//                 positions to where it was placed in the scene along the way. This is done in 2 phases:
+//                      1)  computeSceneBufferLayout() works out where each object's vertices start in the
+//                          scene buffer [a prefix sum of the objects' vertex counts], and so how big the scene
+//                          buffer needs to be.
+//                      2)  assembleSceneBuffer() copies every object into a buffer which is already that big,
+//                          adding the object's offset to its positions as it goes.
+//                 Since the buffer never grows while it is being filled, the copy can be split up across
+//                 threads by vertex [so even a scene of 1 huge object gets split up], and each thread copies 4
+//                 vertices at a time with SSE instructions. There is a scalar path which gives the same results
+//                 on platforms without SSE2.
+//
+// Vertices:       Every object's vertices have to be the same size, with the position in the first 3 floats.
+//                 Everything else about the vertices is copied over exactly as it is.
+
+#pragma once
+
+#ifndef SCENE_BUFFER_ASSEMBLY_H_
+#define SCENE_BUFFER_ASSEMBLY_H_
+
+#include <cstddef>
+#include <vector>
+
+namespace AssetLoadingInternal {
+
+    //Passing this as the thread count lets assembly decide how many threads to use
+    static constexpr const unsigned int AUTOMATIC_ASSEMBLY_THREAD_COUNT = 0u;
+
+    //Fewer vertices per thread than this aren't worth the cost of starting the thread
+    static constexpr const size_t MIN_VERTICES_PER_ASSEMBLY_THREAD = 65536u;
+
+    //An object to be placed into the scene buffer
+    typedef struct SceneBufferObject {
+        const float * vertices;
+        size_t vertexCount;
+        float positionOffset[3];  //Added to each of the object's positions
+    } SceneBufferObject;
+
+    //Phase 1. Fills 'firstVertices' with the vertex each object starts at in the scene buffer, and returns how
+    //many vertices the scene buffer needs to hold.
+    size_t computeSceneBufferLayout(const SceneBufferObject * objects, size_t objectCount, std::vector<size_t>& firstVertices);
+
+    //Phase 2. Copies each object into 'destination' at the vertex phase 1 gave it. 'destination' has to have room for
+    //every vertex phase 1 counted, each 'vertexStride' (at least 3) floats.
+    void assembleSceneBuffer(const SceneBufferObject * objects, size_t objectCount, const std::vector<size_t>& firstVertices,
+                             size_t vertexStride, float * destination, unsigned int threadCount = AUTOMATIC_ASSEMBLY_THREAD_COUNT);
+
+} //namespace AssetLoadingInternal
+
+#endif //SCENE_BUFFER_ASSEMBLY_H_
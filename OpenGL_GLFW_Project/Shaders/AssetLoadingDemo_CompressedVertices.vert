@@ -0,0 +1,93 @@
+//Vertex Shader for the asset loading demo when its meshes are uploaded in the compressed
+//vertex format [see CompressedVertexFormat.h]. This is the 'BASIC_VERT' shader from
+//AssetLoadingDemo.vert with the attributes decoded first, so it pairs with AssetLoadingDemo.frag.
+//
+//Requires 'CompressedVertexDecode.glsl' and 'ShaderNoiseFunctions.glsl' to be attached
+//as secondary vertex shaders.
+//
+// Programmer:  Forrest Miller
+// Date:        October 2026
+
+#version 450 core
+
+//Determines how many unique VertexID values will be possible 
+//for effects that have a repeating per-vertex pattern
+#define VERTEX_ID_MOD_VALUE 46   
+
+//What the input data looks like [already expanded into floats by the GPU]
+layout(location = 0) in vec3 CompressedPosition;  //unorm16, relative to the bounding box
+layout(location = 1) in vec2 ModelTexCoord;       //half float
+layout(location = 2) in vec2 CompressedNormal;    //snorm16, octahedral encoded
+
+//What our Vertex Shader output should look like 
+//(this struct represents a single vertex)
+out VERTEX_SHADER_OUTPUT {  
+    float vertID;
+    float vertIDMod;
+    float instanceID;
+    vec4 position;
+    vec2 texCoord;
+    vec3 normal;
+} processed_vertex;
+
+
+//Some parameters that are passed in by the Application
+uniform float zoom;
+uniform float time;
+uniform mat4 rotation;
+uniform mat4 MVP;
+
+uniform uint customParameter1, customParameter2, customParameter3;
+const float noiseAmpl_A = 1.0 + (float(customParameter2) * 0.5);
+const float noiseAmpl_B = 1.0 + (float(customParameter3) * 0.1);
+const float noiseAmpl = noiseAmpl_A*noiseAmpl_B;
+
+#define vert float(1+gl_VertexID)
+#define vertMod float(getVertIDMod(gl_VertexID))
+#define inst float(gl_InstanceID+1)
+
+///////////////////////////////////////////////////////////////////////////
+// EXTERNAL FUNCTION PROTOTYPES  [for decoding]
+///////////////////////////////////////////////////////////////////////////
+vec4 decodeCompressedPosition(in vec3 quantizedPosition);
+vec3 decodeOctahedralNormal(in vec2 encoded);
+
+///////////////////////////////////////////////////////////////////////////
+// EXTERNAL FUNCTION PROTOTYPES  [for noise]
+///////////////////////////////////////////////////////////////////////////
+float pNoise(vec2 p, int res); //2d Perlin
+float cnoise(vec4 P);          //4d Periodic Classic Perlin Noise
+
+
+// Computes the VertexIDMod value
+int getVertIDMod(in int vertexID) {
+    return (vertexID % int(VERTEX_ID_MOD_VALUE)) + 1;
+}
+
+
+void main() {
+    const vec4 ModelPosition = decodeCompressedPosition(CompressedPosition);
+    const vec3 ModelNormal = decodeOctahedralNormal(CompressedNormal);
+
+    processed_vertex.vertID = vert;
+    processed_vertex.vertIDMod = vertMod;
+    processed_vertex.instanceID = inst;
+    processed_vertex.texCoord = ModelTexCoord;
+    processed_vertex.normal = mat3(rotation) * ModelNormal;
+
+    vec3 instanceDisplacement = vec3(0.0);
+
+    if (gl_InstanceID != 0) {
+        const float instanceDistanceAmplitude = 0.45 * inst;
+        const vec3 instanceDisplacementVector = vec3(cos(1.75*(time * (0.31*pow(1.05, inst-1.)))),
+                                                     sin(1.25*(time * (0.1*pNoise(vec2(inst-1., exp(inst)), int(customParameter3))))),
+                                                     0.033);
+        instanceDisplacement = instanceDistanceAmplitude * instanceDisplacementVector; 
+    }
+    processed_vertex.position = MVP * (ModelPosition + vec4(instanceDisplacement, zoom));
+
+    gl_Position = (1. + 0.001*inst)*processed_vertex.position;
+    gl_Position.z = clamp(gl_Position.z, -1.0, 1.0);
+
+    gl_PointSize = max(1.0, abs(1.0/vertMod + cos(vertMod*time*max(1.0, pow(vertMod, noiseAmpl))) * (cnoise(2.0*vec4(2.5*processed_vertex.position.xy, 5.0 * sin(0.25*(time + vertMod)), cos(0.25*(time + vertMod * 3.14/2.0)))))));
+}
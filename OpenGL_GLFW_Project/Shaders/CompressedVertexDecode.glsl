@@ -0,0 +1,35 @@
+//File:   CompressedVertexDecode.glsl
+//
+//Quick Description:    Functions for undoing the packing done by CompressedVertexFormat.h on the C++ side. By
+//                      the time a compressed vertex reaches the shader the GPU has already expanded its
+//                      normalized integers into floats in the range [0, 1] (positions) or [-1, 1] (normals)
+//                      and its half float texture coordinates into full floats, so all that is left to do
+//                      here is to put the positions back into the model's bounding box and to unfold the
+//                      octahedral normals.
+//
+//Shader Type:  Vertex   [This file needs to be attached to the ShaderProgram as a secondary vertex shader]
+//
+//Programmer:   Forrest Miller
+//Date:         October 2026
+
+#version 450 core
+
+//Set by the Application from CompressedVertexFormat::DecodeParameters
+uniform vec3 compressedPositionMin;
+uniform vec3 compressedPositionExtent;
+uniform float compressedVertexScale;
+
+//Expands a quantized position (each component between 0 and 1) back into model space. The 'w' component
+//of the result is the model's scale, just like the 'w' of the uncompressed vertices.
+vec4 decodeCompressedPosition(in vec3 quantizedPosition) {
+    return vec4(compressedPositionMin + (quantizedPosition * compressedPositionExtent), compressedVertexScale);
+}
+
+//Unfolds an octahedral encoded normal (each component between -1 and 1) back into a unit vector
+vec3 decodeOctahedralNormal(in vec2 encoded) {
+    vec3 n = vec3(encoded, 1.0 - abs(encoded.x) - abs(encoded.y));
+    const float t = max(-n.z, 0.0);
+    n.x += (n.x >= 0.0) ? -t : t;
+    n.y += (n.y >= 0.0) ? -t : t;
+    return normalize(n);
+}
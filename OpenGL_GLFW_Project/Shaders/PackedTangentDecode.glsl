@@ -0,0 +1,32 @@
+//File:   PackedTangentDecode.glsl
+//
+//Quick Description:    Unpacks the tangents that TangentGenerator.h packs into a single float per vertex. The
+//                      integer part of the packed value holds the tangent's octahedral encoded direction as
+//                      2 x 11 bits (plus 1, so that the value is never 0), and its sign is the bitangent sign.
+//                      The bitangent is rebuilt from the normal and the tangent the same way MikkTSpace does it.
+//
+//Shader Type:  Vertex   [This file needs to be attached to the ShaderProgram as a secondary vertex shader]
+//
+//Programmer:   Forrest Miller
+//Date:         October 2026
+
+#version 450 core
+
+//Returns the unit tangent in xyz and the bitangent sign in w
+vec4 decodePackedTangent(in float packedTangent) {
+    const float quantized = abs(packedTangent) - 1.0;
+    const float qy = floor(quantized / 2048.0);
+    const float qx = quantized - (qy * 2048.0);
+    vec3 t = vec3(vec2(qx, qy) * (2.0 / 2047.0) - 1.0, 0.0);
+    t.z = 1.0 - abs(t.x) - abs(t.y);
+    const float fold = max(-t.z, 0.0);
+    t.x += (t.x >= 0.0) ? -fold : fold;
+    t.y += (t.y >= 0.0) ? -fold : fold;
+    return vec4(normalize(t), (packedTangent < 0.0) ? -1.0 : 1.0);
+}
+
+//Rebuilds the bitangent  [MikkTSpace bakers expect this to be done with the interpolated normal and tangent
+//before either of them is renormalized, which is what makes the result match the baked normal map exactly]
+vec3 computeBitangent(in vec3 normal, in vec4 tangent) {
+    return tangent.w * cross(normal, tangent.xyz);
+}
@@ -0,0 +1,256 @@
+// File:           StreamingObjLoader.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   The buffer is allocated with 1 byte more than its usable size. If the stream's
+//                          last line doesn't end with a newline, that spare byte is where one gets added
+//                          (the ObjTokenizer requires its text to end with '\n').
+//
+//                          The partial line at the end of the buffer is moved rather than having the buffer
+//                          wrap around like a true ring buffer, since the tokenizer needs each line to be
+//                          contiguous. It is at most 1 line, so the move is cheap.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "StreamingObjLoader.h"
+
+#include <algorithm>
+#include <cstring>   //memmove
+#include <fstream>
+#include <limits>
+
+#include "NGonTriangulator.h"
+
+namespace {
+    static constexpr const size_t POSITION_COMPONENTS = 4u;
+    static constexpr const size_t TEXTURE_COORDINATE_COMPONENTS = 2u;
+    static constexpr const size_t NORMAL_COMPONENTS = 3u;
+
+    //Used in a vertex's key in place of a component that isn't part of the vertex
+    static constexpr const uint32_t MISSING_COMPONENT = std::numeric_limits<uint32_t>::max();
+
+    //A buffer's worth of text usually holds about this many unique vertices
+    static constexpr const size_t EXPECTED_BYTES_PER_BATCH_VERTEX = 64u;
+}
+
+
+StreamingObjLoader::StreamingObjLoader(size_t bufferBytes, float scale) :
+    mBatchVertices_(std::max(bufferBytes, MIN_BUFFER_BYTES) / EXPECTED_BYTES_PER_BATCH_VERTEX) {
+    mScale_ = scale;
+    mBuffer_.resize(std::max(bufferBytes, MIN_BUFFER_BYTES) + 1u);
+    resetForNewLoad();
+}
+
+
+bool StreamingObjLoader::loadFile(const std::string& filepath, const BatchSink& sink) {
+    std::ifstream file(filepath, std::ios::in | std::ios::binary);
+    if (!file) {
+        fprintf(ERRLOG, "\nERROR! Unable to open the file \"%s\" for streaming!\n", filepath.c_str());
+        return false;
+    }
+    return load(file, sink, filepath);
+}
+
+
+bool StreamingObjLoader::load(std::istream& input, const BatchSink& sink, std::string_view nameForMessages) {
+    resetForNewLoad();
+
+    AssetLoadingInternal::ObjTokenizer tokenizer(nameForMessages);
+    char * const buffer = mBuffer_.data();
+    const size_t capacity = mBuffer_.size() - 1u; //Leaves room for a final '\n'
+    size_t carried = 0u;            //Bytes of a partial line at the front of the buffer
+    size_t nextLineNumber = 1u;
+    bool skippingLongLine = false;
+
+    while (true) {
+        input.read(buffer + carried, static_cast<std::streamsize>(capacity - carried));
+        const size_t bytesReceived = static_cast<size_t>(input.gcount());
+        const bool endOfInput = (bytesReceived < (capacity - carried));
+        if (input.bad()) {
+            fprintf(ERRLOG, "\nERROR! Reading from \"%.*s\" failed after %zu bytes!\n",
+                static_cast<int>(nameForMessages.length()), nameForMessages.data(), mBytesRead_);
+            return false;
+        }
+        mBytesRead_ += bytesReceived;
+        size_t filled = carried + bytesReceived;
+
+        if (skippingLongLine) {
+            //Everything up to the next newline still belongs to the line that was too long
+            const char * newline = static_cast<const char *>(memchr(buffer, '\n', filled));
+            if (newline == nullptr) {
+                carried = 0u;
+                if (endOfInput)
+                    break;
+                continue;
+            }
+            skippingLongLine = false;
+            nextLineNumber++;
+            const size_t skipped = static_cast<size_t>(newline - buffer) + 1u;
+            memmove(buffer, buffer + skipped, filled - skipped);
+            filled -= skipped;
+        }
+
+        if (endOfInput && (filled > 0u) && (buffer[filled - 1u] != '\n'))
+            buffer[filled++] = '\n';
+
+        size_t completeBytes = filled;
+        while ((completeBytes > 0u) && (buffer[completeBytes - 1u] != '\n'))
+            completeBytes--;
+
+        if ((completeBytes == 0u) && (filled == capacity)) {
+            fprintf(ERRLOG, "\nERROR! Line %zu of \"%.*s\" is longer than the %zu byte stream buffer! [The line was skipped]\n",
+                nextLineNumber, static_cast<int>(nameForMessages.length()), nameForMessages.data(), capacity);
+            mLinesWithErrors_++;
+            skippingLongLine = true;
+            carried = 0u;
+            continue;
+        }
+
+        if (completeBytes > 0u) {
+            const std::string_view lines(buffer, completeBytes);
+            mLinesWithErrors_ += tokenizer.tokenize(lines, mParsedData_, nextLineNumber);
+            nextLineNumber += static_cast<size_t>(std::count(lines.cbegin(), lines.cend(), '\n'));
+            emitBatch(sink);
+        }
+
+        carried = filled - completeBytes;
+        if (carried > 0u)
+            memmove(buffer, buffer + completeBytes, carried);
+        if (endOfInput)
+            break;
+    }
+
+    mVertexPoolBytes_ = (mParsedData_.positions.capacityInBytes() + mParsedData_.texCoords.capacityInBytes() +
+        mParsedData_.normals.capacityInBytes());
+    //The pools are only needed while loading, so their memory is released here
+    mParsedData_ = AssetLoadingInternal::ObjParseResult();
+
+    if (mFacesSkipped_ > 0u) {
+        fprintf(ERRLOG, "\nERROR! %zu faces in \"%.*s\" referenced vertex data that does not exist!\n"
+            "  [These faces were skipped]\n", mFacesSkipped_, static_cast<int>(nameForMessages.length()), nameForMessages.data());
+    }
+    if (mIndicesEmitted_ == 0u) {
+        fprintf(ERRLOG, "\nERROR! No faces could be loaded from \"%.*s\"!\n",
+            static_cast<int>(nameForMessages.length()), nameForMessages.data());
+        return false;
+    }
+    return true;
+}
+
+
+void StreamingObjLoader::resetForNewLoad() {
+    mParsedData_ = AssetLoadingInternal::ObjParseResult();
+    mLayoutDecided_ = false;
+    mHasTexCoords_ = false;
+    mHasNormals_ = false;
+    mVertexSize_ = POSITION_COMPONENTS;
+    mBytesRead_ = 0u;
+    mBatchCount_ = 0u;
+    mVerticesEmitted_ = 0u;
+    mIndicesEmitted_ = 0u;
+    mLinesWithErrors_ = 0u;
+    mFacesSkipped_ = 0u;
+    mVertexPoolBytes_ = 0u;
+}
+
+
+void StreamingObjLoader::emitBatch(const BatchSink& sink) {
+    if (mParsedData_.faces.empty())
+        return;
+
+    //Every position an n-gon in this batch can refer to has already been read
+    if (mParsedData_.nGons.size() > 0u)
+        AssetLoadingInternal::triangulateNGons(mParsedData_);
+
+    if (!mLayoutDecided_) {
+        mHasTexCoords_ = mParsedData_.hasTexCoords;
+        mHasNormals_ = mParsedData_.hasNormals;
+        mVertexSize_ = POSITION_COMPONENTS + (mHasTexCoords_ ? TEXTURE_COORDINATE_COMPONENTS : 0u) +
+            (mHasNormals_ ? NORMAL_COMPONENTS : 0u);
+        mLayoutDecided_ = true;
+    }
+
+    mBatchVertices_.clear();
+    mBatchVertexData_.clear();
+    mBatchIndices_.clear();
+
+    for (const AssetLoadingInternal::ParsedFace face : mParsedData_.faces) {
+        if (!faceIndicesAreInRange(face)) {
+            mFacesSkipped_++;
+            continue;
+        }
+        if (face.isQuad()) {
+            for (int corner : AssetLoadingInternal::QUAD_TRIANGULATION_CORNERS)
+                addFaceCorner(face, corner);
+        }
+        else {
+            for (int corner : AssetLoadingInternal::TRIANGLE_CORNERS)
+                addFaceCorner(face, corner);
+        }
+    }
+
+    //The pools are kept, but everything else parsed from this piece of the stream is done with
+    mParsedData_.faces.clear();
+    mParsedData_.lineEndpoints.clear();
+    mParsedData_.subMeshTags.clear();
+    mParsedData_.materialLibraries.clear();
+
+    if (mBatchIndices_.empty())
+        return;
+
+    const size_t vertexCount = mBatchVertexData_.size() / mVertexSize_;
+    const StreamedMeshBatch batch = { mBatchVertexData_.data(), vertexCount, mVertexSize_,
+        mBatchIndices_.data(), mBatchIndices_.size(), mHasTexCoords_, mHasNormals_, mBatchCount_ };
+    sink(batch);
+
+    mBatchCount_++;
+    mVerticesEmitted_ += vertexCount;
+    mIndicesEmitted_ += mBatchIndices_.size();
+}
+
+
+void StreamingObjLoader::addFaceCorner(const AssetLoadingInternal::ParsedFace& face, int corner) {
+    const bool useTexCoord = (mHasTexCoords_ && face.hasTexCoords);
+    const bool useNormal = (mHasNormals_ && face.hasNormals);
+    const AssetLoadingInternal::VertexDeduplicationTable<3u>::Key key = {
+        static_cast<uint32_t>(face.positions[corner]),
+        (useTexCoord ? static_cast<uint32_t>(face.texCoords[corner]) : MISSING_COMPONENT),
+        (useNormal ? static_cast<uint32_t>(face.normals[corner]) : MISSING_COMPONENT) };
+    bool isNewVertex = false;
+    mBatchIndices_.push_back(mBatchVertices_.findOrInsert(key, isNewVertex));
+    if (!isNewVertex)
+        return;
+
+    const AssetLoadingInternal::PositionStreams::Element position = mParsedData_.positions.get(face.positions[corner]);
+    mBatchVertexData_.insert(mBatchVertexData_.end(), { position[0], position[1], position[2], mScale_ });
+    if (mHasTexCoords_) {
+        if (useTexCoord) {
+            const AssetLoadingInternal::TexCoordStreams::Element texCoord = mParsedData_.texCoords.get(face.texCoords[corner]);
+            mBatchVertexData_.insert(mBatchVertexData_.end(), { texCoord[0], 1.0f - texCoord[1] }); //'t' is flipped for OpenGL
+        }
+        else
+            mBatchVertexData_.insert(mBatchVertexData_.end(), { 0.0f, 0.0f });
+    }
+    if (mHasNormals_) {
+        if (useNormal) {
+            const AssetLoadingInternal::NormalStreams::Element normal = mParsedData_.normals.get(face.normals[corner]);
+            mBatchVertexData_.insert(mBatchVertexData_.end(), { normal[0], normal[1], normal[2] });
+        }
+        else
+            mBatchVertexData_.insert(mBatchVertexData_.end(), { 0.0f, 0.0f, 0.0f });
+    }
+}
+
+
+//Faces can only refer to vertices which were read before them, so anything out of range now
+//will never come into range
+bool StreamingObjLoader::faceIndicesAreInRange(const AssetLoadingInternal::ParsedFace& face) const noexcept {
+    for (int i = 0; i < face.vertexCount; i++) {
+        if ((face.positions[i] >= mParsedData_.positions.size()) ||
+            (face.hasTexCoords && (face.texCoords[i] >= mParsedData_.texCoords.size())) ||
+            (face.hasNormals && (face.normals[i] >= mParsedData_.normals.size())))
+            return false;
+    }
+    return true;
+}
@@ -0,0 +1,129 @@
+// File:           StreamingObjLoader.h
+// Class:          StreamingObjLoader
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Loads an '.obj' file from an std::istream a piece at a time, so that very large files
+//                 (i.e. multi-gigabyte scan-derived meshes) can be loaded without ever holding the
+//                 file's text, its faces or the fully assembled mesh in memory all at once. QuickObj
+//                 keeps all of those alive together, which puts its peak memory at several times the
+//                 size of the final mesh.
+//
+//                 The stream is read into one fixed-size buffer. Every complete line in the buffer is
+//                 handed to the ObjTokenizer, the faces it parsed are assembled straight into a batch of
+//                 final vertex and index data, and that batch is handed to a sink callback. The faces are
+//                 then thrown away and the next piece of the stream is read in. The partial line at the
+//                 end of the buffer (a line straddling 2 reads) is moved to the front of the buffer, and
+//                 the next read fills in the space after it.
+//
+// Memory Use:     The text buffer, the faces of one buffer's worth of text and the batch being assembled
+//                 are all bounded by the buffer size. The position/texCoord/normal pools however have to be
+//                 kept for the entire load, since a face is allowed to refer to any vertex that came before
+//                 it. Their size is reported by 'getVertexPoolBytes()'. For a typical scanned mesh the pools
+//                 are a small fraction of the expanded output.
+//
+// Batches:        Each batch is indexed, with its vertices deduplicated by their (position, texCoord, normal)
+//                 index tuple within the batch. Indices are relative to the start of the batch's own vertices,
+//                 so a sink appending batches into one big buffer needs to add its current vertex count to
+//                 each index. Every vertex uses the same layout as QuickObj [4 position components with the
+//                 scale as 'w', then 2 texture coordinate components, then 3 normal components]. Which of the
+//                 optional components are included is decided by whatever had been read by the time the first
+//                 batch was assembled [which is almost always every 'v', 'vt' and 'vn' line, since they come
+//                 before the faces], and it never changes after that. Faces missing a component that is part
+//                 of the layout get zeros for it, nothing is generated.
+//
+//                 Line primitives and object/group/material tags are not streamed.
+//
+// Long Lines:     A line that doesn't fit in the buffer is reported and skipped.
+
+#pragma once
+
+#ifndef STREAMING_OBJ_LOADER_H_
+#define STREAMING_OBJ_LOADER_H_
+
+#include <cstdint>
+#include <functional>   //std::function
+#include <istream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ObjTokenizer.h"             //Used internally by class
+#include "VertexDeduplicationTable.h" //Used internally by class
+
+//One batch of final mesh data. The pointers are only valid for the duration of the sink's call.
+typedef struct StreamedMeshBatch {
+    const float * vertices;     //Interleaved, 'vertexSize' floats per vertex
+    size_t vertexCount;
+    size_t vertexSize;
+    const uint32_t * indices;   //3 per triangle, relative to the first vertex of this batch
+    size_t indexCount;
+    bool hasTexCoords;
+    bool hasNormals;
+    size_t batchNumber;         //Batches are numbered from 0 in the order they are emitted
+} StreamedMeshBatch;
+
+
+class StreamingObjLoader final {
+public:
+    typedef std::function<void(const StreamedMeshBatch&)> BatchSink;
+
+    static constexpr const size_t DEFAULT_BUFFER_BYTES = 1024u * 1024u;
+    static constexpr const size_t MIN_BUFFER_BYTES = 4u * 1024u;
+
+    //The buffer size is the most text which is ever held in memory at once (it is clamped to be at
+    //least MIN_BUFFER_BYTES). The scale is placed as the 'w' component of every position.
+    StreamingObjLoader(size_t bufferBytes = DEFAULT_BUFFER_BYTES, float scale = 1.0f);
+    ~StreamingObjLoader() = default;
+
+    StreamingObjLoader(const StreamingObjLoader&) = delete;
+    StreamingObjLoader& operator=(const StreamingObjLoader&) = delete;
+
+    //Reads the stream until it ends, calling 'sink' with each batch of mesh data as it is assembled.
+    //'nameForMessages' is only used in error messages. Returns false if the stream could not be read
+    //or if it did not contain any faces. A loader can be reused for any number of loads.
+    bool load(std::istream& input, const BatchSink& sink, std::string_view nameForMessages = "stream");
+    //Opens the file at 'filepath' and streams it through load()
+    bool loadFile(const std::string& filepath, const BatchSink& sink);
+
+    //Statistics for the most recent load
+    size_t getBytesRead() const noexcept { return mBytesRead_; }
+    size_t getBatchCount() const noexcept { return mBatchCount_; }
+    size_t getVerticesEmitted() const noexcept { return mVerticesEmitted_; }
+    size_t getIndicesEmitted() const noexcept { return mIndicesEmitted_; }
+    size_t getLinesWithErrors() const noexcept { return mLinesWithErrors_; }
+    //The memory held by the position/texCoord/normal pools at the end of the load
+    size_t getVertexPoolBytes() const noexcept { return mVertexPoolBytes_; }
+    //The layout of the emitted vertices
+    bool hasTexCoords() const noexcept { return mHasTexCoords_; }
+    bool hasNormals() const noexcept { return mHasNormals_; }
+
+private:
+    float mScale_;
+    std::vector<char> mBuffer_;
+    //Only ever holds the faces (and pools) parsed so far, the faces are cleared after each batch
+    AssetLoadingInternal::ObjParseResult mParsedData_;
+    AssetLoadingInternal::VertexDeduplicationTable<3u> mBatchVertices_;
+    std::vector<float> mBatchVertexData_;
+    std::vector<uint32_t> mBatchIndices_;
+
+    bool mLayoutDecided_;
+    bool mHasTexCoords_, mHasNormals_;
+    size_t mVertexSize_;
+
+    size_t mBytesRead_;
+    size_t mBatchCount_;
+    size_t mVerticesEmitted_;
+    size_t mIndicesEmitted_;
+    size_t mLinesWithErrors_;
+    size_t mFacesSkipped_;
+    size_t mVertexPoolBytes_;
+
+    void resetForNewLoad();
+    //Assembles every face parsed since the last batch into a batch and hands it to the sink
+    void emitBatch(const BatchSink& sink);
+    void addFaceCorner(const AssetLoadingInternal::ParsedFace& face, int corner);
+    bool faceIndicesAreInRange(const AssetLoadingInternal::ParsedFace& face) const noexcept;
+};
+
+#endif //STREAMING_OBJ_LOADER_H_
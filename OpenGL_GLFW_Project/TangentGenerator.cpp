@@ -0,0 +1,277 @@
+// File:           TangentGenerator.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   The tangents are generated in 3 steps:
+//                            1)  In parallel over blocks of triangles, each triangle's tangent is worked
+//                                out from its texture coordinates, and each of its corners gets that tangent
+//                                projected onto the corner's normal and weighted by the corner's angle.
+//                            2)  Every corner is given a key for its (position, normal, texture coordinates,
+//                                mirrored) values, with the values compared by their exact bits (-0.0 and
+//                                0.0 count as the same). Keys are handed out in order of first use.
+//                            3)  The corners are counting-sorted by their keys, and then in parallel over
+//                                blocks of keys each key's corners are summed up in corner order.
+//                          Summing by key (rather than having each triangle add itself onto its corners' sums)
+//                          means no 2 threads ever write to the same sum and every sum is added up in the
+//                          same order, which keeps the floating point results identical for any thread count.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "TangentGenerator.h"
+
+#include <algorithm>
+#include <cfloat>      //FLT_MIN
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "GlobalIncludes.h"
+#include "ParallelRanges.h"
+#include "PositionKey.h"
+
+namespace AssetLoadingInternal {
+
+    namespace {
+
+        static constexpr const size_t VERTICES_PER_TRIANGLE = 3u;
+
+        //Each of the 2 octahedral coordinates of a packed tangent is stored as an integer from 0 up to this
+        static constexpr const float PACKED_AXIS_MAX = 2047.0f;            //11 bits
+        //The second coordinate is stored above the first one
+        static constexpr const float PACKED_SECOND_AXIS_SCALE = 2048.0f;
+        //Added to every packed tangent so that it is never 0, which would lose the bitangent sign
+        static constexpr const float PACKED_TANGENT_BIAS = 1.0f;
+
+        //Corners only share a tangent when they are at the same position (see PositionKey.h) with the same
+        //normal, texture coordinates and winding. The normal and texture coordinates are compared the same way.
+        typedef struct CornerKey {
+            PositionKey position;
+            PositionKey normal;
+            uint32_t texCoord[2];
+            uint32_t mirrored;
+            bool operator==(const CornerKey& other) const noexcept {
+                return ((position == other.position) && (normal == other.normal) && (texCoord[0] == other.texCoord[0]) &&
+                        (texCoord[1] == other.texCoord[1]) && (mirrored == other.mirrored));
+            }
+        } CornerKey;
+
+        struct CornerKeyHash {
+            size_t operator()(const CornerKey& key) const noexcept {
+                uint64_t hash = PositionKeyHash::hash(key.position);
+                hash ^= (PositionKeyHash::hash(key.normal) + 0xBF58476D1CE4E5B9ull + (hash << 6) + (hash >> 2));
+                hash ^= (static_cast<uint64_t>(key.texCoord[0]) + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2));
+                hash ^= (static_cast<uint64_t>(key.texCoord[1]) + 0x7F4A7C159E3779B9ull + (hash << 6) + (hash >> 2));
+                hash ^= (static_cast<uint64_t>(key.mirrored) + 0x94D049BB133111EBull + (hash << 6) + (hash >> 2));
+                return static_cast<size_t>(hash);
+            }
+        };
+
+        //Returns a unit vector at right angles to 'normal' (for corners that couldn't be given a real tangent)
+        glm::vec3 perpendicularTo(const glm::vec3& normal) noexcept {
+            const glm::vec3 axis = ((std::fabs(normal.x) < 0.9f) ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f));
+            const glm::vec3 perpendicular = glm::cross(normal, axis);
+            const float length = glm::length(perpendicular);
+            return ((length > FLT_MIN) ? (perpendicular / length) : glm::vec3(1.0f, 0.0f, 0.0f));
+        }
+
+        //Removes the part of 'v' along the (unit) normal
+        glm::vec3 projectOntoPlane(const glm::vec3& v, const glm::vec3& normal) noexcept {
+            return (v - (normal * glm::dot(normal, v)));
+        }
+
+
+        class TangentGenerator final {
+        public:
+            TangentGenerator(const float * vertices, size_t vertexStride, size_t texCoordOffset, size_t normalOffset,
+                             size_t triangleCount, unsigned int threadCount) : mVertices_(vertices), mVertexStride_(vertexStride),
+                                                                               mTexCoordOffset_(texCoordOffset), mNormalOffset_(normalOffset),
+                                                                               mTriangleCount_(triangleCount), mThreadCount_(std::max(threadCount, 1u)) {
+                computeCornerContributions();
+                assignCornerKeys();
+            }
+
+            void generate(float * tangents, size_t tangentStride) {
+                const std::vector<glm::vec3> sharedTangents = sumCornersByKey();
+
+                const size_t cornerCount = mCornerKeys_.size();
+                runInParallelRanges(countParallelRanges(mThreadCount_, cornerCount), cornerCount, [&](size_t, size_t begin, size_t end) {
+                    for (size_t corner = begin; corner < end; corner++) {
+                        const glm::vec3& tangent = sharedTangents[mCornerKeys_[corner]];
+                        float * const destination = tangents + (corner * tangentStride);
+                        destination[0] = tangent.x;
+                        destination[1] = tangent.y;
+                        destination[2] = tangent.z;
+                        destination[3] = (mTriangleIsMirrored_[corner / VERTICES_PER_TRIANGLE] ? -1.0f : 1.0f);
+                    }
+                });
+            }
+
+        private:
+            const float * mVertices_;
+            size_t mVertexStride_;
+            size_t mTexCoordOffset_;
+            size_t mNormalOffset_;
+            size_t mTriangleCount_;
+            unsigned int mThreadCount_;
+            std::vector<uint8_t> mTriangleIsMirrored_;
+            std::vector<glm::vec3> mCornerContributions_;  //Each corner's projected tangent times its angle
+            std::vector<uint32_t> mCornerKeys_;
+            size_t mKeyCount_ = 0u;
+
+            const float * vertex(size_t corner) const noexcept { return (mVertices_ + (corner * mVertexStride_)); }
+            glm::vec3 position(size_t corner) const noexcept {
+                const float * const v = vertex(corner);
+                return glm::vec3(v[0], v[1], v[2]);
+            }
+            glm::vec3 normal(size_t corner) const noexcept {
+                const float * const v = vertex(corner) + mNormalOffset_;
+                return glm::vec3(v[0], v[1], v[2]);
+            }
+            glm::vec2 texCoord(size_t corner) const noexcept {
+                const float * const v = vertex(corner) + mTexCoordOffset_;
+                return glm::vec2(v[0], v[1]);
+            }
+
+            void computeCornerContributions() {
+                mTriangleIsMirrored_.resize(mTriangleCount_);
+                mCornerContributions_.resize(mTriangleCount_ * VERTICES_PER_TRIANGLE);
+
+                runInParallelRanges(countParallelRanges(mThreadCount_, mTriangleCount_), mTriangleCount_, [this](size_t, size_t begin, size_t end) {
+                    for (size_t triangle = begin; triangle < end; triangle++) {
+                        const size_t firstCorner = triangle * VERTICES_PER_TRIANGLE;
+                        const glm::vec3 corners[VERTICES_PER_TRIANGLE] = { position(firstCorner), position(firstCorner + 1u), position(firstCorner + 2u) };
+                        const glm::vec2 uv0 = texCoord(firstCorner);
+                        const glm::vec2 uv1 = texCoord(firstCorner + 1u) - uv0;
+                        const glm::vec2 uv2 = texCoord(firstCorner + 2u) - uv0;
+                        const glm::vec3 edge1 = corners[1] - corners[0];
+                        const glm::vec3 edge2 = corners[2] - corners[0];
+
+                        //Twice the signed area of the triangle in texture space, which is negative when the texture is mirrored
+                        const float signedAreaSTx2 = ((uv1.x * uv2.y) - (uv2.x * uv1.y));
+                        const bool mirrored = (signedAreaSTx2 < 0.0f);
+                        mTriangleIsMirrored_[triangle] = (mirrored ? 1u : 0u);
+
+                        //The direction 's' increases in, up to the sign of the texture space area
+                        glm::vec3 triangleTangent = ((uv2.y * edge1) - (uv1.y * edge2));
+                        const float tangentLength = glm::length(triangleTangent);
+                        const bool hasTangent = ((std::fabs(signedAreaSTx2) > FLT_MIN) && (tangentLength > FLT_MIN));
+                        if (hasTangent)
+                            triangleTangent *= ((mirrored ? -1.0f : 1.0f) / tangentLength);
+
+                        for (size_t i = 0u; i < VERTICES_PER_TRIANGLE; i++) {
+                            glm::vec3& contribution = mCornerContributions_[firstCorner + i];
+                            contribution = glm::vec3(0.0f);
+                            if (!hasTangent)
+                                continue;
+                            const glm::vec3 cornerNormal = normal(firstCorner + i);
+                            const glm::vec3 projected = projectOntoPlane(triangleTangent, cornerNormal);
+                            const float projectedLength = glm::length(projected);
+                            if (projectedLength <= FLT_MIN)
+                                continue;
+                            //The corner's angle is measured in the plane of its normal, like MikkTSpace does
+                            const glm::vec3 toNext = projectOntoPlane(corners[(i + 1u) % VERTICES_PER_TRIANGLE] - corners[i], cornerNormal);
+                            const glm::vec3 toPrevious = projectOntoPlane(corners[(i + 2u) % VERTICES_PER_TRIANGLE] - corners[i], cornerNormal);
+                            const float angle = std::atan2(glm::length(glm::cross(toNext, toPrevious)), glm::dot(toNext, toPrevious));
+                            contribution = (projected * (angle / projectedLength));
+                        }
+                    }
+                });
+            }
+
+            void assignCornerKeys() {
+                const size_t cornerCount = mTriangleCount_ * VERTICES_PER_TRIANGLE;
+                mCornerKeys_.resize(cornerCount);
+                std::unordered_map<CornerKey, uint32_t, CornerKeyHash> keys;
+                keys.reserve(cornerCount / 2u);
+                for (size_t corner = 0u; corner < cornerCount; corner++) {
+                    const float * const v = vertex(corner);
+                    const float * const n = v + mNormalOffset_;
+                    const float * const uv = v + mTexCoordOffset_;
+                    const CornerKey key = { makePositionKey(v), makePositionKey(n),
+                                            { positionBits(uv[0]), positionBits(uv[1]) },
+                                            mTriangleIsMirrored_[corner / VERTICES_PER_TRIANGLE] };
+                    mCornerKeys_[corner] = keys.emplace(key, static_cast<uint32_t>(keys.size())).first->second;
+                }
+                mKeyCount_ = keys.size();
+            }
+
+            //Returns the normalized sum of each key's corners
+            std::vector<glm::vec3> sumCornersByKey() const {
+                //Counting sort the corners by key, which keeps each key's corners in corner order
+                std::vector<size_t> firstCornerOfKey(mKeyCount_ + 1u, 0u);
+                for (const uint32_t key : mCornerKeys_)
+                    firstCornerOfKey[key + 1u]++;
+                for (size_t key = 0u; key < mKeyCount_; key++)
+                    firstCornerOfKey[key + 1u] += firstCornerOfKey[key];
+                std::vector<size_t> nextCornerOfKey(firstCornerOfKey.cbegin(), firstCornerOfKey.cend() - 1);
+                std::vector<uint32_t> cornersByKey(mCornerKeys_.size());
+                for (size_t corner = 0u; corner < mCornerKeys_.size(); corner++)
+                    cornersByKey[nextCornerOfKey[mCornerKeys_[corner]]++] = static_cast<uint32_t>(corner);
+
+                std::vector<glm::vec3> sharedTangents(mKeyCount_);
+                runInParallelRanges(countParallelRanges(mThreadCount_, mKeyCount_), mKeyCount_, [&](size_t, size_t begin, size_t end) {
+                    for (size_t key = begin; key < end; key++) {
+                        glm::vec3 sum(0.0f);
+                        for (size_t i = firstCornerOfKey[key]; i < firstCornerOfKey[key + 1u]; i++)
+                            sum += mCornerContributions_[cornersByKey[i]];
+                        const float length = glm::length(sum);
+                        //Every corner of a key has the same normal, so any of them will do for the fallback
+                        sharedTangents[key] = ((length > FLT_MIN) ? (sum / length) : perpendicularTo(normal(cornersByKey[firstCornerOfKey[key]])));
+                    }
+                });
+                return sharedTangents;
+            }
+        };
+
+    } //namespace
+
+
+    unsigned int chooseTangentGenerationThreadCount(size_t triangleCount) noexcept {
+        return chooseParallelThreadCount(triangleCount, MIN_TRIANGLES_PER_TANGENT_GENERATION_THREAD);
+    }
+
+
+    void generateTangents(const float * vertices, size_t vertexStride, size_t texCoordOffset, size_t normalOffset,
+                          size_t triangleCount, unsigned int threadCount, float * tangents, size_t tangentStride) {
+        if (triangleCount == 0u)
+            return;
+        TangentGenerator generator(vertices, vertexStride, texCoordOffset, normalOffset, triangleCount, threadCount);
+        generator.generate(tangents, tangentStride);
+    }
+
+
+    //Octahedral encoding: the direction is projected onto the octahedron |x| + |y| + |z| = 1, whose lower half
+    //is then folded out over the corners of the upper half so that the whole thing lies flat in the xy plane
+    float packTangent(float x, float y, float z, float bitangentSign) noexcept {
+        const float sum = std::fabs(x) + std::fabs(y) + std::fabs(z);
+        const float px = ((sum > 0.0f) ? (x / sum) : 1.0f);
+        const float py = ((sum > 0.0f) ? (y / sum) : 0.0f);
+        float ex = px, ey = py;
+        if (z < 0.0f) {
+            ex = (1.0f - std::fabs(py)) * ((px >= 0.0f) ? 1.0f : -1.0f);
+            ey = (1.0f - std::fabs(px)) * ((py >= 0.0f) ? 1.0f : -1.0f);
+        }
+        auto quantize = [](float value) {
+            return static_cast<float>(std::lround(((std::min(std::max(value, -1.0f), 1.0f) * 0.5f) + 0.5f) * PACKED_AXIS_MAX));
+        };
+        const float packed = PACKED_TANGENT_BIAS + quantize(ex) + (quantize(ey) * PACKED_SECOND_AXIS_SCALE);
+        return ((bitangentSign < 0.0f) ? -packed : packed);
+    }
+
+
+    std::array<float, TANGENT_COMPONENTS> unpackTangent(float packedTangent) noexcept {
+        const float quantized = std::fabs(packedTangent) - PACKED_TANGENT_BIAS;
+        const float qy = std::floor(quantized / PACKED_SECOND_AXIS_SCALE);
+        const float qx = quantized - (qy * PACKED_SECOND_AXIS_SCALE);
+        glm::vec3 t(((qx / PACKED_AXIS_MAX) * 2.0f) - 1.0f, ((qy / PACKED_AXIS_MAX) * 2.0f) - 1.0f, 0.0f);
+        t.z = 1.0f - std::fabs(t.x) - std::fabs(t.y);
+        const float fold = std::max(-t.z, 0.0f);
+        t.x += ((t.x >= 0.0f) ? -fold : fold);
+        t.y += ((t.y >= 0.0f) ? -fold : fold);
+        t = glm::normalize(t);
+        return { t.x, t.y, t.z, ((packedTangent < 0.0f) ? -1.0f : 1.0f) };
+    }
+
+} //namespace AssetLoadingInternal
@@ -0,0 +1,71 @@
+// File:           TangentGenerator.h
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Generates a tangent for every vertex of a mesh that has both texture coordinates and
+//                 normals, so that normal maps can be sampled without the fragment shader having to work
+//                 out a tangent frame from screen-space derivatives.
+//
+//                 The tangents follow the same conventions as MikkTSpace (the tangent space used by Blender,
+//                 Substance and most bakers), which is what a baked normal map expects:
+//                   -Each triangle's tangent points along the direction its 's' texture coordinate increases.
+//                   -At each corner it is projected onto the plane of that corner's normal, normalized, and
+//                    weighted by the angle of the triangle at that corner.
+//                   -Corners with the same position, normal and texture coordinates share one tangent,
+//                    except that triangles whose texture coordinates are mirrored are never averaged in with
+//                    ones that aren't.
+//                   -The bitangent is not stored. It is rebuilt as  sign * cross(normal, tangent), with the
+//                    sign being -1 for mirrored triangles and +1 otherwise.
+//                 This is a simplified MikkTSpace. The full algorithm also splits up corners whose triangles
+//                 aren't connected to each other and fills in tangents for triangles with degenerate texture
+//                 coordinates from their neighbours, both of which are rare in practice. Corners which end up
+//                 without a tangent are given an arbitrary one at right angles to their normal.
+//
+// Packing:        Tangents can be packed into a single float (see 'packTangent()'), which adds only 4 bytes
+//                 to each vertex. The tangent's direction is octahedral encoded into 2 x 11 bits, which are
+//                 stored as the integer part of the float (every integer up to 2^24 is exact in a float), and
+//                 the bitangent sign is the float's sign. Being an ordinary number, the packed tangent survives
+//                 being copied, compared and deduplicated like any other vertex component. The GLSL to unpack
+//                 it is in 'Shaders/PackedTangentDecode.glsl'. Packed directions are within about a tenth of a
+//                 degree of the originals.
+//
+// Threading:      Each thread works out the tangents of a block of the triangles, then each thread sums
+//                 up the corners of a block of the shared tangents. Every shared tangent is summed by just
+//                 one thread in the same order every time, so the results don't depend on the thread count.
+
+#pragma once
+
+#ifndef TANGENT_GENERATOR_H_
+#define TANGENT_GENERATOR_H_
+
+#include <array>
+#include <cstddef>
+
+namespace AssetLoadingInternal {
+
+    //Meshes smaller than this many triangles per thread aren't worth splitting up further
+    static constexpr const size_t MIN_TRIANGLES_PER_TANGENT_GENERATION_THREAD = 65536u;
+
+    //Each generated tangent is 3 floats of direction followed by the bitangent sign
+    static constexpr const size_t TANGENT_COMPONENTS = 4u;
+
+    //Returns how many threads to use when generating tangents for the given number of triangles
+    unsigned int chooseTangentGenerationThreadCount(size_t triangleCount) noexcept;
+
+    //Computes a tangent for every corner of the 'triangleCount' triangles stored in 'vertices' (3 consecutive
+    //vertices per triangle, each 'vertexStride' floats with its position in the first 3, its 2 texture
+    //coordinates at 'texCoordOffset' and its normal at 'normalOffset'). Each tangent is written as
+    //TANGENT_COMPONENTS floats at 'tangents + (corner * tangentStride)'. Up to 'threadCount' threads are used,
+    //the results are the same for any thread count.
+    void generateTangents(const float * vertices, size_t vertexStride, size_t texCoordOffset, size_t normalOffset,
+                          size_t triangleCount, unsigned int threadCount, float * tangents, size_t tangentStride);
+
+    //Packs a unit tangent and its bitangent sign into a single float
+    float packTangent(float x, float y, float z, float bitangentSign) noexcept;
+    //Unpacks a tangent packed by 'packTangent()' into its unit direction and bitangent sign
+    std::array<float, TANGENT_COMPONENTS> unpackTangent(float packedTangent) noexcept;
+
+} //namespace AssetLoadingInternal
+
+#endif //TANGENT_GENERATOR_H_
@@ -61,6 +61,14 @@ public:
             mMasterTimepointRecord_.insert(*this);
     }
 
+    //Logs a LocalTimepoint that was recorded earlier globally. The master record is not 
+    //thread safe, so this is how times measured on other threads (i.e. by asynchronous 
+    //loading tasks) should be logged once they have been handed back to the main thread.
+    explicit Timepoint(const LocalTimepoint& recordedEarlier) : LocalTimepoint(recordedEarlier) {
+        if (GLFW_INIT_INTERNAL::GLFW_IS_INIT())
+            mMasterTimepointRecord_.insert(*this);
+    }
+
     Timepoint(const Timepoint& other) {
         tag = other.tag;
         timepoint = other.timepoint;
@@ -0,0 +1,958 @@
+// File:           TriangleBVH.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   The tree is built in 2 phases:
+//                            1)  Starting from the root, nodes with at least SUBTREE_BUILD_TRIANGLES triangles are
+//                                split one at a time, with each large node's triangles binned on multiple threads.
+//                                Nodes smaller than that are set aside, in the order they are reached.
+//                            2)  Every set-aside node has its whole subtree built by a single thread into a
+//                                separate array of nodes. Those arrays are then appended onto the tree in the
+//                                order their roots were set aside.
+//                          Which nodes get set aside only depends on the mesh, and merging the bins of the threads
+//                          only takes mins, maxes and integer sums, so the tree comes out the same for any thread
+//                          count. Every node's triangles are partitioned in place within the node's range of the
+//                          triangle order, which is why the triangles of any subtree end up contiguous.
+//
+//                          The SSE and scalar node tests have to agree exactly. No NaNs can come up in either of
+//                          them (rays never divide by 0, see 'RaySetup'), so they do the same multiplies and adds
+//                          in the same order and only differ in how many lanes they do at once.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "TriangleBVH.h"
+
+#include <algorithm>
+#include <array>
+#include <cfloat>      //FLT_MAX
+#include <cmath>
+#include <limits>
+
+#include "GlobalIncludes.h"
+#include "ParallelRanges.h"
+#include "QuickObj.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define TRIANGLE_BVH_USE_SSE2_ 1
+#endif
+
+namespace AssetLoadingInternal {
+
+    namespace {
+
+        static constexpr const size_t VERTICES_PER_TRIANGLE = 3u;
+
+        //How many bins the triangles of a node are sorted into along each axis when looking for a split
+        static constexpr const size_t BIN_COUNT = 16u;
+        //Leaves never hold more triangles than this, even when the SAH would rather not split them
+        static constexpr const size_t MAX_LEAF_TRIANGLES = 8u;
+        //The relative costs of stepping into a node and of testing one triangle, used by the SAH
+        static constexpr const float TRAVERSAL_COST = 1.0f;
+        static constexpr const float TRIANGLE_COST = 1.0f;
+        //Nodes smaller than this have their whole subtree built by just one thread
+        static constexpr const size_t SUBTREE_BUILD_TRIANGLES = 16384u;
+        //Below this depth nodes are split in half by triangle count instead of by the SAH. Halving can only go
+        //on for another 32 levels, which keeps every path through the tree shorter than MAX_QUERY_DEPTH.
+        static constexpr const size_t MEDIAN_SPLIT_DEPTH = 48u;
+        static constexpr const size_t MAX_QUERY_DEPTH = 96u;
+
+        //Ray directions are never divided by anything smaller than this, which keeps infinities out of the
+        //inverse direction so that a ray lying in the plane of a box's face can't give  0 * infinity = NaN
+        static constexpr const float MIN_RAY_DIRECTION_COMPONENT = 1.0e-30f;
+        //Where a ray leaves a box is pushed out by this factor before it is compared to where the ray enters
+        //the box, so that rounding can't make a ray that grazes a box (or a box that is flat) count as a miss
+        static constexpr const float RAY_EXIT_SCALE = (1.0f + 1.0e-6f);
+
+        static constexpr const float NO_HIT = std::numeric_limits<float>::infinity();
+
+        struct Bounds {
+            glm::vec3 min = glm::vec3(FLT_MAX);
+            glm::vec3 max = glm::vec3(-FLT_MAX);
+
+            void grow(const glm::vec3& point) noexcept {
+                min = glm::min(min, point);
+                max = glm::max(max, point);
+            }
+            void grow(const Bounds& other) noexcept {
+                min = glm::min(min, other.min);
+                max = glm::max(max, other.max);
+            }
+            //Half the surface area of the box (the SAH only compares areas, so the factor of 2 doesn't matter)
+            float halfArea() const noexcept {
+                const glm::vec3 size = max - min;
+                if ((size.x < 0.0f) || (size.y < 0.0f) || (size.z < 0.0f))
+                    return 0.0f;
+                return ((size.x * size.y) + (size.y * size.z) + (size.z * size.x));
+            }
+        };
+
+        //The triangles that landed in one bin
+        struct Bin {
+            Bounds bounds;
+            size_t count = 0u;
+
+            void merge(const Bin& other) noexcept {
+                bounds.grow(other.bounds);
+                count += other.count;
+            }
+        };
+        typedef std::array<std::array<Bin, BIN_COUNT>, 3u> NodeBins;
+
+        //A node whose triangles are the range [begin, end) of the triangle order and which still needs splitting
+        struct PendingNode {
+            size_t node;
+            size_t begin, end;
+            Bounds bounds;
+            Bounds centers;
+            size_t depth;
+        };
+
+        //How a node's triangles get split between its 2 children
+        struct Split {
+            bool makeLeaf = true;
+            bool useBins = false;    //True to partition by bin, false if the triangles were already partitioned
+            size_t axis = 0u;
+            size_t firstRightBin = 0u;
+            size_t middle = 0u;
+            Bounds leftBounds, leftCenters;
+            Bounds rightBounds, rightCenters;
+        };
+
+        Bounds computeTriangleBounds(const float (&corners)[3][3]) noexcept {
+            Bounds bounds;
+            for (size_t i = 0u; i < VERTICES_PER_TRIANGLE; i++)
+                bounds.grow(glm::vec3(corners[i][0], corners[i][1], corners[i][2]));
+            return bounds;
+        }
+
+        glm::vec3 computeCenter(const Bounds& bounds) noexcept {
+            return ((bounds.min + bounds.max) * 0.5f);
+        }
+
+        //Copies a box into 16-byte aligned arrays laid out like the halves of a BVHNode, for the node tests
+        struct alignas(16) TestBounds {
+            float min[4];
+            float max[4];
+            explicit TestBounds(const Bounds& bounds) noexcept
+                : min{ bounds.min.x, bounds.min.y, bounds.min.z, 0.0f }, max{ bounds.max.x, bounds.max.y, bounds.max.z, 0.0f } { ; }
+        };
+
+
+        ///////////////////////////////////////////////////////////////////////
+        //////   Building
+        ///////////////////////////////////////////////////////////////////////
+
+        class TreeBuilder final {
+        public:
+            TreeBuilder(const std::vector<glm::vec3>& centers, const std::vector<Bounds>& triangleBounds, std::vector<uint32_t>& order)
+                : mCenters_(centers), mTriangleBounds_(triangleBounds), mOrder_(order) { ; }
+
+            //Works out how to split the pending node, binning its triangles on up to 'rangeCount' threads. For
+            //median splits the node's triangles have already been partitioned when this returns.
+            Split chooseSplit(const PendingNode& pending, size_t rangeCount) {
+                Split split;
+                const size_t count = (pending.end - pending.begin);
+                if (count <= 1u)
+                    return split;
+
+                const glm::vec3 centerExtent = (pending.centers.max - pending.centers.min);
+                if (pending.depth < MEDIAN_SPLIT_DEPTH) {
+                    NodeBins bins;
+                    glm::vec3 binScale(0.0f);
+                    for (int axis = 0; axis < 3; axis++) {
+                        const float scale = (static_cast<float>(BIN_COUNT) / centerExtent[axis]);
+                        binScale[axis] = (((centerExtent[axis] > 0.0f) && std::isfinite(scale)) ? scale : 0.0f);
+                    }
+                    binTriangles(pending, binScale, rangeCount, bins);
+                    if (findCheapestBinSplit(pending, bins, binScale, split))
+                        return split;
+                }
+                //The SAH found nothing worth doing, so only split if the node is too big to be a leaf
+                if (count <= MAX_LEAF_TRIANGLES) {
+                    split.makeLeaf = true;
+                    return split;
+                }
+                splitAtMedian(pending, centerExtent, split);
+                return split;
+            }
+
+            //Partitions the node's triangles by the chosen bin split, returning where the right child's triangles begin.
+            //The bounds of each side's triangle centers are gathered along the way.
+            size_t partition(const PendingNode& pending, Split& split) {
+                if (!split.useBins)
+                    return split.middle;
+                const int axis = static_cast<int>(split.axis);
+                const float binMin = pending.centers.min[axis];
+                const float scale = (static_cast<float>(BIN_COUNT) / (pending.centers.max - pending.centers.min)[axis]);
+                auto isLeft = [&](uint32_t triangle) {
+                    return (computeBin(mCenters_[triangle][axis], binMin, scale) < split.firstRightBin);
+                };
+                size_t left = pending.begin, right = pending.end;
+                while (true) {
+                    while ((left < right) && isLeft(mOrder_[left]))
+                        split.leftCenters.grow(mCenters_[mOrder_[left++]]);
+                    while ((left < right) && (!isLeft(mOrder_[right - 1u])))
+                        split.rightCenters.grow(mCenters_[mOrder_[--right]]);
+                    if (left >= right)
+                        return left;
+                    std::swap(mOrder_[left], mOrder_[right - 1u]);
+                }
+            }
+
+            //Builds the entire subtree beneath 'root' into 'nodes', where nodes[0] is the root itself and every other
+            //node's index is relative to the start of 'nodes'. Returns the depth of the deepest leaf.
+            size_t buildSubtree(const PendingNode& root, std::vector<BVHNode>& nodes) {
+                nodes.clear();
+                nodes.push_back(makeNode(root.bounds));
+                size_t deepest = root.depth;
+                std::vector<PendingNode> stack;
+                PendingNode first = root;
+                first.node = 0u;
+                stack.push_back(first);
+                while (!stack.empty()) {
+                    const PendingNode pending = stack.back();
+                    stack.pop_back();
+                    Split split = chooseSplit(pending, 1u);
+                    if (split.makeLeaf) {
+                        makeLeaf(nodes[pending.node], pending);
+                        deepest = std::max(deepest, pending.depth);
+                        continue;
+                    }
+                    const size_t middle = partition(pending, split);
+                    pushChildren(pending, split, middle, nodes, stack);
+                }
+                return deepest;
+            }
+
+            //Gives the pending node 2 children (appended onto 'nodes') and pushes them onto 'stack', with the left child on top
+            static void pushChildren(const PendingNode& pending, const Split& split, size_t middle,
+                                     std::vector<BVHNode>& nodes, std::vector<PendingNode>& stack) {
+                const size_t firstChild = nodes.size();
+                nodes[pending.node].first = static_cast<uint32_t>(firstChild);
+                nodes[pending.node].triangleCount = 0u;
+                nodes.push_back(makeNode(split.leftBounds));
+                nodes.push_back(makeNode(split.rightBounds));
+                stack.push_back({ firstChild + 1u, middle, pending.end, split.rightBounds, split.rightCenters, pending.depth + 1u });
+                stack.push_back({ firstChild, pending.begin, middle, split.leftBounds, split.leftCenters, pending.depth + 1u });
+            }
+
+            static BVHNode makeNode(const Bounds& bounds) noexcept {
+                BVHNode node;
+                node.boundsMin[0] = bounds.min.x;  node.boundsMin[1] = bounds.min.y;  node.boundsMin[2] = bounds.min.z;
+                node.boundsMax[0] = bounds.max.x;  node.boundsMax[1] = bounds.max.y;  node.boundsMax[2] = bounds.max.z;
+                node.first = 0u;
+                node.triangleCount = 0u;
+                return node;
+            }
+
+            static void makeLeaf(BVHNode& node, const PendingNode& pending) noexcept {
+                node.first = static_cast<uint32_t>(pending.begin);
+                node.triangleCount = static_cast<uint32_t>(pending.end - pending.begin);
+            }
+
+        private:
+            const std::vector<glm::vec3>& mCenters_;
+            const std::vector<Bounds>& mTriangleBounds_;
+            std::vector<uint32_t>& mOrder_;
+
+            static size_t computeBin(float center, float binMin, float scale) noexcept {
+                return std::min(static_cast<size_t>((center - binMin) * scale), (BIN_COUNT - 1u));
+            }
+
+            //Sorts the node's triangles into bins along every axis which has a 'binScale', with each of the 'rangeCount'
+            //ranges of the triangles binned by its own thread into its own bins. The bins are merged in range order.
+            void binTriangles(const PendingNode& pending, const glm::vec3& binScale, size_t rangeCount, NodeBins& bins) const {
+                if (rangeCount == 1u) {
+                    binRange(pending.begin, pending.end, pending.centers.min, binScale, bins);
+                    return;
+                }
+                std::vector<NodeBins> rangeBins(rangeCount);
+                runInParallelRanges(rangeCount, (pending.end - pending.begin), [&](size_t range, size_t begin, size_t end) {
+                    binRange((pending.begin + begin), (pending.begin + end), pending.centers.min, binScale, rangeBins[range]);
+                });
+                bins = rangeBins[0];
+                for (size_t range = 1u; range < rangeCount; range++) {
+                    for (size_t axis = 0u; axis < 3u; axis++) {
+                        for (size_t bin = 0u; bin < BIN_COUNT; bin++)
+                            bins[axis][bin].merge(rangeBins[range][axis][bin]);
+                    }
+                }
+            }
+
+            void binRange(size_t begin, size_t end, const glm::vec3& binMin, const glm::vec3& binScale, NodeBins& bins) const {
+                for (size_t i = begin; i < end; i++) {
+                    const uint32_t triangle = mOrder_[i];
+                    const glm::vec3& center = mCenters_[triangle];
+                    for (int axis = 0; axis < 3; axis++) {
+                        if (binScale[axis] == 0.0f)
+                            continue;
+                        Bin& bin = bins[axis][computeBin(center[axis], binMin[axis], binScale[axis])];
+                        bin.bounds.grow(mTriangleBounds_[triangle]);
+                        bin.count++;
+                    }
+                }
+            }
+
+            //Looks for the split between 2 bins with the lowest SAH cost. Returns false if the node should not be split
+            //by bin, which is the case when no split beats making a leaf (or there is nothing to split on).
+            bool findCheapestBinSplit(const PendingNode& pending, const NodeBins& bins, const glm::vec3& binScale, Split& split) const {
+                const size_t count = (pending.end - pending.begin);
+                //Costs are compared multiplied through by the node's area, which saves dividing by it
+                const float nodeArea = pending.bounds.halfArea();
+                const float leafCost = (static_cast<float>(count) * TRIANGLE_COST * nodeArea);
+                float cheapestCost = std::numeric_limits<float>::max();
+                bool foundSplit = false;
+
+                for (size_t axis = 0u; axis < 3u; axis++) {
+                    if (binScale[static_cast<int>(axis)] == 0.0f)
+                        continue;
+                    //Sweep from the right, recording the area times triangle count of everything right of each split
+                    std::array<float, BIN_COUNT> rightCosts;
+                    Bin right;
+                    for (size_t bin = (BIN_COUNT - 1u); bin > 0u; bin--) {
+                        right.merge(bins[axis][bin]);
+                        rightCosts[bin] = (right.bounds.halfArea() * static_cast<float>(right.count));
+                    }
+                    Bin left;
+                    for (size_t bin = 1u; bin < BIN_COUNT; bin++) {
+                        left.merge(bins[axis][bin - 1u]);
+                        if ((left.count == 0u) || (left.count == count))
+                            continue;
+                        const float cost = ((TRAVERSAL_COST * nodeArea) + (TRIANGLE_COST * ((left.bounds.halfArea() * static_cast<float>(left.count)) + rightCosts[bin])));
+                        if (cost < cheapestCost) {
+                            cheapestCost = cost;
+                            split.axis = axis;
+                            split.firstRightBin = bin;
+                            foundSplit = true;
+                        }
+                    }
+                }
+                if ((!foundSplit) || ((cheapestCost >= leafCost) && (count <= MAX_LEAF_TRIANGLES)))
+                    return false;
+
+                split = sideBoundsOfBinSplit(bins[split.axis], split.axis, split.firstRightBin);
+                return true;
+            }
+
+            static Split sideBoundsOfBinSplit(const std::array<Bin, BIN_COUNT>& axisBins, size_t axis, size_t firstRightBin) noexcept {
+                Split split;
+                split.makeLeaf = false;
+                split.useBins = true;
+                split.axis = axis;
+                split.firstRightBin = firstRightBin;
+                Bin left, right;
+                for (size_t bin = 0u; bin < BIN_COUNT; bin++)
+                    ((bin < firstRightBin) ? left : right).merge(axisBins[bin]);
+                split.leftBounds = left.bounds;
+                split.rightBounds = right.bounds;
+                return split;
+            }
+
+            //Splits the triangles in half by count along the axis their centers are most spread out on [or in half
+            //as they are if every center is in the same place]. This is rare, so it is only ever done on 1 thread.
+            void splitAtMedian(const PendingNode& pending, const glm::vec3& centerExtent, Split& split) {
+                split.makeLeaf = false;
+                split.useBins = false;
+                split.middle = (pending.begin + ((pending.end - pending.begin) / 2u));
+                const int axis = (((centerExtent.x >= centerExtent.y) && (centerExtent.x >= centerExtent.z)) ? 0 : ((centerExtent.y >= centerExtent.z) ? 1 : 2));
+                if (centerExtent[axis] > 0.0f) {
+                    std::nth_element(mOrder_.begin() + pending.begin, mOrder_.begin() + split.middle, mOrder_.begin() + pending.end,
+                        [&](uint32_t a, uint32_t b) {
+                            return ((mCenters_[a][axis] < mCenters_[b][axis]) || ((mCenters_[a][axis] == mCenters_[b][axis]) && (a < b)));
+                        });
+                }
+                split.leftBounds = split.leftCenters = split.rightBounds = split.rightCenters = Bounds();
+                for (size_t i = pending.begin; i < pending.end; i++) {
+                    const uint32_t triangle = mOrder_[i];
+                    const bool isLeft = (i < split.middle);
+                    (isLeft ? split.leftBounds : split.rightBounds).grow(mTriangleBounds_[triangle]);
+                    (isLeft ? split.leftCenters : split.rightCenters).grow(mCenters_[triangle]);
+                }
+            }
+        };
+
+
+        ///////////////////////////////////////////////////////////////////////
+        //////   Node Tests
+        ///////////////////////////////////////////////////////////////////////
+
+        //Everything about a ray that the node tests need, worked out once per query
+        struct alignas(16) RaySetup {
+            float origin[4];
+            float inverseDirection[4];
+            glm::vec3 rayOrigin;
+            glm::vec3 rayDirection;
+
+            RaySetup(const float o[3], const float d[3]) noexcept
+                : origin{ o[0], o[1], o[2], 0.0f }, inverseDirection{ 0.0f, 0.0f, 0.0f, 0.0f },
+                  rayOrigin(o[0], o[1], o[2]), rayDirection(d[0], d[1], d[2]) {
+                for (int axis = 0; axis < 3; axis++) {
+                    const float component = ((std::fabs(d[axis]) < MIN_RAY_DIRECTION_COMPONENT) ?
+                                             std::copysign(MIN_RAY_DIRECTION_COMPONENT, d[axis]) : d[axis]);
+                    inverseDirection[axis] = (1.0f / component);
+                }
+            }
+        };
+
+        //The frustum's planes rearranged for testing 4 planes at a time, with 2 always-passing planes added on the end
+        struct alignas(16) FrustumSetup {
+            float a[2][4], b[2][4], c[2][4], d[2][4];
+
+            explicit FrustumSetup(const BVHFrustum& frustum) noexcept {
+                for (size_t plane = 0u; plane < 8u; plane++) {
+                    const bool isPadding = (plane >= 6u);
+                    a[plane / 4u][plane % 4u] = (isPadding ? 0.0f : frustum.planes[plane][0]);
+                    b[plane / 4u][plane % 4u] = (isPadding ? 0.0f : frustum.planes[plane][1]);
+                    c[plane / 4u][plane % 4u] = (isPadding ? 0.0f : frustum.planes[plane][2]);
+                    d[plane / 4u][plane % 4u] = (isPadding ? 1.0f : frustum.planes[plane][3]);
+                }
+            }
+        };
+
+        //How a box sits relative to a query volume
+        enum class Overlap { OUTSIDE, PARTIAL, INSIDE };
+
+#ifdef TRIANGLE_BVH_USE_SSE2_
+
+        //Returns how far along the ray it enters the box [which must be 16-byte aligned with 4 readable floats in
+        //each half, the 4th lane is ignored], or NO_HIT if it misses the box or only reaches it past 'maxDistance'
+        inline float intersectRayWithBox(const float * boxMin, const float * boxMax, const RaySetup& ray, float maxDistance) noexcept {
+            const __m128 origin = _mm_load_ps(ray.origin);
+            const __m128 inverseDirection = _mm_load_ps(ray.inverseDirection);
+            const __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(boxMin), origin), inverseDirection);
+            const __m128 t2 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(boxMax), origin), inverseDirection);
+            const __m128 entries = _mm_min_ps(t1, t2);
+            const __m128 exits = _mm_mul_ps(_mm_max_ps(t1, t2), _mm_set1_ps(RAY_EXIT_SCALE));
+            const __m128 entry = _mm_max_ss(_mm_max_ss(entries, _mm_shuffle_ps(entries, entries, _MM_SHUFFLE(1, 1, 1, 1))),
+                                            _mm_max_ss(_mm_shuffle_ps(entries, entries, _MM_SHUFFLE(2, 2, 2, 2)), _mm_setzero_ps()));
+            const __m128 exit = _mm_min_ss(_mm_min_ss(exits, _mm_shuffle_ps(exits, exits, _MM_SHUFFLE(1, 1, 1, 1))),
+                                           _mm_min_ss(_mm_shuffle_ps(exits, exits, _MM_SHUFFLE(2, 2, 2, 2)), _mm_set_ss(maxDistance)));
+            return (_mm_comile_ss(entry, exit) ? _mm_cvtss_f32(entry) : NO_HIT);
+        }
+
+        //Intersects the ray with both children of an interior node at once, writing each child's entry distance (or
+        //NO_HIT) into 'entries'. The x, y and z lanes of the 2 boxes are transposed into [x0 x1 y0 y1] and [z0 z1 - -],
+        //so a single max and min of those gives where the ray enters and leaves both children.
+        inline void intersectRayWithChildren(const BVHNode * children, const RaySetup& ray, float maxDistance, float (&entries)[2]) noexcept {
+            const __m128 origin = _mm_load_ps(ray.origin);
+            const __m128 inverseDirection = _mm_load_ps(ray.inverseDirection);
+            const __m128 exitScale = _mm_set1_ps(RAY_EXIT_SCALE);
+            __m128 childEntries[2], childExits[2];
+            for (int child = 0; child < 2; child++) {
+                const __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(children[child].boundsMin), origin), inverseDirection);
+                const __m128 t2 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(children[child].boundsMax), origin), inverseDirection);
+                childEntries[child] = _mm_min_ps(t1, t2);
+                childExits[child] = _mm_mul_ps(_mm_max_ps(t1, t2), exitScale);
+            }
+            const __m128 entryXY = _mm_unpacklo_ps(childEntries[0], childEntries[1]);
+            const __m128 entryZ = _mm_unpackhi_ps(childEntries[0], childEntries[1]);
+            const __m128 exitXY = _mm_unpacklo_ps(childExits[0], childExits[1]);
+            const __m128 exitZ = _mm_unpackhi_ps(childExits[0], childExits[1]);
+            const __m128 entry = _mm_max_ps(_mm_max_ps(entryXY, _mm_movehl_ps(entryXY, entryXY)), _mm_max_ps(entryZ, _mm_setzero_ps()));
+            const __m128 exit = _mm_min_ps(_mm_min_ps(exitXY, _mm_movehl_ps(exitXY, exitXY)), _mm_min_ps(exitZ, _mm_set1_ps(maxDistance)));
+            //Lanes that miss are swapped for NO_HIT without branching
+            const __m128 hits = _mm_cmple_ps(entry, exit);
+            const __m128 result = _mm_or_ps(_mm_and_ps(hits, entry), _mm_andnot_ps(hits, _mm_set1_ps(NO_HIT)));
+            entries[0] = _mm_cvtss_f32(result);
+            entries[1] = _mm_cvtss_f32(_mm_shuffle_ps(result, result, _MM_SHUFFLE(1, 1, 1, 1)));
+        }
+
+        //Same alignment requirements as 'intersectRayWithBox()'
+        inline Overlap overlapBoxWithBox(const float * boxMin, const float * boxMax, const TestBounds& query) noexcept {
+            const __m128 nodeMin = _mm_load_ps(boxMin);
+            const __m128 nodeMax = _mm_load_ps(boxMax);
+            const __m128 queryMin = _mm_load_ps(query.min);
+            const __m128 queryMax = _mm_load_ps(query.max);
+            const int overlaps = _mm_movemask_ps(_mm_and_ps(_mm_cmple_ps(nodeMin, queryMax), _mm_cmple_ps(queryMin, nodeMax)));
+            if ((overlaps & 7) != 7)
+                return Overlap::OUTSIDE;
+            const int contained = _mm_movemask_ps(_mm_and_ps(_mm_cmple_ps(queryMin, nodeMin), _mm_cmple_ps(nodeMax, queryMax)));
+            return (((contained & 7) == 7) ? Overlap::INSIDE : Overlap::PARTIAL);
+        }
+
+        //Each plane is tested against the corner of the box furthest along the plane's normal (if even that corner
+        //is outside, the whole box is) and against the opposite corner (if even that one is inside, the whole box is)
+        inline Overlap overlapBoxWithFrustum(const float * boxMin, const float * boxMax, const FrustumSetup& frustum) noexcept {
+            const __m128 minX = _mm_set1_ps(boxMin[0]), minY = _mm_set1_ps(boxMin[1]), minZ = _mm_set1_ps(boxMin[2]);
+            const __m128 maxX = _mm_set1_ps(boxMax[0]), maxY = _mm_set1_ps(boxMax[1]), maxZ = _mm_set1_ps(boxMax[2]);
+            const __m128 zero = _mm_setzero_ps();
+            bool inside = true;
+            for (size_t group = 0u; group < 2u; group++) {
+                const __m128 a = _mm_load_ps(frustum.a[group]), b = _mm_load_ps(frustum.b[group]);
+                const __m128 c = _mm_load_ps(frustum.c[group]), d = _mm_load_ps(frustum.d[group]);
+                const __m128 ax0 = _mm_mul_ps(a, minX), ax1 = _mm_mul_ps(a, maxX);
+                const __m128 by0 = _mm_mul_ps(b, minY), by1 = _mm_mul_ps(b, maxY);
+                const __m128 cz0 = _mm_mul_ps(c, minZ), cz1 = _mm_mul_ps(c, maxZ);
+                const __m128 furthest = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_max_ps(ax0, ax1), _mm_max_ps(by0, by1)), _mm_max_ps(cz0, cz1)), d);
+                if (_mm_movemask_ps(_mm_cmplt_ps(furthest, zero)) != 0)
+                    return Overlap::OUTSIDE;
+                const __m128 nearest = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_min_ps(ax0, ax1), _mm_min_ps(by0, by1)), _mm_min_ps(cz0, cz1)), d);
+                inside = (inside && (_mm_movemask_ps(_mm_cmplt_ps(nearest, zero)) == 0));
+            }
+            return (inside ? Overlap::INSIDE : Overlap::PARTIAL);
+        }
+
+#else //Scalar fallbacks, which give exactly the same results
+
+        inline float intersectRayWithBox(const float * boxMin, const float * boxMax, const RaySetup& ray, float maxDistance) noexcept {
+            float entry = 0.0f, exit = maxDistance;
+            for (int axis = 0; axis < 3; axis++) {
+                const float t1 = ((boxMin[axis] - ray.origin[axis]) * ray.inverseDirection[axis]);
+                const float t2 = ((boxMax[axis] - ray.origin[axis]) * ray.inverseDirection[axis]);
+                entry = std::max(entry, std::min(t1, t2));
+                exit = std::min(exit, (std::max(t1, t2) * RAY_EXIT_SCALE));
+            }
+            return ((entry <= exit) ? entry : NO_HIT);
+        }
+
+        inline void intersectRayWithChildren(const BVHNode * children, const RaySetup& ray, float maxDistance, float (&entries)[2]) noexcept {
+            for (int child = 0; child < 2; child++)
+                entries[child] = intersectRayWithBox(children[child].boundsMin, children[child].boundsMax, ray, maxDistance);
+        }
+
+        inline Overlap overlapBoxWithBox(const float * boxMin, const float * boxMax, const TestBounds& query) noexcept {
+            bool contained = true;
+            for (int axis = 0; axis < 3; axis++) {
+                if ((boxMin[axis] > query.max[axis]) || (query.min[axis] > boxMax[axis]))
+                    return Overlap::OUTSIDE;
+                contained = (contained && (query.min[axis] <= boxMin[axis]) && (boxMax[axis] <= query.max[axis]));
+            }
+            return (contained ? Overlap::INSIDE : Overlap::PARTIAL);
+        }
+
+        inline Overlap overlapBoxWithFrustum(const float * boxMin, const float * boxMax, const FrustumSetup& frustum) noexcept {
+            bool inside = true;
+            for (size_t plane = 0u; plane < 8u; plane++) {
+                const size_t group = (plane / 4u), lane = (plane % 4u);
+                const float ax0 = (frustum.a[group][lane] * boxMin[0]), ax1 = (frustum.a[group][lane] * boxMax[0]);
+                const float by0 = (frustum.b[group][lane] * boxMin[1]), by1 = (frustum.b[group][lane] * boxMax[1]);
+                const float cz0 = (frustum.c[group][lane] * boxMin[2]), cz1 = (frustum.c[group][lane] * boxMax[2]);
+                const float furthest = (((std::max(ax0, ax1) + std::max(by0, by1)) + std::max(cz0, cz1)) + frustum.d[group][lane]);
+                if (furthest < 0.0f)
+                    return Overlap::OUTSIDE;
+                const float nearest = (((std::min(ax0, ax1) + std::min(by0, by1)) + std::min(cz0, cz1)) + frustum.d[group][lane]);
+                inside = (inside && (nearest >= 0.0f));
+            }
+            return (inside ? Overlap::INSIDE : Overlap::PARTIAL);
+        }
+
+#endif //TRIANGLE_BVH_USE_SSE2_
+
+        inline float intersectRayWithNode(const BVHNode& node, const RaySetup& ray, float maxDistance) noexcept {
+            return intersectRayWithBox(node.boundsMin, node.boundsMax, ray, maxDistance);
+        }
+
+        //Moller-Trumbore, hitting both sides of the triangle. Returns false on a miss or a hit past 'maxDistance'.
+        inline bool intersectRayWithTriangle(const float (&corners)[3][3], const RaySetup& ray, float maxDistance,
+                                             float& distance, float& u, float& v) noexcept {
+            const glm::vec3 corner0(corners[0][0], corners[0][1], corners[0][2]);
+            const glm::vec3 edge1 = (glm::vec3(corners[1][0], corners[1][1], corners[1][2]) - corner0);
+            const glm::vec3 edge2 = (glm::vec3(corners[2][0], corners[2][1], corners[2][2]) - corner0);
+            const glm::vec3 p = glm::cross(ray.rayDirection, edge2);
+            const float determinant = glm::dot(edge1, p);
+            if (determinant == 0.0f)
+                return false;
+            const float inverseDeterminant = (1.0f / determinant);
+            const glm::vec3 s = (ray.rayOrigin - corner0);
+            u = (glm::dot(s, p) * inverseDeterminant);
+            if ((u < 0.0f) || (u > 1.0f))
+                return false;
+            const glm::vec3 q = glm::cross(s, edge1);
+            v = (glm::dot(ray.rayDirection, q) * inverseDeterminant);
+            if ((v < 0.0f) || ((u + v) > 1.0f))
+                return false;
+            distance = (glm::dot(edge2, q) * inverseDeterminant);
+            return ((distance >= 0.0f) && (distance <= maxDistance));
+        }
+
+        //A node waiting on the traversal stack, along with how far along the ray it was entered
+        struct StackEntry {
+            uint32_t node;
+            float entry;
+        };
+
+    } //namespace
+
+
+    unsigned int chooseBVHBuildThreadCount(size_t triangleCount) noexcept {
+        return chooseParallelThreadCount(triangleCount, MIN_TRIANGLES_PER_BVH_BUILD_THREAD);
+    }
+
+
+    //Each row of the matrix is a plane in clip space, and a point is inside the frustum when -w <= x, y, z <= w
+    BVHFrustum extractFrustumPlanes(const float * viewProjection) noexcept {
+        auto row = [viewProjection](int r) {
+            return std::array<float, 4>{ viewProjection[r], viewProjection[4 + r], viewProjection[8 + r], viewProjection[12 + r] };
+        };
+        const std::array<float, 4> w = row(3);
+        BVHFrustum frustum;
+        for (int axis = 0; axis < 3; axis++) {
+            const std::array<float, 4> r = row(axis);
+            for (int i = 0; i < 4; i++) {
+                frustum.planes[2 * axis][i] = (w[i] + r[i]);       //left, bottom, near
+                frustum.planes[(2 * axis) + 1][i] = (w[i] - r[i]); //right, top, far
+            }
+        }
+        return frustum;
+    }
+
+
+    bool TriangleBVH::build(const float * vertices, size_t vertexStride, size_t vertexCount, const uint32_t * indices,
+                            size_t indexCount, unsigned int threadCount) {
+        return buildFromTriangles(vertices, vertexStride, vertexCount, indices, indexCount, threadCount);
+    }
+
+    bool TriangleBVH::build(const float * vertices, size_t vertexStride, size_t vertexCount, const uint16_t * indices,
+                            size_t indexCount, unsigned int threadCount) {
+        return buildFromTriangles(vertices, vertexStride, vertexCount, indices, indexCount, threadCount);
+    }
+
+    bool TriangleBVH::build(const QuickObj& mesh, unsigned int threadCount) {
+        const size_t vertexSize = mesh.getVertexSize();
+        const size_t vertexCount = (mesh.mVertices_.size() / vertexSize);
+        if (!mesh.isIndexed())
+            return build(mesh.mVertices_.data(), vertexSize, vertexCount, static_cast<const uint32_t *>(nullptr), vertexCount, threadCount);
+        if (mesh.uses16BitIndices())
+            return build(mesh.mVertices_.data(), vertexSize, vertexCount, mesh.mIndices16_.data(), mesh.mIndices16_.size(), threadCount);
+        return build(mesh.mVertices_.data(), vertexSize, vertexCount, mesh.mIndices32_.data(), mesh.mIndices32_.size(), threadCount);
+    }
+
+
+    template<typename Index>
+    bool TriangleBVH::buildFromTriangles(const float * vertices, size_t vertexStride, size_t vertexCount, const Index * indices,
+                                         size_t indexCount, unsigned int threadCount) {
+        clear();
+        if ((vertexStride < VERTICES_PER_TRIANGLE) || ((indexCount % VERTICES_PER_TRIANGLE) != 0u)) {
+            fprintf(ERRLOG, "\nERROR! Unable to build a BVH over %zu indices into vertices of %zu floats!\n", indexCount, vertexStride);
+            return false;
+        }
+        const size_t triangleCount = (indexCount / VERTICES_PER_TRIANGLE);
+        if (triangleCount > std::numeric_limits<uint32_t>::max()) {
+            fprintf(ERRLOG, "\nERROR! Unable to build a BVH over %zu triangles, the limit is 2^32!\n", triangleCount);
+            return false;
+        }
+        if (threadCount == AUTOMATIC_BVH_BUILD_THREAD_COUNT)
+            threadCount = chooseBVHBuildThreadCount(triangleCount);
+
+        gatherTriangles(vertices, vertexStride, vertexCount, indices, triangleCount, threadCount);
+        if (!mTriangles_.empty())
+            buildTree(threadCount);
+        return true;
+    }
+
+
+    //Done in 2 passes over the same ranges of triangles: first each range counts its usable triangles, then each
+    //range copies its usable triangles into place right after the previous range's
+    template<typename Index>
+    void TriangleBVH::gatherTriangles(const float * vertices, size_t vertexStride, size_t vertexCount, const Index * indices,
+                                      size_t triangleCount, unsigned int threadCount) {
+        auto fetchTriangle = [=](size_t triangle, BVHTriangle& destination) {
+            for (size_t corner = 0u; corner < VERTICES_PER_TRIANGLE; corner++) {
+                const size_t cornerIndex = ((triangle * VERTICES_PER_TRIANGLE) + corner);
+                const size_t vertex = ((indices != nullptr) ? static_cast<size_t>(indices[cornerIndex]) : cornerIndex);
+                if (vertex >= vertexCount)
+                    return false;
+                for (size_t axis = 0u; axis < 3u; axis++) {
+                    destination.corners[corner][axis] = vertices[(vertex * vertexStride) + axis];
+                    if (!std::isfinite(destination.corners[corner][axis]))
+                        return false;
+                }
+            }
+            const glm::vec3 corner0(destination.corners[0][0], destination.corners[0][1], destination.corners[0][2]);
+            const glm::vec3 edge1 = (glm::vec3(destination.corners[1][0], destination.corners[1][1], destination.corners[1][2]) - corner0);
+            const glm::vec3 edge2 = (glm::vec3(destination.corners[2][0], destination.corners[2][1], destination.corners[2][2]) - corner0);
+            return (glm::cross(edge1, edge2) != glm::vec3(0.0f));
+        };
+
+        const size_t rangeCount = countParallelRanges(threadCount, triangleCount);
+        std::vector<size_t> rangeStarts(rangeCount + 1u, 0u);
+        runInParallelRanges(rangeCount, triangleCount, [&](size_t range, size_t begin, size_t end) {
+            BVHTriangle triangle;
+            for (size_t i = begin; i < end; i++) {
+                if (fetchTriangle(i, triangle))
+                    rangeStarts[range + 1u]++;
+            }
+        });
+        for (size_t range = 0u; range < rangeCount; range++)
+            rangeStarts[range + 1u] += rangeStarts[range];
+
+        mTriangles_.resize(rangeStarts[rangeCount]);
+        mTriangleIds_.resize(rangeStarts[rangeCount]);
+        runInParallelRanges(rangeCount, triangleCount, [&](size_t range, size_t begin, size_t end) {
+            size_t destination = rangeStarts[range];
+            for (size_t i = begin; i < end; i++) {
+                if (fetchTriangle(i, mTriangles_[destination])) {
+                    mTriangleIds_[destination] = static_cast<uint32_t>(i);
+                    destination++;
+                }
+            }
+        });
+    }
+
+
+    void TriangleBVH::buildTree(unsigned int threadCount) {
+        const size_t triangleCount = mTriangles_.size();
+        std::vector<Bounds> triangleBounds(triangleCount);
+        std::vector<glm::vec3> centers(triangleCount);
+        std::vector<uint32_t> order(triangleCount);
+        const size_t rangeCount = countParallelRanges(threadCount, triangleCount);
+        std::vector<PendingNode> rangeRoots(rangeCount);
+        runInParallelRanges(rangeCount, triangleCount, [&](size_t range, size_t begin, size_t end) {
+            PendingNode& root = rangeRoots[range];
+            for (size_t i = begin; i < end; i++) {
+                triangleBounds[i] = computeTriangleBounds(mTriangles_[i].corners);
+                centers[i] = computeCenter(triangleBounds[i]);
+                order[i] = static_cast<uint32_t>(i);
+                root.bounds.grow(triangleBounds[i]);
+                root.centers.grow(centers[i]);
+            }
+        });
+        PendingNode root = { 0u, 0u, triangleCount, Bounds(), Bounds(), 1u };
+        for (const PendingNode& rangeRoot : rangeRoots) {
+            root.bounds.grow(rangeRoot.bounds);
+            root.centers.grow(rangeRoot.centers);
+        }
+
+        //Phase 1: split the large nodes near the root, binning each one on as many threads as it is worth
+        TreeBuilder builder(centers, triangleBounds, order);
+        mNodes_.push_back(TreeBuilder::makeNode(root.bounds));
+        std::vector<PendingNode> stack = { root };
+        std::vector<PendingNode> subtreeRoots;
+        while (!stack.empty()) {
+            const PendingNode pending = stack.back();
+            stack.pop_back();
+            const size_t count = (pending.end - pending.begin);
+            if (count < SUBTREE_BUILD_TRIANGLES) {
+                subtreeRoots.push_back(pending);
+                continue;
+            }
+            const size_t binningThreads = std::min(static_cast<size_t>(threadCount), (count / MIN_TRIANGLES_PER_BVH_BUILD_THREAD));
+            //Nodes this big always get split, since they hold far more triangles than a leaf can
+            Split split = builder.chooseSplit(pending, countParallelRanges(static_cast<unsigned int>(binningThreads), count));
+            const size_t middle = builder.partition(pending, split);
+            TreeBuilder::pushChildren(pending, split, middle, mNodes_, stack);
+        }
+
+        //Phase 2: build the small nodes' subtrees in parallel, then append them in the order they were set aside
+        std::vector<std::vector<BVHNode>> subtrees(subtreeRoots.size());
+        std::vector<size_t> subtreeDepths(subtreeRoots.size(), 0u);
+        runInParallelRanges(countParallelRanges(threadCount, subtreeRoots.size()), subtreeRoots.size(), [&](size_t, size_t begin, size_t end) {
+            TreeBuilder subtreeBuilder(centers, triangleBounds, order);
+            for (size_t i = begin; i < end; i++)
+                subtreeDepths[i] = subtreeBuilder.buildSubtree(subtreeRoots[i], subtrees[i]);
+        });
+        for (size_t i = 0u; i < subtrees.size(); i++) {
+            //Every node but the subtree's root gets appended, so a local index of 1 lands at 'base'
+            const size_t base = mNodes_.size();
+            auto relocate = [base](BVHNode node) {
+                if (!node.isLeaf())
+                    node.first = static_cast<uint32_t>((base + node.first) - 1u);
+                return node;
+            };
+            mNodes_[subtreeRoots[i].node] = relocate(subtrees[i][0]);
+            for (size_t node = 1u; node < subtrees[i].size(); node++)
+                mNodes_.push_back(relocate(subtrees[i][node]));
+            mDepth_ = std::max(mDepth_, subtreeDepths[i]);
+        }
+
+        //Put the triangles into the order the leaves refer to them in
+        std::vector<BVHTriangle> orderedTriangles(triangleCount);
+        std::vector<uint32_t> orderedIds(triangleCount);
+        runInParallelRanges(rangeCount, triangleCount, [&](size_t, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                orderedTriangles[i] = mTriangles_[order[i]];
+                orderedIds[i] = mTriangleIds_[order[i]];
+            }
+        });
+        mTriangles_.swap(orderedTriangles);
+        mTriangleIds_.swap(orderedIds);
+    }
+
+
+    void TriangleBVH::clear() noexcept {
+        mNodes_.clear();
+        mTriangles_.clear();
+        mTriangleIds_.clear();
+        mDepth_ = 0u;
+    }
+
+
+    bool TriangleBVH::castRay(const float origin[3], const float direction[3], float maxDistance, BVHRayHit& hit) const noexcept {
+        if (mNodes_.empty())
+            return false;
+        const RaySetup ray(origin, direction);
+        float closest = maxDistance;
+        bool foundHit = false;
+
+        StackEntry stack[MAX_QUERY_DEPTH];
+        size_t stackSize = 0u;
+        const float rootEntry = intersectRayWithNode(mNodes_[0], ray, closest);
+        if (rootEntry == NO_HIT)
+            return false;
+        stack[stackSize++] = { 0u, rootEntry };
+
+        while (stackSize > 0u) {
+            const StackEntry current = stack[--stackSize];
+            if (current.entry > closest) //Something closer was found since this node was pushed
+                continue;
+            const BVHNode& node = mNodes_[current.node];
+            if (node.isLeaf()) {
+                for (uint32_t i = node.first; i < (node.first + node.triangleCount); i++) {
+                    float distance, u, v;
+                    if (intersectRayWithTriangle(mTriangles_[i].corners, ray, closest, distance, u, v)) {
+                        closest = distance;
+                        hit = { distance, mTriangleIds_[i], u, v };
+                        foundHit = true;
+                    }
+                }
+                continue;
+            }
+            //Push the further child first so that the nearer one is visited first
+            float entries[2];
+            intersectRayWithChildren(&mNodes_[node.first], ray, closest, entries);
+            const bool firstIsNearer = (entries[0] <= entries[1]);
+            const StackEntry nearer = { (firstIsNearer ? node.first : (node.first + 1u)), std::min(entries[0], entries[1]) };
+            const StackEntry further = { (firstIsNearer ? (node.first + 1u) : node.first), std::max(entries[0], entries[1]) };
+            if (further.entry != NO_HIT)
+                stack[stackSize++] = further;
+            if (nearer.entry != NO_HIT)
+                stack[stackSize++] = nearer;
+        }
+        return foundHit;
+    }
+
+
+    bool TriangleBVH::isOccluded(const float origin[3], const float direction[3], float maxDistance) const noexcept {
+        if (mNodes_.empty())
+            return false;
+        const RaySetup ray(origin, direction);
+        uint32_t stack[MAX_QUERY_DEPTH];
+        size_t stackSize = 0u;
+        if (intersectRayWithNode(mNodes_[0], ray, maxDistance) == NO_HIT)
+            return false;
+        stack[stackSize++] = 0u;
+
+        while (stackSize > 0u) {
+            const BVHNode& node = mNodes_[stack[--stackSize]];
+            if (node.isLeaf()) {
+                for (uint32_t i = node.first; i < (node.first + node.triangleCount); i++) {
+                    float distance, u, v;
+                    if (intersectRayWithTriangle(mTriangles_[i].corners, ray, maxDistance, distance, u, v))
+                        return true;
+                }
+                continue;
+            }
+            float entries[2];
+            intersectRayWithChildren(&mNodes_[node.first], ray, maxDistance, entries);
+            for (uint32_t child = 0u; child < 2u; child++) {
+                if (entries[child] != NO_HIT)
+                    stack[stackSize++] = (node.first + child);
+            }
+        }
+        return false;
+    }
+
+
+    size_t TriangleBVH::findTrianglesOverlappingBox(const float boxMin[3], const float boxMax[3], std::vector<uint32_t>& triangles) const {
+        const size_t initialSize = triangles.size();
+        if (mNodes_.empty())
+            return 0u;
+        Bounds queryBounds;
+        queryBounds.min = glm::vec3(boxMin[0], boxMin[1], boxMin[2]);
+        queryBounds.max = glm::vec3(boxMax[0], boxMax[1], boxMax[2]);
+        const TestBounds query(queryBounds);
+
+        uint32_t stack[MAX_QUERY_DEPTH];
+        size_t stackSize = 0u;
+        stack[stackSize++] = 0u;
+        while (stackSize > 0u) {
+            const BVHNode& node = mNodes_[stack[--stackSize]];
+            const Overlap overlap = overlapBoxWithBox(node.boundsMin, node.boundsMax, query);
+            if (overlap == Overlap::OUTSIDE)
+                continue;
+            if (overlap == Overlap::INSIDE) {
+                appendSubtreeTriangles(node, triangles);
+                continue;
+            }
+            if (!node.isLeaf()) {
+                stack[stackSize++] = (node.first + 1u);
+                stack[stackSize++] = node.first;
+                continue;
+            }
+            for (uint32_t i = node.first; i < (node.first + node.triangleCount); i++) {
+                const TestBounds triangle(computeTriangleBounds(mTriangles_[i].corners));
+                if (overlapBoxWithBox(triangle.min, triangle.max, query) != Overlap::OUTSIDE)
+                    triangles.push_back(mTriangleIds_[i]);
+            }
+        }
+        return (triangles.size() - initialSize);
+    }
+
+
+    size_t TriangleBVH::findTrianglesInFrustum(const BVHFrustum& frustum, std::vector<uint32_t>& triangles) const {
+        const size_t initialSize = triangles.size();
+        if (mNodes_.empty())
+            return 0u;
+        const FrustumSetup query(frustum);
+
+        uint32_t stack[MAX_QUERY_DEPTH];
+        size_t stackSize = 0u;
+        stack[stackSize++] = 0u;
+        while (stackSize > 0u) {
+            const BVHNode& node = mNodes_[stack[--stackSize]];
+            const Overlap overlap = overlapBoxWithFrustum(node.boundsMin, node.boundsMax, query);
+            if (overlap == Overlap::OUTSIDE)
+                continue;
+            if (overlap == Overlap::INSIDE) {
+                appendSubtreeTriangles(node, triangles);
+                continue;
+            }
+            if (!node.isLeaf()) {
+                stack[stackSize++] = (node.first + 1u);
+                stack[stackSize++] = node.first;
+                continue;
+            }
+            for (uint32_t i = node.first; i < (node.first + node.triangleCount); i++) {
+                const TestBounds triangle(computeTriangleBounds(mTriangles_[i].corners));
+                if (overlapBoxWithFrustum(triangle.min, triangle.max, query) != Overlap::OUTSIDE)
+                    triangles.push_back(mTriangleIds_[i]);
+            }
+        }
+        return (triangles.size() - initialSize);
+    }
+
+
+    //A subtree's triangles are contiguous, running from its leftmost leaf's first triangle to its rightmost leaf's last
+    void TriangleBVH::appendSubtreeTriangles(const BVHNode& node, std::vector<uint32_t>& triangles) const {
+        const BVHNode * leftmost = &node;
+        while (!leftmost->isLeaf())
+            leftmost = &mNodes_[leftmost->first];
+        const BVHNode * rightmost = &node;
+        while (!rightmost->isLeaf())
+            rightmost = &mNodes_[rightmost->first + 1u];
+        triangles.insert(triangles.end(), mTriangleIds_.begin() + leftmost->first,
+                         mTriangleIds_.begin() + (rightmost->first + rightmost->triangleCount));
+    }
+
+
+    float TriangleBVH::computeSAHCost() const noexcept {
+        if (mNodes_.empty())
+            return 0.0f;
+        auto halfArea = [](const BVHNode& node) {
+            Bounds bounds;
+            bounds.min = glm::vec3(node.boundsMin[0], node.boundsMin[1], node.boundsMin[2]);
+            bounds.max = glm::vec3(node.boundsMax[0], node.boundsMax[1], node.boundsMax[2]);
+            return static_cast<double>(bounds.halfArea());
+        };
+        const double rootArea = halfArea(mNodes_[0]);
+        if (rootArea <= 0.0)
+            return 0.0f;
+        double cost = 0.0;
+        for (const BVHNode& node : mNodes_)
+            cost += (halfArea(node) * (node.isLeaf() ? (static_cast<double>(node.triangleCount) * TRIANGLE_COST) : TRAVERSAL_COST));
+        return static_cast<float>(cost / rootArea);
+    }
+
+} //namespace AssetLoadingInternal
@@ -0,0 +1,166 @@
+// File:           TriangleBVH.h
+// Class:          TriangleBVH
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    A bounding volume hierarchy (BVH) over the triangles of a loaded mesh, so that picking
+//                 (which triangle does a ray hit?) and visibility queries (which triangles are inside a box
+//                 or the view frustum?) don't have to test every triangle of the mesh one by one.
+//
+//                 The tree is binary. Each node holds the bounding box of every triangle beneath it, and
+//                 each leaf holds a handful of triangles. Queries walk down from the root, skipping every
+//                 node whose box can't possibly contain a result.
+//
+// Building:       Nodes are split using the surface area heuristic (SAH): the triangles' centers are
+//                 sorted into 16 bins along each axis and the split between bins that minimizes
+//                     (area of left box * triangles on left) + (area of right box * triangles on right)
+//                 is chosen, since the chance of a random ray hitting a box is proportional to its area.
+//                 A node becomes a leaf once no split is cheaper than testing its triangles directly.
+//
+//                 The binning of the large nodes near the root is split across threads, with every thread
+//                 binning a range of the node's triangles into its own bins. Once the nodes get small
+//                 enough, whole subtrees are built on separate threads. Neither changes the tree that gets
+//                 built: the same mesh always produces exactly the same nodes no matter how many threads
+//                 are used.
+//
+// Node Layout:    Nodes are 32 bytes (see BVHNode) and are stored flattened into a single array, with the
+//                 two children of a node always next to each other. The triangles are copied into the
+//                 order the leaves reference them in, so that the triangles of a leaf (or of any subtree)
+//                 are contiguous.
+//
+// Queries:        The box tests at each node are done with 4-wide SSE instructions (x, y and z of a box in
+//                 one register for rays and boxes, 4 planes at a time for frustums). There is a scalar path
+//                 which gives the same results on platforms without SSE2.
+//                 Box and frustum queries are conservative: a triangle is reported if its bounding box
+//                 overlaps the box or isn't entirely outside of any of the frustum's planes.
+//
+// Note:           Only the x, y and z of each vertex position are used, i.e. the BVH is in the mesh's own
+//                 coordinates (QuickObj stores the model's scale as 'w'). Degenerate triangles (such as the
+//                 ones QuickObj uses for line primitives), triangles with an out-of-range index and triangles
+//                 with non-finite positions are left out of the BVH.
+//                 Triangles are reported by their index in the mesh the BVH was built from (the triangle
+//                 formed by indices 3i, 3i+1 and 3i+2 is triangle i).
+
+#pragma once
+
+#ifndef TRIANGLE_BVH_H_
+#define TRIANGLE_BVH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class QuickObj;
+
+namespace AssetLoadingInternal {
+
+    //Passing this as the thread count lets the BVH decide how many threads to build with
+    static constexpr const unsigned int AUTOMATIC_BVH_BUILD_THREAD_COUNT = 0u;
+
+    //Nodes with fewer than this many triangles per thread aren't worth binning on multiple threads
+    static constexpr const size_t MIN_TRIANGLES_PER_BVH_BUILD_THREAD = 65536u;
+
+    //Returns how many threads to use when building a BVH over the given number of triangles
+    unsigned int chooseBVHBuildThreadCount(size_t triangleCount) noexcept;
+
+    //One node of the flattened tree. The bounds and the index that follows each of them fill 16 bytes
+    //apiece, so each half of the node can be loaded into an SSE register in one go.
+    typedef struct alignas(32) BVHNode {
+        float boundsMin[3];
+        uint32_t first;            //Leaves: the first of the node's triangles. Interior nodes: the first child
+                                   //(the second child is always right after it)
+        float boundsMax[3];
+        uint32_t triangleCount;    //0 for interior nodes
+        bool isLeaf() const noexcept { return (triangleCount != 0u); }
+    } BVHNode;
+    static_assert(sizeof(BVHNode) == 32u, "BVHNode is meant to be 32 bytes");
+
+    //The closest hit found by 'TriangleBVH::castRay()'
+    typedef struct BVHRayHit {
+        float distance;      //How far along the ray the hit is, in multiples of the ray direction's length
+        uint32_t triangle;   //The triangle that was hit
+        float u, v;          //Barycentric coordinates of the hit, so the hit is at  (1-u-v)*v0 + u*v1 + v*v2
+    } BVHRayHit;
+
+    //Six planes (left, right, bottom, top, near, far), each stored as (a, b, c, d) where a point (x, y, z)
+    //is on the inside of the plane when  a*x + b*y + c*z + d >= 0.  The planes don't need to be normalized.
+    typedef struct BVHFrustum {
+        float planes[6][4];
+    } BVHFrustum;
+
+    //Extracts the frustum's planes from a column-major 4x4 view-projection matrix [i.e. what glm::value_ptr()
+    //gives for a glm::mat4] using OpenGL's clip space. Pass in a model-view-projection matrix to get the
+    //frustum in the model's own coordinates, which is what the BVH is in.
+    BVHFrustum extractFrustumPlanes(const float * viewProjection) noexcept;
+
+    class TriangleBVH final {
+    public:
+        TriangleBVH() = default;
+        ~TriangleBVH() = default;
+
+        //Builds the BVH over 'indexCount' / 3 indexed triangles. Each of the 'vertexCount' vertices is 'vertexStride'
+        //floats, with its position in the first 3. Pass null for 'indices' (and the vertex count as 'indexCount') for
+        //triangles stored as 3 consecutive vertices each. Up to 'threadCount' threads are used. Returns false (and
+        //leaves the BVH empty) if the vertex stride is less than 3 or the index count isn't a multiple of 3.
+        bool build(const float * vertices, size_t vertexStride, size_t vertexCount, const uint32_t * indices,
+                   size_t indexCount, unsigned int threadCount = AUTOMATIC_BVH_BUILD_THREAD_COUNT);
+        bool build(const float * vertices, size_t vertexStride, size_t vertexCount, const uint16_t * indices,
+                   size_t indexCount, unsigned int threadCount = AUTOMATIC_BVH_BUILD_THREAD_COUNT);
+        //Builds the BVH over the triangles of a loaded mesh, whether it is EXPANDED or INDEXED
+        bool build(const QuickObj& mesh, unsigned int threadCount = AUTOMATIC_BVH_BUILD_THREAD_COUNT);
+
+        //Finds the closest triangle hit by the ray from 'origin' along 'direction' (which doesn't need to be
+        //normalized), no further than 'maxDistance' multiples of 'direction'. Both sides of each triangle can
+        //be hit. Returns false if nothing was hit, in which case 'hit' is left alone.
+        bool castRay(const float origin[3], const float direction[3], float maxDistance, BVHRayHit& hit) const noexcept;
+        //Returns true as soon as any triangle is found within 'maxDistance' along the ray. Cheaper than
+        //'castRay()' when only whether something is in the way matters (e.g. for line of sight).
+        bool isOccluded(const float origin[3], const float direction[3], float maxDistance) const noexcept;
+
+        //Appends every triangle whose bounding box overlaps the box from 'boxMin' to 'boxMax' onto 'triangles'
+        //(in no particular order), returning how many were appended
+        size_t findTrianglesOverlappingBox(const float boxMin[3], const float boxMax[3], std::vector<uint32_t>& triangles) const;
+        //Appends every triangle that is at least partly inside the frustum onto 'triangles' (in no particular
+        //order), returning how many were appended
+        size_t findTrianglesInFrustum(const BVHFrustum& frustum, std::vector<uint32_t>& triangles) const;
+
+        bool empty() const noexcept { return mNodes_.empty(); }
+        //The number of triangles in the BVH, which doesn't include any that were left out
+        size_t getTriangleCount() const noexcept { return mTriangleIds_.size(); }
+        const std::vector<BVHNode>& getNodes() const noexcept { return mNodes_; }
+        //The length of the longest path from the root to a leaf (a BVH with just a root has a depth of 1)
+        size_t getDepth() const noexcept { return mDepth_; }
+        //The SAH cost of the whole tree relative to its root's area, which is the expected cost of a ray that
+        //hits the root's box. Lower is better, useful for comparing 2 ways of building the same mesh's BVH.
+        float computeSAHCost() const noexcept;
+
+    private:
+        //A triangle's 3 corner positions, in the order the leaves reference the triangles
+        typedef struct BVHTriangle {
+            float corners[3][3];
+        } BVHTriangle;
+
+        std::vector<BVHNode> mNodes_;
+        std::vector<BVHTriangle> mTriangles_;
+        std::vector<uint32_t> mTriangleIds_;  //The index in the original mesh of each triangle in mTriangles_
+        size_t mDepth_ = 0u;
+
+        void clear() noexcept;
+        //Builds the whole BVH, see 'build()'
+        template<typename Index>
+        bool buildFromTriangles(const float * vertices, size_t vertexStride, size_t vertexCount, const Index * indices,
+                                size_t indexCount, unsigned int threadCount);
+        //Copies every usable triangle into mTriangles_ (in the mesh's order) and its index into mTriangleIds_
+        template<typename Index>
+        void gatherTriangles(const float * vertices, size_t vertexStride, size_t vertexCount, const Index * indices,
+                             size_t triangleCount, unsigned int threadCount);
+        //Builds the tree over the gathered triangles, then puts the triangles into the order the leaves use them in
+        void buildTree(unsigned int threadCount);
+        //Appends every triangle beneath the node onto 'triangles', without testing any of them
+        void appendSubtreeTriangles(const BVHNode& node, std::vector<uint32_t>& triangles) const;
+    };
+
+} //namespace AssetLoadingInternal
+
+#endif //TRIANGLE_BVH_H_
@@ -0,0 +1,164 @@
+// File:           VertexAttributeStreams.h
+// Class:          VertexAttributeStreams
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Structure-of-arrays storage for one kind of vertex attribute (positions, texture
+//                 coordinates or normals) parsed out of a model file. The parse results used to hold
+//                 these as 'std::vector<Vertex>', where every element is a full 4-float Vertex object
+//                 (even for 2-component texture coordinates) and every read goes through the Vertex
+//                 class. Here each component instead gets its own contiguous float stream, which is
+//                 aligned to 32 bytes so that it can be read with whole AVX loads.
+//
+//                 Elements are added one at a time by the parsers (see 'push_back()'), or a whole
+//                 set of streams at once (see 'append()'). They are read back either one at a time
+//                 or in bulk through 'gather()', which copies the elements at a list of indices out
+//                 into interleaved vertex data. The gather is where assembling a mesh spends its time,
+//                 so when the compiler is targeting AVX2 it gathers 8 elements per instruction.
+//
+//                 This is header-only because it is a template over the number of components.
+//
+// Note:           Only as many components are stored as the parsers keep, which is 3 for positions and
+//                 normals and 2 for texture coordinates. The 'w' of a position has never been kept
+//                 (the 'w' component of the assembled vertices is the model's scale).
+
+#pragma once
+
+#ifndef VERTEX_ATTRIBUTE_STREAMS_H_
+#define VERTEX_ATTRIBUTE_STREAMS_H_
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define VERTEX_ATTRIBUTE_STREAMS_USE_AVX2_ 1
+#endif
+
+namespace AssetLoadingInternal {
+
+    //Hands out memory aligned to ALIGNMENT bytes
+    template<typename T, size_t ALIGNMENT>
+    class AlignedAllocator {
+    public:
+        using value_type = T;
+        template<typename U>
+        struct rebind { using other = AlignedAllocator<U, ALIGNMENT>; };
+
+        AlignedAllocator() noexcept = default;
+        template<typename U>
+        AlignedAllocator(const AlignedAllocator<U, ALIGNMENT>&) noexcept { ; }
+
+        T * allocate(size_t count) {
+            return static_cast<T *>(::operator new(count * sizeof(T), std::align_val_t(ALIGNMENT)));
+        }
+        void deallocate(T * memory, size_t) noexcept {
+            ::operator delete(memory, std::align_val_t(ALIGNMENT));
+        }
+
+        template<typename U>
+        bool operator==(const AlignedAllocator<U, ALIGNMENT>&) const noexcept { return true; }
+        template<typename U>
+        bool operator!=(const AlignedAllocator<U, ALIGNMENT>&) const noexcept { return false; }
+    };
+
+    static constexpr const size_t ATTRIBUTE_STREAM_ALIGNMENT = 32u;
+    using AttributeStream = std::vector<float, AlignedAllocator<float, ATTRIBUTE_STREAM_ALIGNMENT>>;
+
+
+    template<size_t COMPONENTS>
+    class VertexAttributeStreams final {
+        static_assert((COMPONENTS >= 1u) && (COMPONENTS <= 4u), "A vertex attribute has between 1 and 4 components");
+    public:
+        using Element = std::array<float, COMPONENTS>;
+
+        size_t size() const noexcept { return mStreams_[0].size(); }
+        bool empty() const noexcept { return mStreams_[0].empty(); }
+        size_t capacity() const noexcept { return mStreams_[0].capacity(); }
+        //The number of bytes held by all of the streams, including their unused capacity
+        size_t capacityInBytes() const noexcept { return (capacity() * COMPONENTS * sizeof(float)); }
+
+        void reserve(size_t elementCount) {
+            for (AttributeStream& stream : mStreams_)
+                stream.reserve(elementCount);
+        }
+        void clear() noexcept {
+            for (AttributeStream& stream : mStreams_)
+                stream.clear();
+        }
+        void shrink_to_fit() {
+            for (AttributeStream& stream : mStreams_)
+                stream.shrink_to_fit();
+        }
+
+        //Appends one element made from the first 'valueCount' values, with any components past them set to 0
+        void push_back(const float * values, size_t valueCount) {
+            for (size_t component = 0u; component < COMPONENTS; component++)
+                mStreams_[component].push_back((component < valueCount) ? values[component] : 0.0f);
+        }
+        void push_back(const Element& element) {
+            push_back(element.data(), COMPONENTS);
+        }
+
+        //Appends every element of 'other' onto the end of these streams
+        void append(const VertexAttributeStreams& other) {
+            for (size_t component = 0u; component < COMPONENTS; component++)
+                mStreams_[component].insert(mStreams_[component].end(), other.mStreams_[component].cbegin(), other.mStreams_[component].cend());
+        }
+
+        Element get(size_t elementIndex) const noexcept {
+            Element element;
+            for (size_t component = 0u; component < COMPONENTS; component++)
+                element[component] = mStreams_[component][elementIndex];
+            return element;
+        }
+        float get(size_t elementIndex, size_t component) const noexcept { return mStreams_[component][elementIndex]; }
+        const float * stream(size_t component) const noexcept { return mStreams_[component].data(); }
+
+        //Copies the elements at 'indices' out into interleaved data, with the components of the i'th element
+        //written to 'destination[(i * destinationStride) + component]'. Every index must be in range.
+        void gather(const uint32_t * indices, size_t count, float * destination, size_t destinationStride) const noexcept {
+            size_t i = 0u;
+#ifdef VERTEX_ATTRIBUTE_STREAMS_USE_AVX2_
+            //The gather instruction treats its indices as signed
+            static constexpr const size_t GATHER_WIDTH = 8u;
+            if (size() <= static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+                alignas(ATTRIBUTE_STREAM_ALIGNMENT) float gathered[COMPONENTS][GATHER_WIDTH];
+                for (; (i + GATHER_WIDTH) <= count; i += GATHER_WIDTH) {
+                    const __m256i offsets = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + i));
+                    for (size_t component = 0u; component < COMPONENTS; component++)
+                        _mm256_store_ps(gathered[component], _mm256_i32gather_ps(mStreams_[component].data(), offsets, sizeof(float)));
+                    for (size_t j = 0u; j < GATHER_WIDTH; j++) {
+                        float * output = destination + ((i + j) * destinationStride);
+                        for (size_t component = 0u; component < COMPONENTS; component++)
+                            output[component] = gathered[component][j];
+                    }
+                }
+            }
+#endif //VERTEX_ATTRIBUTE_STREAMS_USE_AVX2_
+            for (; i < count; i++) {
+                const uint32_t index = indices[i];
+                float * output = destination + (i * destinationStride);
+                for (size_t component = 0u; component < COMPONENTS; component++)
+                    output[component] = mStreams_[component][index];
+            }
+        }
+
+        bool operator==(const VertexAttributeStreams& other) const noexcept { return (mStreams_ == other.mStreams_); }
+        bool operator!=(const VertexAttributeStreams& other) const noexcept { return (mStreams_ != other.mStreams_); }
+
+    private:
+        std::array<AttributeStream, COMPONENTS> mStreams_;
+    };
+
+    using PositionStreams = VertexAttributeStreams<3u>;
+    using TexCoordStreams = VertexAttributeStreams<2u>;
+    using NormalStreams = VertexAttributeStreams<3u>;
+
+} //namespace AssetLoadingInternal
+
+#endif //VERTEX_ATTRIBUTE_STREAMS_H_
@@ -0,0 +1,151 @@
+// File:           VertexDeduplicationTable.h
+// Class:          VertexDeduplicationTable
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    An open-addressing hash table used for building indexed meshes. Each vertex
+//                 is described by a fixed-size key made up of 32-bit words, which can either be
+//                 the (position, texCoord, normal) index tuple straight out of an '.obj' file, or
+//                 the raw bit patterns of an already-assembled vertex's floats. The first time a
+//                 key is seen it is assigned the next available vertex index, every later lookup of
+//                 that same key returns the index it was originally assigned.
+//
+// Implementation: Linear probing over a power-of-two sized table that is kept no more than half
+//                 full. Keys and their assigned indices live in 2 separate arrays so that the probe
+//                 loop walks contiguous memory. There is no removal, since building a mesh only ever
+//                 adds vertices.
+//
+//                 This is header-only because it is a template over the number of words in a key.
+
+#pragma once
+
+#ifndef VERTEX_DEDUPLICATION_TABLE_H_
+#define VERTEX_DEDUPLICATION_TABLE_H_
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace AssetLoadingInternal {
+
+    template<size_t KEY_WORDS>
+    class VertexDeduplicationTable final {
+    public:
+        using Key = std::array<uint32_t, KEY_WORDS>;
+
+        //Returned by 'find()' for a key which was never inserted
+        static constexpr const uint32_t NOT_FOUND = std::numeric_limits<uint32_t>::max();
+
+        //The table is sized up front to hold 'expectedUniqueKeys' without having to grow
+        VertexDeduplicationTable(size_t expectedUniqueKeys) {
+            mUniqueKeyCount_ = 0u;
+            size_t capacity = MIN_CAPACITY;
+            while (capacity < (expectedUniqueKeys * 2u))
+                capacity *= 2u;
+            allocate(capacity);
+        }
+
+        ~VertexDeduplicationTable() = default;
+
+        VertexDeduplicationTable(const VertexDeduplicationTable&) = delete;
+        VertexDeduplicationTable& operator=(const VertexDeduplicationTable&) = delete;
+
+        //Returns the vertex index assigned to 'key'. If the key has not been seen before it is assigned
+        //the next index (which is equal to the number of unique keys seen before it) and 'inserted' is
+        //set to true so that the caller knows to emit a new vertex.
+        uint32_t findOrInsert(const Key& key, bool& inserted) {
+            size_t slot = hash(key) & mMask_;
+            while (mIndices_[slot] != EMPTY_SLOT) {
+                if (mKeys_[slot] == key) {
+                    inserted = false;
+                    return mIndices_[slot];
+                }
+                slot = (slot + 1u) & mMask_;
+            }
+
+            const uint32_t newIndex = static_cast<uint32_t>(mUniqueKeyCount_++);
+            mKeys_[slot] = key;
+            mIndices_[slot] = newIndex;
+            inserted = true;
+
+            if ((mUniqueKeyCount_ * 2u) > mIndices_.size())
+                grow();
+            return newIndex;
+        }
+
+        //Returns the vertex index assigned to 'key', or NOT_FOUND if the key has never been inserted
+        uint32_t find(const Key& key) const noexcept {
+            size_t slot = hash(key) & mMask_;
+            while (mIndices_[slot] != EMPTY_SLOT) {
+                if (mKeys_[slot] == key)
+                    return mIndices_[slot];
+                slot = (slot + 1u) & mMask_;
+            }
+            return NOT_FOUND;
+        }
+
+        //Returns the number of unique keys that have been inserted
+        size_t size() const noexcept { return mUniqueKeyCount_; }
+
+        //Forgets every key (so the next key inserted is assigned index 0 again) while keeping
+        //the table's current capacity
+        void clear() {
+            std::fill(mIndices_.begin(), mIndices_.end(), EMPTY_SLOT);
+            mUniqueKeyCount_ = 0u;
+        }
+
+    private:
+        static constexpr const size_t MIN_CAPACITY = 64u;
+        static constexpr const uint32_t EMPTY_SLOT = std::numeric_limits<uint32_t>::max();
+
+        std::vector<Key> mKeys_;
+        std::vector<uint32_t> mIndices_;
+        size_t mMask_;
+        size_t mUniqueKeyCount_;
+
+        void allocate(size_t capacity) {
+            mKeys_.assign(capacity, Key{});
+            mIndices_.assign(capacity, EMPTY_SLOT);
+            mMask_ = capacity - 1u;
+        }
+
+        //Doubles the capacity and re-inserts every key into its new slot
+        void grow() {
+            std::vector<Key> oldKeys;
+            std::vector<uint32_t> oldIndices;
+            oldKeys.swap(mKeys_);
+            oldIndices.swap(mIndices_);
+            allocate(oldIndices.size() * 2u);
+            for (size_t i = 0u; i < oldIndices.size(); i++) {
+                if (oldIndices[i] == EMPTY_SLOT)
+                    continue;
+                size_t slot = hash(oldKeys[i]) & mMask_;
+                while (mIndices_[slot] != EMPTY_SLOT)
+                    slot = (slot + 1u) & mMask_;
+                mKeys_[slot] = oldKeys[i];
+                mIndices_[slot] = oldIndices[i];
+            }
+        }
+
+        //Mixes each word into a 64-bit state, finished off with the 'fmix64' step from MurmurHash3 so
+        //that the low bits (which are all that get used for small tables) depend on every input bit
+        static size_t hash(const Key& key) noexcept {
+            uint64_t h = 0x9E3779B97F4A7C15ULL;
+            for (size_t i = 0u; i < KEY_WORDS; i++) {
+                h ^= key[i];
+                h *= 0xFF51AFD7ED558CCDULL;
+                h ^= (h >> 32u);
+            }
+            h ^= (h >> 33u);
+            h *= 0xC4CEB9FE1A85EC53ULL;
+            h ^= (h >> 33u);
+            return static_cast<size_t>(h);
+        }
+    };
+
+} //namespace AssetLoadingInternal
+
+#endif //VERTEX_DEDUPLICATION_TABLE_H_
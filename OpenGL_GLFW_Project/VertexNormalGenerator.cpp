@@ -0,0 +1,256 @@
+// File:           VertexNormalGenerator.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   The triangles come in expanded (every corner is its own vertex), so first every
+//                          corner is given a key for its (position, smoothing group) pair. Corners with the
+//                          same key are the ones whose normals get smoothed together, so the keys turn the
+//                          triangles into an indexed mesh as far as the normals are concerned. Positions are
+//                          compared by their exact bits (with -0.0 treated as 0.0), which is how the vertex
+//                          deduplication in QuickObj compares them as well. Flat shaded corners get no key.
+//
+//                          The normals are then generated in 2 scatter-add passes over the triangles:
+//                            Pass 1  Every corner adds its triangle's weighted normal onto its key's sum.
+//                            Pass 2  Only the corners whose triangle is within the crease angle of the
+//                                    normal from pass 1 add themselves again, so that the triangles on the
+//                                    far side of a hard edge don't bend the normals on this side of it.
+//                          Each corner ends up with its key's sum from pass 2 (normalized), unless it was
+//                          left out of pass 2, in which case it keeps its triangle's own normal.
+//
+//                          The weighted normals are converted to 64-bit fixed point before they are added up.
+//                          They are scaled so that the heaviest one is 2^40, which leaves room for millions
+//                          of triangles around one vertex before anything could overflow.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "VertexNormalGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "FloatingPointTolerance.h"
+#include "MeshFunctions.h"
+#include "ParallelRanges.h"
+#include "PositionKey.h"
+
+namespace AssetLoadingInternal {
+
+    namespace {
+
+        static constexpr const uint32_t NO_KEY = std::numeric_limits<uint32_t>::max();
+        //The group every triangle is put in when no smoothing groups are given
+        static constexpr const uint32_t SINGLE_SMOOTHING_GROUP = 1u;
+
+        static constexpr const double FIXED_POINT_SCALE = 1099511627776.0; //2^40
+        static constexpr const size_t VERTICES_PER_TRIANGLE = 3u;
+        static constexpr const size_t AXES = 3u;
+
+        static constexpr const double PI = 3.14159265358979323846;
+
+        //A corner's position plus its smoothing group, corners only share a normal when both match
+        typedef struct CornerKey {
+            PositionKey position;
+            uint32_t smoothingGroup;
+            bool operator==(const CornerKey& other) const noexcept {
+                return ((position == other.position) && (smoothingGroup == other.smoothingGroup));
+            }
+        } CornerKey;
+
+        struct CornerKeyHash {
+            size_t operator()(const CornerKey& key) const noexcept {
+                uint64_t hash = PositionKeyHash::hash(key.position);
+                hash ^= (static_cast<uint64_t>(key.smoothingGroup) + 0xBF58476D1CE4E5B9ull + (hash << 6) + (hash >> 2));
+                return static_cast<size_t>(hash);
+            }
+        };
+
+
+        class NormalGenerator final {
+        public:
+            NormalGenerator(const float * vertices, size_t vertexStride, size_t triangleCount, const uint32_t * triangleSmoothingGroups,
+                            unsigned int threadCount) : mVertices_(vertices), mVertexStride_(vertexStride), mTriangleCount_(triangleCount),
+                                                        mThreadCount_(std::max(threadCount, 1u)), mKeyCount_(0u) {
+                assignCornerKeys(triangleSmoothingGroups);
+                computeTriangleNormalsAndCornerWeights();
+            }
+
+            void generate(float creaseAngleDegrees, float * normals, size_t normalStride) {
+                const std::vector<int64_t> allCornerSums = accumulate(nullptr);
+
+                //Pass 2 only includes the corners within the crease angle of the normal from pass 1
+                const float minimumCosine = static_cast<float>(std::cos(static_cast<double>(creaseAngleDegrees) * (PI / 180.0)));
+                std::vector<uint8_t> cornerIsSmooth(mCornerKeys_.size(), 0u);
+                runInParallelRanges(countParallelRanges(mThreadCount_, mCornerKeys_.size()), mCornerKeys_.size(), [&](size_t, size_t begin, size_t end) {
+                    for (size_t corner = begin; corner < end; corner++) {
+                        if ((mCornerKeys_[corner] == NO_KEY) || (mCornerWeights_[corner] <= 0.0f))
+                            continue;
+                        glm::vec3 smoothNormal;
+                        if (normalizedSum(allCornerSums, mCornerKeys_[corner], smoothNormal))
+                            cornerIsSmooth[corner] = (glm::dot(smoothNormal, mTriangleNormals_[corner / VERTICES_PER_TRIANGLE]) >= minimumCosine);
+                    }
+                });
+                const std::vector<int64_t> smoothCornerSums = accumulate(cornerIsSmooth.data());
+
+                runInParallelRanges(countParallelRanges(mThreadCount_, mCornerKeys_.size()), mCornerKeys_.size(), [&](size_t, size_t begin, size_t end) {
+                    for (size_t corner = begin; corner < end; corner++) {
+                        glm::vec3 normal = mTriangleNormals_[corner / VERTICES_PER_TRIANGLE];
+                        if (cornerIsSmooth[corner]) {
+                            glm::vec3 smoothNormal;
+                            if (normalizedSum(smoothCornerSums, mCornerKeys_[corner], smoothNormal))
+                                normal = smoothNormal;
+                        }
+                        float * const destination = normals + (corner * normalStride);
+                        destination[0] = normal.x;
+                        destination[1] = normal.y;
+                        destination[2] = normal.z;
+                    }
+                });
+            }
+
+        private:
+            const float * mVertices_;
+            size_t mVertexStride_;
+            size_t mTriangleCount_;
+            unsigned int mThreadCount_;
+            size_t mKeyCount_;
+            std::vector<uint32_t> mCornerKeys_;
+            std::vector<glm::vec3> mTriangleNormals_;
+            std::vector<float> mCornerWeights_;  //Each corner's triangle's area times the angle at that corner
+            double mFixedPointScale_ = 0.0;
+
+            glm::vec3 position(size_t corner) const noexcept {
+                const float * const vertex = mVertices_ + (corner * mVertexStride_);
+                return glm::vec3(vertex[0], vertex[1], vertex[2]);
+            }
+
+            //Keys are handed out in order of first use, so they never depend on the thread count
+            void assignCornerKeys(const uint32_t * triangleSmoothingGroups) {
+                const size_t cornerCount = mTriangleCount_ * VERTICES_PER_TRIANGLE;
+                mCornerKeys_.resize(cornerCount);
+                std::unordered_map<CornerKey, uint32_t, CornerKeyHash> keys;
+                keys.reserve(cornerCount / 2u);
+                for (size_t corner = 0u; corner < cornerCount; corner++) {
+                    const uint32_t group = ((triangleSmoothingGroups != nullptr) ?
+                        triangleSmoothingGroups[corner / VERTICES_PER_TRIANGLE] : SINGLE_SMOOTHING_GROUP);
+                    if (group == FLAT_SHADED_SMOOTHING_GROUP) {
+                        mCornerKeys_[corner] = NO_KEY;
+                        continue;
+                    }
+                    const float * const vertex = mVertices_ + (corner * mVertexStride_);
+                    const CornerKey key = { makePositionKey(vertex), group };
+                    mCornerKeys_[corner] = keys.emplace(key, static_cast<uint32_t>(keys.size())).first->second;
+                }
+                mKeyCount_ = keys.size();
+            }
+
+            void computeTriangleNormalsAndCornerWeights() {
+                mTriangleNormals_.resize(mTriangleCount_);
+                mCornerWeights_.resize(mTriangleCount_ * VERTICES_PER_TRIANGLE);
+                const size_t rangeCount = countParallelRanges(mThreadCount_, mTriangleCount_);
+                std::vector<float> heaviestWeights(rangeCount, 0.0f);
+
+                runInParallelRanges(rangeCount, mTriangleCount_, [&](size_t range, size_t begin, size_t end) {
+                    float heaviest = 0.0f;
+                    for (size_t triangle = begin; triangle < end; triangle++) {
+                        const size_t firstCorner = triangle * VERTICES_PER_TRIANGLE;
+                        const glm::vec3 corners[VERTICES_PER_TRIANGLE] = { position(firstCorner), position(firstCorner + 1u), position(firstCorner + 2u) };
+                        const glm::vec3 crossProduct = glm::cross(corners[1] - corners[0], corners[2] - corners[0]);
+                        const float doubleArea = glm::length(crossProduct);
+                        //Flat shaded triangles get exactly the normal they always have (including the fallback
+                        //normal for degenerate triangles, which don't count towards any smoothed normals)
+                        mTriangleNormals_[triangle] = MeshFunc::computeNormalizedVertexNormalsForTriangle(corners[0], corners[1], corners[2]);
+                        if (doubleArea <= FP_TOLERANCE) {
+                            for (size_t i = 0u; i < VERTICES_PER_TRIANGLE; i++)
+                                mCornerWeights_[firstCorner + i] = 0.0f;
+                            continue;
+                        }
+                        for (size_t i = 0u; i < VERTICES_PER_TRIANGLE; i++) {
+                            const glm::vec3 toNext = corners[(i + 1u) % VERTICES_PER_TRIANGLE] - corners[i];
+                            const glm::vec3 toPrevious = corners[(i + 2u) % VERTICES_PER_TRIANGLE] - corners[i];
+                            const float angle = std::atan2(glm::length(glm::cross(toNext, toPrevious)), glm::dot(toNext, toPrevious));
+                            const float weight = (0.5f * doubleArea * angle);
+                            mCornerWeights_[firstCorner + i] = weight;
+                            heaviest = std::max(heaviest, weight);
+                        }
+                    }
+                    heaviestWeights[range] = heaviest;
+                });
+
+                //The heaviest weight decides the fixed point scale. Taking the largest of each range's heaviest
+                //weight gives the same answer no matter how the triangles were split up.
+                const float heaviest = *std::max_element(heaviestWeights.cbegin(), heaviestWeights.cend());
+
+                mFixedPointScale_ = ((heaviest > 0.0f) ? (FIXED_POINT_SCALE / static_cast<double>(heaviest)) : 0.0);
+            }
+
+            //Scatters the weighted normal of every corner (or of every corner marked in 'includedCorners') onto its
+            //key's sum. Each thread scatters its own range of triangles into its own sums, which are then added
+            //together one range of keys per thread. Returns 3 sums (x, y, z) per key.
+            std::vector<int64_t> accumulate(const uint8_t * includedCorners) const {
+                const size_t rangeCount = countParallelRanges(mThreadCount_, mTriangleCount_);
+                std::vector<std::vector<int64_t>> threadSums(rangeCount);
+
+                runInParallelRanges(rangeCount, mTriangleCount_, [&](size_t range, size_t firstTriangle, size_t endTriangle) {
+                    std::vector<int64_t>& sums = threadSums[range];
+                    sums.assign(mKeyCount_ * AXES, 0);
+                    for (size_t corner = (firstTriangle * VERTICES_PER_TRIANGLE); corner < (endTriangle * VERTICES_PER_TRIANGLE); corner++) {
+                        const uint32_t key = mCornerKeys_[corner];
+                        if ((key == NO_KEY) || ((includedCorners != nullptr) && (!includedCorners[corner])))
+                            continue;
+                        const glm::vec3& normal = mTriangleNormals_[corner / VERTICES_PER_TRIANGLE];
+                        const double scaledWeight = (static_cast<double>(mCornerWeights_[corner]) * mFixedPointScale_);
+                        int64_t * const sum = sums.data() + (key * AXES);
+                        sum[0] += std::llround(static_cast<double>(normal.x) * scaledWeight);
+                        sum[1] += std::llround(static_cast<double>(normal.y) * scaledWeight);
+                        sum[2] += std::llround(static_cast<double>(normal.z) * scaledWeight);
+                    }
+                });
+
+                std::vector<int64_t>& totals = threadSums[0];
+                if (rangeCount > 1u) {
+                    runInParallelRanges(countParallelRanges(mThreadCount_, totals.size()), totals.size(), [&](size_t, size_t begin, size_t end) {
+                        for (size_t thread = 1u; thread < rangeCount; thread++) {
+                            const std::vector<int64_t>& sums = threadSums[thread];
+                            for (size_t i = begin; i < end; i++)
+                                totals[i] += sums[i];
+                        }
+                    });
+                }
+                return std::move(totals);
+            }
+
+            static bool normalizedSum(const std::vector<int64_t>& sums, uint32_t key, glm::vec3& normal) noexcept {
+                const int64_t * const sum = sums.data() + (static_cast<size_t>(key) * AXES);
+                const double x = static_cast<double>(sum[0]);
+                const double y = static_cast<double>(sum[1]);
+                const double z = static_cast<double>(sum[2]);
+                const double length = std::sqrt((x * x) + (y * y) + (z * z));
+                if (length <= 0.0)
+                    return false;
+                normal = glm::vec3(static_cast<float>(x / length), static_cast<float>(y / length), static_cast<float>(z / length));
+                return true;
+            }
+        };
+
+    } //namespace
+
+
+    unsigned int chooseNormalGenerationThreadCount(size_t triangleCount) noexcept {
+        return chooseParallelThreadCount(triangleCount, MIN_TRIANGLES_PER_NORMAL_GENERATION_THREAD);
+    }
+
+
+    void generateVertexNormals(const float * vertices, size_t vertexStride, size_t triangleCount,
+                               const uint32_t * triangleSmoothingGroups, float creaseAngleDegrees,
+                               unsigned int threadCount, float * normals, size_t normalStride) {
+        if (triangleCount == 0u)
+            return;
+        NormalGenerator generator(vertices, vertexStride, triangleCount, triangleSmoothingGroups, threadCount);
+        generator.generate(creaseAngleDegrees, normals, normalStride);
+    }
+
+} //namespace AssetLoadingInternal
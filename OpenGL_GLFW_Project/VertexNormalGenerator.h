@@ -0,0 +1,62 @@
+// File:           VertexNormalGenerator.h
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Generates smooth vertex normals for meshes whose '.obj' file didn't provide any.
+//                 QuickObj originally gave all 3 corners of each triangle that triangle's own normal,
+//                 which makes every mesh look faceted no matter what the artist intended.
+//
+//                 Each corner's normal is the weighted sum of the normals of every triangle which
+//                 shares its position and its smoothing group. Each triangle is weighted by both its
+//                 area and the angle of its corner at that position, so that neither long thin
+//                 triangles nor finely subdivided regions pull the normal towards themselves.
+//
+//                 Smoothing groups ('s' lines) are respected: triangles in smoothing group 0 (i.e.
+//                 's off') are flat shaded, and triangles only ever get smoothed together with other
+//                 triangles in the same group. On top of that, a corner whose triangle bends away from
+//                 the smoothed normal by more than the crease angle keeps its triangle's own normal
+//                 (and is left out of the smoothed normal), so hard edges stay hard even within a group.
+//
+// Threading:      The normals are summed with a scatter-add (every triangle adds itself onto each of
+//                 its corners' sums). Each thread scatters a range of the triangles into its own
+//                 accumulators, which are added together at the end, so no thread ever writes to
+//                 memory another thread is writing to. The sums are kept in 64-bit fixed point, which
+//                 (unlike floating point) adds up to the same result in any order. This is what makes
+//                 the generated normals bit-for-bit identical no matter how many threads are used.
+
+#pragma once
+
+#ifndef VERTEX_NORMAL_GENERATOR_H_
+#define VERTEX_NORMAL_GENERATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace AssetLoadingInternal {
+
+    //How far (in degrees) a triangle's normal may be from the smoothed normal at one of its corners before
+    //that corner keeps the triangle's own normal instead. 40 degrees keeps edges sharper than about 80 degrees hard.
+    static constexpr const float DEFAULT_NORMAL_CREASE_ANGLE = 40.0f;
+
+    //Triangles in this smoothing group are flat shaded
+    static constexpr const uint32_t FLAT_SHADED_SMOOTHING_GROUP = 0u;
+
+    //Meshes smaller than this many triangles per thread aren't worth splitting up further
+    static constexpr const size_t MIN_TRIANGLES_PER_NORMAL_GENERATION_THREAD = 65536u;
+
+    //Returns how many threads to use when generating normals for the given number of triangles
+    unsigned int chooseNormalGenerationThreadCount(size_t triangleCount) noexcept;
+
+    //Computes a normal for every corner of the 'triangleCount' triangles stored in 'vertices' (3 consecutive
+    //vertices per triangle, each 'vertexStride' floats with its position in the first 3). Each normal is
+    //written as 3 floats at 'normals + (corner * normalStride)'. 'triangleSmoothingGroups' holds each
+    //triangle's smoothing group, or can be null to smooth every triangle together as one group. Up to
+    //'threadCount' threads are used, the results are the same for any thread count.
+    void generateVertexNormals(const float * vertices, size_t vertexStride, size_t triangleCount,
+                               const uint32_t * triangleSmoothingGroups, float creaseAngleDegrees,
+                               unsigned int threadCount, float * normals, size_t normalStride);
+
+} //namespace AssetLoadingInternal
+
+#endif //VERTEX_NORMAL_GENERATOR_H_
@@ -0,0 +1,156 @@
+// File:           VertexWelder.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   The cells are twice as wide as the tolerance. A position within the tolerance of another
+//                          one is then always either in the same cell or in the neighboring cell on the side of
+//                          the cell's middle that the position is on, along each axis. Only 2 x 2 x 2 = 8 cells ever
+//                          need to be checked, where cells as wide as the tolerance would need all 27 of the cells
+//                          around a position checked.
+//
+//                          Only kept positions go into the cells. Any 2 of them differ by at least the tolerance
+//                          along some axis, so no more than 8 of them fit into 1 cell, and each of the 8 cells
+//                          checked costs a hash lookup plus a few comparisons at most. Cells are found through a
+//                          VertexDeduplicationTable (keyed by the cell's coordinates), which numbers each cell the
+//                          first time a position is kept in it, and the positions kept in each cell are linked
+//                          together in a list starting from that cell's entry in 'cellHeads'.
+//
+//                          Most of the positions in a split mesh are exact copies, which end the search early. A kept
+//                          position exactly equal to the one being welded has to be the position it welds onto,
+//                          since any kept position before it within the tolerance would have had it welded away.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "VertexWelder.h"
+
+#include <algorithm> //std::min, std::max
+#include <cmath>
+#include <limits>
+#include <numeric>   //std::iota
+
+#include "VertexDeduplicationTable.h"
+
+namespace AssetLoadingInternal {
+
+    namespace {
+
+        static constexpr const uint32_t NO_POSITION = std::numeric_limits<uint32_t>::max();
+
+        //Cell coordinates are kept well inside of int64_t, so the neighboring cell of the last cell can't overflow
+        static constexpr const double MAX_CELL_COORDINATE = 4611686018427387904.0; //2^62
+
+        using CellTable = VertexDeduplicationTable<6u>;
+
+        CellTable::Key makeCellKey(const int64_t cell[3]) noexcept {
+            CellTable::Key key;
+            for (size_t axis = 0u; axis < 3u; axis++) {
+                const uint64_t bits = static_cast<uint64_t>(cell[axis]);
+                key[(axis * 2u)] = static_cast<uint32_t>(bits);
+                key[(axis * 2u) + 1u] = static_cast<uint32_t>(bits >> 32u);
+            }
+            return key;
+        }
+
+        //The same test as Vertex's 'operator==', on the 3 components of a position
+        bool arePositionsWithinTolerance(const float a[3], const float b[3], float tolerance) noexcept {
+            return ((std::fabs(a[0] - b[0]) < tolerance) && (std::fabs(a[1] - b[1]) < tolerance) &&
+                    (std::fabs(a[2] - b[2]) < tolerance));
+        }
+
+        //'positionOf(i, p)' copies the i'th position into p
+        template<typename PositionOf>
+        size_t weldPositionsInOrder(size_t positionCount, float tolerance, std::vector<uint32_t>& remap, PositionOf positionOf) {
+            remap.resize(positionCount);
+            if ((!(tolerance > 0.0f)) || (!std::isfinite(tolerance))) {
+                std::iota(remap.begin(), remap.end(), 0u);
+                return positionCount;
+            }
+
+            const double cellSize = (2.0 * static_cast<double>(tolerance));
+            CellTable cells(positionCount);
+            std::vector<uint32_t> cellHeads;                              //The last position kept in each cell
+            std::vector<uint32_t> nextInCell(positionCount, NO_POSITION); //The position kept in the same cell before it
+            size_t keptCount = 0u;
+
+            float position[3];
+            float otherPosition[3];
+            for (size_t i = 0u; i < positionCount; i++) {
+                positionOf(i, position);
+                if ((!std::isfinite(position[0])) || (!std::isfinite(position[1])) || (!std::isfinite(position[2]))) {
+                    remap[i] = static_cast<uint32_t>(keptCount++);
+                    continue;
+                }
+
+                //Each axis has the position's own cell plus the neighbor on the nearer side of it
+                int64_t cellCoordinates[2][3];
+                for (size_t axis = 0u; axis < 3u; axis++) {
+                    const double scaled = (static_cast<double>(position[axis]) / cellSize);
+                    const double cell = std::min(std::max(std::floor(scaled), -MAX_CELL_COORDINATE), MAX_CELL_COORDINATE);
+                    cellCoordinates[0][axis] = static_cast<int64_t>(cell);
+                    cellCoordinates[1][axis] = (((scaled - cell) < 0.5) ? (cellCoordinates[0][axis] - 1) : (cellCoordinates[0][axis] + 1));
+                }
+
+                uint32_t weldedOnto = NO_POSITION;
+                bool exactMatch = false;
+                for (unsigned int corner = 0u; (corner < 8u) && (!exactMatch); corner++) {
+                    const int64_t cell[3] = { cellCoordinates[(corner & 1u)][0], cellCoordinates[((corner >> 1u) & 1u)][1],
+                                              cellCoordinates[((corner >> 2u) & 1u)][2] };
+                    const uint32_t cellIndex = cells.find(makeCellKey(cell));
+                    if (cellIndex == CellTable::NOT_FOUND)
+                        continue;
+                    for (uint32_t kept = cellHeads[cellIndex]; kept != NO_POSITION; kept = nextInCell[kept]) {
+                        if (kept > weldedOnto)
+                            continue; //The first position within the tolerance wins
+                        positionOf(kept, otherPosition);
+                        if (arePositionsWithinTolerance(position, otherPosition, tolerance)) {
+                            weldedOnto = kept;
+                            exactMatch = ((position[0] == otherPosition[0]) && (position[1] == otherPosition[1]) &&
+                                          (position[2] == otherPosition[2]));
+                            if (exactMatch)
+                                break;
+                        }
+                    }
+                }
+                if (weldedOnto != NO_POSITION) {
+                    remap[i] = remap[weldedOnto];
+                    continue;
+                }
+
+                bool inserted = false;
+                const uint32_t cellIndex = cells.findOrInsert(makeCellKey(cellCoordinates[0]), inserted);
+                if (inserted)
+                    cellHeads.push_back(NO_POSITION);
+                nextInCell[i] = cellHeads[cellIndex];
+                cellHeads[cellIndex] = static_cast<uint32_t>(i);
+                remap[i] = static_cast<uint32_t>(keptCount++);
+            }
+            return keptCount;
+        }
+
+    } //namespace
+
+
+    size_t weldPositions(const float * vertices, size_t vertexStride, size_t vertexCount, float tolerance,
+                         std::vector<uint32_t>& remap) {
+        return weldPositionsInOrder(vertexCount, tolerance, remap, [vertices, vertexStride](size_t vertex, float * position) {
+            const float * source = (vertices + (vertex * vertexStride));
+            position[0] = source[0];
+            position[1] = source[1];
+            position[2] = source[2];
+        });
+    }
+
+
+    size_t weldPositions(const PositionStreams& positions, float tolerance, std::vector<uint32_t>& remap) {
+        const float * xs = positions.stream(0u);
+        const float * ys = positions.stream(1u);
+        const float * zs = positions.stream(2u);
+        return weldPositionsInOrder(positions.size(), tolerance, remap, [xs, ys, zs](size_t index, float * position) {
+            position[0] = xs[index];
+            position[1] = ys[index];
+            position[2] = zs[index];
+        });
+    }
+
+} //namespace AssetLoadingInternal
@@ -0,0 +1,51 @@
+// File:           VertexWelder.h
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Welds together positions which are within a tolerance of each other, using the same
+//                 test as Vertex's 'operator==' (every component has to differ by less than the tolerance).
+//                 Exporters often write the same position out more than once, usually where they have split
+//                 a vertex along a UV seam or a hard edge, and sometimes with a tiny bit of floating point
+//                 noise between the copies. Anything which finds a mesh's neighbors through its positions
+//                 (generated smooth normals, the outline edges, mesh simplification, meshlets) sees those
+//                 copies as a crack in the mesh. Welding them back together makes the mesh connected again,
+//                 and lets vertices which only differed by which copy of a position they used be merged.
+//
+//                 Positions are welded in order: each position welds onto the first earlier position it is
+//                 within the tolerance of which hasn't itself been welded onto something, otherwise it is kept.
+//                 Every position therefore ends up within the tolerance of the position it was welded onto
+//                 [welds never chain], and the result doesn't depend on anything except the order of the
+//                 positions.
+//
+//                 Comparing every position to every other would take O(n^2) time. Instead the kept positions
+//                 are put into a spatial hash of cubic cells, so each position only needs to be compared to
+//                 the few kept positions in the cells around it, which takes O(n) time overall.
+//
+// Note:           Positions with a NaN or infinite component are never welded to anything.
+
+#pragma once
+
+#ifndef VERTEX_WELDER_H_
+#define VERTEX_WELDER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "VertexAttributeStreams.h"
+
+namespace AssetLoadingInternal {
+
+    //Welds the positions in the first 3 floats of each of the 'vertexCount' vertices. When this returns, 'remap'
+    //holds the new index of every vertex, with the kept positions numbered in the order they appear and every
+    //welded position given the number of the position it was welded onto. Returns the number of kept positions.
+    //A tolerance which isn't greater than 0 welds nothing.
+    size_t weldPositions(const float * vertices, size_t vertexStride, size_t vertexCount, float tolerance,
+                         std::vector<uint32_t>& remap);
+    //The same as above, for positions which are stored as streams [see VertexAttributeStreams.h]
+    size_t weldPositions(const PositionStreams& positions, float tolerance, std::vector<uint32_t>& remap);
+
+} //namespace AssetLoadingInternal
+
+#endif //VERTEX_WELDER_H_
@@ -4,19 +4,263 @@
 //
 //Description:         Wrapper class for a Wavefront '.mtl' material file. Parses and locally stores
 //                     data from the material file. Can be tracked by name. See header for more detail.
-//  
+//
+//Implementation Notes: '.mtl' files are tiny compared to the '.obj' files that use them, so the file is
+//                      simply parsed line by line on the calling thread. Numbers are read with the same
+//                      helpers the ObjTokenizer uses.
+//
+//                      PhongShadingParameterSet has no setters, so each material's colors are collected
+//                      separately while its lines are being parsed and the parameter set is only built
+//                      once the material is finished [i.e. at the next 'newmtl' or the end of the file].
+//
 
 #include "WavefrontMtl.h"
 
-#if 0
+#include "AsciiAsset.h"
+#include "FilepathWrapper.h"
+#include "ObjNumberParsing.h"
+
+#include <algorithm> //std::min
+#include <cstring>   //memchr
+
+using namespace AssetLoadingInternal::ObjNumberParsing;
+
+namespace {
+	static constexpr const MTL_ILLUM_MODEL DEFAULT_ILLUM_MODEL = MTL_ILLUM_MODEL::COLOR_ON_AND_AMBIENT_ON;
+	static constexpr const float DEFAULT_OPTICAL_DENSITY = 1.0f;
+	static constexpr const float DEFAULT_OPACITY = 1.0f;
+
+	//Everything about a material that has to be known before its PhongShadingParameterSet can be built
+	struct MaterialInProgress {
+		WavefrontMaterial material;
+		std::array<float, 3> ambient;
+		std::array<float, 3> diffuse;
+		std::array<float, 3> specular;
+		float shiny;
+		float opacity;
+	};
+
+	MaterialInProgress beginMaterial(const std::string& name) {
+		MaterialInProgress inProgress = { WavefrontMtl::makeDefaultMaterial(name), PHONG_DEFAULT_AMBIENT,
+			PHONG_DEFAULT_DIFFUSE, PHONG_DEFAULT_SPECULAR, PHONG_DEFAULT_SHINY, DEFAULT_OPACITY };
+		return inProgress;
+	}
+
+	WavefrontMaterial finishMaterial(MaterialInProgress& inProgress) {
+		inProgress.material.phong = PhongShadingParameterSet(inProgress.ambient, inProgress.diffuse, inProgress.specular,
+			inProgress.shiny, inProgress.opacity);
+		return std::move(inProgress.material);
+	}
 
-WavefrontMtl::WavefrontMtl() : AssetInterface() {
+	inline const char * findEndOfWord(const char * c) noexcept {
+		while ((!isBlank(*c)) && (*c != '\n'))
+			c++;
+		return c;
+	}
 
+	//Trims the blanks off of both ends of [begin, end)
+	inline std::string_view trim(const char * begin, const char * end) noexcept {
+		begin = skipBlanks(begin);
+		while ((end > begin) && isBlank(end[-1]))
+			end--;
+		return std::string_view(begin, static_cast<size_t>(end - begin));
+	}
+
+	//A texture map option's arguments are all numbers, 'on'/'off', or (for '-imfchan') a single channel letter
+	inline bool isTextureOptionArgument(std::string_view word) noexcept {
+		if ((word == "on") || (word == "off"))
+			return true;
+		const char * c = word.data();
+		float ignored = 0.0f;
+		return (parseFloat(c, ignored) && (c == (word.data() + word.length())));
+	}
 }
 
 
-WavefrontMtl::~WavefrontMtl() {
+WavefrontMtl::WavefrontMtl(const std::string& mtlFilepath) : mError_(false), mFilepath_(mtlFilepath) {
+	if (!FilepathWrapper::file_exists(mtlFilepath.c_str())) {
+		fprintf(WRNLOG, "\nWarning! Unable to find material library \"%s\"!\n", mtlFilepath.c_str());
+		mError_ = true;
+		return;
+	}
+	const AssetLoadingInternal::AsciiAsset file(mtlFilepath, true, false);
+	if (file.getStoredTextLength() == 0u) {
+		fprintf(WRNLOG, "\nWarning! Unable to read material library \"%s\"!\n", mtlFilepath.c_str());
+		mError_ = true;
+		return;
+	}
+	parse(file.getTextView());
+}
+
 
+const WavefrontMaterial * WavefrontMtl::findMaterial(const std::string& materialName) const {
+	const auto found = mIdsByName_.find(materialName);
+	if (found == mIdsByName_.cend())
+		return nullptr;
+	return &(mMaterials_[found->second]);
 }
 
-#endif 
\ No newline at end of file
+
+WavefrontMaterial WavefrontMtl::makeDefaultMaterial(const std::string& materialName) {
+	WavefrontMaterial material;
+	material.name = materialName;
+	material.phong = DEFAULT_PHONG_ILLUMINATION;
+	material.illuminationModel = DEFAULT_ILLUM_MODEL;
+	material.emissive = { 0.0f, 0.0f, 0.0f };
+	material.opticalDensity = DEFAULT_OPTICAL_DENSITY;
+	return material;
+}
+
+
+void WavefrontMtl::parse(std::string_view text) {
+	const char * c = text.data();
+	const char * const end = text.data() + text.length();
+	size_t lineNumber = 0u;
+	size_t linesWithErrors = 0u;
+	size_t linesOutsideOfAnyMaterial = 0u;
+
+	MaterialInProgress current;
+	bool haveMaterial = false;
+
+	while (c < end) {
+		lineNumber++;
+		const char * lineEnd = static_cast<const char *>(memchr(c, '\n', static_cast<size_t>(end - c)));
+		const char * keywordStart = skipBlanks(c);
+		c = lineEnd + 1;
+		if ((keywordStart == lineEnd) || (*keywordStart == '#'))
+			continue;
+		const char * keywordEnd = findEndOfWord(keywordStart);
+		const std::string_view keyword(keywordStart, static_cast<size_t>(keywordEnd - keywordStart));
+		const char * arguments = skipBlanks(keywordEnd);
+
+		if (keyword == "newmtl") {
+			if (haveMaterial)
+				addMaterial(finishMaterial(current));
+			const std::string_view name = trim(arguments, lineEnd);
+			current = beginMaterial(name.empty() ? std::string("default") : std::string(name));
+			haveMaterial = true;
+			continue;
+		}
+		if (!haveMaterial) {
+			linesOutsideOfAnyMaterial++;
+			continue;
+		}
+
+		bool parsed = true;
+		if (keyword == "Ka")
+			parsed = parseColorLine(arguments, current.ambient);
+		else if (keyword == "Kd")
+			parsed = parseColorLine(arguments, current.diffuse);
+		else if (keyword == "Ks")
+			parsed = parseColorLine(arguments, current.specular);
+		else if (keyword == "Ke")
+			parsed = parseColorLine(arguments, current.material.emissive);
+		else if (keyword == "Ns")
+			parsed = parseSingleValueLine(arguments, current.shiny);
+		else if (keyword == "Ni")
+			parsed = parseSingleValueLine(arguments, current.material.opticalDensity);
+		else if (keyword == "d")
+			parsed = parseSingleValueLine(arguments, current.opacity);
+		else if (keyword == "Tr") {
+			float transparency = 0.0f;
+			parsed = parseSingleValueLine(arguments, transparency);
+			if (parsed)
+				current.opacity = 1.0f - transparency;
+		}
+		else if (keyword == "illum") {
+			int64_t model = 0;
+			const char * value = arguments;
+			parsed = (parseInteger(value, model) && (model >= 0) && (*skipBlanks(value) == '\n'));
+			if (parsed)
+				current.material.illuminationModel = ILLUM_MODEL[static_cast<size_t>(std::min(model, static_cast<int64_t>(ILLUM_MODEL.size() - 1u)))];
+		}
+		else if (keyword == "map_Ka")
+			parsed = parseTextureMapLine(arguments, lineEnd, current.material.ambientTextureMap);
+		else if (keyword == "map_Kd")
+			parsed = parseTextureMapLine(arguments, lineEnd, current.material.diffuseTextureMap);
+		else if (keyword == "map_Ks")
+			parsed = parseTextureMapLine(arguments, lineEnd, current.material.specularTextureMap);
+		else if (keyword == "map_d")
+			parsed = parseTextureMapLine(arguments, lineEnd, current.material.alphaTextureMap);
+		else if ((keyword == "map_bump") || (keyword == "map_Bump") || (keyword == "bump"))
+			parsed = parseTextureMapLine(arguments, lineEnd, current.material.bumpMap);
+		//Everything else (reflection maps, 'Tf', 'sharpness', etc.) isn't used by anything, so it is quietly skipped
+
+		if (!parsed) {
+			fprintf(WRNLOG, "Unable to parse line %zu of material library \"%s\": %.*s\n", lineNumber, mFilepath_.c_str(),
+				static_cast<int>(lineEnd - keywordStart), keywordStart);
+			linesWithErrors++;
+		}
+	}
+	if (haveMaterial)
+		addMaterial(finishMaterial(current));
+
+	if (linesOutsideOfAnyMaterial > 0u) {
+		fprintf(WRNLOG, "\nWarning! %zu lines of material library \"%s\" appear before its first 'newmtl' line!\n"
+			"  [These lines were skipped]\n", linesOutsideOfAnyMaterial, mFilepath_.c_str());
+	}
+	fprintf(MSGLOG, "\nLoaded material library \"%s\"  [%zu materials%s]\n", mFilepath_.c_str(), mMaterials_.size(),
+		((linesWithErrors > 0u) ? ", some lines could not be parsed" : ""));
+}
+
+
+bool WavefrontMtl::parseColorLine(const char * c, std::array<float, 3>& color) const noexcept {
+	std::array<float, 3> parsed = { 0.0f, 0.0f, 0.0f };
+	int componentsParsed = 0;
+	while ((componentsParsed < 3) && parseFloat(c, parsed[componentsParsed])) {
+		componentsParsed++;
+		c = skipBlanks(c);
+	}
+	if ((componentsParsed == 0) || (componentsParsed == 2) || (*c != '\n'))
+		return false;
+	if (componentsParsed == 1) //A single value is used for all 3 channels
+		parsed[1] = parsed[2] = parsed[0];
+	color = parsed;
+	return true;
+}
+
+
+bool WavefrontMtl::parseSingleValueLine(const char * c, float& value) const noexcept {
+	float parsed = 0.0f;
+	if ((!parseFloat(c, parsed)) || (*skipBlanks(c) != '\n'))
+		return false;
+	value = parsed;
+	return true;
+}
+
+
+//Options come before the filename, each one being a word beginning with '-' followed by its arguments. Since
+//filenames can contain spaces, everything left after the options is taken as the filename.
+bool WavefrontMtl::parseTextureMapLine(const char * c, const char * lineEnd, std::string& filename) const {
+	while (*c == '-') {
+		const char * optionEnd = findEndOfWord(c);
+		const bool isChannelOption = (std::string_view(c, static_cast<size_t>(optionEnd - c)) == "-imfchan");
+		c = skipBlanks(optionEnd);
+		if (isChannelOption) {
+			c = skipBlanks(findEndOfWord(c));
+			continue;
+		}
+		while (c != lineEnd) {
+			const char * wordEnd = findEndOfWord(c);
+			if (!isTextureOptionArgument(std::string_view(c, static_cast<size_t>(wordEnd - c))))
+				break;
+			c = skipBlanks(wordEnd);
+		}
+	}
+	const std::string_view name = trim(c, lineEnd);
+	if (name.empty())
+		return false;
+	filename = std::string(name);
+	return true;
+}
+
+
+void WavefrontMtl::addMaterial(WavefrontMaterial&& material) {
+	if (mIdsByName_.find(material.name) != mIdsByName_.cend()) {
+		fprintf(WRNLOG, "\nWarning! Material \"%s\" is defined more than once in material library \"%s\"!\n"
+			"  [Only the first definition is used]\n", material.name.c_str(), mFilepath_.c_str());
+		return;
+	}
+	mIdsByName_.emplace(material.name, mMaterials_.size());
+	mMaterials_.push_back(std::move(material));
+}
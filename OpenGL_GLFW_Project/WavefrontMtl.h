@@ -1,15 +1,35 @@
 //File:                           WavefrontMtl.h
 //
-//Description:                    Wrapper class for a '.mtl' file. More detailed description will be written 
-//                                once I have completed this class and have more time...
+//Description:                    Wrapper class for a '.mtl' material library. An '.obj' file names the material
+//                                libraries it uses with 'mtllib' lines, and then picks which of their materials
+//                                applies to the faces that follow with 'usemtl' lines. This class parses one
+//                                library and stores each of its materials as a WavefrontMaterial, with the
+//                                color and shininess values gathered into a PhongShadingParameterSet.
+//
+//                                Any value a material does not specify is left at the value it has in
+//                                DEFAULT_PHONG_ILLUMINATION (see DefaultPhongIllumination.h), which is also
+//                                what materials that couldn't be found in any library are given.
+//
+//Supported Syntax:               newmtl name
+//                                Ka r [g b]        Kd r [g b]        Ks r [g b]        Ke r [g b]
+//                                Ns exponent       Ni density        illum model
+//                                d factor          Tr factor         (Tr is converted to d as '1 - Tr')
+//                                map_Ka / map_Kd / map_Ks / map_d / map_bump / bump  [-options] filename
+//                                Texture map options are skipped, only the filename is kept (exactly as it
+//                                was written, relative paths are relative to the '.mtl' file). The spectral
+//                                ('Ka spectral file.rfl') and CIEXYZ ('Ka xyz x y z') color forms are not
+//                                supported, lines using them are reported and skipped.
 //
 //Reference:                      http://paulbourke.net/dataformats/mtl/
 //
-// 
+//
 //Programmer:                     Forrest Miller
 //Date:                           November 14, 2018
 //
-//                        
+//Update (October 2026):          Finally finished. The class no longer inherits from AssetInterface (which is
+//                                still unfinished), the same as WavefrontObj. QuickObj uses this class to load
+//                                the libraries its '.obj' files name (see QuickObj::getMaterialDrawRanges()).
+//
 
 
 //Here are some sample materials that could exist in a file:
@@ -36,17 +56,18 @@ Tr 0.4300
 
 #pragma once
 
-#ifdef WAVEFRONT_MTL_H_
+#ifndef WAVEFRONT_MTL_H_
 #define WAVEFRONT_MTL_H_
 
-//#include "LoggingMessageTargets.h"
-#include "AssetInterface.h"                  //Abstract base class for loadable assets
-#include "AsciiAsset.h"                      //For loading the asset
-#include "PhongShadingParameterSet.h"               
+#include "LoggingMessageTargets.h"
+#include "PhongShadingParameterSet.h"
 #include "DefaultPhongIllumination.h"
 
 #include <array>
-#include <optional>           //Used to represent optional types, requires C++17 
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 //                           //These illumination models were gather from: https://en.wikipedia.org/wiki/Wavefront_.obj_file#Basic_materials
 enum class MTL_ILLUM_MODEL { COLOR_ON_AND_AMBIENT_OFF,                                                 //illum 0
@@ -66,7 +87,7 @@ enum class MTL_ILLUM_MODEL { COLOR_ON_AND_AMBIENT_OFF,
 
 
 //Use an array as a quick lookup table for when parsing illumination models.
-//This way illum 0 is at index 0, illum 1 is at index 1, and so on... 
+//This way illum 0 is at index 0, illum 1 is at index 1, and so on...
 static const std::array<MTL_ILLUM_MODEL, 12> ILLUM_MODEL = { MTL_ILLUM_MODEL::COLOR_ON_AND_AMBIENT_OFF,
 															 MTL_ILLUM_MODEL::COLOR_ON_AND_AMBIENT_ON,
 															 MTL_ILLUM_MODEL::HIGHLIGHT_ON,
@@ -79,38 +100,68 @@ static const std::array<MTL_ILLUM_MODEL, 12> ILLUM_MODEL = { MTL_ILLUM_MODEL::CO
 															 MTL_ILLUM_MODEL::GLASS_TRANSPARENCY_ON_AND_RAYTRACE_REFLECTION_OFF,
 															 MTL_ILLUM_MODEL::CASTS_SHADOWS_ONTO_INVISIBLE_SURFACES,
 															 MTL_ILLUM_MODEL::UNRECOGNIZED_ILLUM_MODEL };
-                                                             
-
 
-class WavefrontMtlLoader final : public AssetInterface {
-public:
-	//Constructs a WavefrontMtl object. The object will be valid and will have its 
-	//data set to match the default phong illumination preset. 
-	//WavefrontMtlLoader();
-	
-	//WavefrontMtlLoader(const char * mtlFile);
-	//virtual ~WavefrontMtlLoader() override;
-
-	//Returns the name of the material. This name is either:
-	//	(i) a statically assigned name given by the application for self-generated materials
-	//    or
-	//  (ii) the name found under the first occurance of a line matching the syntax 'newmtl [name]'.
-	//
-	std::string getMaterialName() const { return mMatName_; }
-
-private:
-	//Inheriter from AssetInterface:
-	//    bool mLoaded_;
-	//    bool mValid_;
 
-	std::string mMatName_;
-	std::unique_ptr<AssetLoadingInternal::AsciiAsset> mMtlFile_;
+//Everything recorded for one 'newmtl' entry. The texture map strings are empty for maps the
+//material does not use.
+typedef struct WavefrontMaterial {
+	std::string name;
+	PhongShadingParameterSet phong;             //Ka, Kd, Ks, Ns and d
+	MTL_ILLUM_MODEL illuminationModel;
+	std::array<float, 3> emissive;              //Ke
+	float opticalDensity;                       //Ni
+	std::string ambientTextureMap;              //map_Ka
+	std::string diffuseTextureMap;              //map_Kd
+	std::string specularTextureMap;             //map_Ks
+	std::string alphaTextureMap;                //map_d
+	std::string bumpMap;                        //map_bump or bump
+} WavefrontMaterial;
 
-	
-	
 
-	
+class WavefrontMtl final {
+public:
+	//Parses the '.mtl' file at 'mtlFilepath'. Use error() to find out if the file could not be read. A
+	//file that could be read but had lines in it which couldn't be parsed is not an error, those lines
+	//are reported and skipped.
+	WavefrontMtl(const std::string& mtlFilepath);
+	~WavefrontMtl() = default;
+
+	WavefrontMtl(WavefrontMtl&&) = default;
+	WavefrontMtl& operator=(WavefrontMtl&&) = default;
+
+	bool error() const noexcept { return mError_; }
+	const std::string& getFilepath() const noexcept { return mFilepath_; }
+
+	//Materials are numbered in the order they appear in the file
+	size_t getMaterialCount() const noexcept { return mMaterials_.size(); }
+	const std::vector<WavefrontMaterial>& getMaterials() const noexcept { return mMaterials_; }
+	//Returns nullptr if the library has no material with this name
+	const WavefrontMaterial * findMaterial(const std::string& materialName) const;
+
+	//Returns a material with the given name whose values all match DEFAULT_PHONG_ILLUMINATION. This is
+	//what a material gets before any of its lines have been parsed.
+	static WavefrontMaterial makeDefaultMaterial(const std::string& materialName);
+
+	//Must provide a filepath for object construction
+	WavefrontMtl() = delete;
+	//Copying is disabled
+	WavefrontMtl(const WavefrontMtl&) = delete;
+	WavefrontMtl& operator=(const WavefrontMtl&) = delete;
 
+private:
+	bool mError_;
+	std::string mFilepath_;
+	std::vector<WavefrontMaterial> mMaterials_;
+	std::unordered_map<std::string, size_t> mIdsByName_;
+
+	//Parses the entire text of the file, which must end with a '\n'
+	void parse(std::string_view text);
+	//Parses one line (with 'c' just past its keyword), returning false if it couldn't be parsed
+	bool parseColorLine(const char * c, std::array<float, 3>& color) const noexcept;
+	bool parseSingleValueLine(const char * c, float& value) const noexcept;
+	bool parseTextureMapLine(const char * c, const char * lineEnd, std::string& filename) const;
+	//Adds a newly finished material onto the end of mMaterials_, unless its name was already used
+	void addMaterial(WavefrontMaterial&& material);
 };
 
-#endif //WAVEFRONT_MTL_H_
\ No newline at end of file
+#endif //WAVEFRONT_MTL_H_
@@ -1,77 +1,333 @@
 //File:  WavefrontObj.cpp
-//Description:    This file contains the implementation for the WavefrontObj class. See the 
+//Description:    This file contains the implementation for the WavefrontObj class. See the
 //                header file 'WavefrontObj.h' for more details.
 //
 //Programmer:     Forrest Miller
 //Date:           October 15, 2018
+//Updated:        October 2026  (Finished the class)
 
 
 #include "WavefrontObj.h"
 
-#ifndef WAVEFRONT_OBJ_INCOMPLETE_ //Code is disabled since I never finished it and it isn't used anywhere
+#include <algorithm>
+#include <iterator>  //std::size
+#include <limits>
+#include <memory>
 
-void WavefrontObj::initialize() {
-	mFile_ = nullptr;
-	
-}
+#include "AsciiAsset.h"
+#include "NGonTriangulator.h"
+#include "ParallelObjTokenizer.h"
+#include "VertexDeduplicationTable.h"
 
-WavefrontObj::WavefrontObj(const char * filepath) : AssetInterface() {
-	initialize();
-	if (!aquireFile(filepath)) {
-		logError("Unable to acquire parse-able filetext!");
-		mLoaded_ = false;
-		mValid_ = false;
-		return;
+namespace {
+	static constexpr const size_t POSITION_COMPONENTS = 4u;
+	static constexpr const size_t TEXTURE_COORDINATE_COMPONENTS = 2u;
+	static constexpr const size_t NORMAL_COMPONENTS = 3u;
+
+	//Used in a vertex's key in place of a component the face did not provide
+	static constexpr const uint32_t MISSING_COMPONENT = std::numeric_limits<uint32_t>::max();
+
+	static constexpr const std::array<float, 3> EMPTY_BOUNDS_MIN = { std::numeric_limits<float>::max(),
+		std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+	static constexpr const std::array<float, 3> EMPTY_BOUNDS_MAX = { std::numeric_limits<float>::lowest(),
+		std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+
+	inline void growBounds(std::array<float, 3>& boundsMin, std::array<float, 3>& boundsMax,
+		                   const std::array<float, 3>& otherMin, const std::array<float, 3>& otherMax) noexcept {
+		for (int i = 0; i < 3; i++) {
+			boundsMin[i] = std::min(boundsMin[i], otherMin[i]);
+			boundsMax[i] = std::max(boundsMax[i], otherMax[i]);
+		}
 	}
-	//parseFile();
 }
 
-WavefrontObj::WavefrontObj(std::string filepath) : AssetInterface() {
-	initialize();
-	if (!aquireFile(filepath)) {
-		logError("Unable to acquire parse-able filepath!");
-		mLoaded_ = false;
-		mValid_ = false; 
+
+WavefrontObj::WavefrontObj(const std::string& filepath, float scale) {
+	mError_ = false;
+	mScale_ = scale;
+	mHasTexCoords_ = false;
+	mHasNormals_ = false;
+	mVertexSize_ = POSITION_COMPONENTS;
+	mBoundsMin_ = EMPTY_BOUNDS_MIN;
+	mBoundsMax_ = EMPTY_BOUNDS_MAX;
+
+	AssetLoadingInternal::ObjParseResult parsedData;
+	if (!parseFile(filepath, parsedData)) {
+		mError_ = true;
 		return;
 	}
-	//parseFile();
+	buildArena(parsedData, filepath);
+}
+
+
+WavefrontObj::SubMeshView WavefrontObj::getFullMesh() const noexcept {
+	SubMeshView view;
+	if (mIndices_.empty())
+		return view;
+	view.mName_ = FULL_MESH_NAME;
+	view.mRanges_ = mFullMeshRange_.data();
+	view.mRangeCount_ = mFullMeshRange_.size();
+	view.mIndexCount_ = mIndices_.size();
+	view.mVertices_ = mVertices_.data();
+	view.mIndices_ = mIndices_.data();
+	view.mVertexSize_ = mVertexSize_;
+	view.mBoundsMin_ = mBoundsMin_;
+	view.mBoundsMax_ = mBoundsMax_;
+	return view;
 }
 
 
+WavefrontObj::SubMeshView WavefrontObj::getObject(size_t objectID) const noexcept {
+	if (objectID >= mObjects_.size())
+		return SubMeshView();
+	return makeView(mObjects_.subMeshes[objectID]);
+}
 
-//Private helper function definitions 
+WavefrontObj::SubMeshView WavefrontObj::getObject(const std::string& objectName) const {
+	const auto found = mObjects_.idsByName.find(objectName);
+	if (found == mObjects_.idsByName.cend())
+		return SubMeshView();
+	return makeView(mObjects_.subMeshes[found->second]);
+}
 
-void WavefrontObj::logError(const char* errorDescription) const {
-	if (mFile_) {
-		fprintf(ERRLOG, "\nError encountered with Wavefront Obj \"%s.\"\nError reason:\n\t%s\n", mFile_->getFilepath().c_str(), errorDescription);
-	}
-	else {
-		if (errorDescription != nullptr) {
-			fprintf(ERRLOG, "\nError encountered while trying to load a Wavefront Obj file.\n"
-				"Unfortunately the Filewrapper is null, so no information on file name can be provided!\n"
-				"The error message is: %s", errorDescription);
-		}
-		else {
-			fprintf(ERRLOG, "\nERROR within WavefrontObj class!\n"
-                "Both Filewrapper object and error message are NULL!\n");
-		}
-	}
+WavefrontObj::SubMeshView WavefrontObj::getGroup(size_t groupID) const noexcept {
+	if (groupID >= mGroups_.size())
+		return SubMeshView();
+	return makeView(mGroups_.subMeshes[groupID]);
+}
+
+WavefrontObj::SubMeshView WavefrontObj::getGroup(const std::string& groupName) const {
+	const auto found = mGroups_.idsByName.find(groupName);
+	if (found == mGroups_.idsByName.cend())
+		return SubMeshView();
+	return makeView(mGroups_.subMeshes[found->second]);
+}
+
+WavefrontObj::SubMeshView WavefrontObj::getMaterial(size_t materialID) const noexcept {
+	if (materialID >= mMaterials_.size())
+		return SubMeshView();
+	return makeView(mMaterials_.subMeshes[materialID]);
+}
+
+WavefrontObj::SubMeshView WavefrontObj::getMaterial(const std::string& materialName) const {
+	const auto found = mMaterials_.idsByName.find(materialName);
+	if (found == mMaterials_.idsByName.cend())
+		return SubMeshView();
+	return makeView(mMaterials_.subMeshes[found->second]);
+}
+
+
+
+//Private helper function definitions
+
+size_t WavefrontObj::SubMeshList::findOrAdd(const std::string& name) {
+	const auto found = idsByName.find(name);
+	if (found != idsByName.cend())
+		return found->second;
+	const size_t id = subMeshes.size();
+	subMeshes.push_back({ name, {}, 0u, EMPTY_BOUNDS_MIN, EMPTY_BOUNDS_MAX });
+	idsByName.emplace(name, id);
+	return id;
 }
 
 
-bool WavefrontObj::aquireFile(std::string filepath) {
-	mFile_ = std::make_unique <AssetLoadingInternal::AsciiAsset>(filepath/*.c_str()*/);
-	if (!mFile_) {
+bool WavefrontObj::parseFile(const std::string& filepath, AssetLoadingInternal::ObjParseResult& parsedData) {
+	//The file's text is only needed while it is being tokenized, so it is released as soon as this returns
+	const auto file = std::make_unique<AssetLoadingInternal::AsciiAsset>(filepath, true, true);
+	if (file->getStoredTextLength() == 0u) {
+		logError("Unable to acquire parse-able filetext!", filepath);
 		return false;
 	}
-	else {
-		mFile_->aquireLocalCopyOfFileText(); //Load the file as a string
-		if (mFile_->getStoredTextLength() == 0) { 
-			fprintf(ERRLOG, "\nERROR! The '.obj' file \"%s\" is empty!\n", filepath.c_str());
+
+	parsedData.faces.reserve(file->getNumberOfLinesThatBeginWith('f') + file->getNumberOfLinesThatBeginWith('F'));
+	parsedData.positions.reserve(file->getNumberOfLinesThatBeginWith('v'));
+
+	const unsigned int threadCount = AssetLoadingInternal::chooseObjParseThreadCount(file->getStoredTextLength());
+	const size_t linesWithErrors = AssetLoadingInternal::tokenizeObjInParallel(*file, parsedData, threadCount);
+	if (linesWithErrors > 0u) {
+		fprintf(WRNLOG, "\nWarning! %zu lines of file \"%s\" could not be parsed!\n", linesWithErrors, filepath.c_str());
+	}
+
+	if (parsedData.nGons.size() > 0u) {
+		const size_t degenerateNGons = AssetLoadingInternal::triangulateNGons(parsedData);
+		if (degenerateNGons > 0u) {
+			fprintf(WRNLOG, "\nWarning! %zu NGons in file \"%s\" were degenerate and were split into a fan of triangles instead!\n",
+				degenerateNGons, filepath.c_str());
 		}
+	}
+
+	if (parsedData.positions.empty() || parsedData.faces.empty()) {
+		logError("The file does not contain any faces!", filepath);
 		return false;
 	}
-	return true; //File was successfully acquired
+	return true;
+}
+
+
+//Walks through the faces in file order exactly once. Whenever the next tag is reached the current
+//object/group/material is switched, and every face is added to whichever of them are current.
+void WavefrontObj::buildArena(const AssetLoadingInternal::ObjParseResult& parsedData, const std::string& filepath) {
+	mHasTexCoords_ = parsedData.hasTexCoords;
+	mHasNormals_ = parsedData.hasNormals;
+	mVertexSize_ = POSITION_COMPONENTS + (mHasTexCoords_ ? TEXTURE_COORDINATE_COMPONENTS : 0u) +
+		(mHasNormals_ ? NORMAL_COMPONENTS : 0u);
+
+	size_t expectedIndices = 0u;
+	for (size_t i = 0u; i < parsedData.faces.size(); i++)
+		expectedIndices += (parsedData.faces.isQuad(i) ? std::size(AssetLoadingInternal::QUAD_TRIANGULATION_CORNERS) :
+			std::size(AssetLoadingInternal::TRIANGLE_CORNERS));
+	mIndices_.reserve(expectedIndices);
+	mVertices_.reserve(parsedData.positions.size() * mVertexSize_);
+
+	AssetLoadingInternal::VertexDeduplicationTable<3u> uniqueVertices(parsedData.positions.size());
+
+	auto addCorner = [this, &parsedData, &uniqueVertices](const AssetLoadingInternal::ParsedFace& face, int corner) {
+		const AssetLoadingInternal::VertexDeduplicationTable<3u>::Key key = {
+			static_cast<uint32_t>(face.positions[corner]),
+			(face.hasTexCoords ? static_cast<uint32_t>(face.texCoords[corner]) : MISSING_COMPONENT),
+			(face.hasNormals ? static_cast<uint32_t>(face.normals[corner]) : MISSING_COMPONENT) };
+		bool isNewVertex = false;
+		const uint32_t index = uniqueVertices.findOrInsert(key, isNewVertex);
+		mIndices_.push_back(index);
+		if (!isNewVertex)
+			return;
+
+		const AssetLoadingInternal::PositionStreams::Element position = parsedData.positions.get(face.positions[corner]);
+		mVertices_.insert(mVertices_.end(), { position[0], position[1], position[2], mScale_ });
+		if (mHasTexCoords_) {
+			if (face.hasTexCoords) {
+				const AssetLoadingInternal::TexCoordStreams::Element texCoord = parsedData.texCoords.get(face.texCoords[corner]);
+				mVertices_.insert(mVertices_.end(), { texCoord[0], 1.0f - texCoord[1] }); //'t' is flipped for OpenGL
+			}
+			else
+				mVertices_.insert(mVertices_.end(), { 0.0f, 0.0f });
+		}
+		if (mHasNormals_) {
+			if (face.hasNormals) {
+				const AssetLoadingInternal::NormalStreams::Element normal = parsedData.normals.get(face.normals[corner]);
+				mVertices_.insert(mVertices_.end(), { normal[0], normal[1], normal[2] });
+			}
+			else
+				mVertices_.insert(mVertices_.end(), { 0.0f, 0.0f, 0.0f });
+		}
+	};
+
+	auto faceIndicesAreInRange = [&parsedData](const AssetLoadingInternal::ParsedFace& face) {
+		for (int i = 0; i < face.vertexCount; i++) {
+			if ((face.positions[i] >= parsedData.positions.size()) ||
+				(face.hasTexCoords && (face.texCoords[i] >= parsedData.texCoords.size())) ||
+				(face.hasNormals && (face.normals[i] >= parsedData.normals.size())))
+				return false;
+		}
+		return true;
+	};
+
+	size_t currentObject = NO_SUB_MESH;
+	size_t currentGroup = NO_SUB_MESH;
+	size_t currentMaterial = NO_SUB_MESH;
+	size_t nextTag = 0u;
+	size_t facesSkipped = 0u;
+
+	for (size_t faceIndex = 0u; faceIndex < parsedData.faces.size(); faceIndex++) {
+		while ((nextTag < parsedData.subMeshTags.size()) && (parsedData.subMeshTags[nextTag].firstFace <= faceIndex)) {
+			const AssetLoadingInternal::ParsedSubMeshTag& tag = parsedData.subMeshTags[nextTag++];
+			switch (tag.type) {
+			case AssetLoadingInternal::SubMeshTagType::OBJECT:
+				currentObject = mObjects_.findOrAdd(tag.name);
+				currentGroup = NO_SUB_MESH;
+				break;
+			case AssetLoadingInternal::SubMeshTagType::GROUP:
+				currentGroup = mGroups_.findOrAdd(tag.name);
+				break;
+			case AssetLoadingInternal::SubMeshTagType::MATERIAL:
+				currentMaterial = mMaterials_.findOrAdd(tag.name);
+				break;
+			case AssetLoadingInternal::SubMeshTagType::SMOOTHING_GROUP: //Only matters when generating normals
+				break;
+			}
+		}
+
+		const AssetLoadingInternal::ParsedFace face = parsedData.faces[faceIndex];
+		if (!faceIndicesAreInRange(face)) {
+			facesSkipped++;
+			continue;
+		}
+
+		const uint32_t firstIndex = static_cast<uint32_t>(mIndices_.size());
+		if (face.isQuad()) {
+			for (int corner : AssetLoadingInternal::QUAD_TRIANGULATION_CORNERS)
+				addCorner(face, corner);
+		}
+		else {
+			for (int corner : AssetLoadingInternal::TRIANGLE_CORNERS)
+				addCorner(face, corner);
+		}
+
+		std::array<float, 3> faceMin = EMPTY_BOUNDS_MIN, faceMax = EMPTY_BOUNDS_MAX;
+		for (int i = 0; i < face.vertexCount; i++) {
+			const std::array<float, 3> corner = parsedData.positions.get(face.positions[i]);
+			growBounds(faceMin, faceMax, corner, corner);
+		}
+		growBounds(mBoundsMin_, mBoundsMax_, faceMin, faceMax);
+
+		if (currentObject == NO_SUB_MESH) //Only happens for faces before the first 'o' tag
+			currentObject = mObjects_.findOrAdd(DEFAULT_NAME);
+		addFaceToSubMesh(mObjects_.subMeshes[currentObject], firstIndex, faceMin, faceMax);
+		if (currentGroup != NO_SUB_MESH)
+			addFaceToSubMesh(mGroups_.subMeshes[currentGroup], firstIndex, faceMin, faceMax);
+		if (currentMaterial != NO_SUB_MESH)
+			addFaceToSubMesh(mMaterials_.subMeshes[currentMaterial], firstIndex, faceMin, faceMax);
+	}
+
+	if (facesSkipped > 0u) {
+		fprintf(ERRLOG, "\nERROR! %zu faces in file \"%s\" referenced vertex data that does not exist!\n"
+			"  [These faces were skipped]\n", facesSkipped, filepath.c_str());
+	}
+	if (mIndices_.empty()) {
+		logError("None of the file's faces could be loaded!", filepath);
+		mError_ = true;
+		return;
+	}
+
+	mFullMeshRange_.push_back({ 0u, static_cast<uint32_t>(mIndices_.size()) });
+	mVertices_.shrink_to_fit();
+	fprintf(MSGLOG, "\nLoaded \"%s\"  [%zu unique vertices, %zu indices, %zu objects, %zu groups, %zu materials]\n",
+		filepath.c_str(), (mVertices_.size() / mVertexSize_), mIndices_.size(), mObjects_.size(), mGroups_.size(),
+		mMaterials_.size());
 }
 
-#endif //WAVEFRONT_OBJ_INCOMPLETE_
\ No newline at end of file
+
+void WavefrontObj::addFaceToSubMesh(SubMesh& subMesh, uint32_t firstIndex, const std::array<float, 3>& faceMin,
+	                                const std::array<float, 3>& faceMax) {
+	const uint32_t indexCount = static_cast<uint32_t>(mIndices_.size()) - firstIndex;
+	//Faces almost always continue on from the sub-mesh's previous face, in which case its last range just grows
+	if ((!subMesh.ranges.empty()) &&
+		((subMesh.ranges.back().firstIndex + subMesh.ranges.back().indexCount) == firstIndex))
+		subMesh.ranges.back().indexCount += indexCount;
+	else
+		subMesh.ranges.push_back({ firstIndex, indexCount });
+	subMesh.indexCount += indexCount;
+	growBounds(subMesh.boundsMin, subMesh.boundsMax, faceMin, faceMax);
+}
+
+
+WavefrontObj::SubMeshView WavefrontObj::makeView(const SubMesh& subMesh) const noexcept {
+	SubMeshView view;
+	if (subMesh.indexCount == 0u) //Tags which were never followed by any faces
+		return view;
+	view.mName_ = subMesh.name;
+	view.mRanges_ = subMesh.ranges.data();
+	view.mRangeCount_ = subMesh.ranges.size();
+	view.mIndexCount_ = subMesh.indexCount;
+	view.mVertices_ = mVertices_.data();
+	view.mIndices_ = mIndices_.data();
+	view.mVertexSize_ = mVertexSize_;
+	view.mBoundsMin_ = subMesh.boundsMin;
+	view.mBoundsMax_ = subMesh.boundsMax;
+	return view;
+}
+
+
+void WavefrontObj::logError(const char* errorDescription, const std::string& filepath) const {
+	fprintf(ERRLOG, "\nError encountered with Wavefront Obj \"%s.\"\nError reason:\n\t%s\n", filepath.c_str(), errorDescription);
+}
@@ -1,121 +1,194 @@
-
 //File:           WavefrontObj.h
 //Class:          WavefrontObj
-//Base Class:     AssetInterface
 //
-//Dependent on:   AssetInterface.h   -- inherits from base class
-//                Mesh.h             -- Used to store loaded data for processing by rest of application
-//                AsciiAsset.h       -- Used to assist in parsing file
-//                
+//Dependent on:   ObjTokenizer.h          -- Used to parse the file (along with ParallelObjTokenizer.h)
+//                NGonTriangulator.h      -- Used to split up faces with more than 4 vertices
+//                AsciiAsset.h            -- Used to acquire the file's text
+//
+//
+//Description:    This class wraps a Wavefront '.obj' file. Unlike QuickObj, it keeps track of
+//                the objects ('o'), groups ('g') and materials ('usemtl') that the file's faces
+//                are split up into, so that each piece of the model can be drawn or culled on
+//                its own without having to load the file several times.
+//
+//                All of the model's data lives in one shared 'arena', which is a single buffer of
+//                unique interleaved vertices plus a single buffer of 32-bit indices. Each object,
+//                group and material is recorded as one or more ranges within the index buffer, and
+//                getObject()/getGroup()/getMaterial() hand out non-owning SubMeshViews of those
+//                ranges. Nothing gets copied when a view is requested. The arena can be uploaded to
+//                the GPU once, after which each sub-mesh is drawn with a glDrawElements() call per
+//                range [using 'firstIndex * sizeof(uint32_t)' as the offset into the index buffer].
 //
-//Description:    This class wraps a Wavefront '.obj' file. It can be used
-//                to parse model information from the file and create a Mesh
-//                object from it. 
+//                Everything is recorded in the same single pass over the file that parses it, the
+//                tokenizer notes where each tag appears while it parses the faces and the ranges are
+//                laid out while the vertices are being assembled.
 //
-// 
-// Notes:         I am note sure yet, but I am thinking this class will have its own 
-//                internal way of storing and ordering parsed data, and then it can
-//                emplace and distribute the data in the form of a 'Mesh' object.
+// Vertex Layout: Each vertex is 4 position components (with the scale as 'w'), followed by 2 texture
+//                coordinate components if the file has any texture coordinates, followed by 3 normal
+//                components if the file has any normals. This is the same layout QuickObj uses. If the
+//                file has a component but an individual face does not provide it, that face's vertices
+//                get zeros for the missing component. Nothing is generated.
 //
-//                For a brief description of the '.obj' file format, see the link:
+// Sub-Mesh Rules:
+//                -Every face belongs to exactly one object. Faces appearing before the first 'o' tag
+//                   belong to an object named "default".
+//                -A group lasts until the next 'g' or 'o' tag. Faces outside of any group are not part
+//                   of any group.
+//                -A material lasts until the next 'usemtl' tag (it carries across 'o' tags).
+//                -Tags that appear more than once with the same name all refer to the same sub-mesh,
+//                   which is why a sub-mesh can be made up of more than one index range.
+//                -A tag is always given the whole rest of its line as its name, so "g a b" is a single
+//                   group named "a b" rather than a face belonging to the 2 groups 'a' and 'b'.
+//                -A tag that is never followed by any faces still gets an ID, but its view is empty.
+//                -Line primitives ('l') are not loaded.
+//
+// Notes:         For a brief description of the '.obj' file format, see the link:
 //                  https://www.fileformat.info/format/wavefrontobj/egff.htm
 //				  and for a more detailed description see:
 //				    http://paulbourke.net/dataformats/obj/
-//					
 //
-//Future additions:    todo  (maybe make code less confusing. Oh, and
-//                            actually one day I should finish implementing
-//                            this class)
+//                [October 2026] This class was finally finished. It no longer inherits from AssetInterface
+//                (which was never finished either) and it no longer produces 'Mesh' objects, since neither
+//                exists in a usable state. Material files are still not supported, only the names of the
+//                materials are tracked.
 //
 //
 //  Programmer:       Forrest Miller
-//  Date(s):      
+//  Date(s):
 //       Created:     October 15, 2018
 //   Version 0.1:     October 23, 2018
+//   Version 1.0:     October 2026
 
 #pragma once
 
 #ifndef WAVEFRONT_OBJ_H_
 #define WAVEFRONT_OBJ_H_
 
-#define WAVEFRONT_OBJ_INCOMPLETE_ true
-
-#ifndef WAVEFRONT_OBJ_INCOMPLETE_
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
-#include "AssetInterface.h" //This class inherits from base class found in this file
-#include "Mesh.h"           //Loaded data will be placed into "Mesh.h"
-#include "Line.h"           //Used internally by class
-#include "Face.h"           //Used internally by class
-#include "AsciiAsset.h"     //Used internally by class
+#include "ObjTokenizer.h"   //Used internally by class
 
-class WavefrontObj final : public AssetInterface {
+class WavefrontObj final {
 public:
+	//A run of consecutive indices within the shared index buffer
+	typedef struct IndexRange {
+		uint32_t firstIndex;
+		uint32_t indexCount;
+	} IndexRange;
+
+	//A non-owning view of part (or all) of the shared arena. The vertex and index pointers always point
+	//at the start of the full arena buffers, since every index is relative to the start of the vertex
+	//buffer. Only the indices within the view's ranges belong to the sub-mesh.
+	//A view stays valid for as long as the WavefrontObj it came from (or a WavefrontObj that was moved
+	//into from that one) is alive. A default-constructed view is empty.
+	class SubMeshView final {
+	public:
+		SubMeshView() = default;
+
+		bool empty() const noexcept { return (mIndexCount_ == 0u); }
+		explicit operator bool() const noexcept { return (!empty()); }
+
+		std::string_view name() const noexcept { return mName_; }
+
+		const IndexRange * ranges() const noexcept { return mRanges_; }
+		size_t rangeCount() const noexcept { return mRangeCount_; }
+		//The total number of indices across every range
+		size_t indexCount() const noexcept { return mIndexCount_; }
+
+		const float * vertexData() const noexcept { return mVertices_; }
+		const uint32_t * indexData() const noexcept { return mIndices_; }
+		//Number of floats per vertex
+		size_t vertexSize() const noexcept { return mVertexSize_; }
+
+		//An axis-aligned bounding box around every vertex in the view, for culling
+		const std::array<float, 3>& boundsMin() const noexcept { return mBoundsMin_; }
+		const std::array<float, 3>& boundsMax() const noexcept { return mBoundsMax_; }
+
+	private:
+		friend class WavefrontObj;
+		std::string_view mName_;
+		const IndexRange * mRanges_ = nullptr;
+		size_t mRangeCount_ = 0u;
+		size_t mIndexCount_ = 0u;
+		const float * mVertices_ = nullptr;
+		const uint32_t * mIndices_ = nullptr;
+		size_t mVertexSize_ = 0u;
+		std::array<float, 3> mBoundsMin_ = { 0.0f, 0.0f, 0.0f };
+		std::array<float, 3> mBoundsMax_ = { 0.0f, 0.0f, 0.0f };
+	};
+
+
 	/*                      /////////////////////
 	                        //   Constructors  //
 	                        /////////////////////                            */
-	WavefrontObj(const char * filepath);
-	WavefrontObj(std::string filepath);
+	//Parses the '.obj' file. The scale is placed as the 'w' component of every position. Use error()
+	//to find out if the file could not be loaded.
+	WavefrontObj(const std::string& filepath, float scale = 1.0f);
 
 	//   Eventually      (or maybe make a separate class for tying Wavefront file-collections together):
-	//WavefrontObj(std::vector<std::string> filepaths); //Will parse extensions on filepaths 
+	//WavefrontObj(std::vector<std::string> filepaths); //Will parse extensions on filepaths
 
 
 	/*                        ///////////////////
 	                          //  Destructor  ///
 	                          ///////////////////                            */
-	virtual ~WavefrontObj() override { ; }
+	~WavefrontObj() = default;
 
 
 
 	/*                    //////////////////////////
 	                      //  Move Functionality  //
-	                      //////////////////////////                         */        
-	WavefrontObj(WavefrontObj&&);
-	WavefrontObj& operator=(WavefrontObj&&);
-
-
-
-	/*                 ////////////////////////////////
-	                   //  AssetInterface Overrides  //
-					   ////////////////////////////////                      */
+	                      //////////////////////////                         */
+	//Moving keeps every buffer (and so every view) where it is
+	WavefrontObj(WavefrontObj&&) = default;
+	WavefrontObj& operator=(WavefrontObj&&) = default;
 
-	//Returns the size of the loaded asset data (just the mesh data)
-	virtual size_t size() const override /*;*/ { return 0; }
-	//Returns the amount of storage space required to store the asset
-	virtual GLsizei requiredStorageSpace() const override  /*;*/ { return 0; }
-	//Loads the asset into application memory. Most likely this will involve
-	//parsing a file. Does nothing if the asset has already been loaded.
-	//The parameters dictate whether to load/generate additional mesh data.
-	virtual bool load() override  /*;*/ { return false; }
 
 
 	/*                      ////////////////////////
 					        //  Public Interface  //
 					        ////////////////////////                         */
 
-	//Retrieves the data loaded by this object as a mesh as a unique_ptr. Will 
-	//return a default mesh if the object was unable to load.
-	std::unique_ptr<Mesh> getFullMesh() /*const*/; 
+	bool error() const noexcept { return mError_; }
+
+	bool hasTexCoords() const noexcept { return mHasTexCoords_; }
+	bool hasNormals() const noexcept { return mHasNormals_; }
+	float getScale() const noexcept { return mScale_; }
+
+	//The shared arena
+	const std::vector<float>& getVertices() const noexcept { return mVertices_; }
+	const std::vector<uint32_t>& getIndices() const noexcept { return mIndices_; }
+	//Number of floats per vertex
+	size_t getVertexSize() const noexcept { return mVertexSize_; }
+
+	//Returns a view of the entire model (which has an empty name)
+	SubMeshView getFullMesh() const noexcept;
 
-	std::unique_ptr<Mesh> getObject(int ObjID) /*const*/;
-	std::unique_ptr<Mesh> getObject(std::string objName) /*const*/;
-	std::unique_ptr<Mesh> getGroup(int groupID) /*const*/;
-	std::unique_ptr<Mesh> getGroup(std::string groupName) /*const*/;
+	//Objects, groups and materials are numbered in the order their names first appear in the file.
+	//Looking up an ID or name that doesn't exist returns an empty view.
+	size_t getObjectCount() const noexcept { return mObjects_.size(); }
+	SubMeshView getObject(size_t objectID) const noexcept;
+	SubMeshView getObject(const std::string& objectName) const;
 
-	//Attaches the material file to this object. The material will be automatically linked
-	//if name of material matches the name of a material in the '.obj' file. 
-	void attachMaterial(std::string materialFilePath);
+	size_t getGroupCount() const noexcept { return mGroups_.size(); }
+	SubMeshView getGroup(size_t groupID) const noexcept;
+	SubMeshView getGroup(const std::string& groupName) const;
 
-	//Attaches the material file to this object as though it's name was really  
-	//'materialName.'
-	void attachMaterialAs(std::string materialFilePath, std::string materialName);
+	size_t getMaterialCount() const noexcept { return mMaterials_.size(); }
+	SubMeshView getMaterial(size_t materialID) const noexcept;
+	SubMeshView getMaterial(const std::string& materialName) const;
 
 
 	/*                   ///////////////////////////////
 	                     //   Disabled Functionality  //
 	                     ///////////////////////////////                     */
 
-	//Must provide a filepath for object construction 
+	//Must provide a filepath for object construction
 	WavefrontObj() = delete;
 	//Copying is disabled
 	WavefrontObj(const WavefrontObj &) = delete;
@@ -125,70 +198,63 @@ public:
 private:
 
 	static constexpr const char * DEFAULT_NAME = "default";
-	static constexpr const char * NO_MATERIAL = "None";
-
-	//Each object in the '.obj' file (denoted by 'o' in filetext) will be assigned
-	//a unique integer ID.
-	using ObjectID = int;
-
-	//A struct is used to track each object's name and ID. 
-	struct Object {
-		ObjectID id;
-		std::string objectName;
+	static constexpr const char * FULL_MESH_NAME = "";
+	static constexpr const size_t NO_SUB_MESH = ~static_cast<size_t>(0u);
+
+	//Everything recorded for one object, group or material
+	struct SubMesh {
+		std::string name;
+		std::vector<IndexRange> ranges;
+		size_t indexCount;
+		std::array<float, 3> boundsMin;
+		std::array<float, 3> boundsMax;
 	};
 
-	//A struct is used to hold group info. Groups are delineated in '.obj' file by the letter 'g'
-	//Objects without any grouping are placed in a default group.
-	struct Group {
-		ObjectID objectID;
-		std::string groupName;
-		std::vector<std::shared_ptr<AssetLoadingInternal::AsciiAsset>> materials;
-		std::vector < AssetLoadingInternal::Face > faces;
-	};
+	//Each type of sub-mesh is kept in a vector (in order of first appearance) along with a map
+	//from each name to its position in that vector
+	struct SubMeshList {
+		std::vector<SubMesh> subMeshes;
+		std::unordered_map<std::string, size_t> idsByName;
 
+		//Returns the ID of the sub-mesh with this name, adding a new sub-mesh if there isn't one yet
+		size_t findOrAdd(const std::string& name);
+		size_t size() const noexcept { return subMeshes.size(); }
+	};
 
-	std::vector<std::unique_ptr<struct Group>> mGroups_;
-	std::vector < std::unique_ptr<struct Object>> mObjects_;
-	std::unique_ptr<AssetLoadingInternal::AsciiAsset> mFile_;
+	bool mError_;
+	float mScale_;
+	bool mHasTexCoords_, mHasNormals_;
+	size_t mVertexSize_;
+	std::array<float, 3> mBoundsMin_, mBoundsMax_;
 
+	std::vector<float> mVertices_;
+	std::vector<uint32_t> mIndices_;
+	//Always a single range covering every index. It is kept in a vector (rather than on its own) so that
+	//it doesn't move when the WavefrontObj is moved.
+	std::vector<IndexRange> mFullMeshRange_;
 
+	SubMeshList mObjects_;
+	SubMeshList mGroups_;
+	SubMeshList mMaterials_;
 
 
 	//Helper member functions  (Functions appear in the order which they are to be called)
-	void initialize();
-
-	//Attempts to load the filepath as a string into this object's AsciiAsset member. 
-	bool aquireFile(std::string filepath);
-
-	void logError(const char* message) const;
-
-	//Function to parse the '.obj' file
-	//void parseFile(); 
 
-	//
+	//Tokenizes the file into 'parsedData', returning false if it could not be loaded
+	bool parseFile(const std::string& filepath, AssetLoadingInternal::ObjParseResult& parsedData);
 
+	//Builds the shared arena out of the parsed data while recording every sub-mesh's ranges
+	void buildArena(const AssetLoadingInternal::ObjParseResult& parsedData, const std::string& filepath);
 
-	//void parseMaterials();
-	//void findDuplicateFaces();
+	//Extends the sub-mesh's ranges to cover the indices from 'firstIndex' through the end of mIndices_
+	//(which are the indices of the face that was just added), and grows its bounds to cover the face
+	void addFaceToSubMesh(SubMesh& subMesh, uint32_t firstIndex, const std::array<float, 3>& faceMin,
+	                      const std::array<float, 3>& faceMax);
 
-	//void organizeData();
+	SubMeshView makeView(const SubMesh& subMesh) const noexcept;
 
-	//int detectComponentsPerPosition();
-	//void parseVertices();
-
-	//bool detectIfHasNormals();
-	//void parseNormals();
-
-	//bool detectIfHasTextureCoords();
-	//void parseTextureCoords();
-
-	
+	void logError(const char* message, const std::string& filepath) const;
 };
 
 
-
-
-#endif //WAVEFRONT_OBJ_INCOMPLETE_
-
-
-#endif //WAVEFRONT_OBJ_H_
\ No newline at end of file
+#endif //WAVEFRONT_OBJ_H_
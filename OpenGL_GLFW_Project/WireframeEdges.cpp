@@ -0,0 +1,141 @@
+// File:           WireframeEdges.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   Each range works out which vertex every vertex it uses gets welded to in a table covering
+//                          just the span of vertices the range uses (the ranges of a scene each use their own block
+//                          of vertices, so this stays small), looking each position up in a hash map only the first
+//                          time a vertex is seen. An edge is keyed by its 2 welded vertices, smaller one first, in a
+//                          hash set.
+//
+//                          Ranges are handed out to the threads one at a time as each thread finishes its last one,
+//                          since the objects of a scene can be very different sizes. Every range writes its edges
+//                          into its own list, and the lists are joined in range order once all are done.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "WireframeEdges.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ParallelRanges.h"
+#include "PositionKey.h"
+
+namespace AssetLoadingInternal {
+
+    namespace {
+
+        static constexpr const uint32_t NO_VERTEX = std::numeric_limits<uint32_t>::max();
+        static constexpr const size_t VERTICES_PER_TRIANGLE = 3u;
+
+        //Both vertices of an edge packed into 64 bits, with the smaller vertex in the upper half
+        struct EdgeKeyHash {
+            size_t operator()(uint64_t key) const noexcept {
+                key ^= (key >> 33);
+                key *= 0xFF51AFD7ED558CCDull;
+                key ^= (key >> 33);
+                return static_cast<size_t>(key);
+            }
+        };
+
+        std::vector<uint32_t> findRangeEdges(const uint32_t * indices, const WireframeRange& range, const float * vertices,
+                                             size_t vertexStride, size_t vertexCount) {
+            const size_t triangleCount = (range.indexCount / VERTICES_PER_TRIANGLE);
+            const uint32_t * const triangles = (indices + range.firstIndex);
+            auto isUsable = [&](size_t triangle) {
+                const uint32_t * const corners = (triangles + (triangle * VERTICES_PER_TRIANGLE));
+                return ((corners[0] < vertexCount) && (corners[1] < vertexCount) && (corners[2] < vertexCount));
+            };
+
+            uint32_t firstVertex = NO_VERTEX;
+            uint32_t lastVertex = 0u;
+            size_t usableTriangles = 0u;
+            for (size_t triangle = 0u; triangle < triangleCount; triangle++) {
+                if (!isUsable(triangle))
+                    continue;
+                usableTriangles++;
+                for (size_t corner = 0u; corner < VERTICES_PER_TRIANGLE; corner++) {
+                    firstVertex = std::min(firstVertex, triangles[(triangle * VERTICES_PER_TRIANGLE) + corner]);
+                    lastVertex = std::max(lastVertex, triangles[(triangle * VERTICES_PER_TRIANGLE) + corner]);
+                }
+            }
+            std::vector<uint32_t> edges;
+            if (usableTriangles == 0u)
+                return edges;
+
+            //Which vertex each vertex in the span gets welded to, filled in as the vertices are first used
+            std::vector<uint32_t> weldedVertices(static_cast<size_t>(lastVertex - firstVertex) + 1u, NO_VERTEX);
+            std::unordered_map<PositionKey, uint32_t, PositionKeyHash> firstVertexAtPosition;
+            firstVertexAtPosition.reserve(weldedVertices.size());
+            auto weld = [&](uint32_t vertex) {
+                uint32_t& welded = weldedVertices[vertex - firstVertex];
+                if (welded == NO_VERTEX) {
+                    const float * const position = (vertices + (static_cast<size_t>(vertex) * vertexStride));
+                    const PositionKey key = makePositionKey(position);
+                    welded = firstVertexAtPosition.emplace(key, vertex).first->second;
+                }
+                return welded;
+            };
+
+            //A closed mesh has 3 edges for every 2 triangles
+            std::unordered_set<uint64_t, EdgeKeyHash> foundEdges;
+            foundEdges.reserve((usableTriangles * 3u) / 2u);
+            edges.reserve(usableTriangles * 3u);
+            for (size_t triangle = 0u; triangle < triangleCount; triangle++) {
+                if (!isUsable(triangle))
+                    continue;
+                const uint32_t * const corners = (triangles + (triangle * VERTICES_PER_TRIANGLE));
+                const uint32_t welded[VERTICES_PER_TRIANGLE] = { weld(corners[0]), weld(corners[1]), weld(corners[2]) };
+                for (size_t side = 0u; side < VERTICES_PER_TRIANGLE; side++) {
+                    const uint32_t start = welded[side];
+                    const uint32_t end = welded[(side + 1u) % VERTICES_PER_TRIANGLE];
+                    if (start == end)
+                        continue;
+                    const uint64_t key = ((static_cast<uint64_t>(std::min(start, end)) << 32) | std::max(start, end));
+                    if (foundEdges.insert(key).second) {
+                        edges.push_back(start);
+                        edges.push_back(end);
+                    }
+                }
+            }
+            return edges;
+        }
+
+    } //namespace
+
+
+    std::vector<uint32_t> buildWireframeEdges(const uint32_t * indices, const WireframeRange * ranges, size_t rangeCount,
+                                              const float * vertices, size_t vertexStride, size_t vertexCount,
+                                              unsigned int threadCount) {
+        if ((rangeCount == 0u) || (vertexStride < 3u))
+            return {};
+        if (threadCount == AUTOMATIC_WIREFRAME_THREAD_COUNT) {
+            size_t triangleCount = 0u;
+            for (size_t range = 0u; range < rangeCount; range++)
+                triangleCount += (ranges[range].indexCount / VERTICES_PER_TRIANGLE);
+            threadCount = chooseParallelThreadCount(triangleCount, MIN_TRIANGLES_PER_WIREFRAME_THREAD);
+        }
+
+        std::vector<std::vector<uint32_t>> rangeEdges(rangeCount);
+        std::atomic<size_t> nextRange(0u);
+        runInParallelRanges(countParallelRanges(threadCount, rangeCount), rangeCount, [&](size_t, size_t, size_t) {
+            for (size_t range = nextRange++; range < rangeCount; range = nextRange++)
+                rangeEdges[range] = findRangeEdges(indices, ranges[range], vertices, vertexStride, vertexCount);
+        });
+
+        size_t totalIndices = 0u;
+        for (const std::vector<uint32_t>& edges : rangeEdges)
+            totalIndices += edges.size();
+        std::vector<uint32_t> allEdges;
+        allEdges.reserve(totalIndices);
+        for (const std::vector<uint32_t>& edges : rangeEdges)
+            allEdges.insert(allEdges.end(), edges.cbegin(), edges.cend());
+        return allEdges;
+    }
+
+} //namespace AssetLoadingInternal
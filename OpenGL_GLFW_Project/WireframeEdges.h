@@ -0,0 +1,55 @@
+// File:           WireframeEdges.h
+// Namespace:      AssetLoadingInternal
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Builds the index list for drawing a triangle mesh as a wireframe with GL_LINES, with
+//                 every edge of the mesh in the list exactly once. Outlining each triangle on its own would
+//                 draw every edge shared by 2 triangles twice, which for a closed mesh is every edge.
+//
+//                 An indexed mesh usually has several vertices at the same position, wherever a UV seam or
+//                 a hard edge needed the vertex split up. The vertices are welded by position first [positions
+//                 have to match exactly], so an edge running along a seam still only gets drawn once. Each
+//                 welded position is drawn with the first of its vertices the triangles use.
+//
+//                 The mesh is given as a list of ranges (e.g. one per object in a scene), each range's
+//                 triangles having their edges found on their own. The ranges are split across threads, but the
+//                 list comes out the same no matter how many threads are used: each range's edges are in the
+//                 order its triangles first use them, and the ranges are in the order they were given in.
+//
+// Note:           Vertices are only welded to other vertices used by the same range. Edges which have both ends
+//                 at the same welded position (such as the ones QuickObj uses to store line primitives as
+//                 triangles) are left out, as are triangles with an index past the end of the vertices.
+
+#pragma once
+
+#ifndef WIREFRAME_EDGES_H_
+#define WIREFRAME_EDGES_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace AssetLoadingInternal {
+
+    //Passing this as the thread count lets the edges be found on as many threads as are useful
+    static constexpr const unsigned int AUTOMATIC_WIREFRAME_THREAD_COUNT = 0u;
+
+    //Scenes with fewer triangles than this per thread aren't worth splitting up further
+    static constexpr const size_t MIN_TRIANGLES_PER_WIREFRAME_THREAD = 65536u;
+
+    //'indexCount' / 3 triangles starting at 'firstIndex' in the index list
+    typedef struct WireframeRange {
+        size_t firstIndex;
+        size_t indexCount;
+    } WireframeRange;
+
+    //Returns 2 indices (into the same vertices as 'indices') for every distinct edge of the triangles within each of
+    //the 'rangeCount' ranges. Each vertex is 'vertexStride' floats, with its position in the first 3.
+    std::vector<uint32_t> buildWireframeEdges(const uint32_t * indices, const WireframeRange * ranges, size_t rangeCount,
+                                              const float * vertices, size_t vertexStride, size_t vertexCount,
+                                              unsigned int threadCount = AUTOMATIC_WIREFRAME_THREAD_COUNT);
+
+} //namespace AssetLoadingInternal
+
+#endif //WIREFRAME_EDGES_H_
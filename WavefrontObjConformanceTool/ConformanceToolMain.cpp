@@ -0,0 +1,92 @@
+// File:           ConformanceToolMain.cpp
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Entry point for the WavefrontObjConformanceTool. Like the AssetLoadingBenchmark, this
+//                 project compiles the asset loading code straight out of the main project's directory
+//                 and never creates a window or a GL context, so it builds and runs on Linux as well.
+//
+//                 Usage:
+//                     WavefrontObjConformanceTool <input.obj> [output.obj]
+//                     WavefrontObjConformanceTool --verify <file.obj> [file.obj ...]
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "LoggingMessageTargets.h"
+#include "AsciiAsset.h"
+#include "ConformantObj.h"
+#include "ObjConformer.h"
+
+namespace {
+    //Appended to the name of the input file when no output file is given
+    constexpr const char * DEFAULT_OUTPUT_SUFFIX = ".conformant.obj";
+
+    void printUsage(const char* programName) {
+        fprintf(MSGLOG, "\nUsage:\n"
+            "    %s <input.obj> [output.obj]\n"
+            "          Conforms the input file and writes the result to the output file. The output\n"
+            "          defaults to the input's name with '.obj' replaced by '%s'. The output is\n"
+            "          allowed to be the input file itself.\n"
+            "    %s --verify <file.obj> [file.obj ...]\n"
+            "          Checks whether each file carries a valid conformance stamp, meaning it is\n"
+            "          still exactly as the tool wrote it.\n",
+            programName, DEFAULT_OUTPUT_SUFFIX, programName);
+    }
+
+    std::string getDefaultOutputFilepath(const std::string& inputFilepath) {
+        const size_t extension = inputFilepath.rfind('.');
+        const size_t lastSeparator = inputFilepath.find_last_of("/\\");
+        if ((extension == std::string::npos) || ((lastSeparator != std::string::npos) && (extension < lastSeparator)))
+            return (inputFilepath + DEFAULT_OUTPUT_SUFFIX);
+        return (inputFilepath.substr(0u, extension) + DEFAULT_OUTPUT_SUFFIX);
+    }
+
+    //Returns the number of files which were not conformant
+    int verifyFiles(int argc, char** argv) {
+        int nonConformantFiles = 0;
+        for (int i = 2; i < argc; i++) {
+            AssetLoadingInternal::AsciiAsset file(argv[i], true, true);
+            AssetLoadingInternal::ConformantObjStamp stamp;
+            if ((file.getStoredTextLength() > 0u) && AssetLoadingInternal::verifyConformantObjStamp(file.getTextView(), stamp)) {
+                fprintf(MSGLOG, "CONFORMANT      %s  [%zu positions, %zu texture coordinates, %zu normals, %zu triangles]\n",
+                    argv[i], stamp.positionCount, stamp.texCoordCount, stamp.normalCount, stamp.triangleCount);
+            }
+            else {
+                const bool hasStamp = AssetLoadingInternal::readConformantObjStamp(file.getTextView(), stamp);
+                fprintf(MSGLOG, "NOT CONFORMANT  %s%s\n", argv[i], (hasStamp ? "  [the file was changed after it was stamped]" : ""));
+                nonConformantFiles++;
+            }
+        }
+        return nonConformantFiles;
+    }
+}
+
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (strcmp(argv[1], "--verify") == 0) {
+        if (argc < 3) {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        return ((verifyFiles(argc, argv) == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    const std::string inputFilepath = argv[1];
+    const std::string outputFilepath = ((argc > 2) ? std::string(argv[2]) : getDefaultOutputFilepath(inputFilepath));
+
+    ObjConformer conformer;
+    if (!conformer.conform(inputFilepath))
+        return EXIT_FAILURE;
+    conformer.printReport();
+    if (!conformer.writeConformedFile(outputFilepath))
+        return EXIT_FAILURE;
+    fprintf(MSGLOG, "    Wrote \"%s\"  (%zu bytes)\n", outputFilepath.c_str(), conformer.getConformedText().length());
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,376 @@
+// File:           ObjConformer.cpp
+//
+//  See header file for details.
+//
+//  Implementation Notes:   Numbers are written with std::to_chars, which for floats writes the shortest
+//                          text that reads back as exactly the same value. This keeps the conformed file
+//                          about the same size as a typical exported file while losing nothing.
+//
+// Programmer:     Forrest Miller
+// Date:           October 2026
+
+#include "ObjConformer.h"
+
+#include <charconv>     //to_chars
+#include <cstring>      //memcpy
+#include <filesystem>
+#include <fstream>
+#include <limits>
+
+#include "AsciiAsset.h"
+#include "ConformantObj.h"
+#include "NGonTriangulator.h"
+#include "ParallelObjTokenizer.h"
+
+namespace {
+    //Each corner of a conformed triangle is stored as its (position, texCoord, normal) indices
+    static constexpr const size_t INDICES_PER_CORNER = 3u;
+    static constexpr const size_t INDICES_PER_TRIANGLE = INDICES_PER_CORNER * 3u;
+
+    static constexpr const uint32_t NOT_YET_USED = std::numeric_limits<uint32_t>::max();
+
+    static constexpr const char * TEMPORARY_EXTENSION = ".tmp";
+
+    //Conformed files tend to come out close to this many bytes per triangle, which is only used
+    //for reserving space
+    static constexpr const size_t EXPECTED_BYTES_PER_TRIANGLE = 96u;
+
+    inline void appendFloat(std::string& text, float value) {
+        char digits[32];
+        const std::to_chars_result written = std::to_chars(digits, digits + sizeof(digits), value);
+        text.append(digits, written.ptr);
+    }
+
+    inline void appendIndex(std::string& text, uint32_t zeroBasedIndex) {
+        char digits[16];
+        const std::to_chars_result written = std::to_chars(digits, digits + sizeof(digits), zeroBasedIndex + 1u);
+        text.append(digits, written.ptr);
+    }
+
+    //Compares the bits of the 2 values, so that -0.0 and 0.0 are told apart and NaN matches itself
+    inline bool sameFloat(float a, float b) noexcept {
+        uint32_t aBits, bBits;
+        memcpy(&aBits, &a, sizeof(float));
+        memcpy(&bBits, &b, sizeof(float));
+        return (aBits == bBits);
+    }
+
+    //Looks up the conformed index of a source vertex, giving it the next index if this is its first use
+    inline uint32_t remap(std::vector<uint32_t>& remapTable, size_t sourceIndex, uint32_t& nextIndex) {
+        uint32_t& conformedIndex = remapTable[sourceIndex];
+        if (conformedIndex == NOT_YET_USED)
+            conformedIndex = nextIndex++;
+        return conformedIndex;
+    }
+}
+
+
+bool ObjConformer::conform(const std::string& filepath) {
+    resetStatistics();
+    mSourceFilepath_ = filepath;
+    mConformedText_.clear();
+
+    AssetLoadingInternal::ObjParseResult parsed;
+    {
+        //The file is only kept open for parsing, so that the output is able to replace it
+        AssetLoadingInternal::AsciiAsset file(filepath, true, true);
+        if (file.getStoredTextLength() == 0u) {
+            fprintf(ERRLOG, "\nERROR! Unable to read the file \"%s\"!\n", filepath.c_str());
+            return false;
+        }
+        AssetLoadingInternal::ConformantObjStamp stamp;
+        mSourceWasConformant_ = AssetLoadingInternal::verifyConformantObjStamp(file.getTextView(), stamp);
+        const unsigned int threadCount = AssetLoadingInternal::chooseObjParseThreadCount(file.getStoredTextLength());
+        mLinesWithErrors_ = AssetLoadingInternal::tokenizeObjInParallel(file, parsed, threadCount);
+    }
+
+    mSourcePositions_ = parsed.positions.size();
+    mSourceTexCoords_ = parsed.texCoords.size();
+    mSourceNormals_ = parsed.normals.size();
+    mSourceNGons_ = parsed.nGons.size();
+    mSourceLineSegments_ = parsed.lineEndpoints.size() / 2u;
+    mSourceSubMeshTags_ = parsed.subMeshTags.size();
+    for (const AssetLoadingInternal::ParsedFace face : parsed.faces) {
+        if (face.isQuad())
+            mSourceQuads_++;
+        else if (!face.isNGon())
+            mSourceTriangles_++;
+    }
+
+    if (parsed.nGons.size() > 0u)
+        AssetLoadingInternal::triangulateNGons(parsed);
+
+    //Faces with out-of-range indices are dropped here, so nothing past this point needs to check
+    AssetLoadingInternal::ParsedFaceList faces;
+    faces.reserve(parsed.faces.size());
+    bool anyFaceHasTexCoords = false, everyFaceHasTexCoords = true;
+    bool anyFaceHasNormals = false, everyFaceHasNormals = true;
+    for (const AssetLoadingInternal::ParsedFace face : parsed.faces) {
+        bool inRange = true;
+        for (int i = 0; i < face.vertexCount; i++) {
+            if ((face.positions[i] >= parsed.positions.size()) ||
+                (face.hasTexCoords && (face.texCoords[i] >= parsed.texCoords.size())) ||
+                (face.hasNormals && (face.normals[i] >= parsed.normals.size())))
+                inRange = false;
+        }
+        if (!inRange) {
+            mFacesDropped_++;
+            continue;
+        }
+        anyFaceHasTexCoords = (anyFaceHasTexCoords || face.hasTexCoords);
+        everyFaceHasTexCoords = (everyFaceHasTexCoords && face.hasTexCoords);
+        anyFaceHasNormals = (anyFaceHasNormals || face.hasNormals);
+        everyFaceHasNormals = (everyFaceHasNormals && face.hasNormals);
+        faces.push_back(face);
+    }
+    parsed.faces.clear();
+    parsed.faces.shrink_to_fit();
+
+    if (faces.empty()) {
+        fprintf(ERRLOG, "\nERROR! The file \"%s\" does not contain any usable faces!\n", filepath.c_str());
+        return false;
+    }
+
+    bool keepTexCoords = everyFaceHasTexCoords;
+    mTexCoordsDroppedAsMixed_ = (anyFaceHasTexCoords && (!everyFaceHasTexCoords));
+    if (keepTexCoords && (!usesNonZeroTexCoords(parsed, faces))) {
+        keepTexCoords = false;
+        mTexCoordsDroppedAsZero_ = true;
+    }
+    const bool keepNormals = everyFaceHasNormals;
+    mNormalsDroppedAsMixed_ = (anyFaceHasNormals && (!everyFaceHasNormals));
+
+    //Re-index everything in the order the faces first use it
+    std::vector<uint32_t> positionRemap(parsed.positions.size(), NOT_YET_USED);
+    std::vector<uint32_t> texCoordRemap(keepTexCoords ? parsed.texCoords.size() : 0u, NOT_YET_USED);
+    std::vector<uint32_t> normalRemap(keepNormals ? parsed.normals.size() : 0u, NOT_YET_USED);
+    std::vector<float> positions, texCoords, normals;
+    std::vector<uint32_t> corners;
+    corners.reserve(faces.size() * INDICES_PER_TRIANGLE * 2u);
+    uint32_t nextPosition = 0u, nextTexCoord = 0u, nextNormal = 0u;
+
+    auto addCorner = [&](const AssetLoadingInternal::ParsedFace& face, int corner) {
+        const uint32_t position = remap(positionRemap, face.positions[corner], nextPosition);
+        if (position == (positions.size() / 3u)) {
+            const AssetLoadingInternal::PositionStreams::Element source = parsed.positions.get(face.positions[corner]);
+            positions.insert(positions.end(), source.cbegin(), source.cend());
+        }
+        uint32_t texCoord = 0u;
+        if (keepTexCoords) {
+            texCoord = remap(texCoordRemap, face.texCoords[corner], nextTexCoord);
+            if (texCoord == (texCoords.size() / 2u)) {
+                const AssetLoadingInternal::TexCoordStreams::Element source = parsed.texCoords.get(face.texCoords[corner]);
+                texCoords.insert(texCoords.end(), source.cbegin(), source.cend());
+            }
+        }
+        uint32_t normal = 0u;
+        if (keepNormals) {
+            normal = remap(normalRemap, face.normals[corner], nextNormal);
+            if (normal == (normals.size() / 3u)) {
+                const AssetLoadingInternal::NormalStreams::Element source = parsed.normals.get(face.normals[corner]);
+                normals.insert(normals.end(), source.cbegin(), source.cend());
+            }
+        }
+        corners.insert(corners.end(), { position, texCoord, normal });
+    };
+
+    for (const AssetLoadingInternal::ParsedFace face : faces) {
+        if (face.isQuad()) {
+            for (int corner : AssetLoadingInternal::QUAD_TRIANGULATION_CORNERS)
+                addCorner(face, corner);
+        }
+        else {
+            for (int corner : AssetLoadingInternal::TRIANGLE_CORNERS)
+                addCorner(face, corner);
+        }
+    }
+
+    mPositions_ = positions.size() / 3u;
+    mTexCoords_ = texCoords.size() / 2u;
+    mNormals_ = normals.size() / 3u;
+    mTriangles_ = corners.size() / INDICES_PER_TRIANGLE;
+
+    AssetLoadingInternal::ConformantObjStamp stamp = { 0u, mPositions_, mTexCoords_, mNormals_, mTriangles_, 0u };
+    mConformedText_ = AssetLoadingInternal::formatConformantObjStamp(stamp);
+    mConformedText_.reserve(mTriangles_ * EXPECTED_BYTES_PER_TRIANGLE);
+    for (size_t i = 0u; i < positions.size(); i += 3u) {
+        mConformedText_.append("v ");
+        appendFloat(mConformedText_, positions[i]);
+        mConformedText_.push_back(' ');
+        appendFloat(mConformedText_, positions[i + 1u]);
+        mConformedText_.push_back(' ');
+        appendFloat(mConformedText_, positions[i + 2u]);
+        mConformedText_.push_back('\n');
+    }
+    for (size_t i = 0u; i < texCoords.size(); i += 2u) {
+        mConformedText_.append("vt ");
+        appendFloat(mConformedText_, texCoords[i]);
+        mConformedText_.push_back(' ');
+        appendFloat(mConformedText_, texCoords[i + 1u]);
+        mConformedText_.push_back('\n');
+    }
+    for (size_t i = 0u; i < normals.size(); i += 3u) {
+        mConformedText_.append("vn ");
+        appendFloat(mConformedText_, normals[i]);
+        mConformedText_.push_back(' ');
+        appendFloat(mConformedText_, normals[i + 1u]);
+        mConformedText_.push_back(' ');
+        appendFloat(mConformedText_, normals[i + 2u]);
+        mConformedText_.push_back('\n');
+    }
+    for (size_t i = 0u; i < corners.size(); i += INDICES_PER_CORNER) {
+        const bool firstCorner = (((i / INDICES_PER_CORNER) % 3u) == 0u);
+        mConformedText_.append(firstCorner ? "f " : " ");
+        appendIndex(mConformedText_, corners[i]);
+        if (keepTexCoords) {
+            mConformedText_.push_back('/');
+            appendIndex(mConformedText_, corners[i + 1u]);
+        }
+        if (keepNormals) {
+            mConformedText_.append(keepTexCoords ? "/" : "//");
+            appendIndex(mConformedText_, corners[i + 2u]);
+        }
+        if ((((i / INDICES_PER_CORNER) % 3u) == 2u))
+            mConformedText_.push_back('\n');
+    }
+    AssetLoadingInternal::sealConformantObjText(mConformedText_);
+
+    if (!conformedTextReadsBackExactly(positions, texCoords, normals, corners)) {
+        fprintf(ERRLOG, "\nERROR! The conformed text for \"%s\" did not read back as the same mesh!\n"
+            "  [Nothing will be written for this file]\n", filepath.c_str());
+        mConformedText_.clear();
+        return false;
+    }
+    return true;
+}
+
+
+bool ObjConformer::writeConformedFile(const std::string& filepath) const {
+    if (mConformedText_.empty()) {
+        fprintf(ERRLOG, "\nERROR! There is no conformed text to write to \"%s\"!\n", filepath.c_str());
+        return false;
+    }
+
+    const std::string temporaryFilepath = filepath + TEMPORARY_EXTENSION;
+    {
+        //Written in binary mode, since converting the line endings would invalidate the stamp
+        std::ofstream out(temporaryFilepath, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!out) {
+            fprintf(ERRLOG, "\nERROR! Unable to create the file \"%s\"!\n", temporaryFilepath.c_str());
+            return false;
+        }
+        out.write(mConformedText_.data(), static_cast<std::streamsize>(mConformedText_.length()));
+        if (!out) {
+            fprintf(ERRLOG, "\nERROR! An error occurred while writing the file \"%s\"!\n", temporaryFilepath.c_str());
+            out.close();
+            std::error_code ignored;
+            std::filesystem::remove(temporaryFilepath, ignored);
+            return false;
+        }
+    }
+
+    std::error_code errorCodeFromOS;
+    std::filesystem::rename(temporaryFilepath, filepath, errorCodeFromOS);
+    if (errorCodeFromOS) {
+        fprintf(ERRLOG, "\nERROR! Unable to move the conformed file into place at \"%s\"!\nError Message: %s\n",
+            filepath.c_str(), errorCodeFromOS.message().c_str());
+        std::error_code ignored;
+        std::filesystem::remove(temporaryFilepath, ignored);
+        return false;
+    }
+    return true;
+}
+
+
+void ObjConformer::printReport() const {
+    fprintf(MSGLOG, "\n\"%s\"\n", mSourceFilepath_.c_str());
+    if (mSourceWasConformant_)
+        fprintf(MSGLOG, "    The file was already conformant, it was conformed again anyways.\n");
+    fprintf(MSGLOG, "    Source:     %zu positions, %zu texture coordinates, %zu normals\n",
+        mSourcePositions_, mSourceTexCoords_, mSourceNormals_);
+    fprintf(MSGLOG, "                %zu triangles, %zu quads, %zu n-gons\n", mSourceTriangles_, mSourceQuads_, mSourceNGons_);
+    if (mLinesWithErrors_ > 0u)
+        fprintf(WRNLOG, "    Warning! %zu lines could not be parsed and were dropped\n", mLinesWithErrors_);
+    if (mFacesDropped_ > 0u)
+        fprintf(WRNLOG, "    Warning! %zu faces referred to vertex data that doesn't exist and were dropped\n", mFacesDropped_);
+    if (mTexCoordsDroppedAsZero_)
+        fprintf(MSGLOG, "    Dropped the texture coordinates, since every one of them was <0, 0>\n");
+    if (mTexCoordsDroppedAsMixed_)
+        fprintf(WRNLOG, "    Warning! Dropped the texture coordinates, since some faces didn't have any\n");
+    if (mNormalsDroppedAsMixed_)
+        fprintf(WRNLOG, "    Warning! Dropped the normals, since some faces didn't have any\n");
+    if (mSourceLineSegments_ > 0u)
+        fprintf(MSGLOG, "    Dropped %zu line segments\n", mSourceLineSegments_);
+    if (mSourceSubMeshTags_ > 0u)
+        fprintf(MSGLOG, "    Dropped %zu object/group/material/smoothing group tags\n", mSourceSubMeshTags_);
+    fprintf(MSGLOG, "    Conformed:  %zu positions, %zu texture coordinates, %zu normals, %zu triangles\n",
+        mPositions_, mTexCoords_, mNormals_, mTriangles_);
+}
+
+
+void ObjConformer::resetStatistics() {
+    mLinesWithErrors_ = 0u;
+    mSourcePositions_ = mSourceTexCoords_ = mSourceNormals_ = 0u;
+    mSourceTriangles_ = mSourceQuads_ = mSourceNGons_ = 0u;
+    mSourceLineSegments_ = 0u;
+    mSourceSubMeshTags_ = 0u;
+    mSourceWasConformant_ = false;
+    mFacesDropped_ = 0u;
+    mTexCoordsDroppedAsZero_ = false;
+    mTexCoordsDroppedAsMixed_ = false;
+    mNormalsDroppedAsMixed_ = false;
+    mPositions_ = mTexCoords_ = mNormals_ = mTriangles_ = 0u;
+}
+
+
+bool ObjConformer::usesNonZeroTexCoords(const AssetLoadingInternal::ObjParseResult& parsed,
+                                        const AssetLoadingInternal::ParsedFaceList& faces) noexcept {
+    for (const AssetLoadingInternal::ParsedFace face : faces) {
+        const int cornerCount = (face.isQuad() ? 4 : 3);
+        for (int i = 0; i < cornerCount; i++) {
+            const AssetLoadingInternal::TexCoordStreams::Element texCoord = parsed.texCoords.get(face.texCoords[i]);
+            if ((texCoord[0] != 0.0f) || (texCoord[1] != 0.0f))
+                return true;
+        }
+    }
+    return false;
+}
+
+
+bool ObjConformer::conformedTextReadsBackExactly(const std::vector<float>& positions, const std::vector<float>& texCoords,
+                                                 const std::vector<float>& normals, const std::vector<uint32_t>& corners) const {
+    AssetLoadingInternal::ConformantObjStamp stamp;
+    if (!AssetLoadingInternal::verifyConformantObjStamp(mConformedText_, stamp))
+        return false;
+    AssetLoadingInternal::ObjParseResult readBack;
+    AssetLoadingInternal::parseConformantObj(mConformedText_, stamp, readBack);
+
+    auto matches = [](const auto& readValues, const std::vector<float>& written, size_t components) {
+        if ((readValues.size() * components) != written.size())
+            return false;
+        for (size_t i = 0u; i < readValues.size(); i++) {
+            for (size_t component = 0u; component < components; component++) {
+                if (!sameFloat(readValues.get(i, component), written[(i * components) + component]))
+                    return false;
+            }
+        }
+        return true;
+    };
+    if ((!matches(readBack.positions, positions, 3u)) || (!matches(readBack.texCoords, texCoords, 2u)) ||
+        (!matches(readBack.normals, normals, 3u)))
+        return false;
+
+    if ((readBack.faces.size() * INDICES_PER_TRIANGLE) != corners.size())
+        return false;
+    for (size_t i = 0u; i < readBack.faces.size(); i++) {
+        const AssetLoadingInternal::ParsedFace face = readBack.faces[i];
+        for (int corner = 0; corner < 3; corner++) {
+            const uint32_t * expected = &corners[(i * INDICES_PER_TRIANGLE) + (corner * INDICES_PER_CORNER)];
+            if ((face.positions[corner] != expected[0]) ||
+                (face.hasTexCoords && (face.texCoords[corner] != expected[1])) ||
+                (face.hasNormals && (face.normals[corner] != expected[2])))
+                return false;
+        }
+    }
+    return true;
+}
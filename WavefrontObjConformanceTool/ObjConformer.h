@@ -0,0 +1,89 @@
+// File:           ObjConformer.h
+// Class:          ObjConformer
+// Programmer:     Forrest Miller
+// Date:           October 2026
+//
+// Description:    Converts an arbitrary '.obj' file into a conformant one (see ConformantObj.h in the main
+//                 project for the exact form). The file is parsed with the same tokenizer QuickObj uses,
+//                 and then:
+//                      -Every face is triangulated. Quads are split the same way QuickObj splits them,
+//                        n-gons are split by the NGonTriangulator.
+//                      -Faces that refer to vertex data which doesn't exist are dropped.
+//                      -Texture coordinates are dropped if any face is missing them, or if every one
+//                        of them is <0, 0> [Blender writes these for meshes without a UV map].
+//                      -Normals are dropped if any face is missing them.
+//                      -Every position/texture coordinate/normal that isn't used by a face is dropped,
+//                        and the rest are re-indexed in the order the faces first use them.
+//                      -Line primitives, objects, groups, materials, smoothing groups and comments are
+//                        all dropped, since QuickObj doesn't use any of them.
+//                 The result is stamped with a hash of its contents, which is what lets QuickObj trust it.
+//
+//                 The loaded mesh is unchanged by conforming [except for whatever had to be dropped],
+//                 every value is written out with as many digits as it takes to read back as exactly
+//                 the same float. The conformed text is read back with QuickObj's fast path before it
+//                 is handed out to make sure of this.
+
+#pragma once
+
+#ifndef OBJ_CONFORMER_H_
+#define OBJ_CONFORMER_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ObjTokenizer.h"
+
+class ObjConformer final {
+public:
+    ObjConformer() = default;
+    ~ObjConformer() = default;
+
+    ObjConformer(const ObjConformer&) = delete;
+    ObjConformer& operator=(const ObjConformer&) = delete;
+
+    //Parses the '.obj' file at 'filepath' and builds its conformant text. Returns false (after
+    //printing why) if the file could not be read or if it had no usable faces.
+    bool conform(const std::string& filepath);
+
+    //Writes the conformant text built by the last successful call to conform() out to 'filepath'.
+    //The text is written to a temporary file first which is then renamed, so it is safe for
+    //'filepath' to be the file that was conformed.
+    bool writeConformedFile(const std::string& filepath) const;
+
+    const std::string& getConformedText() const noexcept { return mConformedText_; }
+
+    //Prints what was found in the source file and what was changed to MSGLOG
+    void printReport() const;
+
+private:
+    std::string mSourceFilepath_;
+    std::string mConformedText_;
+
+    //Statistics about the source file
+    size_t mLinesWithErrors_ = 0u;
+    size_t mSourcePositions_ = 0u, mSourceTexCoords_ = 0u, mSourceNormals_ = 0u;
+    size_t mSourceTriangles_ = 0u, mSourceQuads_ = 0u, mSourceNGons_ = 0u;
+    size_t mSourceLineSegments_ = 0u;
+    size_t mSourceSubMeshTags_ = 0u;
+    bool mSourceWasConformant_ = false;
+
+    //What was changed
+    size_t mFacesDropped_ = 0u;
+    bool mTexCoordsDroppedAsZero_ = false;
+    bool mTexCoordsDroppedAsMixed_ = false;
+    bool mNormalsDroppedAsMixed_ = false;
+
+    //Statistics about the conformed file
+    size_t mPositions_ = 0u, mTexCoords_ = 0u, mNormals_ = 0u, mTriangles_ = 0u;
+
+    void resetStatistics();
+    //Returns true if any texture coordinate used by one of the faces is something other than <0, 0>
+    static bool usesNonZeroTexCoords(const AssetLoadingInternal::ObjParseResult& parsed,
+                                     const AssetLoadingInternal::ParsedFaceList& faces) noexcept;
+    //Re-reads the conformed text through the fast path and compares it against what was written
+    bool conformedTextReadsBackExactly(const std::vector<float>& positions, const std::vector<float>& texCoords,
+                                       const std::vector<float>& normals, const std::vector<uint32_t>& corners) const;
+};
+
+#endif //OBJ_CONFORMER_H_